@@ -27,6 +27,10 @@
 #include <eos/utils/options-impl.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/shared-result.hh>
+
+#include <algorithm>
+#include <cmath>
 
 namespace eos
 {
@@ -56,6 +60,13 @@ namespace eos
         // form factors
         std::shared_ptr<FormFactors<PToV>> ff;
 
+        // normalizations and q2-integrated angular coefficients, shared by all bins of the same distribution
+        std::shared_ptr<SharedResult> pdf_q2_normalization;
+        std::shared_ptr<SharedResult> integrated_pdf_q2_normalization;
+        std::shared_ptr<SharedResult> coefficients_d;
+        std::shared_ptr<SharedResult> coefficients_l;
+        std::shared_ptr<SharedResult> coefficients_chi;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
@@ -66,7 +77,12 @@ namespace eos
             opt_l(o, options, "l"_ok),
             m_l(p["mass::" + opt_l.str()], u),
             cub_conf(cubature::Config().epsrel(1e-5)),
-            ff(FormFactorFactory<PToV>::create("B->D^*::" + o.get("form-factors"_ok, "BGJvD2019"), p, o))
+            ff(FormFactorFactory<PToV>::create("B->D^*::" + o.get("form-factors"_ok, "BGJvD2019"), p, o)),
+            pdf_q2_normalization(SharedResult::make(p, "B->Dpilnu::pdf_q2_normalization;" + o.as_string())),
+            integrated_pdf_q2_normalization(SharedResult::make(p, "B->Dpilnu::integrated_pdf_q2_normalization;" + o.as_string())),
+            coefficients_d(SharedResult::make(p, "B->Dpilnu::coefficients_d;" + o.as_string())),
+            coefficients_l(SharedResult::make(p, "B->Dpilnu::coefficients_l;" + o.as_string())),
+            coefficients_chi(SharedResult::make(p, "B->Dpilnu::coefficients_chi;" + o.as_string()))
         {
             Context ctx("When constructing B->Dpilnu observable");
 
@@ -236,7 +252,10 @@ namespace eos
 
             std::function<double (const double &)> f = std::bind(&Implementation<BToDPiLeptonNeutrino>::dist_q2, this, std::placeholders::_1);
             const double num   = dist_q2(q2);
-            const double denom = integrate<1>(f, q2_min, q2_max, cub_conf);
+            const double denom = (*pdf_q2_normalization)([&]() -> std::vector<double>
+            {
+                return { integrate<1>(f, q2_min, q2_max, cub_conf) };
+            })[0];
 
             return num / denom;
         }
@@ -256,8 +275,14 @@ namespace eos
             const double q2_abs_max = power_of<2>(m_B() - m_Dstar());
 
             std::function<double (const double &)> f = std::bind(&Implementation<BToDPiLeptonNeutrino>::dist_q2, this, std::placeholders::_1);
-            const double num   = integrate<GSL::QAGS>(f, q2_min,     q2_max);
-            const double denom = integrate<GSL::QAGS>(f, q2_abs_min, q2_abs_max);
+
+            // the normalization is shared by all bins; it is obtained with the same integrator as the numerator,
+            // so that the result does not depend on the order in which the bins are evaluated
+            const double denom = (*integrated_pdf_q2_normalization)([&]() -> std::vector<double>
+            {
+                return { integrate_bins(f, { q2_abs_min, q2_abs_max })[0] };
+            })[0];
+            const double num = integrate_bins(f, { q2_min, q2_max })[0];
 
             return num / denom;
         }
@@ -290,6 +315,27 @@ namespace eos
             return { nf * a, nf * b };
         }
 
+        // integrate the angular coefficients over the full q2 range
+        template <size_t n_>
+        std::array<double, n_> integrated_coefficients(SharedResult & shared, std::array<double, n_> (Implementation<BToDPiLeptonNeutrino>::*coefficients)(const double &) const) const
+        {
+            const double q2_min = power_of<2>(m_l());
+            const double q2_max = 10.68;
+
+            const auto result = shared([&]() -> std::vector<double>
+            {
+                std::function<std::array<double, n_> (const double &)> f = std::bind(coefficients, this, std::placeholders::_1);
+                const auto coeffs = integrate<1, n_>(f, q2_min, q2_max, cub_conf);
+
+                return std::vector<double>(coeffs.cbegin(), coeffs.cend());
+            });
+
+            std::array<double, n_> coeffs;
+            std::copy(result.cbegin(), result.cend(), coeffs.begin());
+
+            return coeffs;
+        }
+
         double pdf_q2d(const double & q2, const double & c_d) const
         {
             auto coeffs = pdf_coefficients_q2d(q2);
@@ -299,11 +345,7 @@ namespace eos
 
         double pdf_d(const double & c_d) const
         {
-            const double q2_min = power_of<2>(m_l());
-            const double q2_max = 10.68;
-
-            std::function<std::array<double, 2> (const double &)> f = std::bind(&Implementation<BToDPiLeptonNeutrino>::pdf_coefficients_q2d, this, std::placeholders::_1);
-            const auto coeffs = integrate<1, 2>(f, q2_min, q2_max, cub_conf);
+            const auto coeffs = integrated_coefficients(*coefficients_d, &Implementation<BToDPiLeptonNeutrino>::pdf_coefficients_q2d);
 
             const double num   = 3.0 / 2.0 * (coeffs[0] + coeffs[1] * c_d * c_d);
             const double denom = 3.0 * coeffs[0] + coeffs[1];
@@ -313,14 +355,10 @@ namespace eos
 
         double pdf_d(const double & c_d_min, const double & c_d_max) const
         {
-            const double q2_min = power_of<2>(m_l());
-            const double q2_max = 10.68;
-
             const double c_d_max3 = power_of<3>(c_d_max);
             const double c_d_min3 = power_of<3>(c_d_min);
 
-            std::function<std::array<double, 2> (const double &)> f = std::bind(&Implementation<BToDPiLeptonNeutrino>::pdf_coefficients_q2d, this, std::placeholders::_1);
-            const auto coeffs = integrate<1, 2>(f, q2_min, q2_max, cub_conf);
+            const auto coeffs = integrated_coefficients(*coefficients_d, &Implementation<BToDPiLeptonNeutrino>::pdf_coefficients_q2d);
 
             const double num   = 3.0 / 2.0 * (coeffs[0] * (c_d_max - c_d_min) + coeffs[1] * (c_d_max3 - c_d_min3) / 3.0);
             const double denom = 3.0 * coeffs[0] + coeffs[1];
@@ -364,11 +402,7 @@ namespace eos
 
         double pdf_l(const double & c_l) const
         {
-            const double q2_min = power_of<2>(m_l());
-            const double q2_max = 10.68;
-
-            std::function<std::array<double, 3> (const double &)> f = std::bind(&Implementation<BToDPiLeptonNeutrino>::pdf_coefficients_q2l, this, std::placeholders::_1);
-            const auto coeffs = integrate<1, 3>(f, q2_min, q2_max, cub_conf);
+            const auto coeffs = integrated_coefficients(*coefficients_l, &Implementation<BToDPiLeptonNeutrino>::pdf_coefficients_q2l);
 
             const double num   = 3.0 / 4.0 * (coeffs[0] + coeffs[1] * c_l + coeffs[2] * c_l * c_l);
             const double denom = (3.0 * coeffs[0] + coeffs[2]) / 2.0;
@@ -378,11 +412,7 @@ namespace eos
 
         double pdf_l(const double & c_l_min, const double & c_l_max) const
         {
-            const double q2_min = power_of<2>(m_l());
-            const double q2_max = 10.68;
-
-            std::function<std::array<double, 3> (const double &)> f = std::bind(&Implementation<BToDPiLeptonNeutrino>::pdf_coefficients_q2l, this, std::placeholders::_1);
-            const auto coeffs = integrate<1, 3>(f, q2_min, q2_max, cub_conf);
+            const auto coeffs = integrated_coefficients(*coefficients_l, &Implementation<BToDPiLeptonNeutrino>::pdf_coefficients_q2l);
 
             double num         = coeffs[0] * (c_l_max - c_l_min);
             num               += coeffs[1] * (c_l_max * c_l_max - c_l_min * c_l_min) / 2.0;
@@ -430,11 +460,7 @@ namespace eos
 
         double pdf_chi(const double & chi) const
         {
-            const double q2_min = power_of<2>(m_l());
-            const double q2_max = 10.68;
-
-            std::function<std::array<double, 3> (const double &)> f = std::bind(&Implementation<BToDPiLeptonNeutrino>::pdf_coefficients_q2chi, this, std::placeholders::_1);
-            const auto coeffs = integrate<1, 3>(f, q2_min, q2_max, cub_conf);
+            const auto coeffs = integrated_coefficients(*coefficients_chi, &Implementation<BToDPiLeptonNeutrino>::pdf_coefficients_q2chi);
 
             const double c_chi = cos(chi);
 
@@ -446,11 +472,7 @@ namespace eos
 
         double pdf_chi(const double & chi_min, const double & chi_max) const
         {
-            const double q2_min = power_of<2>(m_l());
-            const double q2_max = 10.68;
-
-            std::function<std::array<double, 3> (const double &)> f = std::bind(&Implementation<BToDPiLeptonNeutrino>::pdf_coefficients_q2chi, this, std::placeholders::_1);
-            const auto coeffs = integrate<1, 3>(f, q2_min, q2_max, cub_conf);
+            const auto coeffs = integrated_coefficients(*coefficients_chi, &Implementation<BToDPiLeptonNeutrino>::pdf_coefficients_q2chi);
 
             const double c_chi_min = cos(chi_min), c_chi_max = cos(chi_max);
             const double s_chi_min = sin(chi_min), s_chi_max = sin(chi_max);
@@ -178,5 +178,29 @@ class BToDPiLeptonNeutrinoTest :
                 TEST_CHECK_NEARLY_EQUAL(d.integrated_pdf_chi( 0.0,  +M_PI), 0.50000, eps);
                 TEST_CHECK_NEARLY_EQUAL(d.integrated_pdf_chi(-M_PI, +M_PI), 1.0,     eps);
             }
+
+            // the integrated w distribution does not depend on the order in which the bins are evaluated
+            {
+                Parameters p1 = Parameters::Defaults();
+                Parameters p2 = Parameters::Defaults();
+
+                Options o{
+                    { "l"_ok,             "mu"        },
+                    { "q"_ok,             "d"         },
+                    { "form-factors"_ok,  "BGJvD2019" }
+                };
+
+                BToDPiLeptonNeutrino d1(p1, o);
+                BToDPiLeptonNeutrino d2(p2, o);
+
+                const double first_1  = d1.integrated_pdf_w(1.0, 1.2);
+                const double second_1 = d1.integrated_pdf_w(1.2, 1.4);
+
+                const double second_2 = d2.integrated_pdf_w(1.2, 1.4);
+                const double first_2  = d2.integrated_pdf_w(1.0, 1.2);
+
+                TEST_CHECK_EQUAL(first_1,  first_2);
+                TEST_CHECK_EQUAL(second_1, second_2);
+            }
         }
 } b_to_d_pi_l_nu_test;
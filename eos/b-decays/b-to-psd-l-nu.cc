@@ -31,9 +31,13 @@
 #include <eos/utils/kinematic.hh>
 #include <eos/utils/options-impl.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/shared-result.hh>
 
+#include <cmath>
+#include <functional>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace eos
 {
@@ -96,6 +100,10 @@ namespace eos
 
         std::shared_ptr<FormFactors<PToP>> form_factors;
 
+        // normalizations of the q2 distribution, shared by all of its bins
+        std::shared_ptr<SharedResult> pdf_q2_normalization;
+        std::shared_ptr<SharedResult> integrated_pdf_q2_normalization;
+
         // { q, P } -> { process, U, B_name, P_name, c_I }
         // q: u, d, s: the spectar quark flavor
         // P: D, K, pi, eta, eta_prime: the type of daughter meson
@@ -182,7 +190,9 @@ namespace eos
             mu(p[stringify(_U()) + "b" + opt_l.str() + "nu" + opt_l.str() + "::mu"], u),
             cub_conf(cubature::Config().epsrel(1e-5).epsabs(1.0e-9)),
             opt_cp_conjugate(o, options, "cp-conjugate"_ok),
-            form_factors(FormFactorFactory<PToP>::create(_process() + "::" + o.get("form-factors"_ok, "BSZ2015"), p, o))
+            form_factors(FormFactorFactory<PToP>::create(_process() + "::" + o.get("form-factors"_ok, "BSZ2015"), p, o)),
+            pdf_q2_normalization(SharedResult::make(p, "B->Plnu::pdf_q2_normalization;" + o.as_string())),
+            integrated_pdf_q2_normalization(SharedResult::make(p, "B->Plnu::integrated_pdf_q2_normalization;" + o.as_string()))
         {
             Context ctx("When constructing B->Plnu observable");
 
@@ -209,22 +219,35 @@ namespace eos
             u.uses(*model);
         }
 
-        b_to_psd_l_nu::Amplitudes amplitudes(const double & s) const
+        // s-independent couplings of the amplitudes
+        struct Couplings
+        {
+            complex<double> gV, gS, gT;
+
+            // difference of the running quark masses at the scale mu
+            double m_quarks;
+        };
+
+        Couplings couplings() const
         {
             // NP contributions in EFT including tensor operator (cf. [DDS:2014A]).
             auto wc = this->wc(opt_l.value(), opt_cp_conjugate.value());
-            const complex<double> gV = wc.cvr() + (wc.cvl() - 1.0); // in SM cvl=1 => gV contains NP contribution of cvl
-            const complex<double> gS = wc.csr() + wc.csl();
-            const complex<double> gT = wc.ct();
 
-            // form factors
-            const double fp = form_factors->f_p(s);
-            const double f0 = form_factors->f_0(s);
-            const double fT = form_factors->f_t(s);
+            return Couplings{
+                wc.cvr() + (wc.cvl() - 1.0), // in SM cvl=1 => gV contains NP contribution of cvl
+                wc.csr() + wc.csl(),
+                wc.ct(),
+                model->m_b_msbar(mu) - m_U_msbar(mu)
+            };
+        }
 
-            // running quark masses
-            const double mbatmu = model->m_b_msbar(mu);
-            const double mUatmu = m_U_msbar(mu);
+        // amplitudes for the form factors f_+, f_0 and f_T at s, cf. FormFactors<PToP>::evaluate
+        b_to_psd_l_nu::Amplitudes amplitudes(const double & s, const std::array<double, 3> & ff, const Couplings & c) const
+        {
+            const complex<double> & gV = c.gV, & gS = c.gS, & gT = c.gT;
+
+            // form factors
+            const auto & [fp, f0, fT] = ff;
 
             const double m_B = this->m_B(), m_B2 = m_B * m_B;
             const double m_P = this->m_P(), m_P2 = m_P * m_P;
@@ -247,7 +270,7 @@ namespace eos
             {
                 result.h_0  =   isospin * 2.0 * m_B * p * fp * (1.0 + gV) / std::sqrt(s);
                 result.h_t  =   isospin * (1.0 + gV) * (m_B2 - m_P2) * f0 / std::sqrt(s);
-                result.h_S  = - isospin * gS * (m_B2 - m_P2) * f0 / (mbatmu - mUatmu);
+                result.h_S  = - isospin * gS * (m_B2 - m_P2) * f0 / c.m_quarks;
                 result.h_T  = - isospin * 2.0 * m_B * p * fT * gT / (m_B + m_P);
 
                 result.h_tS = result.h_t - result.h_S / ml_hat;
@@ -273,6 +296,35 @@ namespace eos
             return result;
         }
 
+        b_to_psd_l_nu::Amplitudes amplitudes(const double & s) const
+        {
+            std::array<double, 3> ff;
+            form_factors->evaluate(&s, 1, ff.data());
+
+            return amplitudes(s, ff, couplings());
+        }
+
+        // integrate a function of the amplitudes, evaluating the form factors for all points of a cubature pass at once
+        double integrate_amplitudes(const std::function<double (const b_to_psd_l_nu::Amplitudes &)> & f, const double & s_min, const double & s_max) const
+        {
+            const Couplings c = couplings();
+
+            std::vector<double> ff_buffer;
+            cubature::batched_integrand integrand = [&](const double * s, const size_t & n, double * results)
+            {
+                ff_buffer.resize(3 * n);
+                form_factors->evaluate(s, n, ff_buffer.data());
+
+                for (size_t j = 0 ; j < n ; ++j)
+                {
+                    const std::array<double, 3> ff{ ff_buffer[0 * n + j], ff_buffer[1 * n + j], ff_buffer[2 * n + j] };
+                    results[j] = f(this->amplitudes(s[j], ff, c));
+                }
+            };
+
+            return integrate_batched<1>(integrand, s_min, s_max, cub_conf)[0];
+        }
+
         // normalized (|V_Ub| = 1) two-fold-distribution, cf. [DDS:2014A], eq. (12), p. 6
         double normalized_two_differential_decay_width(const double & s, const double & c_theta_l) const
         {
@@ -294,8 +346,11 @@ namespace eos
         // normalized to |V_Ub = 1|, obtained using cf. [DDS:2014A], eq. (12), agrees with Sakaki'13 et al cf. [STTW:2013A]
         double normalized_differential_decay_width(const double & s) const
         {
-            b_to_psd_l_nu::Amplitudes amp(this->amplitudes(s));
+            return normalized_differential_decay_width(this->amplitudes(s));
+        }
 
+        double normalized_differential_decay_width(const b_to_psd_l_nu::Amplitudes & amp) const
+        {
             return 4.0 / 3.0 * amp.NF * amp.p * (
                        std::norm(amp.h_0) * (3.0 - amp.v)
                        + 3.0 * std::norm(amp.h_tS) * (1.0 - amp.v)
@@ -306,8 +361,11 @@ namespace eos
 
         double normalized_differential_decay_width_p(const double & s) const
         {
-            b_to_psd_l_nu::Amplitudes amp(this->amplitudes(s));
+            return normalized_differential_decay_width_p(this->amplitudes(s));
+        }
 
+        double normalized_differential_decay_width_p(const b_to_psd_l_nu::Amplitudes & amp) const
+        {
             return 4.0 / 3.0 * amp.NF * amp.p * (
                        std::norm(amp.h_0) * (3.0 - amp.v)
                        );
@@ -315,8 +373,11 @@ namespace eos
 
         double normalized_differential_decay_width_0(const double & s) const
         {
-            b_to_psd_l_nu::Amplitudes amp(this->amplitudes(s));
+            return normalized_differential_decay_width_0(this->amplitudes(s));
+        }
 
+        double normalized_differential_decay_width_0(const b_to_psd_l_nu::Amplitudes & amp) const
+        {
             return 4.0 / 3.0 * amp.NF * amp.p * (
                        3.0 * std::norm(amp.h_t) * (1.0 - amp.v)
                    );
@@ -327,8 +388,11 @@ namespace eos
         // crosschecked against [BFNT:2019A] and [STTW:2013A]
         double numerator_differential_a_fb_leptonic(const double & s) const
         {
-            b_to_psd_l_nu::Amplitudes amp(this->amplitudes(s));
+            return numerator_differential_a_fb_leptonic(this->amplitudes(s));
+        }
 
+        double numerator_differential_a_fb_leptonic(const b_to_psd_l_nu::Amplitudes & amp) const
+        {
             return - 4.0 * amp.NF * amp.p * (
                        std::real(amp.h_0 * std::conj(amp.h_tS)) * (1.0 - amp.v)
                        - 4.0 * std::sqrt(1.0 - amp.v) * std::real(amp.h_T * std::conj(amp.h_tS))
@@ -338,8 +402,11 @@ namespace eos
         // obtained using cf. [DDS:2014A], eq. (12) and [BHP:2007A] eq.(1.2)
         double numerator_differential_flat_term(const double & s) const
         {
-            b_to_psd_l_nu::Amplitudes amp(this->amplitudes(s));
+            return numerator_differential_flat_term(this->amplitudes(s));
+        }
 
+        double numerator_differential_flat_term(const b_to_psd_l_nu::Amplitudes & amp) const
+        {
             return amp.NF * amp.p * (
                        (std::norm(amp.h_0) + std::norm(amp.h_tS)) * (1.0 - amp.v)
                        + 16.0 * std::norm(amp.h_T)
@@ -350,8 +417,11 @@ namespace eos
         // obtained using cf. [STTW:2013A], eq. (49a - 49b)
         double numerator_differential_lepton_polarization(const double & s) const
         {
-            b_to_psd_l_nu::Amplitudes amp(this->amplitudes(s));
+            return numerator_differential_lepton_polarization(this->amplitudes(s));
+        }
 
+        double numerator_differential_lepton_polarization(const b_to_psd_l_nu::Amplitudes & amp) const
+        {
             const double dGplus = (std::norm(amp.h_0) + 3.0 * std::norm(amp.h_t)) * (1.0 - amp.v) / 2.0
                                 + 3.0 / 2.0 * std::norm(amp.h_S)
                                 + 8.0 * std::norm(amp.h_T)
@@ -397,9 +467,11 @@ namespace eos
             const double q2_min = power_of<2>(m_l());
             const double q2_max = power_of<2>(m_B() - m_P());
 
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_branching_ratio, this, std::placeholders::_1);
             const double num   = normalized_differential_branching_ratio(q2);
-            const double denom = integrate<1, 1>(f, q2_min, q2_max, cub_conf);
+            const double denom = (*pdf_q2_normalization)([&]() -> std::vector<double>
+            {
+                return { integrate_amplitudes([this](const b_to_psd_l_nu::Amplitudes & amp) { return normalized_differential_decay_width(amp) * tau_B / hbar; }, q2_min, q2_max) };
+            })[0];
 
             return num / denom;
         }
@@ -419,8 +491,15 @@ namespace eos
             const double q2_abs_max = power_of<2>(m_B() - m_P());
 
             std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_branching_ratio, this, std::placeholders::_1);
-            const double num   = integrate<1, 1>(f, q2_min,     q2_max,     cub_conf);
-            const double denom = integrate<1, 1>(f, q2_abs_min, q2_abs_max, cub_conf);
+            const auto config = GSL::QAGS::Config().epsrel(cub_conf.epsrel()).epsabs(cub_conf.epsabs());
+
+            // the normalization is shared by all bins; it is obtained with the same integrator as the numerator,
+            // so that the result does not depend on the order in which the bins are evaluated
+            const double denom = (*integrated_pdf_q2_normalization)([&]() -> std::vector<double>
+            {
+                return { integrate_bins(f, { q2_abs_min, q2_abs_max }, config)[0] };
+            })[0];
+            const double num = integrate_bins(f, { q2_min, q2_max }, config)[0];
 
             return num / denom / (q2_max - q2_min);
         }
@@ -516,10 +595,10 @@ namespace eos
     double
     BToPseudoscalarLeptonNeutrino::integrated_branching_ratio(const double & s_min, const double & s_max) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::differential_branching_ratio,
-                _imp.get(), std::placeholders::_1);
+        const double factor = std::norm(_imp->v_Ub()) * _imp->tau_B / _imp->hbar;
 
-        return integrate<1, 1>(f, s_min, s_max, _imp->cub_conf);
+        return _imp->integrate_amplitudes([this, &factor](const b_to_psd_l_nu::Amplitudes & amp) { return _imp->normalized_differential_decay_width(amp) * factor; },
+                s_min, s_max);
     }
 
     double
@@ -554,38 +633,32 @@ namespace eos
     double
     BToPseudoscalarLeptonNeutrino::normalized_integrated_branching_ratio(const double & s_min, const double & s_max) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_branching_ratio,
-                                                             _imp.get(), std::placeholders::_1);
+        const double factor = _imp->tau_B / _imp->hbar;
 
-        return integrate<1, 1>(f, s_min, s_max, _imp->cub_conf);
+        return _imp->integrate_amplitudes([this, &factor](const b_to_psd_l_nu::Amplitudes & amp) { return _imp->normalized_differential_decay_width(amp) * factor; },
+                s_min, s_max);
     }
 
     // normalized (|V_Ub|=1) integrated decay_width
     double
     BToPseudoscalarLeptonNeutrino::normalized_integrated_decay_width_p(const double & s_min, const double & s_max) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width_p,
-                                                             _imp.get(), std::placeholders::_1);
-
-        return integrate<1, 1>(f, s_min, s_max, _imp->cub_conf);
+        return _imp->integrate_amplitudes([this](const b_to_psd_l_nu::Amplitudes & amp) { return _imp->normalized_differential_decay_width_p(amp); },
+                s_min, s_max);
     }
 
     double
     BToPseudoscalarLeptonNeutrino::normalized_integrated_decay_width_0(const double & s_min, const double & s_max) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width_0,
-                                                             _imp.get(), std::placeholders::_1);
-
-        return integrate<1, 1>(f, s_min, s_max, _imp->cub_conf);
+        return _imp->integrate_amplitudes([this](const b_to_psd_l_nu::Amplitudes & amp) { return _imp->normalized_differential_decay_width_0(amp); },
+                s_min, s_max);
     }
 
     double
     BToPseudoscalarLeptonNeutrino::normalized_integrated_decay_width(const double & s_min, const double & s_max) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width,
-                                                             _imp.get(), std::placeholders::_1);
-
-        return integrate<1, 1>(f, s_min, s_max, _imp->cub_conf);
+        return _imp->integrate_amplitudes([this](const b_to_psd_l_nu::Amplitudes & amp) { return _imp->normalized_differential_decay_width(amp); },
+                s_min, s_max);
     }
 
     double
@@ -597,19 +670,10 @@ namespace eos
     double
     BToPseudoscalarLeptonNeutrino::integrated_a_fb_leptonic(const double & s_min, const double & s_max) const
     {
-        double integrated_numerator;
-        {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::numerator_differential_a_fb_leptonic,
-                                                                 _imp.get(), std::placeholders::_1);
-            integrated_numerator = integrate<1, 1>(f, s_min, s_max, _imp->cub_conf);
-        }
-
-        double integrated_denominator;
-        {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width,
-                                                                 _imp.get(), std::placeholders::_1);
-            integrated_denominator = integrate<1, 1>(f, s_min, s_max, _imp->cub_conf);
-        }
+        const double integrated_numerator = _imp->integrate_amplitudes([this](const b_to_psd_l_nu::Amplitudes & amp) { return _imp->numerator_differential_a_fb_leptonic(amp); },
+                s_min, s_max);
+        const double integrated_denominator = _imp->integrate_amplitudes([this](const b_to_psd_l_nu::Amplitudes & amp) { return _imp->normalized_differential_decay_width(amp); },
+                s_min, s_max);
 
         return integrated_numerator / integrated_denominator;
     }
@@ -623,19 +687,10 @@ namespace eos
     double
     BToPseudoscalarLeptonNeutrino::integrated_flat_term(const double & s_min, const double & s_max) const
     {
-        double integrated_numerator;
-        {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::numerator_differential_flat_term,
-                                                                 _imp.get(), std::placeholders::_1);
-            integrated_numerator = integrate<1, 1>(f, s_min, s_max, _imp->cub_conf);
-        }
-
-        double integrated_denominator;
-        {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width,
-                                                                 _imp.get(), std::placeholders::_1);
-            integrated_denominator = integrate<1, 1>(f, s_min, s_max, _imp->cub_conf);
-        }
+        const double integrated_numerator = _imp->integrate_amplitudes([this](const b_to_psd_l_nu::Amplitudes & amp) { return _imp->numerator_differential_flat_term(amp); },
+                s_min, s_max);
+        const double integrated_denominator = _imp->integrate_amplitudes([this](const b_to_psd_l_nu::Amplitudes & amp) { return _imp->normalized_differential_decay_width(amp); },
+                s_min, s_max);
 
         return integrated_numerator / integrated_denominator;
     }
@@ -649,19 +704,10 @@ namespace eos
     double
     BToPseudoscalarLeptonNeutrino::integrated_lepton_polarization(const double & s_min, const double & s_max) const
     {
-        double integrated_numerator;
-        {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::numerator_differential_lepton_polarization,
-                                                                 _imp.get(), std::placeholders::_1);
-            integrated_numerator = integrate<1, 1>(f, s_min, s_max, _imp->cub_conf);
-        }
-
-        double integrated_denominator;
-        {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width,
-                                                                 _imp.get(), std::placeholders::_1);
-            integrated_denominator = integrate<1, 1>(f, s_min, s_max, _imp->cub_conf);
-        }
+        const double integrated_numerator = _imp->integrate_amplitudes([this](const b_to_psd_l_nu::Amplitudes & amp) { return _imp->numerator_differential_lepton_polarization(amp); },
+                s_min, s_max);
+        const double integrated_denominator = _imp->integrate_amplitudes([this](const b_to_psd_l_nu::Amplitudes & amp) { return _imp->normalized_differential_decay_width(amp); },
+                s_min, s_max);
 
         return integrated_numerator / integrated_denominator;
     }
@@ -33,11 +33,14 @@
 #include <eos/utils/options.hh>
 #include <eos/utils/options-impl.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/shared-result.hh>
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace eos
 {
@@ -82,6 +85,9 @@ namespace eos
 
         std::shared_ptr<FormFactors<PToV>> form_factors;
 
+        // normalization of the q2 distribution, shared by all of its bins
+        std::shared_ptr<SharedResult> integrated_pdf_q2_normalization;
+
         using IntermediateResult = BToVectorLeptonNeutrino::IntermediateResult;
 
         IntermediateResult intermediate_result;
@@ -174,7 +180,8 @@ namespace eos
             opt_cp_conjugate(o, options, "cp-conjugate"_ok),
             mu(p[stringify(_U()) + "b" + opt_l.str() + "nu" + opt_l.str() + "::mu"], u),
             cub_conf(cubature::Config().epsrel(1e-5).epsabs(1.0e-9)),
-            form_factors(FormFactorFactory<PToV>::create(_process() + "::" + o.get("form-factors"_ok, "BSZ2015"), p, o))
+            form_factors(FormFactorFactory<PToV>::create(_process() + "::" + o.get("form-factors"_ok, "BSZ2015"), p, o)),
+            integrated_pdf_q2_normalization(SharedResult::make(p, "B->Vlnu::integrated_pdf_q2_normalization;" + o.as_string()))
         {
             Context ctx("When constructing B->Vlnu observable");
 
@@ -211,32 +218,44 @@ namespace eos
             return power_of<2>(g_fermi()) * p * q2 * power_of<2>(1.0 - m_l * m_l / q2) / (3.0 * 64.0 * power_of<3>(M_PI) * m_B * m_B);
         }
 
-        b_to_vec_l_nu::Amplitudes amplitudes(const double & q2) const
+        // q2-independent couplings of the amplitudes
+        struct Couplings
         {
-            b_to_vec_l_nu::Amplitudes result;
+            complex<double> gV_pl, gV_mi, gP, TL;
 
+            // sum of the running quark masses at the scale mu
+            double m_quarks;
+        };
+
+        Couplings couplings() const
+        {
             // NP contributions in EFT including tensor operator cf. [DDS:2014A], p. 3
             const WilsonCoefficients<ChargedCurrent> wc = this->wc(opt_l.value(), opt_cp_conjugate.value());
-            const complex<double> gV_pl = wc.cvl() + wc.cvr();  // gV_pl = 1 + gV = 1 + VL + VR = cVL + cVR
-            const complex<double> gV_mi = wc.cvl() - wc.cvr();  // gV_mi = 1 - gA = 1 + VL - VR = cVL - cVR
-            const complex<double> gP = wc.csr() - wc.csl();
-            const complex<double> TL = wc.ct();
-
-            // form factors
-            const double aff0  = form_factors->a_0(q2);
-            const double aff1  = form_factors->a_1(q2);
-            const double aff12 = form_factors->a_12(q2);
-            const double vff   = form_factors->v(q2);
-            const double tff1  = form_factors->t_1(q2);
-            const double tff2  = form_factors->t_2(q2);
-            const double tff3  = form_factors->t_3(q2);
+
+            return Couplings{
+                wc.cvl() + wc.cvr(),  // gV_pl = 1 + gV = 1 + VL + VR = cVL + cVR
+                wc.cvl() - wc.cvr(),  // gV_mi = 1 - gA = 1 + VL - VR = cVL - cVR
+                wc.csr() - wc.csl(),
+                wc.ct(),
+                model->m_b_msbar(mu) + this->m_U_msbar(mu)
+            };
+        }
+
+        // amplitudes for the form factors V, A_0, A_1, A_12, T_1, T_2 and T_23 at q2, cf. FormFactors<PToV>::evaluate;
+        // T_23 is not used, since its masses need not coincide with the masses of this process
+        b_to_vec_l_nu::Amplitudes amplitudes(const double & q2, const std::array<double, 7> & ff, const Couplings & c) const
+        {
+            b_to_vec_l_nu::Amplitudes result;
+
+            const complex<double> & gV_pl = c.gV_pl, & gV_mi = c.gV_mi, & gP = c.gP, & TL = c.TL;
+
+            // form factors; T_3 is not part of the batch, and taken from the form factors directly
+            const auto & [vff, aff0, aff1, aff12, tff1, tff2, tff23] = ff;
+            const double tff3 = form_factors->t_3(q2);
             // meson & lepton masses
             const double m_l = this->m_l();
             const double m_B = this->m_B();
             const double m_V = this->m_V();
-            // running quark masses
-            const double mbatmu = model->m_b_msbar(mu);
-            const double mUatmu = this->m_U_msbar(mu);
             // kinematic variables
             const double lam      = lambda(m_B * m_B, m_V * m_V, q2);
             const double sqrt_lam = (lam > 0.0) ? std::sqrt(lam) : 0.0;
@@ -253,7 +272,7 @@ namespace eos
                 result.a_plus_T     = isospin * TL / sqrtq2 * ( (m_B * m_B - m_V * m_V) * tff2 + sqrt_lam * tff1 );
                 result.a_minus_T    = isospin * TL / sqrtq2 * ( (m_B * m_B - m_V * m_V) * tff2 - sqrt_lam * tff1 );
                 result.a_t          = isospin * sqrt_lam * aff0 * gV_mi / sqrtq2;
-                result.a_P          = isospin * sqrt_lam * aff0 * gP / (mbatmu + mUatmu);
+                result.a_P          = isospin * sqrt_lam * aff0 * gP / c.m_quarks;
                 result.a_para       = (result.a_plus + result.a_minus) / std::sqrt(2.0);
                 result.a_para_T     = (result.a_plus_T + result.a_minus_T) / std::sqrt(2.0);
                 result.a_perp       = (result.a_plus - result.a_minus) / std::sqrt(2.0);
@@ -285,6 +304,14 @@ namespace eos
 
         }
 
+        b_to_vec_l_nu::Amplitudes amplitudes(const double & q2) const
+        {
+            std::array<double, 7> ff;
+            form_factors->evaluate(&q2, 1, ff.data());
+
+            return amplitudes(q2, ff, couplings());
+        }
+
         std::array<double, 12> _differential_angular_observables(const double & q2) const
         {
             return b_to_vec_l_nu::AngularObservables(this->amplitudes(q2))._vv;
@@ -293,8 +320,29 @@ namespace eos
         // define below integrated observables in generic form
         std::array<double, 12> _integrated_angular_observables(const double & q2_min, const double & q2_max) const
         {
-            std::function<std::array<double, 12> (const double &)> integrand(std::bind(&Implementation::_differential_angular_observables, this, std::placeholders::_1));
-            return integrate<1, 12>(integrand, q2_min, q2_max, cub_conf);
+            const Couplings c = couplings();
+
+            // the form factors are evaluated for all points of a cubature pass at once
+            std::vector<double> ff_buffer;
+            cubature::batched_integrand integrand = [&](const double * q2, const size_t & n, double * results)
+            {
+                ff_buffer.resize(7 * n);
+                form_factors->evaluate(q2, n, ff_buffer.data());
+
+                for (size_t j = 0 ; j < n ; ++j)
+                {
+                    std::array<double, 7> ff;
+                    for (size_t i = 0 ; i < 7 ; ++i)
+                    {
+                        ff[i] = ff_buffer[i * n + j];
+                    }
+
+                    const auto ao = b_to_vec_l_nu::AngularObservables(this->amplitudes(q2[j], ff, c))._vv;
+                    std::copy(ao.cbegin(), ao.cend(), results + 12 * j);
+                }
+            };
+
+            return integrate_batched<12>(integrand, q2_min, q2_max, cub_conf);
         }
 
         inline b_to_vec_l_nu::AngularObservables differential_angular_observables(const double & q2) const
@@ -324,8 +372,14 @@ namespace eos
             const double q2_abs_max = power_of<2>(m_B() - m_V());
 
             std::function<double (const double &)> f = std::bind(&Implementation<BToVectorLeptonNeutrino>::normalized_decay_width, this, std::placeholders::_1);
-            const double num   = integrate<GSL::QAGS>(f, q2_min,     q2_max);
-            const double denom = integrate<GSL::QAGS>(f, q2_abs_min, q2_abs_max);
+
+            // the normalization is shared by all bins; it is obtained with the same integrator as the numerator,
+            // so that the result does not depend on the order in which the bins are evaluated
+            const double denom = (*integrated_pdf_q2_normalization)([&]() -> std::vector<double>
+            {
+                return { integrate_bins(f, { q2_abs_min, q2_abs_max })[0] };
+            })[0];
+            const double num = integrate_bins(f, { q2_min, q2_max })[0];
 
             return num / denom / (q2_max - q2_min);
         }
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2025 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_B_DECAYS_LAMBDAB_TO_LAMBDAC_L_NU_IMPL_HH
+#define EOS_GUARD_EOS_B_DECAYS_LAMBDAB_TO_LAMBDAC_L_NU_IMPL_HH 1
+
+#include <eos/b-decays/lambdab-to-lambdac-l-nu.hh>
+#include <eos/observable.hh>
+
+#include <array>
+
+namespace eos
+{
+    class LambdaBToLambdaCLeptonNeutrino::IntermediateResult :
+        public CacheableObservable::IntermediateResult
+    {
+        public:
+            // the q^2-integrated angular observables K_1ss, ..., K_4s
+            std::array<double, 10> k;
+
+            IntermediateResult()
+            {
+            }
+
+            ~IntermediateResult() = default;
+    };
+}
+
+#endif
@@ -19,6 +19,7 @@
  */
 
 #include <eos/b-decays/lambdab-to-lambdac-l-nu.hh>
+#include <eos/b-decays/lambdab-to-lambdac-l-nu-impl.hh>
 #include <eos/form-factors/baryonic.hh>
 #include <eos/maths/complex.hh>
 #include <eos/maths/integrate.hh>
@@ -256,6 +257,10 @@ namespace eos
 
     template <> struct Implementation<LambdaBToLambdaCLeptonNeutrino>
     {
+        using IntermediateResult = LambdaBToLambdaCLeptonNeutrino::IntermediateResult;
+
+        IntermediateResult intermediate_result;
+
         std::shared_ptr<Model> model;
 
         Parameters parameters;
@@ -392,6 +397,18 @@ namespace eos
         {
             return lambdab_to_lambdac_l_nu::AngularObservables{ _integrated_angular_observables(q2_min, q2_max) };
         }
+
+        const IntermediateResult * prepare(const double & q2_min, const double & q2_max)
+        {
+            intermediate_result.k = _integrated_angular_observables(q2_min, q2_max);
+
+            return &intermediate_result;
+        }
+
+        inline lambdab_to_lambdac_l_nu::AngularObservables integrated_angular_observables(const IntermediateResult * ir)
+        {
+            return lambdab_to_lambdac_l_nu::AngularObservables{ ir->k };
+        }
     };
 
     const std::vector<OptionSpecification>
@@ -465,97 +482,103 @@ namespace eos
         return _imp->integrated_angular_observables(s_min, s_max).decay_width() * _imp->tau_Lambda_b / _imp->hbar;
     }
 
+    const LambdaBToLambdaCLeptonNeutrino::IntermediateResult *
+    LambdaBToLambdaCLeptonNeutrino::prepare(const double & q2_min, const double & q2_max) const
+    {
+        return _imp->prepare(q2_min, q2_max);
+    }
+
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_a_fb_leptonic(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_a_fb_leptonic(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_leptonic();
+        return _imp->integrated_angular_observables(ir).a_fb_leptonic();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_a_fb_hadronic(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_a_fb_hadronic(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_hadronic();
+        return _imp->integrated_angular_observables(ir).a_fb_hadronic();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_a_fb_combined(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_a_fb_combined(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_combined();
+        return _imp->integrated_angular_observables(ir).a_fb_combined();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_fzero(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_fzero(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).f_zero();
+        return _imp->integrated_angular_observables(ir).f_zero();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_k1ss(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_k1ss(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k1ss() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_k1cc(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_k1cc(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k1cc() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_k1c(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_k1c(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k1c() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_k2ss(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_k2ss(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k2ss() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_k2cc(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_k2cc(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k2cc() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_k2c(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_k2c(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k2c() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_k3sc(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_k3sc(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k3sc() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_k3s(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_k3s(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k3s() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_k4sc(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_k4sc(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k4sc() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_k4s(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_k4s(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k4s() / o.decay_width();
     }
 
@@ -50,20 +50,24 @@ namespace eos
             double differential_fzero(const double & q2) const;
 
             double integrated_branching_ratio(const double & q2_min, const double & q2_max) const;
-            double integrated_a_fb_leptonic(const double & q2_min, const double & q2_max) const;
-            double integrated_a_fb_hadronic(const double & q2_min, const double & q2_max) const;
-            double integrated_a_fb_combined(const double & q2_min, const double & q2_max) const;
-            double integrated_fzero(const double & q2_min, const double & q2_max) const;
-            double integrated_k1ss(const double & q2_min, const double & q2_max) const;
-            double integrated_k1cc(const double & q2_min, const double & q2_max) const;
-            double integrated_k1c(const double & q2_min, const double & q2_max) const;
-            double integrated_k2ss(const double & q2_min, const double & q2_max) const;
-            double integrated_k2cc(const double & q2_min, const double & q2_max) const;
-            double integrated_k2c(const double & q2_min, const double & q2_max) const;
-            double integrated_k3sc(const double & q2_min, const double & q2_max) const;
-            double integrated_k3s(const double & q2_min, const double & q2_max) const;
-            double integrated_k4sc(const double & q2_min, const double & q2_max) const;
-            double integrated_k4s(const double & q2_min, const double & q2_max) const;
+
+            // Intermediate result shared by the remaining q^2-integrated observables of one bin
+            class IntermediateResult;
+            const IntermediateResult * prepare(const double & q2_min, const double & q2_max) const;
+            double integrated_a_fb_leptonic(const IntermediateResult *) const;
+            double integrated_a_fb_hadronic(const IntermediateResult *) const;
+            double integrated_a_fb_combined(const IntermediateResult *) const;
+            double integrated_fzero(const IntermediateResult *) const;
+            double integrated_k1ss(const IntermediateResult *) const;
+            double integrated_k1cc(const IntermediateResult *) const;
+            double integrated_k1c(const IntermediateResult *) const;
+            double integrated_k2ss(const IntermediateResult *) const;
+            double integrated_k2cc(const IntermediateResult *) const;
+            double integrated_k2c(const IntermediateResult *) const;
+            double integrated_k3sc(const IntermediateResult *) const;
+            double integrated_k3s(const IntermediateResult *) const;
+            double integrated_k4sc(const IntermediateResult *) const;
+            double integrated_k4s(const IntermediateResult *) const;
 
             /*!
             * Descriptions of the process and its kinematics.
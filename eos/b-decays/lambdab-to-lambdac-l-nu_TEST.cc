@@ -68,10 +68,12 @@ class LambdaBToLambdaCLeptonNeutrinoTest :
                 const double eps = 1e-4;
 
                 // the full phase-space region for muon
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_leptonic(0.011, 11.1), -0.20052, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_hadronic(0.011, 11.1),  0.32750, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_combined(0.011, 11.1), -0.11678, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_fzero(0.011, 11.1),          0.58731, eps);
+                auto ir = d.prepare(0.011, 11.1);
+
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_leptonic(ir), -0.20052, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_hadronic(ir),  0.32750, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_combined(ir), -0.11678, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_fzero(ir),          0.58731, eps);
             }
 
             // tests for SM observables, Re{cVL}=1.0 in the SM and all other couplings are zero, l = mu
@@ -96,10 +98,12 @@ class LambdaBToLambdaCLeptonNeutrinoTest :
                 const double eps = 1e-4;
 
                 // the full phase-space region for muon
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_leptonic(3.154, 11.1), +0.024465, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_hadronic(3.154, 11.1),  0.295939, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_combined(3.154, 11.1), -0.022105, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_fzero(3.154, 11.1),          0.380371, eps);
+                auto ir = d.prepare(3.154, 11.1);
+
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_leptonic(ir), +0.024465, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_hadronic(ir),  0.295939, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_combined(ir), -0.022105, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_fzero(ir),          0.380371, eps);
             }
 
             // Consistency check for R_lambda
@@ -174,10 +178,12 @@ class LambdaBToLambdaCLeptonNeutrinoTest :
                 const double eps = 1e-4;
 
                 // the full phase-space region for muon
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_leptonic(0.011, 11.1),   0.046821, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_hadronic(0.011, 11.1),  -0.018187, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_combined(0.011, 11.1),  -0.015075, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_fzero(0.011, 11.1),           0.401914, eps);
+                auto ir = d.prepare(0.011, 11.1);
+
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_leptonic(ir),   0.046821, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_hadronic(ir),  -0.018187, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_combined(ir),  -0.015075, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_fzero(ir),           0.401914, eps);
             }
 
             // tests for NP observables (no tensors)
@@ -213,10 +219,12 @@ class LambdaBToLambdaCLeptonNeutrinoTest :
                 const double eps = 1e-2;
 
                 // the full phase-space region for muon
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_leptonic(0.011, 11.1),   0.1336, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_hadronic(0.011, 11.1),  -0.0147, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_combined(0.011, 11.1),  -0.1180, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_fzero(0.011, 11.1),           0.3742, eps);
+                auto ir = d.prepare(0.011, 11.1);
+
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_leptonic(ir),   0.1336, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_hadronic(ir),  -0.0147, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_combined(ir),  -0.1180, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_fzero(ir),           0.3742, eps);
             }
         }
 } lambdab_to_lambdac_l_nu_test;
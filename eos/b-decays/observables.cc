@@ -33,6 +33,7 @@
 #include <eos/b-decays/bq-to-dq-psd.hh>
 #include <eos/b-decays/bq-to-dstarq-psd.hh>
 #include <eos/b-decays/lambdab-to-lambdac-l-nu.hh>
+#include <eos/b-decays/lambdab-to-lambdac-l-nu-impl.hh>
 #include <eos/b-decays/lambdab-to-lambdac2595-l-nu.hh>
 #include <eos/b-decays/lambdab-to-lambdac2625-l-nu.hh>
 #include <eos/b-decays/lifetime.hh>
@@ -2359,13 +2360,15 @@ namespace eos
                         <<Lambda_b->Lambda_clnu::BR;l=mu>>[q2_max=>q2_mu_max,q2_min=>q2_mu_min]
                         )"),
 
-                make_observable("Lambda_b->Lambda_clnu::A_FB^l",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::A_FB^l",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_a_fb_leptonic,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::A_FB^h",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::A_FB^h",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_a_fb_hadronic,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -2385,63 +2388,75 @@ namespace eos
                         <<Lambda_b->Lambda_clnu::A_FB^h;l=mu>>[q2_max=>q2_mu_max,q2_min=>q2_mu_min]
                         )"),
 
-                make_observable("Lambda_b->Lambda_clnu::A_FB^c",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::A_FB^c",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_a_fb_combined,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::F_0",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::F_0",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_fzero,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::K_1ss", R"(K_{1ss}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::K_1ss", R"(K_{1ss}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_k1ss,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::K_1cc", R"(K_{1cc}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::K_1cc", R"(K_{1cc}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_k1cc,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::K_1c", R"(K_{1c}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::K_1c", R"(K_{1c}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_k1c,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::K_2ss", R"(K_{2ss}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::K_2ss", R"(K_{2ss}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_k2ss,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::K_2cc", R"(K_{2cc}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::K_2cc", R"(K_{2cc}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_k2cc,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::K_2c", R"(K_{2c}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::K_2c", R"(K_{2c}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_k2c,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::K_3sc", R"(K_{3sc}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::K_3sc", R"(K_{3sc}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_k3sc,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::K_3s", R"(K_{3s}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::K_3s", R"(K_{3s}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_k3s,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::K_4sc", R"(K_{4sc}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::K_4sc", R"(K_{4sc}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_k4sc,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::K_4s", R"(K_{4s}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::K_4s", R"(K_{4s}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_k4s,
                         std::make_tuple("q2_min", "q2_max")),
 
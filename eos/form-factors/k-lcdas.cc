@@ -19,6 +19,7 @@
  */
 
 #include <eos/form-factors/k-lcdas.hh>
+#include <eos/form-factors/lcda.hh>
 #include <eos/models/model.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
@@ -32,6 +33,8 @@ namespace eos
     {
         std::shared_ptr<Model> model;
 
+        Parameters parameters;
+
         // twist 2 Gegenbauer coefficients at mu = 1 GeV
         UsedParameter a1K_0;
         UsedParameter a2K_0;
@@ -56,6 +59,7 @@ namespace eos
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             model(Model::make("SM", p, o)),
+            parameters(p),
             a1K_0(p["K::a1@1GeV"], u),
             a2K_0(p["K::a2@1GeV"], u),
             f3K_0(p["K::f3@1GeV"], u),
@@ -71,7 +75,7 @@ namespace eos
         {
         }
 
-        inline double c_rge(const double & _mu) const
+        inline double c_rge(const double & mu) const
         {
             /*
              * RGE coefficient, basically
@@ -79,27 +83,9 @@ namespace eos
              *     (alpha_s/alpha_s_0)^(1/beta_0),
              *
              * with matching between the individual n-flavor QCDs.
+             * Shared with all other LCDAs that use the same parameters.
              */
-
-            double mu = _mu, alpha_s_mu = model->alpha_s(mu);
-            double mu_0 = 1.0, alpha_s_0 = model->alpha_s(mu_0);
-
-            if (mu < _mu_c)
-                return std::pow(alpha_s_mu / alpha_s_0, 1.0 / QCD::beta_function_nf_3[0]);
-
-            double alpha_s_c = model->alpha_s(_mu_c);
-            double result = std::pow(alpha_s_c / alpha_s_0, 1.0 / QCD::beta_function_nf_3[0]);
-
-            if (mu < _mu_b)
-                return result * std::pow(alpha_s_mu / alpha_s_c, 1.0 / QCD::beta_function_nf_4[0]);
-
-            double alpha_s_b = model->alpha_s(_mu_b);
-            result *= std::pow(alpha_s_b / alpha_s_c, 1.0 / QCD::beta_function_nf_4[0]);
-
-            if (mu < _mu_t)
-                return result * std::pow(alpha_s_mu / alpha_s_b, 1.0 / QCD::beta_function_nf_5[0]);
-
-            throw InternalError("Implementation<AntiKaonLCDAs>: RGE coefficient must not be evolved above mu_t = " + stringify(_mu_t()));
+            return LCDA::rge_coefficient(parameters, *model, mu, _mu_c, _mu_b, _mu_t);
         }
 
         inline double a1K(const double & mu) const
@@ -275,6 +261,12 @@ namespace eos
         return 6.0 * u * (1.0 - u) * (1.0 + _imp->a1K(mu) * c1 + _imp->a2K(mu) * c2);
     }
 
+    void
+    AntiKaonLCDAs::phi(const double * u, const std::size_t & n, const double & mu, double * results) const
+    {
+        LCDA::twist2({ 1.0, _imp->a1K(mu), _imp->a2K(mu) }, u, n, results);
+    }
+
     double
     AntiKaonLCDAs::phi3p(const double & u, const double & mu) const
     {
@@ -652,6 +644,8 @@ namespace eos
     {
         std::shared_ptr<Model> model;
 
+        Parameters parameters;
+
         // twist 2 Gegenbauer coefficients at mu = 1 GeV
         UsedParameter a1K_0;
         UsedParameter a2K_0;
@@ -676,6 +670,7 @@ namespace eos
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             model(Model::make("SM", p, o)),
+            parameters(p),
             a1K_0(p["K::a1@1GeV"], u),
             a2K_0(p["K::a2@1GeV"], u),
             f3K_0(p["K::f3@1GeV"], u),
@@ -691,7 +686,7 @@ namespace eos
         {
         }
 
-        inline double c_rge(const double & _mu) const
+        inline double c_rge(const double & mu) const
         {
             /*
              * RGE coefficient, basically
@@ -699,27 +694,9 @@ namespace eos
              *     (alpha_s/alpha_s_0)^(1/beta_0),
              *
              * with matching between the individual n-flavor QCDs.
+             * Shared with all other LCDAs that use the same parameters.
              */
-
-            double mu = _mu, alpha_s_mu = model->alpha_s(mu);
-            double mu_0 = 1.0, alpha_s_0 = model->alpha_s(mu_0);
-
-            if (mu < _mu_c)
-                return std::pow(alpha_s_mu / alpha_s_0, 1.0 / QCD::beta_function_nf_3[0]);
-
-            double alpha_s_c = model->alpha_s(_mu_c);
-            double result = std::pow(alpha_s_c / alpha_s_0, 1.0 / QCD::beta_function_nf_3[0]);
-
-            if (mu < _mu_b)
-                return result * std::pow(alpha_s_mu / alpha_s_c, 1.0 / QCD::beta_function_nf_4[0]);
-
-            double alpha_s_b = model->alpha_s(_mu_b);
-            result *= std::pow(alpha_s_b / alpha_s_c, 1.0 / QCD::beta_function_nf_4[0]);
-
-            if (mu < _mu_t)
-                return result * std::pow(alpha_s_mu / alpha_s_b, 1.0 / QCD::beta_function_nf_5[0]);
-
-            throw InternalError("Implementation<KaonLCDAs>: RGE coefficient must not be evolved above mu_t = " + stringify(_mu_t()));
+            return LCDA::rge_coefficient(parameters, *model, mu, _mu_c, _mu_b, _mu_t);
         }
 
         inline double a1K(const double & mu) const
@@ -896,6 +873,12 @@ namespace eos
         return 6.0 * u * (1.0 - u) * (1.0 + _imp->a1K(mu) * c1 + _imp->a2K(mu) * c2);
     }
 
+    void
+    KaonLCDAs::phi(const double * u, const std::size_t & n, const double & mu, double * results) const
+    {
+        LCDA::twist2({ 1.0, _imp->a1K(mu), _imp->a2K(mu) }, u, n, results);
+    }
+
     double
     KaonLCDAs::phi3p(const double & u, const double & mu) const
     {
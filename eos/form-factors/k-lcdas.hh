@@ -59,6 +59,7 @@ namespace eos
 
             /* Twist 2 LCDA */
             double phi(const double & u, const double & mu) const override;
+            void phi(const double * u, const std::size_t & n, const double & mu, double * results) const override;
 
             /* Twist 3 LCDAs and their derivatives */
             double phi3p(const double & u, const double & mu) const override;
@@ -106,6 +107,7 @@ namespace eos
 
             /* Twist 2 LCDA */
             double phi(const double & u, const double & mu) const override;
+            void phi(const double * u, const std::size_t & n, const double & mu, double * results) const override;
 
             /* Twist 3 LCDAs and their derivatives */
             double phi3p(const double & u, const double & mu) const override;
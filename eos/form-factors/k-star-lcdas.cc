@@ -18,6 +18,7 @@
  */
 
 #include <eos/form-factors/k-star-lcdas.hh>
+#include <eos/form-factors/lcda.hh>
 #include <eos/models/model.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 #include <eos/utils/qcd.hh>
@@ -30,6 +31,8 @@ namespace eos
     {
         std::shared_ptr<Model> model;
 
+        Parameters parameters;
+
         // twist 2 (even) para Gegenbauer coefficients at mu = 1 GeV
         UsedParameter a1para_0;
         UsedParameter a2para_0;
@@ -71,6 +74,7 @@ namespace eos
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             model(Model::make("SM", p, o)),
+            parameters(p),
             a1para_0(p["K^*::a1para@1GeV"], u),
             a2para_0(p["K^*::a2para@1GeV"], u),
             a3para_0(p["K^*::a3para@1GeV"], u),
@@ -101,7 +105,7 @@ namespace eos
         {
         }
 
-        inline double c_rge(const double & _mu) const
+        inline double c_rge(const double & mu) const
         {
             /*
              * RGE coefficient, basically
@@ -109,27 +113,9 @@ namespace eos
              *     (alpha_s/alpha_s_0)^(1/beta_0),
              *
              * with matching between the individual n-flavor QCDs.
+             * Shared with all other LCDAs that use the same parameters.
              */
-
-            double mu = _mu, alpha_s_mu = model->alpha_s(mu);
-            double mu_0 = 1.0, alpha_s_0 = model->alpha_s(mu_0);
-
-            if (mu < _mu_c)
-                return std::pow(alpha_s_mu / alpha_s_0, 1.0 / QCD::beta_function_nf_3[0]);
-
-            double alpha_s_c = model->alpha_s(_mu_c);
-            double result = std::pow(alpha_s_c / alpha_s_0, 1.0 / QCD::beta_function_nf_3[0]);
-
-            if (mu < _mu_b)
-                return result * std::pow(alpha_s_mu / alpha_s_c, 1.0 / QCD::beta_function_nf_4[0]);
-
-            double alpha_s_b = model->alpha_s(_mu_b);
-            result *= std::pow(alpha_s_b / alpha_s_c, 1.0 / QCD::beta_function_nf_4[0]);
-
-            if (mu < _mu_t)
-                return result * std::pow(alpha_s_mu / alpha_s_b, 1.0 / QCD::beta_function_nf_5[0]);
-
-            throw InternalError("Implementation<AntiKStarLCDAs>: RGE coefficient must not be evolved above mu_t = " + stringify(_mu_t()));
+            return LCDA::rge_coefficient(parameters, *model, mu, _mu_c, _mu_b, _mu_t);
         }
 
         inline double a1para(const double & mu) const
@@ -861,6 +847,18 @@ namespace eos
         return 6.0 * u * (1.0 - u) * (1.0 + _imp->a1perp(mu) * c1 + _imp->a2perp(mu) * c2 + _imp->a3perp(mu) * c3 + _imp->a4perp(mu) * c4);
     }
 
+    void
+    AntiKStarLCDAs::phi2para(const double * u, const std::size_t & n, const double & mu, double * results) const
+    {
+        LCDA::twist2({ 1.0, _imp->a1para(mu), _imp->a2para(mu), _imp->a3para(mu), _imp->a4para(mu) }, u, n, results);
+    }
+
+    void
+    AntiKStarLCDAs::phi2perp(const double * u, const std::size_t & n, const double & mu, double * results) const
+    {
+        LCDA::twist2({ 1.0, _imp->a1perp(mu), _imp->a2perp(mu), _imp->a3perp(mu), _imp->a4perp(mu) }, u, n, results);
+    }
+
     double
     AntiKStarLCDAs::psi3para(const double & u, const double & mu) const
     {
@@ -1028,6 +1026,8 @@ namespace eos
     {
         std::shared_ptr<Model> model;
 
+        Parameters parameters;
+
         // twist 2 (even) para Gegenbauer coefficients at mu = 1 GeV
         UsedParameter a1para_0;
         UsedParameter a2para_0;
@@ -1069,6 +1069,7 @@ namespace eos
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             model(Model::make("SM", p, o)),
+            parameters(p),
             a1para_0(p["K^*::a1para@1GeV"], u),
             a2para_0(p["K^*::a2para@1GeV"], u),
             a3para_0(p["K^*::a3para@1GeV"], u),
@@ -1099,7 +1100,7 @@ namespace eos
         {
         }
 
-        inline double c_rge(const double & _mu) const
+        inline double c_rge(const double & mu) const
         {
             /*
              * RGE coefficient, basically
@@ -1107,27 +1108,9 @@ namespace eos
              *     (alpha_s/alpha_s_0)^(1/beta_0),
              *
              * with matching between the individual n-flavor QCDs.
+             * Shared with all other LCDAs that use the same parameters.
              */
-
-            double mu = _mu, alpha_s_mu = model->alpha_s(mu);
-            double mu_0 = 1.0, alpha_s_0 = model->alpha_s(mu_0);
-
-            if (mu < _mu_c)
-                return std::pow(alpha_s_mu / alpha_s_0, 1.0 / QCD::beta_function_nf_3[0]);
-
-            double alpha_s_c = model->alpha_s(_mu_c);
-            double result = std::pow(alpha_s_c / alpha_s_0, 1.0 / QCD::beta_function_nf_3[0]);
-
-            if (mu < _mu_b)
-                return result * std::pow(alpha_s_mu / alpha_s_c, 1.0 / QCD::beta_function_nf_4[0]);
-
-            double alpha_s_b = model->alpha_s(_mu_b);
-            result *= std::pow(alpha_s_b / alpha_s_c, 1.0 / QCD::beta_function_nf_4[0]);
-
-            if (mu < _mu_t)
-                return result * std::pow(alpha_s_mu / alpha_s_b, 1.0 / QCD::beta_function_nf_5[0]);
-
-            throw InternalError("Implementation<KStarLCDAs>: RGE coefficient must not be evolved above mu_t = " + stringify(_mu_t()));
+            return LCDA::rge_coefficient(parameters, *model, mu, _mu_c, _mu_b, _mu_t);
         }
 
         // running of twist 2 parameters
@@ -1860,6 +1843,18 @@ namespace eos
         return 6.0 * u * (1.0 - u) * (1.0 + _imp->a1perp(mu) * c1 + _imp->a2perp(mu) * c2 + _imp->a3perp(mu) * c3 + _imp->a4perp(mu) * c4);
     }
 
+    void
+    KStarLCDAs::phi2para(const double * u, const std::size_t & n, const double & mu, double * results) const
+    {
+        LCDA::twist2({ 1.0, _imp->a1para(mu), _imp->a2para(mu), _imp->a3para(mu), _imp->a4para(mu) }, u, n, results);
+    }
+
+    void
+    KStarLCDAs::phi2perp(const double * u, const std::size_t & n, const double & mu, double * results) const
+    {
+        LCDA::twist2({ 1.0, _imp->a1perp(mu), _imp->a2perp(mu), _imp->a3perp(mu), _imp->a4perp(mu) }, u, n, results);
+    }
+
     double
     KStarLCDAs::psi3para(const double & u, const double & mu) const
     {
@@ -18,8 +18,16 @@
  */
 
 #include <eos/form-factors/lcda.hh>
+#include <eos/maths/gegenbauer-polynomial.hh>
+#include <eos/models/model.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/instantiation_policy-impl.hh>
+#include <eos/utils/memoise.hh>
+#include <eos/utils/stringify.hh>
 
 #include <cmath>
+#include <functional>
+#include <mutex>
 
 #include <gsl/gsl_sf_psi.h>
 
@@ -37,4 +45,151 @@ namespace eos
         // cf. [BBL:2006A], Eq. (2.13), p. 5
         return std::pow(eta, gamma_0 / 2.0 / beta[0]) * a_n_0;
     }
+
+    double
+    LCDA::rge_coefficient(const Parameters & parameters, const Model & model, const double & mu,
+            const double & mu_c, const double & mu_b, const double & mu_t)
+    {
+        if (mu >= mu_t)
+        {
+            throw InternalError("LCDA: RGE coefficient must not be evolved above mu_t = " + stringify(mu_t));
+        }
+
+        auto cache = LCDARGECache::instance();
+
+        double result;
+        if (cache->find(parameters, mu, result))
+        {
+            return result;
+        }
+
+        const double alpha_s_mu = model.alpha_s(mu);
+        const double mu_0 = 1.0, alpha_s_0 = model.alpha_s(mu_0);
+
+        if (mu < mu_c)
+        {
+            result = std::pow(alpha_s_mu / alpha_s_0, 1.0 / QCD::beta_function_nf_3[0]);
+        }
+        else
+        {
+            const double alpha_s_c = model.alpha_s(mu_c);
+            result = std::pow(alpha_s_c / alpha_s_0, 1.0 / QCD::beta_function_nf_3[0]);
+
+            if (mu < mu_b)
+            {
+                result *= std::pow(alpha_s_mu / alpha_s_c, 1.0 / QCD::beta_function_nf_4[0]);
+            }
+            else
+            {
+                const double alpha_s_b = model.alpha_s(mu_b);
+                result *= std::pow(alpha_s_b / alpha_s_c, 1.0 / QCD::beta_function_nf_4[0]);
+                result *= std::pow(alpha_s_mu / alpha_s_b, 1.0 / QCD::beta_function_nf_5[0]);
+            }
+        }
+
+        cache->insert(parameters, mu, result);
+
+        return result;
+    }
+
+    void
+    LCDA::twist2(const std::vector<double> & a, const double * u, const std::size_t & n, double * results)
+    {
+        std::vector<double> x(n);
+        for (std::size_t j = 0 ; j < n ; ++j)
+        {
+            x[j] = 2.0 * u[j] - 1.0;
+        }
+
+        gegenbauer_series(3.0 / 2.0, a, x.data(), n, results);
+
+        for (std::size_t j = 0 ; j < n ; ++j)
+        {
+            results[j] *= 6.0 * u[j] * (1.0 - u[j]);
+        }
+    }
+
+    template class InstantiationPolicy<LCDARGECache, Singleton>;
+
+    LCDARGECache::LCDARGECache()
+    {
+        MemoisationControl::instance()->register_clear_function(std::bind(&LCDARGECache::clear, this));
+    }
+
+    LCDARGECache::~LCDARGECache() = default;
+
+    bool
+    LCDARGECache::find(const Parameters & parameters, const double & mu, double & coefficient) const
+    {
+        std::shared_lock<std::shared_mutex> l(_mutex);
+
+        auto e = _entries.find(parameters.identity());
+        if ((_entries.end() == e) || (e->second.generation != parameters.generation()))
+        {
+            return false;
+        }
+
+        auto c = e->second.coefficients.find(mu);
+        if (e->second.coefficients.end() == c)
+        {
+            return false;
+        }
+
+        coefficient = c->second;
+
+        return true;
+    }
+
+    void
+    LCDARGECache::insert(const Parameters & parameters, const double & mu, const double & coefficient)
+    {
+        std::unique_lock<std::shared_mutex> l(_mutex);
+
+        auto e = _entries.find(parameters.identity());
+        if (_entries.end() == e)
+        {
+            // each entry keeps its set of parameters alive; bound the number of sets
+            if (_entries.size() >= 64u)
+            {
+                _entries.clear();
+            }
+
+            e = _entries.emplace(parameters.identity(), Entry{ parameters, parameters.generation(), {} }).first;
+        }
+        else if (e->second.generation != parameters.generation())
+        {
+            e->second.generation = parameters.generation();
+            e->second.coefficients.clear();
+        }
+
+        // bound the memory use for scans over the scale
+        if (e->second.coefficients.size() >= 1024u)
+        {
+            e->second.coefficients.clear();
+        }
+
+        e->second.coefficients[mu] = coefficient;
+    }
+
+    void
+    LCDARGECache::clear()
+    {
+        std::unique_lock<std::shared_mutex> l(_mutex);
+
+        _entries.clear();
+    }
+
+    unsigned
+    LCDARGECache::size() const
+    {
+        std::shared_lock<std::shared_mutex> l(_mutex);
+
+        unsigned result = 0;
+        for (const auto & e : _entries)
+        {
+            result += e.second.coefficients.size();
+        }
+
+        return result;
+    }
 }
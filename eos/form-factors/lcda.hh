@@ -20,10 +20,19 @@
 #ifndef EOS_GUARD_SRC_UTILS_LCDA_HH
 #define EOS_GUARD_SRC_UTILS_LCDA_HH 1
 
+#include <eos/utils/instantiation_policy.hh>
+#include <eos/utils/parameters.hh>
 #include <eos/utils/qcd.hh>
 
+#include <cstddef>
+#include <map>
+#include <shared_mutex>
+#include <vector>
+
 namespace eos
 {
+    class Model;
+
     /*!
      * Groups all functions related to LightCone Distribution Amplitudes
      * (LCDAs).
@@ -41,6 +50,77 @@ namespace eos
          * @param beta  The coefficients of the QCD beta function.
          */
         static double evolve_gegenbauer_moment(const double & a_n_0, const unsigned & n, const double & eta, const QCD::BetaFunction & beta);
+
+        /*!
+         * Compute the LL RGE coefficient
+         *
+         *     c(mu) = (alpha_s(mu) / alpha_s(mu_0))^(1 / beta_0),   mu_0 = 1 GeV,
+         *
+         * with matching between the individual n-flavor QCDs. The n-th LCDA parameter evolves as c(mu)^gamma_n.
+         *
+         * The results are shared through the LCDARGECache by all LCDAs that use the same set of parameters.
+         *
+         * @param parameters The parameters from which the model has been made.
+         * @param model      The model that provides alpha_s.
+         * @param mu         The scale to which the parameters are evolved; must lie below mu_t.
+         * @param mu_c       The matching scale between the 3- and 4-flavor QCDs.
+         * @param mu_b       The matching scale between the 4- and 5-flavor QCDs.
+         * @param mu_t       The matching scale between the 5- and 6-flavor QCDs.
+         */
+        static double rge_coefficient(const Parameters & parameters, const Model & model, const double & mu,
+                const double & mu_c, const double & mu_b, const double & mu_t);
+
+        /*!
+         * Evaluate a twist-2 LCDA
+         *
+         *     phi(u) = 6 u (1 - u) sum_k a_k C_k^(3/2)(2 u - 1)
+         *
+         * at the n points u[j], and store the results in results[j].
+         *
+         * @param a       The Gegenbauer moments a_k at the scale of interest, including a_0 = 1.
+         * @param u       The momentum fractions.
+         * @param n       The number of momentum fractions.
+         * @param results The values of the LCDA.
+         */
+        static void twist2(const std::vector<double> & a, const double * u, const std::size_t & n, double * results);
+    };
+
+    /*!
+     * Cache of the LL RGE coefficients of the LCDA parameters, keyed by the identity of the set of parameters
+     * and by the scale. The entries of a set of parameters are discarded as soon as its generation changes.
+     * Look-ups only share the lock, so that concurrent evaluations of cached coefficients do not serialize.
+     */
+    class LCDARGECache :
+        public InstantiationPolicy<LCDARGECache, Singleton>
+    {
+        private:
+            struct Entry
+            {
+                // keeps the identity of the parameters from being reused
+                Parameters parameters;
+
+                std::uint64_t generation;
+
+                std::map<double, double> coefficients;
+            };
+
+            mutable std::shared_mutex _mutex;
+
+            std::map<const void *, Entry> _entries;
+
+        public:
+            LCDARGECache();
+
+            ~LCDARGECache();
+
+            // Look up a coefficient, returning false if none is cached
+            bool find(const Parameters & parameters, const double & mu, double & coefficient) const;
+
+            void insert(const Parameters & parameters, const double & mu, const double & coefficient);
+
+            void clear();
+
+            unsigned size() const;
     };
 }
 
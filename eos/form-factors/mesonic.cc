@@ -40,16 +40,257 @@
 #include <eos/form-factors/parametric-kmpw2010.hh>
 #include <eos/form-factors/parametric-ksvd2025.hh>
 #include <eos/utils/destringify.hh>
+#include <eos/utils/instantiation_policy-impl.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/mutex.hh>
 #include <eos/utils/qualified-name.hh>
 
+#include <array>
 #include <cmath>
 #include <limits>
 #include <map>
+#include <tuple>
+#include <unordered_map>
 
 namespace eos
 {
     using namespace std::literals::string_literals;
 
+    namespace impl
+    {
+        /*
+         * Hands out one shared instance of the form factors per set of parameters, name, and options.
+         *
+         * Only weak references are held, so that instances are destroyed along with the last observable using them.
+         * Since each instance keeps its parameters alive, the parameters' identity cannot be reused while an entry
+         * is valid.
+         */
+        template <typename Transition_>
+        class FormFactorsRegistry :
+            public InstantiationPolicy<FormFactorsRegistry<Transition_>, Singleton>
+        {
+            private:
+                using KeyType = std::tuple<const void *, std::string, std::string>;
+
+                Mutex * const _mutex;
+
+                std::map<KeyType, std::weak_ptr<FormFactors<Transition_>>> _entries;
+
+            public:
+                FormFactorsRegistry() :
+                    _mutex(new Mutex)
+                {
+                }
+
+                ~FormFactorsRegistry() { delete _mutex; }
+
+                std::shared_ptr<FormFactors<Transition_>>
+                get(const QualifiedName & name, const Parameters & parameters, const Options & options,
+                        const std::function<std::shared_ptr<FormFactors<Transition_>> ()> & make)
+                {
+                    Lock l(*_mutex);
+
+                    KeyType key(parameters.identity(), name.full(), options.as_string());
+
+                    auto i = _entries.find(key);
+                    if (_entries.end() != i)
+                    {
+                        if (auto result = i->second.lock())
+                        {
+                            return result;
+                        }
+                    }
+
+                    // remove entries of destroyed instances
+                    for (auto j = _entries.begin() ; j != _entries.end() ; )
+                    {
+                        j = j->second.expired() ? _entries.erase(j) : std::next(j);
+                    }
+
+                    auto result = make();
+                    _entries[key] = result;
+
+                    return result;
+                }
+        };
+
+        /*
+         * Caches the values of n_ real-valued functions of q2 for the current generation of a set of parameters.
+         *
+         * The functions are evaluated without holding the lock, so concurrent observables are not serialised.
+         */
+        template <unsigned n_>
+        class FormFactorsResultCache
+        {
+            private:
+                Parameters _parameters;
+
+                Mutex * const _mutex;
+
+                std::uint64_t _generation;
+
+                std::array<std::unordered_map<double, double>, n_> _values;
+
+            public:
+                FormFactorsResultCache(const Parameters & parameters) :
+                    _parameters(parameters),
+                    _mutex(new Mutex),
+                    _generation(parameters.generation())
+                {
+                }
+
+                ~FormFactorsResultCache() { delete _mutex; }
+
+                template <typename Function_>
+                double
+                operator() (const unsigned & index, const double & q2, const Function_ & f)
+                {
+                    const std::uint64_t generation = _parameters.generation();
+
+                    {
+                        Lock l(*_mutex);
+
+                        if (generation != _generation)
+                        {
+                            for (auto & v : _values)
+                            {
+                                v.clear();
+                            }
+
+                            _generation = generation;
+                        }
+
+                        auto i = _values[index].find(q2);
+                        if (_values[index].end() != i)
+                        {
+                            return i->second;
+                        }
+                    }
+
+                    const double result = f(q2);
+
+                    {
+                        Lock l(*_mutex);
+
+                        if (generation == _generation)
+                        {
+                            if (_values[index].size() > 4096u)
+                            {
+                                _values[index].clear();
+                            }
+
+                            _values[index].emplace(q2, result);
+                        }
+                    }
+
+                    return result;
+                }
+        };
+
+        // decorates shared P->V form factors with a cache of their real-valued results
+        class CachedPToVFormFactors :
+            public FormFactors<PToV>
+        {
+            private:
+                std::shared_ptr<FormFactors<PToV>> _form_factors;
+
+                mutable FormFactorsResultCache<15> _cache;
+
+                template <double (FormFactors<PToV>::*f_)(const double &) const>
+                double
+                cached(const unsigned & index, const double & q2) const
+                {
+                    return _cache(index, q2, [this](const double & q2) { return (_form_factors.get()->*f_)(q2); });
+                }
+
+            public:
+                CachedPToVFormFactors(const std::shared_ptr<FormFactors<PToV>> & form_factors, const Parameters & parameters) :
+                    _form_factors(form_factors),
+                    _cache(parameters)
+                {
+                    this->uses(*form_factors);
+                }
+
+                ~CachedPToVFormFactors() = default;
+
+                virtual double v(const double & q2) const { return cached<&FormFactors<PToV>::v>(0, q2); }
+
+                virtual double a_0(const double & q2) const { return cached<&FormFactors<PToV>::a_0>(1, q2); }
+                virtual double a_1(const double & q2) const { return cached<&FormFactors<PToV>::a_1>(2, q2); }
+                virtual double a_2(const double & q2) const { return cached<&FormFactors<PToV>::a_2>(3, q2); }
+                virtual double a_12(const double & q2) const { return cached<&FormFactors<PToV>::a_12>(4, q2); }
+
+                virtual double t_1(const double & q2) const { return cached<&FormFactors<PToV>::t_1>(5, q2); }
+                virtual double t_2(const double & q2) const { return cached<&FormFactors<PToV>::t_2>(6, q2); }
+                virtual double t_3(const double & q2) const { return cached<&FormFactors<PToV>::t_3>(7, q2); }
+                virtual double t_23(const double & q2) const { return cached<&FormFactors<PToV>::t_23>(8, q2); }
+
+                virtual double f_perp(const double & q2) const { return cached<&FormFactors<PToV>::f_perp>(9, q2); }
+                virtual double f_para(const double & q2) const { return cached<&FormFactors<PToV>::f_para>(10, q2); }
+                virtual double f_long(const double & q2) const { return cached<&FormFactors<PToV>::f_long>(11, q2); }
+
+                virtual double f_perp_T(const double & q2) const { return cached<&FormFactors<PToV>::f_perp_T>(12, q2); }
+                virtual double f_para_T(const double & q2) const { return cached<&FormFactors<PToV>::f_para_T>(13, q2); }
+                virtual double f_long_T(const double & q2) const { return cached<&FormFactors<PToV>::f_long_T>(14, q2); }
+
+                virtual void evaluate(const double * q2, const std::size_t & n, double * results) const { _form_factors->evaluate(q2, n, results); }
+
+                virtual complex<double> v(const complex<double> & q2) const { return _form_factors->v(q2); }
+
+                virtual complex<double> a_0(const complex<double> & q2) const { return _form_factors->a_0(q2); }
+                virtual complex<double> a_1(const complex<double> & q2) const { return _form_factors->a_1(q2); }
+                virtual complex<double> a_12(const complex<double> & q2) const { return _form_factors->a_12(q2); }
+                virtual complex<double> a_2(const complex<double> & q2) const { return _form_factors->a_2(q2); }
+
+                virtual complex<double> t_1(const complex<double> & q2) const { return _form_factors->t_1(q2); }
+                virtual complex<double> t_2(const complex<double> & q2) const { return _form_factors->t_2(q2); }
+                virtual complex<double> t_23(const complex<double> & q2) const { return _form_factors->t_23(q2); }
+        };
+
+        // decorates shared P->P form factors with a cache of their real-valued results
+        class CachedPToPFormFactors :
+            public FormFactors<PToP>
+        {
+            private:
+                std::shared_ptr<FormFactors<PToP>> _form_factors;
+
+                mutable FormFactorsResultCache<7> _cache;
+
+                template <double (FormFactors<PToP>::*f_)(const double &) const>
+                double
+                cached(const unsigned & index, const double & s) const
+                {
+                    return _cache(index, s, [this](const double & s) { return (_form_factors.get()->*f_)(s); });
+                }
+
+            public:
+                CachedPToPFormFactors(const std::shared_ptr<FormFactors<PToP>> & form_factors, const Parameters & parameters) :
+                    _form_factors(form_factors),
+                    _cache(parameters)
+                {
+                    this->uses(*form_factors);
+                }
+
+                ~CachedPToPFormFactors() = default;
+
+                virtual double f_p(const double & s) const { return cached<&FormFactors<PToP>::f_p>(0, s); }
+                virtual double f_0(const double & s) const { return cached<&FormFactors<PToP>::f_0>(1, s); }
+                virtual double f_t(const double & s) const { return cached<&FormFactors<PToP>::f_t>(2, s); }
+                virtual double f_m(const double & s) const { return cached<&FormFactors<PToP>::f_m>(3, s); }
+
+                virtual double f_plus_T(const double & s) const { return cached<&FormFactors<PToP>::f_plus_T>(4, s); }
+
+                virtual double f_p_d1(const double & s) const { return cached<&FormFactors<PToP>::f_p_d1>(5, s); }
+                virtual double f_p_d2(const double & s) const { return cached<&FormFactors<PToP>::f_p_d2>(6, s); }
+
+                virtual void evaluate(const double * s, const std::size_t & n, double * results) const { _form_factors->evaluate(s, n, results); }
+
+                virtual complex<double> f_p(const complex<double> & q2) const { return _form_factors->f_p(q2); }
+                virtual complex<double> f_0(const complex<double> & q2) const { return _form_factors->f_0(q2); }
+                virtual complex<double> f_t(const complex<double> & q2) const { return _form_factors->f_t(q2); }
+        };
+    }
+
     /* P -> V Processes */
 
     FormFactors<PToV>::~FormFactors()
@@ -83,6 +324,21 @@ namespace eos
         { "B_s->D_s^*::B-LCSR",   &AnalyticFormFactorBToVLCSR<BsToDsstar>::make       }
     };
 
+    void
+    FormFactors<PToV>::evaluate(const double * q2, const std::size_t & n, double * results) const
+    {
+        for (std::size_t j = 0 ; j < n ; ++j)
+        {
+            results[0 * n + j] = this->v(q2[j]);
+            results[1 * n + j] = this->a_0(q2[j]);
+            results[2 * n + j] = this->a_1(q2[j]);
+            results[3 * n + j] = this->a_12(q2[j]);
+            results[4 * n + j] = this->t_1(q2[j]);
+            results[5 * n + j] = this->t_2(q2[j]);
+            results[6 * n + j] = this->t_23(q2[j]);
+        }
+    }
+
     complex<double>
     FormFactors<PToV>::v(const complex<double> &) const
     {
@@ -149,7 +405,14 @@ namespace eos
         auto i = form_factors.find(name);
         if (form_factors.end() != i)
         {
-            result.reset(i->second(parameters, name.options() + options));
+            // observables with identical parameters and options share one instance and its results
+            const Options all_options = name.options() + options;
+            result = impl::FormFactorsRegistry<PToV>::instance()->get(name, parameters, all_options, [&]()
+            {
+                std::shared_ptr<FormFactors<PToV>> form_factors(i->second(parameters, all_options));
+                return std::make_shared<impl::CachedPToVFormFactors>(form_factors, parameters);
+            });
+
             return result;
         }
 
@@ -335,6 +598,17 @@ namespace eos
         return derivative<2u, deriv::TwoSided>(f, s);
     }
 
+    void
+    FormFactors<PToP>::evaluate(const double * s, const std::size_t & n, double * results) const
+    {
+        for (std::size_t j = 0 ; j < n ; ++j)
+        {
+            results[0 * n + j] = this->f_p(s[j]);
+            results[1 * n + j] = this->f_0(s[j]);
+            results[2 * n + j] = this->f_t(s[j]);
+        }
+    }
+
     const std::map<FormFactorFactory<PToP>::KeyType, FormFactorFactory<PToP>::ValueType>
     FormFactorFactory<PToP>::form_factors
     {
@@ -419,7 +693,14 @@ namespace eos
         auto i = FormFactorFactory<PToP>::form_factors.find(name);
         if (FormFactorFactory<PToP>::form_factors.end() != i)
         {
-            result.reset(i->second(parameters, name.options() + options));
+            // observables with identical parameters and options share one instance and its results
+            const Options all_options = name.options() + options;
+            result = impl::FormFactorsRegistry<PToP>::instance()->get(name, parameters, all_options, [&]()
+            {
+                std::shared_ptr<FormFactors<PToP>> form_factors(i->second(parameters, all_options));
+                return std::make_shared<impl::CachedPToPFormFactors>(form_factors, parameters);
+            });
+
             return result;
         }
 
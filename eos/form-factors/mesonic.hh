@@ -34,6 +34,7 @@
 #include <eos/utils/transitions.hh>
 
 #include <array>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <string>
@@ -67,6 +68,10 @@ namespace eos
             virtual double f_para_T(const double & q2) const = 0;
             virtual double f_long_T(const double & q2) const = 0;
 
+            // V, A_0, A_1, A_12, T_1, T_2 and T_23 (in this order) at n points q2,
+            // stored row by row as results[i * n + j]
+            virtual void evaluate(const double * q2, const std::size_t & n, double * results) const;
+
             // for access in the complex q2 plane
             virtual complex<double> v(const complex<double> & q2) const;
 
@@ -183,6 +188,9 @@ namespace eos
             virtual double f_p_d1(const double & s) const;
             virtual double f_p_d2(const double & s) const;
 
+            // f_+, f_0 and f_T (in this order) at n points s, stored row by row as results[i * n + j]
+            virtual void evaluate(const double * s, const std::size_t & n, double * results) const;
+
             // for access in the complex q2 plane
             virtual complex<double> f_p(const complex<double> & q2) const;
             virtual complex<double> f_0(const complex<double> & q2) const;
@@ -88,6 +88,32 @@ class PToVFormFactorsTest :
                 TEST_CHECK_THROWS(NoSuchFormFactorError, FormFactorFactory<PToV>::create("Foo->Baz::BSZ2015", parameter, options));
                 TEST_CHECK_THROWS(NoSuchFormFactorError, FormFactorFactory<PToV>::create("B->rho::FooBaz",    parameter, options));
             }
+
+            // sharing of instances and their results
+            {
+                auto parameters = Parameters::Defaults();
+                auto options    = Options();
+
+                auto ff1 = FormFactorFactory<PToV>::create("B->K^*::BSZ2015", parameters, options);
+                auto ff2 = FormFactorFactory<PToV>::create("B->K^*::BSZ2015", parameters, options);
+                auto ff3 = FormFactorFactory<PToV>::create("B->K^*::BSZ2015", parameters, Options{ { "l"_ok, "tau" } });
+                auto ff4 = FormFactorFactory<PToV>::create("B->K^*::BSZ2015", parameters.clone(), options);
+
+                TEST_CHECK(ff1.get() == ff2.get());
+                TEST_CHECK(ff1.get() != ff3.get());
+                TEST_CHECK(ff1.get() != ff4.get());
+
+                // cached results are invalidated by changes to the parameters
+                const double v = ff1->v(4.0);
+                TEST_CHECK_EQUAL(ff2->v(4.0), v);
+                TEST_CHECK_EQUAL(ff4->v(4.0), v);
+
+                parameters["B->K^*::alpha^V_0@BSZ2015"] = 2.0 * parameters["B->K^*::alpha^V_0@BSZ2015"]();
+                auto ff5 = FormFactorFactory<PToV>::create("B->K^*::BSZ2015", parameters.clone(), options);
+                TEST_CHECK(ff1->v(4.0) != v);
+                TEST_CHECK_EQUAL(ff1->v(4.0), ff5->v(4.0));
+                TEST_CHECK_EQUAL(ff4->v(4.0), v);
+            }
         }
 } p_to_v_form_factor_test;
 
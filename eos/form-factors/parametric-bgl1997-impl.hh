@@ -31,11 +31,103 @@
 #include <gsl/gsl_sf_dilog.h>
 
 #include <numeric>
+#include <vector>
 
 namespace eos
 {
     using namespace std::literals::string_literals;
 
+    namespace bgl1997
+    {
+        /*
+         * A form factor f(s) = factor * sum_k a_k z(s)^k / (phi(s) B(s)), with the outer function phi
+         * of [BGL:1997A] eq. (4.14) and the Blaschke factor B of its bound states.
+         */
+        struct BatchedFormFactor
+        {
+            // includes the normalization sqrt(K pi chi) of the outer function
+            double factor;
+
+            // exponents of the outer function
+            unsigned a, b, c;
+
+            // sqrt(t_+ - m^2) for the masses m of the bound states below t_+
+            const std::vector<double> * poles;
+
+            std::array<double, 4> coefficients;
+        };
+
+        inline std::vector<double>
+        poles(const double & t_p, const UsedParameter * masses, const int & n_bound_states)
+        {
+            std::vector<double> result;
+            for (int i = 0 ; i < n_bound_states ; ++i)
+            {
+                const double m2 = masses[i]() * masses[i]();
+                if (m2 <= t_p)
+                {
+                    result.push_back(std::sqrt(t_p - m2));
+                }
+            }
+
+            return result;
+        }
+
+        /*
+         * Evaluate form factors that share the kinematic thresholds t_+, t_- and t_0 at the n points s.
+         * All s-independent quantities are taken from the form factor descriptions, which are set up
+         * once per batch. The results are stored row by row, i.e., results[i * n + j] = f_i(s[j]).
+         */
+        template <std::size_t nff_>
+        void
+        evaluate(const std::array<BatchedFormFactor, nff_> & form_factors, const double & t_p, const double & t_m, const double & t_0,
+                const double * s, const std::size_t & n, double * results)
+        {
+            const double sq_tp    = std::sqrt(t_p);
+            const double sq_tp_t0 = std::sqrt(t_p - t_0);
+            const double sq_tp_tm = std::sqrt(t_p - t_m);
+
+            for (std::size_t j = 0 ; j < n ; ++j)
+            {
+                if (s[j] > t_p)
+                    throw InternalError("The real conformal mapping is used above threshold: " + stringify(s[j]) + " > " + stringify(t_p));
+
+                const double sq_tp_t = std::sqrt(t_p - s[j]);
+                const double z       = (sq_tp_t - sq_tp_t0) / (sq_tp_t + sq_tp_t0);
+
+                // building blocks of the outer functions: (t_+ - s)^(1/4), (sqrt(t_+ - s) + sqrt(t_+ - t_-))^(1/2), and sqrt(t_+ - s) + sqrt(t_+)
+                const double common = (sq_tp_t + sq_tp_t0) * std::sqrt(sq_tp_t / sq_tp_t0);
+                const double u      = std::sqrt(sq_tp_t);
+                const double w      = std::sqrt(sq_tp_t + sq_tp_tm);
+                const double x      = sq_tp_t + sq_tp;
+
+                for (std::size_t i = 0 ; i < nff_ ; ++i)
+                {
+                    const BatchedFormFactor & ff = form_factors[i];
+
+                    double phi = common;
+                    for (unsigned k = 0 ; k < ff.a ; ++k)
+                        phi *= u;
+                    for (unsigned k = 0 ; k < ff.b ; ++k)
+                        phi *= w;
+                    for (unsigned k = 0 ; k < ff.c + 3 ; ++k)
+                        phi /= x;
+
+                    double blaschke = 1.0;
+                    for (const auto & pole : *ff.poles)
+                    {
+                        blaschke *= (sq_tp_t - pole) / (sq_tp_t + pole);
+                    }
+
+                    const auto & a = ff.coefficients;
+                    const double series = a[0] + z * (a[1] + z * (a[2] + z * a[3]));
+
+                    results[i * n + j] = ff.factor * series / phi / blaschke;
+                }
+            }
+        }
+    }
+
     template<typename Process_>
     std::string BGL1997FormFactors<Process_, PToV>::_par_name(const std::string & ff_name)
     {
@@ -301,6 +393,39 @@ namespace eos
         return series / phi / blaschke;
     }
 
+    template<typename Process_>
+    void BGL1997FormFactors<Process_, PToV>::evaluate(const double * s, const std::size_t & n, double * results) const
+    {
+        using bgl1997::BatchedFormFactor;
+
+        const double t_p = _traits.tp(), t_m = _traits.tm();
+        const double m_B = _mB(), m_V = _mV();
+
+        const std::vector<double> poles_1m = bgl1997::poles(t_p, _traits.masses_1m.data(), _traits.n_bound_states_1m.value());
+        const std::vector<double> poles_1p = bgl1997::poles(t_p, _traits.masses_1p.data(), _traits.n_bound_states_1p.value());
+        const std::vector<double> poles_0m = bgl1997::poles(t_p, _traits.masses_0m.data(), _traits.n_bound_states_0m.value());
+
+        const auto norm = [](const double & K, const double & chi) { return std::sqrt(K * M_PI * chi); };
+
+        // the constrained coefficients are determined once per batch
+        const std::array<BatchedFormFactor, 7> form_factors
+        {{
+            // V = (m_B + m_V) / 2 g
+            { (m_B + m_V) / 2.0 * norm(96.0, _traits.chi_1m), 3, 3, 1, &poles_1m, {{ _a_g[0], _a_g[1], _a_g[2], _a_g[3] }} },
+            // A_0 = F_2 / 2
+            { norm(64.0, _traits.chi_0m) / 2.0, 3, 3, 1, &poles_0m, {{ a_F2_0(), _a_F2[0], _a_F2[1], _a_F2[2] }} },
+            // A_1 = f / (m_B + m_V)
+            { norm(24.0, _traits.chi_1p) / (m_B + m_V), 1, 1, 1, &poles_1p, {{ _a_f[0], _a_f[1], _a_f[2], _a_f[3] }} },
+            // A_12 = F_1 / (8 m_B m_V)
+            { norm(48.0, _traits.chi_1p) / (8.0 * m_B * m_V), 1, 1, 2, &poles_1p, {{ a_F1_0(), _a_F1[0], _a_F1[1], _a_F1[2] }} },
+            { norm(24.0, _traits.chi_T_1m), 3, 3, 2, &poles_1m, {{ _a_T1[0], _a_T1[1], _a_T1[2], _a_T1[3] }} },
+            { norm(24.0 / (t_p * t_m), _traits.chi_T_1p), 1, 1, 2, &poles_1p, {{ a_T2_0(), _a_T2[0], _a_T2[1], _a_T2[2] }} },
+            { norm(3.0 * t_p / (power_of<2>(m_B) * power_of<2>(m_V)), _traits.chi_T_1p), 1, 1, 1, &poles_1p, {{ a_T23_0(), _a_T23[0], _a_T23[1], _a_T23[2] }} }
+        }};
+
+        bgl1997::evaluate(form_factors, t_p, t_m, _traits.t_0(), s, n, results);
+    }
+
     template<typename Process_>
     double BGL1997FormFactors<Process_, PToV>::f_perp(const double & /*s*/) const
     {
@@ -462,6 +587,28 @@ namespace eos
         return 0.0; //  TODO
     }
 
+    template<typename Process_>
+    void BGL1997FormFactors<Process_, PToP>::evaluate(const double * s, const std::size_t & n, double * results) const
+    {
+        using bgl1997::BatchedFormFactor;
+
+        const double t_p = _traits.tp(), t_m = _traits.tm();
+
+        const std::vector<double> poles_1m = bgl1997::poles(t_p, _traits.masses_1m.data(), _traits.n_bound_states_1m.value());
+        const std::vector<double> poles_0p = bgl1997::poles(t_p, _traits.masses_0p.data(), _traits.n_bound_states_0p.value());
+
+        const auto norm = [](const double & K, const double & chi) { return std::sqrt(K * M_PI * chi); };
+
+        const std::array<BatchedFormFactor, 3> form_factors
+        {{
+            { norm(48.0, _traits.chi_1m), 3, 3, 2, &poles_1m, {{ _a_f_p[0], _a_f_p[1], _a_f_p[2], _a_f_p[3] }} },
+            { norm(16.0, _traits.chi_0p), 1, 1, 1, &poles_0p, {{ _a_f_0[0], _a_f_0[1], _a_f_0[2], _a_f_0[3] }} },
+            { norm(48.0 * t_p, _traits.chi_T_1m), 3, 3, 1, &poles_1m, {{ _a_f_t[0], _a_f_t[1], _a_f_t[2], _a_f_t[3] }} }
+        }};
+
+        bgl1997::evaluate(form_factors, t_p, t_m, _traits.t_0(), s, n, results);
+    }
+
     template<typename Process_>
     const std::set<ReferenceName> BGL1997FormFactors<Process_, PToP>::references
     {
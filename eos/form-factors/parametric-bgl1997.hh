@@ -317,6 +317,8 @@ namespace eos
             virtual double f_para_T(const double & s) const;
             virtual double f_long_T(const double & s) const;
 
+            virtual void evaluate(const double * s, const std::size_t & n, double * results) const;
+
             /*!
              * References used in the computation of our (pseudo)observables.
              */
@@ -359,6 +361,8 @@ namespace eos
 
             virtual double f_plus_T(const double & s) const;
 
+            virtual void evaluate(const double * s, const std::size_t & n, double * results) const;
+
             /*!
              * References used in the computation of our (pseudo)observables.
              */
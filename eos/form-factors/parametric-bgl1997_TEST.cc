@@ -269,6 +269,21 @@ class BGL1997FormFactorsTest :
 
                 TEST_CHECK_NEARLY_EQUAL(ff.t_1(0.0),  ff.t_2(0.0),                                                                      eps);
                 TEST_CHECK_NEARLY_EQUAL(ff.t_23(t_m), (mB + mV) * (mB * mB + 3.0 * mV * mV - t_m) / (8.0 * mB * mV * mV) * ff.t_2(t_m), eps);
+
+                // the batched evaluation agrees with the individual form factors
+                const std::vector<double> s{ -2.0, +1.0, +4.0, t_m };
+                std::vector<double> results(7 * s.size());
+                ff.evaluate(s.data(), s.size(), results.data());
+                for (std::size_t j = 0 ; j < s.size() ; ++j)
+                {
+                    TEST_CHECK_RELATIVE_ERROR(results[0 * s.size() + j], ff.v(s[j]),    1.0e-12);
+                    TEST_CHECK_RELATIVE_ERROR(results[1 * s.size() + j], ff.a_0(s[j]),  1.0e-12);
+                    TEST_CHECK_RELATIVE_ERROR(results[2 * s.size() + j], ff.a_1(s[j]),  1.0e-12);
+                    TEST_CHECK_RELATIVE_ERROR(results[3 * s.size() + j], ff.a_12(s[j]), 1.0e-12);
+                    TEST_CHECK_RELATIVE_ERROR(results[4 * s.size() + j], ff.t_1(s[j]),  1.0e-12);
+                    TEST_CHECK_RELATIVE_ERROR(results[5 * s.size() + j], ff.t_2(s[j]),  1.0e-12);
+                    TEST_CHECK_RELATIVE_ERROR(results[6 * s.size() + j], ff.t_23(s[j]), 1.0e-12);
+                }
             }
 
             /* B -> D FFs*/
@@ -340,6 +355,17 @@ class BGL1997FormFactorsTest :
                 TEST_CHECK_NEARLY_EQUAL(ff.f_t(-2.0), 0.158273, eps);
                 TEST_CHECK_NEARLY_EQUAL(ff.f_t(+1.0), 0.172925, eps);
                 TEST_CHECK_NEARLY_EQUAL(ff.f_t(+4.0), 0.190572, eps);
+
+                // the batched evaluation agrees with the individual form factors
+                const std::vector<double> s{ -2.0, +1.0, +4.0 };
+                std::vector<double> results(3 * s.size());
+                ff.evaluate(s.data(), s.size(), results.data());
+                for (std::size_t j = 0 ; j < s.size() ; ++j)
+                {
+                    TEST_CHECK_RELATIVE_ERROR(results[0 * s.size() + j], ff.f_p(s[j]), 1.0e-12);
+                    TEST_CHECK_RELATIVE_ERROR(results[1 * s.size() + j], ff.f_0(s[j]), 1.0e-12);
+                    TEST_CHECK_RELATIVE_ERROR(results[2 * s.size() + j], ff.f_t(s[j]), 1.0e-12);
+                }
             }
 
             /* Adapt the parameters */
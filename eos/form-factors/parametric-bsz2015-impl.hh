@@ -73,6 +73,32 @@ namespace eos
                 (a_0 + a_1 * diff_z + a_2 * power_of<2>(diff_z));
     }
 
+    template <typename Process_>
+    ZExpansionKernel<7, 3>
+    BSZ2015FormFactors<Process_, PToV>::_kernel() const
+    {
+        ZExpansionKernel<7, 3> result;
+
+        result.t_p   = _traits.tp();
+        result.t_0   = _traits.t0();
+        result.z_ref = _traits.calc_z(0.0);
+
+        const double m2_R_0m = power_of<2>(_traits.m_R_0m()), m2_R_1m = power_of<2>(_traits.m_R_1m()), m2_R_1p = power_of<2>(_traits.m_R_1p());
+        result.inverse_m2_R = {{ 1.0 / m2_R_1m, 1.0 / m2_R_0m, 1.0 / m2_R_1p, 1.0 / m2_R_1p, 1.0 / m2_R_1m, 1.0 / m2_R_1p, 1.0 / m2_R_1p }};
+
+        result.a[0] = {{ _a_V[0],   _a_V[1],   _a_V[2]   }};
+        result.a[1] = {{ _a_A0[0],  _a_A0[1],  _a_A0[2]  }};
+        result.a[2] = {{ _a_A1[0],  _a_A1[1],  _a_A1[2]  }};
+        // use constraint (B.6) in [BSZ:2015A] to remove A_12(0)
+        result.a[3] = {{ (power_of<2>(_mB) - power_of<2>(_mV)) / (8.0 * _mB * _mV) * _a_A0[0], _a_A12[0], _a_A12[1] }};
+        result.a[4] = {{ _a_T1[0],  _a_T1[1],  _a_T1[2]  }};
+        // use constraint T_1(0) = T_2(0) to replace T_2(0)
+        result.a[5] = {{ _a_T1[0],  _a_T2[0],  _a_T2[1]  }};
+        result.a[6] = {{ _a_T23[0], _a_T23[1], _a_T23[2] }};
+
+        return result;
+    }
+
     template <typename Process_>
     std::string
     BSZ2015FormFactors<Process_, PToV>::_par_name(const std::string & ff_name)
@@ -312,6 +338,14 @@ namespace eos
     }
 
 
+    template <typename Process_>
+    void
+    BSZ2015FormFactors<Process_, PToV>::evaluate(const double * s, const std::size_t & n, double * results) const
+    {
+        _kernel()(s, n, results);
+    }
+
+
     // P -> P
     template <typename Process_>
     const std::map<std::tuple<QuarkFlavor, QuarkFlavor>, std::string>
@@ -349,6 +383,27 @@ namespace eos
                 (a_0 + a_1 * diff_z + a_2 * power_of<2>(diff_z));
     }
 
+    template <typename Process_>
+    ZExpansionKernel<3, 3>
+    BSZ2015FormFactors<Process_, PToP>::_kernel() const
+    {
+        ZExpansionKernel<3, 3> result;
+
+        result.t_p   = _traits.tp();
+        result.t_0   = _traits.t0();
+        result.z_ref = _traits.calc_z(0.0);
+
+        const double m2_R_0p = power_of<2>(_traits.m_R_0p()), m2_R_1m = power_of<2>(_traits.m_R_1m());
+        result.inverse_m2_R = {{ 1.0 / m2_R_1m, 1.0 / m2_R_0p, 1.0 / m2_R_1m }};
+
+        result.a[0] = {{ _a_fp[0], _a_fp[1], _a_fp[2] }};
+        // use equation of motion to replace f_0(0) by f_+(0)
+        result.a[1] = {{ _a_fp[0], _a_fz[0], _a_fz[1] }};
+        result.a[2] = {{ _a_ft[0], _a_ft[1], _a_ft[2] }};
+
+        return result;
+    }
+
     template <typename Process_>
     std::string
     BSZ2015FormFactors<Process_, PToP>::_par_name(const std::string & ff_name)
@@ -447,6 +502,13 @@ namespace eos
     {
         return real(f_plus_T(complex<double>(s)));
     }
+
+    template <typename Process_>
+    void
+    BSZ2015FormFactors<Process_, PToP>::evaluate(const double * s, const std::size_t & n, double * results) const
+    {
+        _kernel()(s, n, results);
+    }
 }
 
 #endif
@@ -22,6 +22,7 @@
 
 #include <eos/form-factors/mesonic.hh>
 #include <eos/form-factors/mesonic-processes.hh>
+#include <eos/form-factors/z-expansion-kernel.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/utils/kinematic.hh>
 #include <eos/utils/options.hh>
@@ -102,6 +103,9 @@ namespace eos
             template <typename Parameter_>
             complex<double> _calc_ff(const complex<double> & s, const double & m2_R, const std::array<Parameter_, 3> & a) const;
 
+            // snapshot of the current coefficients of V, A_0, A_1, A_12, T_1, T_2 and T_23
+            ZExpansionKernel<7, 3> _kernel() const;
+
             static std::string _par_name(const std::string & ff_name);
 
         public:
@@ -156,6 +160,8 @@ namespace eos
             virtual double f_para_T(const double & s) const;
 
             virtual double f_long_T(const double & s) const;
+
+            virtual void evaluate(const double * s, const std::size_t & n, double * results) const;
     };
 
     extern template class BSZ2015FormFactors<BToDstar, PToV>;
@@ -232,6 +238,9 @@ namespace eos
             template <typename Parameter_>
             complex<double> _calc_ff(const complex<double> & s, const double & m2_R, const std::array<Parameter_, 3> & a) const;
 
+            // snapshot of the current coefficients of f_+, f_0 and f_T
+            ZExpansionKernel<3, 3> _kernel() const;
+
             static std::string _par_name(const std::string & ff_name);
 
         public:
@@ -250,6 +259,8 @@ namespace eos
             virtual double f_t(const double & s) const;
             virtual double f_0(const double & s) const;
             virtual double f_plus_T(const double & s) const;
+
+            virtual void evaluate(const double * s, const std::size_t & n, double * results) const;
     };
 
     extern template class BSZ2015FormFactors<BToD, PToP>;
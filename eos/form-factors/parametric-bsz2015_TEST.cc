@@ -21,6 +21,8 @@
 #include <test/test.hh>
 #include <eos/form-factors/parametric-bsz2015-impl.hh>
 
+#include <vector>
+
 using namespace test;
 using namespace eos;
 
@@ -81,6 +83,18 @@ class BToPiBSZ2015FormFactorsTest :
                 TEST_CHECK_NEARLY_EQUAL(ff->f_t(10.0), 1.73442, eps);
                 TEST_CHECK_NEARLY_EQUAL(ff->f_t(15.0), 2.64425, eps);
                 TEST_CHECK_NEARLY_EQUAL(ff->f_t(20.0), 4.99850, eps);
+
+                // batch evaluation agrees with the individual form factors
+                const std::vector<double> s{ 0.0, 5.0, 10.0, 15.0, 20.0 };
+                std::vector<double> results(3 * s.size());
+                ff->evaluate(s.data(), s.size(), results.data());
+
+                for (std::size_t j = 0 ; j < s.size() ; ++j)
+                {
+                    TEST_CHECK_RELATIVE_ERROR(results[0 * s.size() + j], ff->f_p(s[j]), 1e-12);
+                    TEST_CHECK_RELATIVE_ERROR(results[1 * s.size() + j], ff->f_0(s[j]), 1e-12);
+                    TEST_CHECK_RELATIVE_ERROR(results[2 * s.size() + j], ff->f_t(s[j]), 1e-12);
+                }
             }
         }
 } b_to_pi_bsz2015_form_factors_test;
@@ -236,6 +250,25 @@ class BToKstarBSZ2015FormFactorsTest :
             TEST_CHECK_NEARLY_EQUAL(ff->t_3(2.1), 0.200925, eps);
             TEST_CHECK_NEARLY_EQUAL(ff->t_3(4.1), 0.219004, eps);
             TEST_CHECK_NEARLY_EQUAL(ff->t_3(6.1), 0.239587, eps);
+
+            // batch evaluation agrees with the individual form factors
+            {
+                const std::vector<double> q2{ -2.0, 0.0, 0.1, 2.1, 4.1, 6.1, 8.0, 12.0, 15.0, 19.0 };
+                const std::size_t n = q2.size();
+                std::vector<double> results(7 * n);
+                ff->evaluate(q2.data(), n, results.data());
+
+                for (std::size_t j = 0 ; j < n ; ++j)
+                {
+                    TEST_CHECK_RELATIVE_ERROR(results[0 * n + j], ff->v(q2[j]),    1e-12);
+                    TEST_CHECK_RELATIVE_ERROR(results[1 * n + j], ff->a_0(q2[j]),  1e-12);
+                    TEST_CHECK_RELATIVE_ERROR(results[2 * n + j], ff->a_1(q2[j]),  1e-12);
+                    TEST_CHECK_RELATIVE_ERROR(results[3 * n + j], ff->a_12(q2[j]), 1e-12);
+                    TEST_CHECK_RELATIVE_ERROR(results[4 * n + j], ff->t_1(q2[j]),  1e-12);
+                    TEST_CHECK_RELATIVE_ERROR(results[5 * n + j], ff->t_2(q2[j]),  1e-12);
+                    TEST_CHECK_RELATIVE_ERROR(results[6 * n + j], ff->t_23(q2[j]), 1e-12);
+                }
+            }
         }
 } b_to_kstar_bsz2015_form_factors_test;
 
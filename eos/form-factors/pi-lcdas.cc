@@ -18,6 +18,7 @@
  */
 
 #include <eos/form-factors/pi-lcdas.hh>
+#include <eos/form-factors/lcda.hh>
 #include <eos/models/model.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 #include <eos/utils/qcd.hh>
@@ -30,6 +31,8 @@ namespace eos
     {
         std::shared_ptr<Model> model;
 
+        Parameters parameters;
+
         // twist 2 (even) Gegenbauer coefficients at mu = 1 GeV
         UsedParameter a2pi_0;
         UsedParameter a4pi_0;
@@ -53,6 +56,7 @@ namespace eos
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             model(Model::make("SM", p, o)),
+            parameters(p),
             a2pi_0(p["pi::a2@1GeV"], u),
             a4pi_0(p["pi::a4@1GeV"], u),
             f3pi_0(p["pi::f3@1GeV"], u),
@@ -67,7 +71,7 @@ namespace eos
         {
         }
 
-        inline double c_rge(const double & _mu) const
+        inline double c_rge(const double & mu) const
         {
             /*
              * RGE coefficient, basically
@@ -75,27 +79,9 @@ namespace eos
              *     (alpha_s/alpha_s_0)^(1/beta_0),
              *
              * with matching between the individual n-flavor QCDs.
+             * Shared with all other LCDAs that use the same parameters.
              */
-
-            double mu = _mu, alpha_s_mu = model->alpha_s(mu);
-            double mu_0 = 1.0, alpha_s_0 = model->alpha_s(mu_0);
-
-            if (mu < _mu_c)
-                return std::pow(alpha_s_mu / alpha_s_0, 1.0 / QCD::beta_function_nf_3[0]);
-
-            double alpha_s_c = model->alpha_s(_mu_c);
-            double result = std::pow(alpha_s_c / alpha_s_0, 1.0 / QCD::beta_function_nf_3[0]);
-
-            if (mu < _mu_b)
-                return result * std::pow(alpha_s_mu / alpha_s_c, 1.0 / QCD::beta_function_nf_4[0]);
-
-            double alpha_s_b = model->alpha_s(_mu_b);
-            result *= std::pow(alpha_s_b / alpha_s_c, 1.0 / QCD::beta_function_nf_4[0]);
-
-            if (mu < _mu_t)
-                return result * std::pow(alpha_s_mu / alpha_s_b, 1.0 / QCD::beta_function_nf_5[0]);
-
-            throw InternalError("Implementation<PionLCDAs>: RGE coefficient must not be evolved above mu_t = " + stringify(_mu_t()));
+            return LCDA::rge_coefficient(parameters, *model, mu, _mu_c, _mu_b, _mu_t);
         }
 
         inline double a2pi(const double & mu) const
@@ -220,6 +206,12 @@ namespace eos
         return 6.0 * u * (1.0 - u) * (1.0 + _imp->a2pi(mu) * c2 + _imp->a4pi(mu) * c4);
     }
 
+    void
+    PionLCDAs::phi(const double * u, const std::size_t & n, const double & mu, double * results) const
+    {
+        LCDA::twist2({ 1.0, 0.0, _imp->a2pi(mu), 0.0, _imp->a4pi(mu) }, u, n, results);
+    }
+
     double
     PionLCDAs::phi3p(const double & u, const double & mu) const
     {
@@ -198,5 +198,44 @@ class PionLCDAsTest :
                 TEST_CHECK_NEARLY_EQUAL(pi.phi4_d2(0.2, 2.0), -1.686311876,    eps);
                 TEST_CHECK_NEARLY_EQUAL(pi.phi4_d2(0.3, 2.0), -5.678881509,    eps);
             }
+
+            /* Batched evaluation */
+            {
+                PionLCDAs pi(p, Options{ });
+
+                std::vector<double> u(100), results(100);
+                for (std::size_t j = 0 ; j < u.size() ; ++j)
+                {
+                    u[j] = (j + 0.5) / u.size();
+                }
+
+                for (const double mu : { 1.0, 2.0, 3.0 })
+                {
+                    pi.phi(u.data(), u.size(), mu, results.data());
+
+                    for (std::size_t j = 0 ; j < u.size() ; ++j)
+                    {
+                        TEST_CHECK_NEARLY_EQUAL(results[j], pi.phi(u[j], mu), 1e-12);
+                    }
+                }
+            }
+
+            /* Shared RGE coefficients */
+            {
+                Parameters q = p.clone();
+                PionLCDAs pi1(q, Options{ });
+                PionLCDAs pi2(q, Options{ });
+
+                const double a2 = pi1.a2(2.0);
+                TEST_CHECK_EQUAL(pi2.a2(2.0), a2);
+
+                // a change of the parameters invalidates the cached coefficients
+                q["QCD::alpha_s(MZ)"] = 0.1200;
+                PionLCDAs pi3(q.clone(), Options{ });
+
+                TEST_CHECK(std::abs(pi1.a2(2.0) - a2) > 1e-5);
+                TEST_CHECK_NEARLY_EQUAL(pi1.a2(2.0), pi3.a2(2.0), 1e-14);
+                TEST_CHECK_NEARLY_EQUAL(pi2.a4(3.0), pi3.a4(3.0), 1e-14);
+            }
         }
 } pi_lcdas_test;
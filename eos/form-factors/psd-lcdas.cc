@@ -30,6 +30,15 @@ namespace eos
     {
     }
 
+    void
+    PseudoscalarLCDAs::phi(const double * u, const std::size_t & n, const double & mu, double * results) const
+    {
+        for (std::size_t j = 0 ; j < n ; ++j)
+        {
+            results[j] = this->phi(u[j], mu);
+        }
+    }
+
     std::shared_ptr<PseudoscalarLCDAs>
     PseudoscalarLCDAs::make(const std::string & name, const Parameters & parameters, const Options & options)
     {
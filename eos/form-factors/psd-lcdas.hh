@@ -23,6 +23,8 @@
 #include <eos/utils/parameters.hh>
 #include <eos/utils/options.hh>
 
+#include <cstddef>
+
 namespace eos
 {
     class PseudoscalarLCDAs :
@@ -52,6 +54,9 @@ namespace eos
             /* Twist 2 LCDA */
             virtual double phi(const double & u, const double & mu) const = 0;
 
+            /* Twist 2 LCDA at the n points u; results[j] = phi(u[j], mu) */
+            virtual void phi(const double * u, const std::size_t & n, const double & mu, double * results) const;
+
             /* Twist 3 LCDAs and their derivatives */
             virtual double phi3p(const double & u, const double & mu) const = 0;
             virtual double phi3s(const double & u, const double & mu) const = 0;
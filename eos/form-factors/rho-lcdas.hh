@@ -78,6 +78,8 @@ namespace eos
             /* Twist 2 LCDAs */
             double phi2para(const double & u, const double & mu) const override;
             double phi2perp(const double & u, const double & mu) const override;
+            void phi2para(const double * u, const std::size_t & n, const double & mu, double * results) const override;
+            void phi2perp(const double * u, const std::size_t & n, const double & mu, double * results) const override;
 
             /* Twist 3 two particle LCDAs */
             virtual double phi3para(const double & u, const double & mu) const override;
@@ -28,7 +28,11 @@
 
 #include <gsl/gsl_sf_dilog.h>
 
+#include <atomic>
 #include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
 
 #include <iostream>
 
@@ -91,6 +95,9 @@ namespace eos
         UsedParameter l5sone, l5spone, l5sppone;
         UsedParameter l6sone, l6spone, l6sppone;
 
+        // parameters on which the coefficients for q=u,d and q=s depend
+        ParameterUser user_ud, user_s;
+
         static const std::vector<OptionSpecification> options;
 
         std::string _sslp_prefix()
@@ -162,6 +169,27 @@ namespace eos
             l6spone(p[_sslp_prefix() + "::l_6'(1)@HQET"], u),
             l6sppone(p[_sslp_prefix() + "::l_6''(1)@HQET"], u)
         {
+            for (const UsedParameter * parameter : {
+                    &xipone, &xippone, &xipppone, &chi2one, &chi2pone, &chi2ppone,
+                    &chi3pone, &chi3ppone, &etaone, &etapone, &etappone, &l1one,
+                    &l1pone, &l1ppone, &l2one, &l2pone, &l2ppone, &l3one,
+                    &l3pone, &l3ppone, &l4one, &l4pone, &l4ppone, &l5one,
+                    &l5pone, &l5ppone, &l6one, &l6pone, &l6ppone
+                })
+            {
+                user_ud.uses(parameter->id());
+            }
+
+            for (const UsedParameter * parameter : {
+                    &xispone, &xisppone, &xispppone, &chi2sone, &chi2spone, &chi2sppone,
+                    &chi3spone, &chi3sppone, &etasone, &etaspone, &etasppone, &l1sone,
+                    &l1spone, &l1sppone, &l2sone, &l2spone, &l2sppone, &l3sone,
+                    &l3spone, &l3sppone, &l4sone, &l4spone, &l4sppone, &l5sone,
+                    &l5spone, &l5sppone, &l6sone, &l6spone, &l6sppone
+                })
+            {
+                user_s.uses(parameter->id());
+            }
         }
 
         ~Implementation() = default;
@@ -2476,6 +2504,18 @@ namespace eos
     double BGLCoefficients::T10s_a2() const { return _imp->T10s_a2(); }
     // }}}
 
+    const ParameterUser &
+    BGLCoefficients::parameters_ud() const
+    {
+        return _imp->user_ud;
+    }
+
+    const ParameterUser &
+    BGLCoefficients::parameters_s() const
+    {
+        return _imp->user_s;
+    }
+
     std::vector<OptionSpecification>::const_iterator
     BGLCoefficients::begin_options()
     {
@@ -2488,6 +2528,95 @@ namespace eos
         return Implementation<BGLCoefficients>::options.cend();
     }
 
+    namespace impl
+    {
+        // detects changes to the values of a group of parameters since the last call to update()
+        class ParameterSnapshot
+        {
+            private:
+                std::vector<Parameter> _parameters;
+
+                std::vector<double> _values;
+
+            public:
+                ParameterSnapshot(const Parameters & p, const ParameterUser & user)
+                {
+                    for (const auto & id : user)
+                    {
+                        _parameters.push_back(p[id]);
+                    }
+
+                    _values.resize(_parameters.size(), std::numeric_limits<double>::quiet_NaN());
+                }
+
+                bool update()
+                {
+                    bool changed = false;
+                    for (std::size_t i = 0 ; i < _parameters.size() ; ++i)
+                    {
+                        const double value = _parameters[i].evaluate();
+                        if (value != _values[i]) // also true for the initial NaN
+                        {
+                            _values[i] = value;
+                            changed = true;
+                        }
+                    }
+
+                    return changed;
+                }
+        };
+
+        // sum of squares that is updated one term at a time, only for the terms that change
+        class IncrementalSumOfSquares
+        {
+            private:
+                std::vector<double> _values;
+
+                double _sum;
+
+                // number of incremental updates since the sum was last computed from scratch
+                unsigned _updates;
+
+                void _resum()
+                {
+                    _sum = 0.0;
+                    for (const auto & value : _values)
+                    {
+                        _sum += value * value;
+                    }
+
+                    _updates = 0;
+                }
+
+            public:
+                IncrementalSumOfSquares(const std::size_t & size) :
+                    _values(size, 0.0),
+                    _sum(0.0),
+                    _updates(0)
+                {
+                }
+
+                void set(const std::size_t & index, const double & value)
+                {
+                    const double old_value = _values[index];
+                    if (value == old_value)
+                        return;
+
+                    _values[index] = value;
+                    _sum += (value - old_value) * (value + old_value);
+
+                    // bound the accumulation of rounding errors
+                    if (++_updates > 1024u)
+                        _resum();
+                }
+
+                double sum() const
+                {
+                    return _sum;
+                }
+        };
+    }
+
     template <> struct Implementation<HQETUnitarityBounds>
     {
         // option to determine if we use z^3 terms in the leading-power IW function
@@ -2500,13 +2629,58 @@ namespace eos
 
         std::shared_ptr<BGLCoefficients> bgl;
 
+        using Coefficient = double (BGLCoefficients::*)() const;
+
+        // per-bound partial sums for spectator quarks q=u,d and q=s, which are only
+        // recomputed when the parameters of the respective spectator change
+        struct PartialSums
+        {
+            impl::ParameterSnapshot snapshot_ud, snapshot_s;
+
+            impl::IncrementalSumOfSquares sum_ud, sum_s;
+
+            PartialSums(const Parameters & p, const BGLCoefficients & bgl) :
+                snapshot_ud(p, bgl.parameters_ud()),
+                snapshot_s(p, bgl.parameters_s()),
+                sum_ud(7 * 3),
+                sum_s(7 * 3)
+            {
+            }
+        };
+
+        struct State
+        {
+            PartialSums sums_0p, sums_0m, sums_1p, sums_1m, sums_1p_T, sums_1m_T;
+
+            State(const Parameters & p, const BGLCoefficients & bgl) :
+                sums_0p(p, bgl),
+                sums_0m(p, bgl),
+                sums_1p(p, bgl),
+                sums_1m(p, bgl),
+                sums_1p_T(p, bgl),
+                sums_1m_T(p, bgl)
+            {
+            }
+        };
+
+        Parameters parameters;
+
+        // identifies this object among the per-thread states; never reused
+        const unsigned long id;
+
+        // expires with this object, so that the per-thread states can be discarded
+        std::shared_ptr<const bool> alive;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             opt_zorder_bound(o, "z-order-bound"_ok, { "1", "2" }, "2"),
             nf(p["B(*)->D(*)::n_f@HQET"], u),
             ns(p["B_s(*)->D_s(*)::n_s@HQET"], u),
-            bgl(new BGLCoefficients(p, o))
+            bgl(new BGLCoefficients(p, o)),
+            parameters(p),
+            id(next_id()),
+            alive(std::make_shared<const bool>(true))
         {
             if ("1" == opt_zorder_bound.value())
             {
@@ -2524,347 +2698,311 @@ namespace eos
 
         ~Implementation() = default;
 
+        static unsigned long next_id()
+        {
+            static std::atomic<unsigned long> counter(0);
+
+            return counter.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Each thread keeps its own partial sums, so that concurrent evaluations neither share nor lock any state.
+        State & state() const
+        {
+            struct Entry
+            {
+                unsigned long id;
+
+                std::weak_ptr<const bool> alive;
+
+                std::unique_ptr<State> state;
+            };
+
+            thread_local std::vector<Entry> entries;
+
+            for (auto & e : entries)
+            {
+                if (id == e.id)
+                    return *e.state;
+            }
+
+            // discard the states of destroyed objects
+            std::erase_if(entries, [](const Entry & e) { return e.alive.expired(); });
+
+            entries.push_back(Entry{ id, alive, std::make_unique<State>(parameters, *bgl) });
+
+            return *entries.back().state;
+        }
+
+        template <std::size_t n_>
+        static void update_sum(impl::IncrementalSumOfSquares & sum, const BGLCoefficients & bgl, const unsigned & zorder_bound,
+                const std::array<std::array<Coefficient, 3>, n_> & coefficients)
+        {
+            for (std::size_t ff = 0 ; ff < n_ ; ++ff)
+            {
+                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
+                {
+                    sum.set(3 * ff + i, (bgl.*coefficients[ff][i])());
+                }
+            }
+        }
+
+        template <std::size_t n_>
+        double evaluate(PartialSums & sums,
+                const std::array<std::array<Coefficient, 3>, n_> & coefficients_ud,
+                const std::array<std::array<Coefficient, 3>, n_> & coefficients_s) const
+        {
+            if (sums.snapshot_ud.update())
+            {
+                update_sum(sums.sum_ud, *bgl, zorder_bound, coefficients_ud);
+            }
+
+            if (sums.snapshot_s.update())
+            {
+                update_sum(sums.sum_s, *bgl, zorder_bound, coefficients_s);
+            }
+
+            // to account for flavor symmetry
+            return sums.sum_ud.sum() * nf + sums.sum_s.sum() * ns;
+        }
+
         // bounds up to z^2
         // {{{
         double bound_0p() const
         {
             // 3 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=u,d
-            const std::array<std::array<double, 3>, 3> bgl_coeffs_ud
+            static const std::array<std::array<Coefficient, 3>, 3> bgl_coeffs_ud
             {{
                 // B -> D S_1
-                { bgl->S1_a0(), bgl->S1_a1(), bgl->S1_a2() },
+                { &BGLCoefficients::S1_a0, &BGLCoefficients::S1_a1, &BGLCoefficients::S1_a2 },
                 // B^* -> D^* S_2
-                { bgl->S2_a0(), bgl->S2_a1(), bgl->S2_a2() },
+                { &BGLCoefficients::S2_a0, &BGLCoefficients::S2_a1, &BGLCoefficients::S2_a2 },
                 // B^* -> D^* S_3
-                { bgl->S3_a0(), bgl->S3_a1(), bgl->S3_a2() }
+                { &BGLCoefficients::S3_a0, &BGLCoefficients::S3_a1, &BGLCoefficients::S3_a2 }
             }};
 
-            double result = 0.0;
-            for (const auto & ff : bgl_coeffs_ud)
-            {
-                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-                {
-                    result += power_of<2>(ff[i]) * nf; // to account for flavor symmetry
-                }
-            }
-
             // 3 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=s
-            const std::array<std::array<double, 3>, 3> bgl_coeffs_s
+            static const std::array<std::array<Coefficient, 3>, 3> bgl_coeffs_s
             {{
                 // B_s -> D_s S_1
-                { bgl->S1s_a0(), bgl->S1s_a1(), bgl->S1s_a2() },
+                { &BGLCoefficients::S1s_a0, &BGLCoefficients::S1s_a1, &BGLCoefficients::S1s_a2 },
                 // B_s^* -> D_s^* S_2
-                { bgl->S2s_a0(), bgl->S2s_a1(), bgl->S2s_a2() },
+                { &BGLCoefficients::S2s_a0, &BGLCoefficients::S2s_a1, &BGLCoefficients::S2s_a2 },
                 // B_s^* -> D_s^* S_3
-                { bgl->S3s_a0(), bgl->S3s_a1(), bgl->S3s_a2() }
+                { &BGLCoefficients::S3s_a0, &BGLCoefficients::S3s_a1, &BGLCoefficients::S3s_a2 }
             }};
 
-            for (const auto & ff : bgl_coeffs_s)
-            {
-                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-                {
-                    result += power_of<2>(ff[i]) * ns;
-                }
-            }
-
-            return result;
+            return evaluate(state().sums_0p, bgl_coeffs_ud, bgl_coeffs_s);
         }
 
         double bound_0m() const
         {
             // 3 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=u,d
-            const std::array<std::array<double, 3>, 3> bgl_coeffs_ud
+            static const std::array<std::array<Coefficient, 3>, 3> bgl_coeffs_ud
             {{
                 // B -> D^* P_1
-                { bgl->P1_a0(), bgl->P1_a1(), bgl->P1_a2() },
+                { &BGLCoefficients::P1_a0, &BGLCoefficients::P1_a1, &BGLCoefficients::P1_a2 },
                 // B^* -> D P_2
-                { bgl->P2_a0(), bgl->P2_a1(), bgl->P2_a2() },
+                { &BGLCoefficients::P2_a0, &BGLCoefficients::P2_a1, &BGLCoefficients::P2_a2 },
                 // B^* -> D^* P_3
-                { bgl->P3_a0(), bgl->P3_a1(), bgl->P3_a2() }
+                { &BGLCoefficients::P3_a0, &BGLCoefficients::P3_a1, &BGLCoefficients::P3_a2 }
             }};
 
-            double result = 0.0;
-            for (const auto & ff : bgl_coeffs_ud)
-            {
-                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-                {
-                    result += power_of<2>(ff[i]) * nf; // to account for flavor symmetry
-                }
-            }
-
             // 3 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=s
-            const std::array<std::array<double, 3>, 3> bgl_coeffs_s
+            static const std::array<std::array<Coefficient, 3>, 3> bgl_coeffs_s
             {{
                 // B_s -> D_s S_1
-                { bgl->P1s_a0(), bgl->P1s_a1(), bgl->P1s_a2() },
+                { &BGLCoefficients::P1s_a0, &BGLCoefficients::P1s_a1, &BGLCoefficients::P1s_a2 },
                 // B_s^* -> D_s^* S_2
-                { bgl->P2s_a0(), bgl->P2s_a1(), bgl->P2s_a2() },
+                { &BGLCoefficients::P2s_a0, &BGLCoefficients::P2s_a1, &BGLCoefficients::P2s_a2 },
                 // B_s^* -> D_s^* S_3
-                { bgl->P3s_a0(), bgl->P3s_a1(), bgl->P3s_a2() }
+                { &BGLCoefficients::P3s_a0, &BGLCoefficients::P3s_a1, &BGLCoefficients::P3s_a2 }
             }};
 
-            for (const auto & ff : bgl_coeffs_s)
-            {
-                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-                {
-                    result += power_of<2>(ff[i]) * ns;
-                }
-            }
-
-            return result;
+            return evaluate(state().sums_0m, bgl_coeffs_ud, bgl_coeffs_s);
         }
 
         double bound_1p() const
         {
             // 7 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=u,d
-            const std::array<std::array<double, 3>, 7> bgl_coeffs_ud
+            static const std::array<std::array<Coefficient, 3>, 7> bgl_coeffs_ud
             {{
                 // B -> D V_1
-                { bgl->V1_a0(), bgl->V1_a1(), bgl->V1_a2() },
+                { &BGLCoefficients::V1_a0, &BGLCoefficients::V1_a1, &BGLCoefficients::V1_a2 },
                 // B -> D^* V_2
-                { bgl->V2_a0(), bgl->V2_a1(), bgl->V2_a2() },
+                { &BGLCoefficients::V2_a0, &BGLCoefficients::V2_a1, &BGLCoefficients::V2_a2 },
                 // B^* -> D V_3
-                { bgl->V3_a0(), bgl->V3_a1(), bgl->V3_a2() },
+                { &BGLCoefficients::V3_a0, &BGLCoefficients::V3_a1, &BGLCoefficients::V3_a2 },
                 // B^* -> D^* V_4
-                { bgl->V4_a0(), bgl->V4_a1(), bgl->V4_a2() },
+                { &BGLCoefficients::V4_a0, &BGLCoefficients::V4_a1, &BGLCoefficients::V4_a2 },
                 // B^* -> D^* V_5
-                { bgl->V5_a0(), bgl->V5_a1(), bgl->V5_a2() },
+                { &BGLCoefficients::V5_a0, &BGLCoefficients::V5_a1, &BGLCoefficients::V5_a2 },
                 // B^* -> D^* V_6
-                { bgl->V6_a0(), bgl->V6_a1(), bgl->V6_a2() },
+                { &BGLCoefficients::V6_a0, &BGLCoefficients::V6_a1, &BGLCoefficients::V6_a2 },
                 // B^* -> D^* V_7
-                { bgl->V7_a0(), bgl->V7_a1(), bgl->V7_a2() }
+                { &BGLCoefficients::V7_a0, &BGLCoefficients::V7_a1, &BGLCoefficients::V7_a2 }
             }};
 
-            double result = 0.0;
-            for (const auto & ff : bgl_coeffs_ud)
-            {
-                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-                {
-                    result += power_of<2>(ff[i]) * nf; // to account for flavor symmetry
-                }
-            }
-
             // 7 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=s
-            const std::array<std::array<double, 3>, 7> bgl_coeffs_s
+            static const std::array<std::array<Coefficient, 3>, 7> bgl_coeffs_s
             {{
                 // B_s -> D_s V_1
-                { bgl->V1s_a0(), bgl->V1s_a1(), bgl->V1s_a2() },
+                { &BGLCoefficients::V1s_a0, &BGLCoefficients::V1s_a1, &BGLCoefficients::V1s_a2 },
                 // B_s -> D_s^* V_2
-                { bgl->V2s_a0(), bgl->V2s_a1(), bgl->V2s_a2() },
+                { &BGLCoefficients::V2s_a0, &BGLCoefficients::V2s_a1, &BGLCoefficients::V2s_a2 },
                 // B_s^* -> D_s V_3
-                { bgl->V3s_a0(), bgl->V3s_a1(), bgl->V3s_a2() },
+                { &BGLCoefficients::V3s_a0, &BGLCoefficients::V3s_a1, &BGLCoefficients::V3s_a2 },
                 // B_s^* -> D_s^* V_4
-                { bgl->V4s_a0(), bgl->V4s_a1(), bgl->V4s_a2() },
+                { &BGLCoefficients::V4s_a0, &BGLCoefficients::V4s_a1, &BGLCoefficients::V4s_a2 },
                 // B_s^* -> D_s^* V_5
-                { bgl->V5s_a0(), bgl->V5s_a1(), bgl->V5s_a2() },
+                { &BGLCoefficients::V5s_a0, &BGLCoefficients::V5s_a1, &BGLCoefficients::V5s_a2 },
                 // B_s^* -> D_s^* V_6
-                { bgl->V6s_a0(), bgl->V6s_a1(), bgl->V6s_a2() },
+                { &BGLCoefficients::V6s_a0, &BGLCoefficients::V6s_a1, &BGLCoefficients::V6s_a2 },
                 // B_s^* -> D_s^* V_7
-                { bgl->V7s_a0(), bgl->V7s_a1(), bgl->V7s_a2() }
+                { &BGLCoefficients::V7s_a0, &BGLCoefficients::V7s_a1, &BGLCoefficients::V7s_a2 }
             }};
 
-            for (const auto & ff : bgl_coeffs_s)
-            {
-                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-                {
-                    result += power_of<2>(ff[i]) * ns;
-                }
-            }
-
-            return result;
+            return evaluate(state().sums_1p, bgl_coeffs_ud, bgl_coeffs_s);
         }
 
         double bound_1m() const
         {
             // 3 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=u,d
-            const std::array<std::array<double, 3>, 7> bgl_coeffs_ud
+            static const std::array<std::array<Coefficient, 3>, 7> bgl_coeffs_ud
             {{
                 // B -> D^* A_1
-                { bgl->A1_a0(), bgl->A1_a1(), bgl->A1_a2() },
+                { &BGLCoefficients::A1_a0, &BGLCoefficients::A1_a1, &BGLCoefficients::A1_a2 },
                 // B^* -> D A_2
-                { bgl->A2_a0(), bgl->A2_a1(), bgl->A2_a2() },
+                { &BGLCoefficients::A2_a0, &BGLCoefficients::A2_a1, &BGLCoefficients::A2_a2 },
                 // B^* -> D^* A_3
-                { bgl->A3_a0(), bgl->A3_a1(), bgl->A3_a2() },
+                { &BGLCoefficients::A3_a0, &BGLCoefficients::A3_a1, &BGLCoefficients::A3_a2 },
                 // B^* -> D^* A_4
-                { bgl->A4_a0(), bgl->A4_a1(), bgl->A4_a2() },
+                { &BGLCoefficients::A4_a0, &BGLCoefficients::A4_a1, &BGLCoefficients::A4_a2 },
                 // B -> D^* A_5
-                { bgl->A5_a0(), bgl->A5_a1(), bgl->A5_a2() },
+                { &BGLCoefficients::A5_a0, &BGLCoefficients::A5_a1, &BGLCoefficients::A5_a2 },
                 // B^* -> D A_6
-                { bgl->A6_a0(), bgl->A6_a1(), bgl->A6_a2() },
+                { &BGLCoefficients::A6_a0, &BGLCoefficients::A6_a1, &BGLCoefficients::A6_a2 },
                 // B^* -> D^* A_7
-                { bgl->A7_a0(), bgl->A7_a1(), bgl->A7_a2() }
+                { &BGLCoefficients::A7_a0, &BGLCoefficients::A7_a1, &BGLCoefficients::A7_a2 }
             }};
 
-            double result = 0.0;
-            for (const auto & ff : bgl_coeffs_ud)
-            {
-                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-                {
-                    result += power_of<2>(ff[i]) * nf; // to account for flavor symmetry
-                }
-            }
-
             // 7 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=s
-            const std::array<std::array<double, 3>, 7> bgl_coeffs_s
+            static const std::array<std::array<Coefficient, 3>, 7> bgl_coeffs_s
             {{
                 // B_s -> D_s^* A_1
-                { bgl->A1s_a0(), bgl->A1s_a1(), bgl->A1s_a2() },
+                { &BGLCoefficients::A1s_a0, &BGLCoefficients::A1s_a1, &BGLCoefficients::A1s_a2 },
                 // B_s^* -> D_s A_2
-                { bgl->A2s_a0(), bgl->A2s_a1(), bgl->A2s_a2() },
+                { &BGLCoefficients::A2s_a0, &BGLCoefficients::A2s_a1, &BGLCoefficients::A2s_a2 },
                 // B_s^* -> D_s^* A_3
-                { bgl->A3s_a0(), bgl->A3s_a1(), bgl->A3s_a2() },
+                { &BGLCoefficients::A3s_a0, &BGLCoefficients::A3s_a1, &BGLCoefficients::A3s_a2 },
                 // B_s^* -> D_s^* A_4
-                { bgl->A4s_a0(), bgl->A4s_a1(), bgl->A4s_a2() },
+                { &BGLCoefficients::A4s_a0, &BGLCoefficients::A4s_a1, &BGLCoefficients::A4s_a2 },
                 // B_s -> D_s^* A_5
-                { bgl->A5s_a0(), bgl->A5s_a1(), bgl->A5s_a2() },
+                { &BGLCoefficients::A5s_a0, &BGLCoefficients::A5s_a1, &BGLCoefficients::A5s_a2 },
                 // B_s^* -> D_s A_6
-                { bgl->A6s_a0(), bgl->A6s_a1(), bgl->A6s_a2() },
+                { &BGLCoefficients::A6s_a0, &BGLCoefficients::A6s_a1, &BGLCoefficients::A6s_a2 },
                 // B_s^* -> D_s^* A_7
-                { bgl->A7s_a0(), bgl->A7s_a1(), bgl->A7s_a2() }
+                { &BGLCoefficients::A7s_a0, &BGLCoefficients::A7s_a1, &BGLCoefficients::A7s_a2 }
             }};
 
-            for (const auto & ff : bgl_coeffs_s)
-            {
-                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-                {
-                    result += power_of<2>(ff[i]) * ns;
-                }
-            }
-
-            return result;
+            return evaluate(state().sums_1m, bgl_coeffs_ud, bgl_coeffs_s);
         }
 
         double bound_1m_T() const
         {
             // 7 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=u,d
-            const std::array<std::array<double, 3>, 7> bgl_coeffs_ud
+            static const std::array<std::array<Coefficient, 3>, 7> bgl_coeffs_ud
             {{
                 // B -> D f_T
-                { bgl->fT_a0(),    bgl->fT_a1(),    bgl->fT_a2()    },
+                { &BGLCoefficients::fT_a0,    &BGLCoefficients::fT_a1,    &BGLCoefficients::fT_a2    },
                 // B -> D^* T_1
-                { bgl->T1_a0(),    bgl->T1_a1(),    bgl->T1_a2()    },
+                { &BGLCoefficients::T1_a0,    &BGLCoefficients::T1_a1,    &BGLCoefficients::T1_a2    },
                 // B^* -> D Tbar_1
-                { bgl->T1bar_a0(), bgl->T1bar_a1(), bgl->T1bar_a2() },
+                { &BGLCoefficients::T1bar_a0, &BGLCoefficients::T1bar_a1, &BGLCoefficients::T1bar_a2 },
                 // B^* -> D^* T_7
-                { bgl->T7_a0(),    bgl->T7_a1(),    bgl->T7_a2()    },
+                { &BGLCoefficients::T7_a0,    &BGLCoefficients::T7_a1,    &BGLCoefficients::T7_a2    },
                 // B -> D^* T_8
-                { bgl->T8_a0(),    bgl->T8_a1(),    bgl->T8_a2()    },
+                { &BGLCoefficients::T8_a0,    &BGLCoefficients::T8_a1,    &BGLCoefficients::T8_a2    },
                 // B -> D^* T_9
-                { bgl->T9_a0(),    bgl->T9_a1(),    bgl->T9_a2()    },
+                { &BGLCoefficients::T9_a0,    &BGLCoefficients::T9_a1,    &BGLCoefficients::T9_a2    },
                 // B -> D^* T_10
-                { bgl->T10_a0(),   bgl->T10_a1(),   bgl->T10_a2()   }
+                { &BGLCoefficients::T10_a0,   &BGLCoefficients::T10_a1,   &BGLCoefficients::T10_a2   }
             }};
 
-            double result = 0.0;
-            for (const auto & ff : bgl_coeffs_ud)
-            {
-                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-                {
-                    result += power_of<2>(ff[i]) * nf; // to account for flavor symmetry
-                }
-            }
-
             // 7 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=s
-            const std::array<std::array<double, 3>, 7> bgl_coeffs_s
+            static const std::array<std::array<Coefficient, 3>, 7> bgl_coeffs_s
             {{
                 // B_s -> D_s f_T
-                { bgl->fTs_a0(),    bgl->fTs_a1(),    bgl->fTs_a2()    },
+                { &BGLCoefficients::fTs_a0,    &BGLCoefficients::fTs_a1,    &BGLCoefficients::fTs_a2    },
                 // B_s -> D_s^* T_1
-                { bgl->T1s_a0(),    bgl->T1s_a1(),    bgl->T1s_a2()    },
+                { &BGLCoefficients::T1s_a0,    &BGLCoefficients::T1s_a1,    &BGLCoefficients::T1s_a2    },
                 // B_s^* -> D_s Tbar_1
-                { bgl->T1bars_a0(), bgl->T1bars_a1(), bgl->T1bars_a2() },
+                { &BGLCoefficients::T1bars_a0, &BGLCoefficients::T1bars_a1, &BGLCoefficients::T1bars_a2 },
                 // B_s^* -> D_s^* T_7
-                { bgl->T7s_a0(),    bgl->T7s_a1(),    bgl->T7s_a2()    },
+                { &BGLCoefficients::T7s_a0,    &BGLCoefficients::T7s_a1,    &BGLCoefficients::T7s_a2    },
                 // B_s -> D_s^* T_8
-                { bgl->T8s_a0(),    bgl->T8s_a1(),    bgl->T8s_a2()    },
+                { &BGLCoefficients::T8s_a0,    &BGLCoefficients::T8s_a1,    &BGLCoefficients::T8s_a2    },
                 // B_s -> D_s^* T_9
-                { bgl->T9s_a0(),    bgl->T9s_a1(),    bgl->T9s_a2()    },
+                { &BGLCoefficients::T9s_a0,    &BGLCoefficients::T9s_a1,    &BGLCoefficients::T9s_a2    },
                 // B_s -> D_s^* T_10
-                { bgl->T10s_a0(),   bgl->T10s_a1(),   bgl->T10s_a2()   }
+                { &BGLCoefficients::T10s_a0,   &BGLCoefficients::T10s_a1,   &BGLCoefficients::T10s_a2   }
             }};
 
-            for (const auto & ff : bgl_coeffs_s)
-            {
-                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-                {
-                    result += power_of<2>(ff[i]) * ns;
-                }
-            }
-
-            return result;
+            return evaluate(state().sums_1m_T, bgl_coeffs_ud, bgl_coeffs_s);
         }
 
         double bound_1p_T() const
         {
             // 7 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=u,d
-            const std::array<std::array<double, 3>, 7> bgl_coeffs_ud
+            static const std::array<std::array<Coefficient, 3>, 7> bgl_coeffs_ud
             {{
                 // B -> D^* T_2
-                { bgl->T2_a0(), bgl->T2_a1(), bgl->T2_a2() },
+                { &BGLCoefficients::T2_a0, &BGLCoefficients::T2_a1, &BGLCoefficients::T2_a2 },
                 // B^* -> D Tbar_2
-                { bgl->T2bar_a0(), bgl->T2bar_a1(), bgl->T2bar_a2() },
+                { &BGLCoefficients::T2bar_a0, &BGLCoefficients::T2bar_a1, &BGLCoefficients::T2bar_a2 },
                 // B -> D^* T_23
-                { bgl->T23_a0(), bgl->T23_a1(), bgl->T23_a2() },
+                { &BGLCoefficients::T23_a0, &BGLCoefficients::T23_a1, &BGLCoefficients::T23_a2 },
                 // B^* -> D Tbar_23
-                { bgl->T23bar_a0(), bgl->T23bar_a1(), bgl->T23bar_a2() },
+                { &BGLCoefficients::T23bar_a0, &BGLCoefficients::T23bar_a1, &BGLCoefficients::T23bar_a2 },
                 // B^* -> D^* T_4
-                { bgl->T4_a0(), bgl->T4_a1(), bgl->T4_a2() },
+                { &BGLCoefficients::T4_a0, &BGLCoefficients::T4_a1, &BGLCoefficients::T4_a2 },
                 // B^* -> D^* T_5
-                { bgl->T5_a0(), bgl->T5_a1(), bgl->T5_a2() },
+                { &BGLCoefficients::T5_a0, &BGLCoefficients::T5_a1, &BGLCoefficients::T5_a2 },
                 // B^* -> D^* T_6
-                { bgl->T6_a0(), bgl->T6_a1(), bgl->T6_a2() }
+                { &BGLCoefficients::T6_a0, &BGLCoefficients::T6_a1, &BGLCoefficients::T6_a2 }
             }};
 
-            double result = 0.0;
-            for (const auto & ff : bgl_coeffs_ud)
-            {
-                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-                {
-                    result += power_of<2>(ff[i]) * nf; // to account for flavor symmetry
-                }
-            }
-
-
             // 7 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=s
-            const std::array<std::array<double, 3>, 7> bgl_coeffs_s
+            static const std::array<std::array<Coefficient, 3>, 7> bgl_coeffs_s
             {{
                 // B_s -> D_s^* T_2
-                { bgl->T2s_a0(), bgl->T2s_a1(), bgl->T2s_a2() },
+                { &BGLCoefficients::T2s_a0, &BGLCoefficients::T2s_a1, &BGLCoefficients::T2s_a2 },
                 // B_s^* -> D_s Tbar_2
-                { bgl->T2bars_a0(), bgl->T2bars_a1(), bgl->T2bars_a2() },
+                { &BGLCoefficients::T2bars_a0, &BGLCoefficients::T2bars_a1, &BGLCoefficients::T2bars_a2 },
                 // B_s -> D_s^* T_23
-                { bgl->T23s_a0(), bgl->T23s_a1(), bgl->T23s_a2() },
+                { &BGLCoefficients::T23s_a0, &BGLCoefficients::T23s_a1, &BGLCoefficients::T23s_a2 },
                 // B_s^* -> D_s Tbar_23
-                { bgl->T23bars_a0(), bgl->T23bars_a1(), bgl->T23bars_a2() },
+                { &BGLCoefficients::T23bars_a0, &BGLCoefficients::T23bars_a1, &BGLCoefficients::T23bars_a2 },
                 // B_s^* -> D_s^* T_4
-                { bgl->T4s_a0(), bgl->T4s_a1(), bgl->T4s_a2() },
+                { &BGLCoefficients::T4s_a0, &BGLCoefficients::T4s_a1, &BGLCoefficients::T4s_a2 },
                 // B_s^* -> D_s^* T_5
-                { bgl->T5s_a0(), bgl->T5s_a1(), bgl->T5s_a2() },
+                { &BGLCoefficients::T5s_a0, &BGLCoefficients::T5s_a1, &BGLCoefficients::T5s_a2 },
                 // B_s^* -> D_s^* T_6
-                { bgl->T6s_a0(), bgl->T6s_a1(), bgl->T6s_a2() }
+                { &BGLCoefficients::T6s_a0, &BGLCoefficients::T6s_a1, &BGLCoefficients::T6s_a2 }
             }};
 
-            for (const auto & ff : bgl_coeffs_s)
-            {
-                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-                {
-                    result += power_of<2>(ff[i]) * ns;
-                }
-            }
-
-            return result;
+            return evaluate(state().sums_1p_T, bgl_coeffs_ud, bgl_coeffs_s);
         }
         // }}}
     };
@@ -3235,6 +3373,37 @@ namespace eos
             return result;
         }
         // }}}
+
+        // gradients of the bounds with respect to the coefficients and to the number of light flavor multiplets
+        // {{{
+        template <std::size_t n_>
+        std::map<std::string, double> gradient(const std::array<const std::array<UsedParameter, 4> *, n_> & coefficients) const
+        {
+            std::map<std::string, double> result;
+
+            double sum = 0.0;
+            for (const auto & c : coefficients)
+            {
+                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
+                {
+                    const double a = (*c)[i];
+                    result[(*c)[i].name()] = 2.0 * a * nf;
+                    sum += power_of<2>(a);
+                }
+            }
+            result[nf.name()] = sum;
+
+            return result;
+        }
+
+        std::map<std::string, double> bound_0p_gradient() const { return gradient<1>({{ &_a_f_0 }}); }
+
+        std::map<std::string, double> bound_0m_gradient() const { return gradient<1>({{ &_a_F2 }}); }
+
+        std::map<std::string, double> bound_1p_gradient() const { return gradient<2>({{ &_a_f, &_a_F1 }}); }
+
+        std::map<std::string, double> bound_1m_gradient() const { return gradient<2>({{ &_a_f_p, &_a_g }}); }
+        // }}}
     };
 
     const std::vector<OptionSpecification>
@@ -3274,6 +3443,30 @@ namespace eos
         return _imp->bound_1m();
     }
 
+    std::map<std::string, double>
+    BGLUnitarityBounds::bound_0p_gradient() const
+    {
+        return _imp->bound_0p_gradient();
+    }
+
+    std::map<std::string, double>
+    BGLUnitarityBounds::bound_0m_gradient() const
+    {
+        return _imp->bound_0m_gradient();
+    }
+
+    std::map<std::string, double>
+    BGLUnitarityBounds::bound_1p_gradient() const
+    {
+        return _imp->bound_1p_gradient();
+    }
+
+    std::map<std::string, double>
+    BGLUnitarityBounds::bound_1m_gradient() const
+    {
+        return _imp->bound_1m_gradient();
+    }
+
     const std::set<ReferenceName>
     BGLUnitarityBounds::references
     {
@@ -26,6 +26,9 @@
 #include <eos/utils/private_implementation_pattern.hh>
 #include <eos/utils/reference-name.hh>
 
+#include <map>
+#include <string>
+
 namespace eos
 {
     class BGLCoefficients :
@@ -332,6 +335,12 @@ namespace eos
             double T10s_a2() const;
             // }}}
 
+            /*!
+             * Parameters on which the coefficients for the spectator quarks q=u,d and q=s depend, respectively.
+             */
+            const ParameterUser & parameters_ud() const;
+            const ParameterUser & parameters_s() const;
+
             /*!
              * References used in the computation of our observables.
              */
@@ -426,6 +435,15 @@ namespace eos
 
             double bound_1m() const;
 
+            // gradients of the bounds with respect to the parameters they depend on, keyed by parameter name
+            std::map<std::string, double> bound_0p_gradient() const;
+
+            std::map<std::string, double> bound_0m_gradient() const;
+
+            std::map<std::string, double> bound_1p_gradient() const;
+
+            std::map<std::string, double> bound_1m_gradient() const;
+
             /*!
              * References used in the computation of our observables.
              */
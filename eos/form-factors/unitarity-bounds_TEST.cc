@@ -339,9 +339,92 @@ class HQETUnitarityBoundsTest :
                 TEST_CHECK_NEARLY_EQUAL(bgl.T10s_a2(), -0.168148675, eps);
                 // }}}
             }
+
+            // incremental updates agree with a fresh evaluation
+            {
+                Parameters p = Parameters::Defaults();
+
+                HQETUnitarityBounds bounds(p, Options{ });
+                const double bound_1m = bounds.bound_1m();
+                const double bound_1p_T = bounds.bound_1p_T();
+
+                // q=u,d parameters only
+                p["B(*)->D(*)::xi'(1)@HQET"] = -1.3;
+                p["B(*)->D(*)::l_2(1)@HQET"] = -1.5;
+                TEST_CHECK_RELATIVE_ERROR(bounds.bound_1m(),   HQETUnitarityBounds(p, Options{ }).bound_1m(),   1e-12);
+                TEST_CHECK_RELATIVE_ERROR(bounds.bound_1p_T(), HQETUnitarityBounds(p, Options{ }).bound_1p_T(), 1e-12);
+
+                // q=s parameters only
+                p["B_s(*)->D_s(*)::eta(1)@HQET"] = 0.5;
+                TEST_CHECK_RELATIVE_ERROR(bounds.bound_1m(),   HQETUnitarityBounds(p, Options{ }).bound_1m(),   1e-12);
+                TEST_CHECK_RELATIVE_ERROR(bounds.bound_1p_T(), HQETUnitarityBounds(p, Options{ }).bound_1p_T(), 1e-12);
+
+                // multiplicities
+                p["B(*)->D(*)::n_f@HQET"] = 3.0;
+                TEST_CHECK_RELATIVE_ERROR(bounds.bound_1m(),   HQETUnitarityBounds(p, Options{ }).bound_1m(),   1e-12);
+
+                // back to the defaults
+                p["B(*)->D(*)::xi'(1)@HQET"]     = Parameters::Defaults()["B(*)->D(*)::xi'(1)@HQET"].evaluate();
+                p["B(*)->D(*)::l_2(1)@HQET"]     = Parameters::Defaults()["B(*)->D(*)::l_2(1)@HQET"].evaluate();
+                p["B_s(*)->D_s(*)::eta(1)@HQET"] = Parameters::Defaults()["B_s(*)->D_s(*)::eta(1)@HQET"].evaluate();
+                p["B(*)->D(*)::n_f@HQET"]        = Parameters::Defaults()["B(*)->D(*)::n_f@HQET"].evaluate();
+                TEST_CHECK_RELATIVE_ERROR(bounds.bound_1m(),   bound_1m,   1e-12);
+                TEST_CHECK_RELATIVE_ERROR(bounds.bound_1p_T(), bound_1p_T, 1e-12);
+            }
         }
 } unitarity_bounds_test;
 
+class BGLUnitarityBoundsTest :
+    public TestCase
+{
+    public:
+        BGLUnitarityBoundsTest() :
+            TestCase("bgl_unitarity_bounds_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // bounds follow changes of the coefficients, and their gradients
+            {
+                Parameters p = Parameters::Defaults();
+                p["B->D^*::a^g_0@BGL1997"]  = 0.02;
+                p["B->D^*::a^g_1@BGL1997"]  = -0.05;
+                p["B->D^*::a^g_2@BGL1997"]  = 0.3;
+                p["B->D::a^f+_0@BGL1997"]   = 0.015;
+                p["B->D::a^f+_1@BGL1997"]   = -0.04;
+                p["B->D::a^f+_2@BGL1997"]   = -0.2;
+
+                BGLUnitarityBounds bounds(p, Options{ });
+
+                const double nf = p["B(*)->D(*)::n_f@BGL1997"].evaluate();
+                TEST_CHECK_RELATIVE_ERROR(bounds.bound_1m(), nf * (0.02 * 0.02 + 0.05 * 0.05 + 0.3 * 0.3 + 0.015 * 0.015 + 0.04 * 0.04 + 0.2 * 0.2), 1e-12);
+
+                p["B->D^*::a^g_1@BGL1997"] = 0.1;
+                TEST_CHECK_RELATIVE_ERROR(bounds.bound_1m(), BGLUnitarityBounds(p, Options{ }).bound_1m(), 1e-12);
+
+                // the coefficient of z^3 does not contribute
+                p["B->D^*::a^g_3@BGL1997"] = 0.5;
+                TEST_CHECK_RELATIVE_ERROR(bounds.bound_1m(), BGLUnitarityBounds(p, Options{ }).bound_1m(), 1e-12);
+
+                const auto gradient = bounds.bound_1m_gradient();
+                TEST_CHECK_EQUAL(gradient.size(), 7u);
+                TEST_CHECK_RELATIVE_ERROR(gradient.at("B->D^*::a^g_1@BGL1997"), 2.0 * nf * 0.1,   1e-12);
+                TEST_CHECK_RELATIVE_ERROR(gradient.at("B->D::a^f+_2@BGL1997"),  2.0 * nf * -0.2,  1e-12);
+                TEST_CHECK_RELATIVE_ERROR(gradient.at("B(*)->D(*)::n_f@BGL1997"), bounds.bound_1m() / nf, 1e-12);
+
+                // compare with a finite difference
+                const double a = p["B->D^*::a^F1_1@BGL1997"].evaluate(), h = 1.0e-4;
+                p["B->D^*::a^F1_1@BGL1997"] = a + h;
+                const double upper = bounds.bound_1p();
+                p["B->D^*::a^F1_1@BGL1997"] = a - h;
+                const double lower = bounds.bound_1p();
+                p["B->D^*::a^F1_1@BGL1997"] = a;
+                TEST_CHECK_NEARLY_EQUAL(bounds.bound_1p_gradient().at("B->D^*::a^F1_1@BGL1997"), (upper - lower) / (2.0 * h), 1e-8);
+            }
+        }
+} bgl_unitarity_bounds_test;
+
 class OPEUnitarityBoundsTest :
     public TestCase
 {
@@ -30,6 +30,24 @@ namespace eos
     {
     }
 
+    void
+    VectorLCDAs::phi2para(const double * u, const std::size_t & n, const double & mu, double * results) const
+    {
+        for (std::size_t j = 0 ; j < n ; ++j)
+        {
+            results[j] = this->phi2para(u[j], mu);
+        }
+    }
+
+    void
+    VectorLCDAs::phi2perp(const double * u, const std::size_t & n, const double & mu, double * results) const
+    {
+        for (std::size_t j = 0 ; j < n ; ++j)
+        {
+            results[j] = this->phi2perp(u[j], mu);
+        }
+    }
+
     std::shared_ptr<VectorLCDAs>
     VectorLCDAs::make(const std::string & name, const Parameters & parameters, const Options & options)
     {
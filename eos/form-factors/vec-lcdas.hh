@@ -23,6 +23,8 @@
 #include <eos/utils/parameters.hh>
 #include <eos/utils/options.hh>
 
+#include <cstddef>
+
 namespace eos
 {
     class VectorLCDAs :
@@ -49,6 +51,10 @@ namespace eos
             virtual double phi2para(const double & u, const double & mu) const = 0;
             virtual double phi2perp(const double & u, const double & mu) const = 0;
 
+            /* Twist 2 LCDAs at the n points u; results[j] = phi2para(u[j], mu) and phi2perp(u[j], mu), respectively */
+            virtual void phi2para(const double * u, const std::size_t & n, const double & mu, double * results) const;
+            virtual void phi2perp(const double * u, const std::size_t & n, const double & mu, double * results) const;
+
             /* Twist 3 parameters */
             virtual double kappa3para(const double & mu) const = 0;
             virtual double omega3para(const double & mu) const = 0;
@@ -0,0 +1,108 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2025 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_FORM_FACTORS_Z_EXPANSION_KERNEL_HH
+#define EOS_GUARD_EOS_FORM_FACTORS_Z_EXPANSION_KERNEL_HH 1
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace eos
+{
+    /*
+     * Fixed-order kernel for a set of nff_ form factors that share one conformal mapping z(s; t_+, t_0),
+     *
+     *   f_i(s) = 1 / (1 - s / m_{R,i}^2) * sum_{k < order_} a_{i,k} (z(s) - z_ref)^k .
+     *
+     * The coefficients are a snapshot of the parameter values, taken by the owning parametrisation
+     * before a batch is evaluated. The loops over the points of a batch have compile-time trip counts
+     * in their bodies and contiguous operands, so that the compiler can vectorise them.
+     *
+     * The kernel is only valid for real s < t_+.
+     */
+    template <std::size_t nff_, std::size_t order_>
+    struct ZExpansionKernel
+    {
+        static_assert(order_ > 0, "the z expansion must have at least one term");
+
+        static constexpr std::size_t form_factors = nff_;
+
+        double t_p, t_0, z_ref;
+
+        std::array<double, nff_> inverse_m2_R;
+
+        std::array<std::array<double, order_>, nff_> a;
+
+        double z(const double & s) const
+        {
+            const double sqrt_tp_s  = std::sqrt(t_p - s);
+            const double sqrt_tp_t0 = std::sqrt(t_p - t_0);
+
+            return (sqrt_tp_s - sqrt_tp_t0) / (sqrt_tp_s + sqrt_tp_t0);
+        }
+
+        /*
+         * Evaluate all form factors at the n points s. The results are stored row by row,
+         * i.e., results[i * n + j] = f_i(s[j]).
+         */
+        void operator() (const double * s, const std::size_t & n, double * results) const
+        {
+            static constexpr std::size_t chunk = 64;
+
+            const double sqrt_tp_t0 = std::sqrt(t_p - t_0);
+
+            std::array<double, chunk> dz;
+
+            for (std::size_t j0 = 0 ; j0 < n ; j0 += chunk)
+            {
+                const std::size_t m = std::min(chunk, n - j0);
+                const double * s_j0 = s + j0;
+
+                for (std::size_t j = 0 ; j < m ; ++j)
+                {
+                    const double sqrt_tp_s = std::sqrt(t_p - s_j0[j]);
+                    dz[j] = (sqrt_tp_s - sqrt_tp_t0) / (sqrt_tp_s + sqrt_tp_t0) - z_ref;
+                }
+
+                for (std::size_t i = 0 ; i < nff_ ; ++i)
+                {
+                    const std::array<double, order_> & a_i = a[i];
+                    const double inverse_m2_R_i = inverse_m2_R[i];
+                    double * results_i = results + i * n + j0;
+
+                    for (std::size_t j = 0 ; j < m ; ++j)
+                    {
+                        // Horner scheme; unrolled, since order_ is known at compile time
+                        double sum = a_i[order_ - 1];
+                        for (std::size_t k = order_ - 1 ; k > 0 ; --k)
+                        {
+                            sum = sum * dz[j] + a_i[k - 1];
+                        }
+
+                        results_i[j] = sum / (1.0 - s_j0[j] * inverse_m2_R_i);
+                    }
+                }
+            }
+        }
+    };
+}
+
+#endif
@@ -17,7 +17,11 @@
 
 #include <eos/maths/power-of.hh>
 #include <eos/maths/gegenbauer-polynomial.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/stringify.hh>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <vector>
 
@@ -58,4 +62,56 @@ namespace eos
 
         return result;
     }
+
+    void gegenbauer_series(const double & alpha, const std::vector<double> & a, const double * z, const std::size_t & n, double * results)
+    {
+        if (alpha <= 0.0)
+        {
+            throw InternalError("gegenbauer_series: alpha must be positive, but is " + stringify(alpha));
+        }
+
+        static constexpr std::size_t chunk = 64;
+
+        std::array<double, chunk> c_prev, c_curr;
+
+        for (std::size_t j0 = 0 ; j0 < n ; j0 += chunk)
+        {
+            const std::size_t m = std::min(chunk, n - j0);
+            const double * z_j0 = z + j0;
+            double * results_j0 = results + j0;
+
+            // C_0(z) = 1, C_1(z) = 2 alpha z
+            for (std::size_t j = 0 ; j < m ; ++j)
+            {
+                c_prev[j] = 1.0;
+                c_curr[j] = 2.0 * alpha * z_j0[j];
+                results_j0[j] = (a.empty() ? 0.0 : a[0]);
+            }
+
+            if (a.size() < 2)
+            {
+                continue;
+            }
+
+            for (std::size_t j = 0 ; j < m ; ++j)
+            {
+                results_j0[j] += a[1] * c_curr[j];
+            }
+
+            // k C_k(z) = 2 z (k + alpha - 1) C_{k-1}(z) - (k + 2 alpha - 2) C_{k-2}(z)
+            for (std::size_t k = 2 ; k < a.size() ; ++k)
+            {
+                const double f1 = 2.0 * (k + alpha - 1.0) / k;
+                const double f2 = (k + 2.0 * alpha - 2.0) / k;
+
+                for (std::size_t j = 0 ; j < m ; ++j)
+                {
+                    const double c_next = f1 * z_j0[j] * c_curr[j] - f2 * c_prev[j];
+                    c_prev[j] = c_curr[j];
+                    c_curr[j] = c_next;
+                    results_j0[j] += a[k] * c_next;
+                }
+            }
+        }
+    }
 }
@@ -20,6 +20,7 @@
 
 #include <eos/maths/power-of.hh>
 
+#include <cstddef>
 #include <vector>
 
 namespace eos
@@ -51,6 +52,14 @@ namespace eos
 
             double evaluate(const double & z) const;
     };
+
+    /*
+     * Evaluate the Gegenbauer series sum_k a[k] C_k^(alpha)(z) at the n points z[j], and store the results in results[j].
+     *
+     * The polynomials are generated through their three-term recurrence relation, which avoids the evaluation of
+     * each polynomial from its explicit coefficients. The normalisation agrees with GegenbauerPolynomial for alpha > 0.
+     */
+    void gegenbauer_series(const double & alpha, const std::vector<double> & a, const double * z, const std::size_t & n, double * results);
 }
 
 #endif
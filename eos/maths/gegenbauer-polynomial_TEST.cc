@@ -19,9 +19,11 @@
 
 #include <test/test.hh>
 #include <eos/maths/gegenbauer-polynomial.hh>
+#include <eos/utils/exception.hh>
 
 #include <cmath>
 #include <array>
+#include <vector>
 
 using namespace test;
 using namespace eos;
@@ -61,5 +63,37 @@ class GegenbauerPolynomialTest :
                     }
                 }
             }
+
+            // series evaluated through the recurrence relation
+            {
+                for (const double alpha : { 0.5, 1.5 })
+                {
+                    const std::vector<double> a = { 1.0, 0.3, -0.2, 0.1, 0.05, -0.02 };
+
+                    // cross the chunk boundary of the batched evaluation
+                    std::vector<double> z(150), results(150);
+                    for (std::size_t j = 0 ; j < z.size() ; ++j)
+                    {
+                        z[j] = -1.0 + 2.0 * j / (z.size() - 1.0);
+                    }
+
+                    gegenbauer_series(alpha, a, z.data(), z.size(), results.data());
+
+                    for (std::size_t j = 0 ; j < z.size() ; ++j)
+                    {
+                        double reference = 0.0;
+                        for (unsigned k = 0 ; k < a.size() ; ++k)
+                        {
+                            reference += a[k] * GegenbauerPolynomial(k, alpha).evaluate(z[j]);
+                        }
+
+                        TEST_CHECK_NEARLY_EQUAL(results[j], reference, 1.0e-12);
+                    }
+                }
+
+                const double z = 0.5;
+                double result;
+                TEST_CHECK_THROWS(InternalError, gegenbauer_series(0.0, { 1.0 }, &z, 1, &result));
+            }
         }
 } gegenbauer_polynomial_test;
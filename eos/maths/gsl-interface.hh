@@ -49,7 +49,7 @@ namespace eos
 
     using GSLMatrixPtr = std::unique_ptr<gsl_matrix, gsl::MatrixDeleter>;
 
-    GSLMatrixPtr make_gsl_matrix(size_t n1, size_t n2)
+    inline GSLMatrixPtr make_gsl_matrix(size_t n1, size_t n2)
     {
         gsl_matrix * result = gsl_matrix_calloc(n1, n2);
 
@@ -77,12 +77,41 @@ namespace eos
 
     using GSLVectorPtr = std::unique_ptr<gsl_vector, gsl::VectorDeleter>;
 
-    GSLVectorPtr make_gsl_vector(size_t n)
+    inline GSLVectorPtr make_gsl_vector(size_t n)
     {
         gsl_vector * result = gsl_vector_calloc(n);
 
         return GSLVectorPtr(result);
     }
+
+    namespace gsl
+    {
+        /**
+         * Deletes a gsl_rng upon release from std::unique_ptr<>.
+         */
+        struct RNGDeleter
+        {
+            RNGDeleter() { }
+
+            void operator() (gsl_rng * r)
+            {
+                if (r)
+                {
+                    gsl_rng_free(r);
+                }
+            }
+        };
+    }
+
+    using GSLRNGPtr = std::unique_ptr<gsl_rng, gsl::RNGDeleter>;
+
+    inline GSLRNGPtr make_gsl_rng(const gsl_rng_type * type, unsigned long seed)
+    {
+        gsl_rng * result = gsl_rng_alloc(type);
+        gsl_rng_set(result, seed);
+
+        return GSLRNGPtr(result);
+    }
 }
 
 #endif
@@ -26,6 +26,7 @@
 #include <eos/maths/integrate.hh>
 #include <eos/maths/integrate-cubature.hh>
 #include <eos/maths/matrix.hh>
+#include <eos/utils/profiler.hh>
 
 #include <cassert>
 #include <vector>
@@ -50,6 +51,19 @@ namespace eos
 
             return 0;
         }
+
+        template <size_t fdim_>
+        int batched_integrand_wrapper(unsigned ndim, size_t npt, const double * x, void * data,
+                      unsigned fdim, double * fval)
+        {
+            assert(1 == ndim);
+            assert(fdim == fdim_);
+
+            auto & f = *static_cast<cubature::batched_integrand *>(data);
+            f(x, npt, fval);
+
+            return 0;
+        }
     }
 
     template <size_t ndim_, size_t fdim_, typename T_>
@@ -62,6 +76,8 @@ namespace eos
         using integrand_traits = cubature::integrand_traits<ndim_, fdim_, T_>;
         using cubature::integrand_wrapper;
 
+        Profiler::count_integration();
+
         constexpr unsigned nintegrands = integrand_traits::buffer_size;
         typename integrand_traits::buffer_type result_buffer;
         typename integrand_traits::buffer_type error_buffer;
@@ -75,6 +91,26 @@ namespace eos
 
         return integrand_traits::contruct_result(result_buffer);
     }
+
+    template <size_t fdim_>
+    std::array<double, fdim_> integrate_batched(const cubature::batched_integrand & f, const double & a, const double & b,
+                                                const cubature::Config & config)
+    {
+        using cubature::batched_integrand_wrapper;
+
+        Profiler::count_integration();
+
+        std::array<double, fdim_> result_buffer;
+        std::array<double, fdim_> error_buffer;
+        if (hcubature_v(fdim_, &batched_integrand_wrapper<fdim_>,
+                        &const_cast<cubature::batched_integrand &>(f), 1, &a, &b, config.maxeval(), config.epsabs(), config.epsrel(),
+                        ERROR_L2, result_buffer.data(), error_buffer.data()))
+        {
+            throw IntegrationError("hcubature_v failed");
+        }
+
+        return result_buffer;
+    }
 }
 
 #endif
@@ -22,10 +22,14 @@
 #include <eos/maths/integrate.hh>
 #include <eos/maths/integrate-impl.hh>
 #include <eos/maths/matrix.hh>
+#include <eos/utils/profiler.hh>
 
 #include <gsl/gsl_errno.h>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <queue>
 #include <vector>
 
 namespace
@@ -35,6 +39,29 @@ namespace
         const auto& f = *static_cast<eos::GSL::fdd*>(params);
         return f(x);
     }
+
+    using gsl_qk_rule = void (*)(const gsl_function *, double, double, double *, double *, double *, double *);
+
+    gsl_qk_rule gsl_qk_rule_from_key(const int & key)
+    {
+        switch (key)
+        {
+            case GSL_INTEG_GAUSS15:
+                return &gsl_integration_qk15;
+            case GSL_INTEG_GAUSS21:
+                return &gsl_integration_qk21;
+            case GSL_INTEG_GAUSS31:
+                return &gsl_integration_qk31;
+            case GSL_INTEG_GAUSS41:
+                return &gsl_integration_qk41;
+            case GSL_INTEG_GAUSS51:
+                return &gsl_integration_qk51;
+            case GSL_INTEG_GAUSS61:
+                return &gsl_integration_qk61;
+            default:
+                return nullptr;
+        }
+    }
 }
 
 namespace eos
@@ -122,6 +149,8 @@ namespace eos
     template <>
     double integrate<GSL::QNG>(const GSL::fdd &f, const double &a, const double &b, const GSL::QNG::Config &config)
     {
+        Profiler::count_integration();
+
         double result, abserr;
         size_t neval;
         gsl_function F;
@@ -141,6 +170,8 @@ namespace eos
     template <>
     double integrate<GSL::QAGS>(const GSL::fdd &f, const double &a, const double &b, const GSL::QAGS::Config &config)
     {
+        Profiler::count_integration();
+
         double result, abserr;
         gsl_function F;
         F.function = &gsl_function_adapter;
@@ -158,6 +189,133 @@ namespace eos
         return result;
     }
 
+    std::vector<double>
+    integrate_bins(const GSL::fdd & f, const std::vector<double> & edges, const GSL::QAGS::Config & config)
+    {
+        if (edges.size() < 2)
+        {
+            throw IntegrationError("integrate_bins: at least two bin edges are required");
+        }
+
+        for (unsigned i = 1 ; i < edges.size() ; ++i)
+        {
+            if (! (edges[i - 1] <= edges[i]))
+            {
+                throw IntegrationError("integrate_bins: the bin edges must be in non-decreasing order");
+            }
+        }
+
+        Profiler::count_integration();
+
+        const auto rule = gsl_qk_rule_from_key(config.key());
+        if (nullptr == rule)
+        {
+            throw IntegrationError(gsl_strerror(GSL_EINVAL));
+        }
+
+        gsl_function F;
+        F.function = &gsl_function_adapter;
+        F.params = (void*)&f;
+
+        struct Interval
+        {
+            double a, b;
+            double result, error, resabs;
+            unsigned bin;
+
+            bool operator< (const Interval & rhs) const { return error < rhs.error; }
+        };
+
+        const unsigned bins = edges.size() - 1;
+        std::vector<double> results(bins, 0.0), errors(bins, 0.0), resabs(bins, 0.0);
+
+        auto evaluate = [&](const double & a, const double & b, const unsigned & bin) -> Interval
+        {
+            Interval result{ a, b, 0.0, 0.0, 0.0, bin };
+            double resasc;
+            rule(&F, a, b, &result.result, &result.error, &result.resabs, &resasc);
+
+            return result;
+        };
+
+        // a bin has converged once it meets the accuracy goal, or once its error estimate is dominated by roundoff
+        auto converged = [&](const unsigned & bin) -> bool
+        {
+            const double tolerance = std::max(config.epsabs(), config.epsrel() * std::abs(results[bin]));
+
+            return (errors[bin] <= tolerance) || (errors[bin] <= 50.0 * std::numeric_limits<double>::epsilon() * resabs[bin]);
+        };
+
+        std::priority_queue<Interval> intervals;
+        for (unsigned i = 0 ; i < bins ; ++i)
+        {
+            if (edges[i] == edges[i + 1])
+                continue;
+
+            const Interval interval = evaluate(edges[i], edges[i + 1], i);
+            results[i] = interval.result;
+            errors[i]  = interval.error;
+            resabs[i]  = interval.resabs;
+            intervals.push(interval);
+        }
+
+        // intervals of converged bins are set aside, and are revisited if their bin's goal tightens
+        std::vector<Interval> converged_intervals;
+        unsigned size = intervals.size();
+        while (true)
+        {
+            while ((! intervals.empty()) && converged(intervals.top().bin))
+            {
+                converged_intervals.push_back(intervals.top());
+                intervals.pop();
+            }
+
+            if (intervals.empty())
+            {
+                for (const auto & interval : converged_intervals)
+                {
+                    if (! converged(interval.bin))
+                    {
+                        intervals.push(interval);
+                    }
+                }
+
+                if (intervals.empty())
+                    break;
+
+                std::erase_if(converged_intervals, [&](const Interval & interval) { return ! converged(interval.bin); });
+                continue;
+            }
+
+            if (size >= unsigned(GSL::work_space.limit()))
+            {
+                throw IntegrationError(gsl_strerror(GSL_EMAXITER));
+            }
+
+            const Interval interval = intervals.top();
+            intervals.pop();
+
+            const double center = (interval.a + interval.b) / 2.0;
+            if ((center <= interval.a) || (center >= interval.b))
+            {
+                throw IntegrationError(gsl_strerror(GSL_ESING));
+            }
+
+            const Interval left  = evaluate(interval.a, center, interval.bin);
+            const Interval right = evaluate(center, interval.b, interval.bin);
+
+            results[interval.bin] += left.result + right.result - interval.result;
+            errors[interval.bin]   = std::max(0.0, errors[interval.bin] + left.error + right.error - interval.error);
+            resabs[interval.bin]  += left.resabs + right.resabs - interval.resabs;
+
+            intervals.push(left);
+            intervals.push(right);
+            ++size;
+        }
+
+        return results;
+    }
+
     namespace cubature
     {
         Config::Config() :
@@ -33,6 +33,7 @@
 
 #include <array>
 #include <functional>
+#include <vector>
 
 namespace eos
 {
@@ -109,6 +110,23 @@ namespace GSL
                      const double &a, const double &b,
                      const typename Method_::Config &config = typename Method_::Config());
 
+    /*!
+     * Numerically integrate a function of one real-valued parameter over a set of contiguous bins.
+     *
+     * All bins are integrated in a single adaptive pass over their union. Subintervals never straddle
+     * a bin edge, and only the subintervals of bins that do not yet meet the accuracy goal are bisected.
+     * The Gauss-Kronrod rule is selected by the configuration's key, as for `QAGS`.
+     *
+     * @param f       The integrand.
+     * @param edges   The non-decreasing edges of the bins.
+     * @param config  The accuracy goal for each individual bin and the Gauss-Kronrod rule.
+     *
+     * @return The integrals over the edges.size() - 1 bins; their sum is the integral over the union.
+     */
+    std::vector<double> integrate_bins(const std::function<double(const double &)> & f,
+                                       const std::vector<double> & edges,
+                                       const GSL::QAGS::Config & config = GSL::QAGS::Config());
+
 namespace cubature
 {
     template <size_t ndim_, size_t fdim_, typename ResultT_> struct integrand_traits
@@ -235,6 +253,12 @@ namespace cubature
     template <size_t ndim_, size_t fdim_ = 1, typename T_ = double>
     using integrand = typename integrand_traits<ndim_, fdim_, T_>::function_type;
 
+    /*
+     * Vector-valued integrand of one real-valued variable that is evaluated at a batch of points at once.
+     * It is called as f(x, n, results) and stores the i-th component at the point x[j] in results[j * fdim + i].
+     */
+    using batched_integrand = std::function<void (const double * x, const size_t & n, double * results)>;
+
     class Config
     {
     public:
@@ -264,6 +288,17 @@ namespace cubature
                                                                                  const typename cubature::integrand_traits<ndim_, fdim_, T_>::argument_type & b,
                                                                                  const cubature::Config &config = cubature::Config());
 
+    /*!
+     * Numerically integrate a batched vector-valued function of one real-valued variable with
+     * cubature methods.
+     *
+     * The adaptive subdivision is the same as for integrate<1, fdim_>, but all points of one
+     * subdivision pass are handed to the integrand at once.
+     */
+    template <size_t fdim_>
+    std::array<double, fdim_> integrate_batched(const cubature::batched_integrand & f, const double & a, const double & b,
+                                                const cubature::Config & config = cubature::Config());
+
 
     class IntegrationError :
         public Exception
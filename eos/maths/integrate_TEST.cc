@@ -23,6 +23,7 @@
 
 #include <cmath>
 #include <limits>
+#include <vector>
 
 #include <iostream>
 
@@ -148,5 +149,44 @@ class IntegrateTest :
             TEST_CHECK_RELATIVE_ERROR(2 * 3.43656, q9[1], eps);
             TEST_CHECK_RELATIVE_ERROR(3 * 3.43656, q9[2], eps);
             TEST_CHECK_RELATIVE_ERROR(4 * 3.43656, q9[3], eps);
+
+            // batched integration agrees with the scalar integration
+            {
+                const cubature::batched_integrand f9 = [] (const double * x, const size_t & n, double * results)
+                {
+                    for (size_t j = 0 ; j < n ; ++j)
+                    {
+                        results[j * 2 + 0] = std::log(x[j]);
+                        results[j * 2 + 1] = 2.0 * std::log(x[j]);
+                    }
+                };
+                const std::array<double, 2> q9b = integrate_batched<2>(f9, 1.0, std::exp(1), config_cubature);
+                TEST_CHECK_RELATIVE_ERROR(    i4, q9b[0], eps);
+                TEST_CHECK_RELATIVE_ERROR(2 * i4, q9b[1], eps);
+                TEST_CHECK_RELATIVE_ERROR(q7[0], q9b[0], 1e-14);
+            }
+
+            // binned integration
+            {
+                auto f3obj = std::function<double (const double &)>(&f3);
+                const std::vector<double> edges{ 0.0, 0.5, 2.0, 2.0, 10.0 };
+                const auto q10 = integrate_bins(f3obj, edges, GSL::QAGS::Config().epsrel(1e-10));
+
+                TEST_CHECK_EQUAL(q10.size(), 4u);
+                for (unsigned i = 0 ; i < q10.size() ; ++i)
+                {
+                    const double i10 = std::exp(-edges[i]) - std::exp(-edges[i + 1]);
+                    TEST_CHECK_NEARLY_EQUAL(i10, q10[i], 1e-10);
+                }
+                TEST_CHECK_RELATIVE_ERROR(i3, q10[0] + q10[1] + q10[2] + q10[3], 1e-10);
+
+                // the logarithmic singularity is confined to the first bin
+                const auto q11 = integrate_bins(f4obj, { 0.0, 1.0, std::exp(1.0) }, GSL::QAGS::Config().epsrel(1e-8));
+                TEST_CHECK_RELATIVE_ERROR(-1.0, q11[0], 1e-8);
+                TEST_CHECK_RELATIVE_ERROR( 1.0, q11[1], 1e-8);
+
+                TEST_CHECK_THROWS(IntegrationError, integrate_bins(f3obj, { 1.0 }));
+                TEST_CHECK_THROWS(IntegrationError, integrate_bins(f3obj, { 1.0, 0.0 }));
+            }
         }
 } model_test;
@@ -22,6 +22,10 @@
 #include <eos/maths/legendre-polynomial-vector.hh>
 #include <eos/maths/omnes-factor.hh>
 #include <eos/utils/exception.hh>
+#include <eos/utils/instantiation_policy-impl.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/memoise.hh>
+#include <eos/utils/thread_pool.hh>
 
 #include <gsl/gsl_blas.h>
 #include <gsl/gsl_linalg.h>
@@ -29,9 +33,68 @@
 
 #include <array>
 #include <functional>
+#include <string>
 
 namespace eos
 {
+    template <unsigned order_, unsigned nints_>
+    OmnesFactorCache<order_, nints_>::OmnesFactorCache() :
+        _mutex(new Mutex)
+    {
+        MemoisationControl::instance()->register_clear_function(std::bind(&OmnesFactorCache<order_, nints_>::clear, this));
+    }
+
+    template <unsigned order_, unsigned nints_>
+    OmnesFactorCache<order_, nints_>::~OmnesFactorCache()
+    {
+        delete _mutex;
+    }
+
+    template <unsigned order_, unsigned nints_>
+    bool OmnesFactorCache<order_, nints_>::find(const Key & key, Solution & solution) const
+    {
+        Lock l(*_mutex);
+
+        auto i = _solutions.find(key);
+        if (_solutions.end() == i)
+        {
+            return false;
+        }
+
+        solution = i->second;
+
+        return true;
+    }
+
+    template <unsigned order_, unsigned nints_>
+    void OmnesFactorCache<order_, nints_>::insert(const Key & key, const Solution & solution)
+    {
+        Lock l(*_mutex);
+
+        // each solution takes nints_ * order_ doubles; bound the memory use as for other memoisations
+        if (_solutions.size() > 10000u)
+        {
+            _solutions.clear();
+        }
+
+        _solutions.insert(std::make_pair(key, solution));
+    }
+
+    template <unsigned order_, unsigned nints_>
+    void OmnesFactorCache<order_, nints_>::clear()
+    {
+        Lock l(*_mutex);
+
+        _solutions.clear();
+    }
+
+    template <unsigned order_, unsigned nints_>
+    unsigned OmnesFactorCache<order_, nints_>::size() const
+    {
+        Lock l(*_mutex);
+
+        return _solutions.size();
+    }
 
     // Allocate memory and initialise zeros & weights
     template <unsigned order_, unsigned nints_>
@@ -46,6 +109,8 @@ namespace eos
         _b(gsl_vector_calloc(nints_ * order_ + 1)),
         _err(-1.0),
         _eps(1.0e-5),
+        _bc_pos(0.0),
+        _solve(false),
         _scattering_phase(scattering_phase)
     {
         // Perform pointer check
@@ -61,16 +126,16 @@ namespace eos
             for (unsigned j = 0 ; j < order_ ; j++)
             {
                 _slist[i * order_ + j] = (_intervals[i] + _intervals[i + 1] + (_intervals[i + 1] - _intervals[i]) * _zeros[j]) / 2.0;
-                _tanvals[i][j] = std::tan(_scattering_phase(_slist[i * order_ + j]));
             }
         }
 
         for (unsigned j = 0 ; j < order_ ; j++)
         {
             _slist[(nints_ - 1) * order_ + j] = (2.0 * _intervals[nints_ - 1] / (1 - _zeros[j]));
-            _tanvals[nints_ - 1][j] = std::tan(_scattering_phase(_slist[(nints_ - 1) * order_ + j]));
         }
 
+        compute_tanvals();
+
         LegendrePVector<order_ - 1> lp_v;
         for(unsigned i = 0 ; i < order_ ; i++)
         {
@@ -83,6 +148,87 @@ namespace eos
         }
     }
 
+    template <unsigned order_, unsigned nints_>
+    void OmnesFactor<order_, nints_>::compute_tanvals()
+    {
+        for (unsigned i = 0 ; i < nints_ ; i++)
+        {
+            for (unsigned j = 0 ; j < order_ ; j++)
+            {
+                _tanvals[i][j] = std::tan(_scattering_phase(_slist[i * order_ + j]));
+            }
+        }
+    }
+
+    template <unsigned order_, unsigned nints_>
+    std::array<double, nints_ * order_> OmnesFactor<order_, nints_>::solve_cached(const double & bc_pos)
+    {
+        typename OmnesFactorCache<order_, nints_>::Key key(_intervals.cbegin(), _intervals.cend());
+        key.push_back(bc_pos);
+        for (const auto & tanvals : _tanvals)
+        {
+            key.insert(key.end(), tanvals.cbegin(), tanvals.cend());
+        }
+
+        auto cache = OmnesFactorCache<order_, nints_>::instance();
+
+        std::array<double, nints_ * order_> result;
+        if (! cache->find(key, result))
+        {
+            result = solve_sys(bc_pos);
+            cache->insert(key, result);
+        }
+
+        return result;
+    }
+
+    template <unsigned order_, unsigned nints_>
+    void OmnesFactor<order_, nints_>::update()
+    {
+        compute_tanvals();
+
+        if (_solve)
+        {
+            _sol = solve_cached(_bc_pos);
+        }
+    }
+
+    template <unsigned order_, unsigned nints_>
+    void OmnesFactor<order_, nints_>::prepare(const std::array<double, nints_> & intervals, const std::vector<std::function<double(const double &)>> & scattering_phases, const double & bcpos)
+    {
+        std::vector<std::string> errors(scattering_phases.size());
+
+        std::vector<Ticket> tickets;
+        for (unsigned i = 0 ; i < scattering_phases.size() ; ++i)
+        {
+            tickets.push_back(ThreadPool::instance()->enqueue([&, i]()
+            {
+                try
+                {
+                    // the constructor stores the solution in the cache
+                    OmnesFactor<order_, nints_> omnes(intervals, scattering_phases[i], bcpos);
+                }
+                catch (eos::Exception & e)
+                {
+                    errors[i] = e.what();
+                }
+            }));
+        }
+
+        for (auto & t : tickets)
+        {
+            t.wait();
+        }
+
+        for (const auto & e : errors)
+        {
+            if (! e.empty())
+            {
+                throw InternalError("OmnesFactor::prepare: " + e);
+            }
+        }
+    }
+
     // Deallocate memory
     template <unsigned order_, unsigned nints_>
     OmnesFactor<order_, nints_>::~OmnesFactor()
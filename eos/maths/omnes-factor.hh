@@ -20,6 +20,8 @@
 
 #include <eos/maths/complex.hh>
 #include <eos/utils/exception.hh>
+#include <eos/utils/instantiation_policy.hh>
+#include <eos/utils/mutex.hh>
 
 #include <gsl/gsl_blas.h>
 #include <gsl/gsl_linalg.h>
@@ -27,9 +29,46 @@
 
 #include <array>
 #include <functional>
+#include <map>
+#include <vector>
 
 namespace eos
 {
+    /*
+     * Content-addressed cache of solutions of the Omnes integral equation.
+     *
+     * A solution depends on the scattering phase only through tan(phase) at the quadrature nodes. Solutions are
+     * keyed on the interval borders, the position of the boundary condition and these values, and are shared by
+     * all OmnesFactor objects of the same order and number of intervals.
+     */
+    template <unsigned order_, unsigned nints_>
+    class OmnesFactorCache :
+        public InstantiationPolicy<OmnesFactorCache<order_, nints_>, Singleton>
+    {
+        public:
+            using Key = std::vector<double>;
+            using Solution = std::array<double, nints_ * order_>;
+
+        private:
+            Mutex * const _mutex;
+
+            std::map<Key, Solution> _solutions;
+
+        public:
+            OmnesFactorCache();
+
+            ~OmnesFactorCache();
+
+            // Look up a solution, returning false if none is cached
+            bool find(const Key & key, Solution & solution) const;
+
+            void insert(const Key & key, const Solution & solution);
+
+            void clear();
+
+            unsigned size() const;
+    };
+
     // Abstract class implementing the algorithm of [M:1999A] to solve the Omnes integral equation
     template <unsigned order_, unsigned nints_>
     class OmnesFactor
@@ -64,6 +103,10 @@ namespace eos
             // Range for numerical differentiation
             double _eps;
 
+            // Position of the boundary condition, if the solution is obtained from the integral equation
+            double _bc_pos;
+            bool _solve;
+
             // Phase input
             std::function<double(const double &)> _scattering_phase;
 
@@ -85,6 +128,12 @@ namespace eos
             // Solve the system of equations
             std::array<double, nints_ * order_> solve_sys(const double & bc_pos);
 
+            // Evaluate tan(phase) at the quadrature nodes
+            void compute_tanvals();
+
+            // Obtain the solution from the OmnesFactorCache, solving the system of equations if necessary
+            std::array<double, nints_ * order_> solve_cached(const double & bc_pos);
+
             // Evaluate results
             double omnes_abs(const double & s) const;
             complex<double> evaluate_omnes(const double & s) const;
@@ -95,7 +144,7 @@ namespace eos
                 OmnesFactor(intervals, scattering_phase) { _sol = sol; }
 
             OmnesFactor(const std::array<double, nints_> & intervals, std::function<double(const double &)> scattering_phase, const double & bcpos) :
-                OmnesFactor(intervals, scattering_phase) { _sol = solve_sys(bcpos); }
+                OmnesFactor(intervals, scattering_phase) { _bc_pos = bcpos; _solve = true; _sol = solve_cached(bcpos); }
 
             // Destructor
             ~OmnesFactor();
@@ -103,6 +152,19 @@ namespace eos
             // Return weights
             std::array<double, nints_ * order_> get_weights() { return _sol; }
 
+            /*
+             * Re-evaluate the scattering phase, e.g. after a change of its parameters. If the solution was obtained
+             * from the integral equation, it is looked up in the OmnesFactorCache, or solved anew if the phase at
+             * the quadrature nodes has not been encountered before.
+             */
+            void update();
+
+            /*
+             * Solve the integral equation for several scattering phases concurrently, e.g. for a batch of parameter
+             * points, and store the solutions in the OmnesFactorCache.
+             */
+            static void prepare(const std::array<double, nints_> & intervals, const std::vector<std::function<double(const double &)>> & scattering_phases, const double & bcpos);
+
             // Return Omnes factor evaluated at s
             complex<double> constexpr operator() (const double & s) const
             {
@@ -22,6 +22,8 @@
 
 #include <cmath>
 #include <array>
+#include <functional>
+#include <vector>
 
 using namespace test;
 using namespace eos;
@@ -76,5 +78,48 @@ class OmnesFactorTest :
                 TEST_CHECK_NEARLY_EQUAL(O2(1.0),        1.0,        eps);
                 TEST_CHECK_NEARLY_EQUAL(abs(O2(16.1)),  4.80814,    eps);
             }
+
+            // content-addressed cache of solutions
+            {
+                std::array<double, 4> intervals = {4.0, 10.0, 25.0, 50.0};
+                auto cache = OmnesFactorCache<20, 4>::instance();
+                cache->clear();
+
+                double scale = 1.0;
+                auto scaled_phase = [&scale](const double & s) { return scale * test_phase(s); };
+
+                OmnesFactor<20, 4> O1(intervals, test_phase, 1.0);
+                TEST_CHECK_EQUAL(cache->size(), 1u);
+
+                // identical phases at the quadrature nodes share the solution
+                OmnesFactor<20, 4> O2(intervals, scaled_phase, 1.0);
+                TEST_CHECK_EQUAL(cache->size(), 1u);
+                TEST_CHECK_NEARLY_EQUAL(abs(O1(8.0)),   abs(O2(8.0)),   1e-14);
+
+                // a changed phase is solved anew on update
+                scale = 0.9;
+                O2.update();
+                TEST_CHECK_EQUAL(cache->size(), 2u);
+
+                OmnesFactor<20, 4> O3(intervals, scaled_phase, 1.0);
+                TEST_CHECK_EQUAL(cache->size(), 2u);
+                TEST_CHECK_NEARLY_EQUAL(abs(O2(8.0)),   abs(O3(8.0)),   1e-14);
+                TEST_CHECK_NEARLY_EQUAL(abs(O2(30.0)),  abs(O3(30.0)),  1e-14);
+                TEST_CHECK(std::abs(abs(O1(8.0)) - abs(O2(8.0))) > eps);
+
+                // batches of phases are solved concurrently
+                std::vector<std::function<double(const double &)>> phases;
+                for (double f : { 0.8, 0.7 })
+                {
+                    phases.push_back([f](const double & s) { return f * test_phase(s); });
+                }
+                OmnesFactor<20, 4>::prepare(intervals, phases, 1.0);
+                TEST_CHECK_EQUAL(cache->size(), 4u);
+
+                scale = 0.8;
+                O2.update();
+                TEST_CHECK_EQUAL(cache->size(), 4u);
+                TEST_CHECK_NEARLY_EQUAL(O2(1.0),        1.0,        eps);
+            }
     }
 } omnes_factor_test;
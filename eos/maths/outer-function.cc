@@ -20,6 +20,9 @@
 #include <eos/maths/integrate-impl.hh>
 #include <eos/maths/outer-function.hh>
 #include <eos/utils/exception.hh>
+#include <eos/utils/stringify.hh>
+
+#include <gsl/gsl_fft_complex.h>
 
 namespace eos
 {
@@ -46,4 +49,114 @@ namespace eos
         return std::exp(integrate<1, 1, complex<double>>(integrand, 0.0, 2 * M_PI, cubature::Config().epsrel(relative_precision)) / 2.0 / M_PI );
     }
 
+    OuterFunction::OuterFunction(const std::function<complex<double> (const complex<double> &)> & f, const double & relative_precision, const unsigned & max_points) :
+        _points(64)
+    {
+        auto log_abs_f = [&] (const double & t)
+        {
+            double x = std::abs(f(std::exp(complex<double>(0, t))));
+            if (std::abs(x) < 1e-16)
+            {
+                throw InternalError("Trying to compute outer function of function with zero on unit circle");
+            }
+            else if (!isfinite(x))
+            {
+                throw InternalError("Trying to compute outer function of function with pole on unit circle");
+            }
+            return std::log(x);
+        };
+
+        // log|f| on the grid t_j = 2 pi j / _points
+        std::vector<double> samples(_points);
+        for (unsigned j = 0 ; j < _points ; ++j)
+        {
+            samples[j] = log_abs_f(2.0 * M_PI * j / _points);
+        }
+
+        while (true)
+        {
+            std::vector<double> data(2 * _points, 0.0);
+            for (unsigned j = 0 ; j < _points ; ++j)
+            {
+                data[2 * j] = samples[j];
+            }
+
+            gsl_fft_complex_radix2_forward(data.data(), 1, _points);
+
+            // only the lower half of the coefficients is free of aliasing
+            _coefficients.resize(_points / 2);
+            for (unsigned k = 0 ; k < _points / 2 ; ++k)
+            {
+                _coefficients[k] = complex<double>(data[2 * k], data[2 * k + 1]) / double(_points);
+            }
+
+            double tail = 0.0;
+            for (unsigned k = _points / 4 ; k < _points / 2 ; ++k)
+            {
+                tail += 2.0 * std::abs(_coefficients[k]);
+            }
+
+            if (tail < relative_precision)
+            {
+                break;
+            }
+
+            if (2 * _points > max_points)
+            {
+                throw InternalError("OuterFunction: Fourier coefficients did not converge with " + stringify(_points) + " points on the unit circle");
+            }
+
+            // the previous samples make up every other point of the refined grid
+            std::vector<double> refined(2 * _points);
+            for (unsigned j = 0 ; j < _points ; ++j)
+            {
+                refined[2 * j]     = samples[j];
+                refined[2 * j + 1] = log_abs_f(M_PI * (2 * j + 1) / _points);
+            }
+
+            samples.swap(refined);
+            _points *= 2;
+        }
+
+        // drop trailing coefficients that do not contribute at the requested precision
+        double dropped = 0.0;
+        while (_coefficients.size() > 1)
+        {
+            const double contribution = 2.0 * std::abs(_coefficients.back());
+            if (dropped + contribution > 0.1 * relative_precision)
+            {
+                break;
+            }
+
+            dropped += contribution;
+            _coefficients.pop_back();
+        }
+    }
+
+    complex<double>
+    OuterFunction::operator() (const complex<double> & z) const
+    {
+        if (std::abs(z) >= 1.0)
+            throw InternalError("Trying to evaluate outer function outside of unit disk. This is not yet supported.");
+
+        complex<double> result = 0.0;
+        for (unsigned k = _coefficients.size() - 1 ; k > 0 ; --k)
+        {
+            result = (result + 2.0 * _coefficients[k]) * z;
+        }
+
+        return std::exp(_coefficients[0] + result);
+    }
+
+    unsigned
+    OuterFunction::points() const
+    {
+        return _points;
+    }
+
+    unsigned
+    OuterFunction::coefficients() const
+    {
+        return _coefficients.size();
+    }
 }
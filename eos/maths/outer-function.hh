@@ -23,12 +23,50 @@
 #include <eos/maths/complex.hh>
 
 #include <functional>
+#include <vector>
 
 namespace eos
 {
     /* Computes the outer function of a given function f numerically using the integral representation */
     complex<double> outer(const std::function<complex<double> (const complex<double> &)> & f, complex<double> z, double relative_precision);
 
+    /*
+     * Computes the outer function of a given function f for arbitrarily many points within the unit disk.
+     *
+     * log|f| is sampled once on an equidistant grid on the unit circle, and its Fourier coefficients c_k are
+     * obtained by FFT. Expanding the kernel of the integral representation in z yields
+     *
+     *     log outer(z) = c_0 + 2 sum_{k >= 1} c_k z^k ,
+     *
+     * which is evaluated at the cost of one Horner scheme per point. The grid is refined until the coefficients
+     * in the upper half of the resolved range add up to less than the requested precision.
+     */
+    class OuterFunction
+    {
+        private:
+            std::vector<complex<double>> _coefficients;
+
+            unsigned _points;
+
+        public:
+            /*!
+             * Constructor.
+             *
+             * @param f                  The function whose outer function shall be computed.
+             * @param relative_precision The relative precision of the outer function.
+             * @param max_points         The largest number of points on the unit circle; must be a power of two.
+             */
+            OuterFunction(const std::function<complex<double> (const complex<double> &)> & f, const double & relative_precision, const unsigned & max_points = 1u << 14);
+
+            /// Evaluate the outer function at a point z within the unit disk.
+            complex<double> operator() (const complex<double> & z) const;
+
+            /// Retrieve the number of points on the unit circle at which f has been evaluated.
+            unsigned points() const;
+
+            /// Retrieve the number of retained Fourier coefficients.
+            unsigned coefficients() const;
+    };
 }
 
 #endif
@@ -18,6 +18,7 @@
 #include <test/test.hh>
 #include <eos/maths/complex.hh>
 #include <eos/maths/outer-function.hh>
+#include <eos/utils/exception.hh>
 
 using namespace test;
 using namespace eos;
@@ -91,5 +92,32 @@ class OuterFunctionTest :
                 TEST_CHECK_NEARLY_EQUAL(outer(test_func_3, complex<double>(0.1,0.2), 1e-6).real(),  0.887640,   eps);
                 TEST_CHECK_NEARLY_EQUAL(outer(test_func_3, complex<double>(0.1,0.2), 1e-6).imag(), -0.179775,   eps);
             }
+
+            // FFT-based evaluation
+            {
+                const OuterFunction outer_2(test_func_2, 1e-6);
+                const OuterFunction outer_3(test_func_3, 1e-6);
+
+                TEST_CHECK_NEARLY_EQUAL(outer_2(0.0).real(),                          2.0,        eps);
+                TEST_CHECK_NEARLY_EQUAL(outer_2(0.5).real(),                          2.5,        eps);
+                TEST_CHECK_NEARLY_EQUAL(outer_2(0.95).real(),                         2.95,       eps);
+                TEST_CHECK_NEARLY_EQUAL(outer_2(complex<double>(0.1,0.2)).real(),     2.1,        eps);
+                TEST_CHECK_NEARLY_EQUAL(outer_2(complex<double>(0.1,0.2)).imag(),     0.2,        eps);
+
+                TEST_CHECK_NEARLY_EQUAL(outer_3(0.0).real(),                          1.0,        eps);
+                TEST_CHECK_NEARLY_EQUAL(outer_3(0.5).real(),                          0.6,        eps);
+                TEST_CHECK_NEARLY_EQUAL(outer_3(complex<double>(0.1,0.2)).real(),     0.887640,   eps);
+                TEST_CHECK_NEARLY_EQUAL(outer_3(complex<double>(0.1,0.2)).imag(),    -0.179775,   eps);
+
+                // agreement with the adaptive integration
+                for (const complex<double> z : { complex<double>(-0.7, 0.0), complex<double>(0.3, -0.6), complex<double>(0.0, 0.7) })
+                {
+                    TEST_CHECK_NEARLY_EQUAL(outer_3(z).real(), outer(test_func_3, z, 1e-6).real(), eps);
+                    TEST_CHECK_NEARLY_EQUAL(outer_3(z).imag(), outer(test_func_3, z, 1e-6).imag(), eps);
+                }
+
+                TEST_CHECK_THROWS(InternalError, outer_2(1.0));
+                TEST_CHECK_THROWS(InternalError, OuterFunction(test_func_4, 1e-6));
+            }
     }
 } outer_function_test;
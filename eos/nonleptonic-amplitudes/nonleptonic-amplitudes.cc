@@ -25,6 +25,7 @@
 #include <eos/nonleptonic-amplitudes/topological-amplitudes.hh>
 #include <eos/utils/options-impl.hh>
 
+#include <cmath>
 #include <map>
 
 namespace eos
@@ -85,6 +86,56 @@ namespace eos
                                     } }
         };
         // clang-format on
+
+        std::array<rank2, 3>
+        psd_octet_basis(const LightMeson & meson, const bool & transposed)
+        {
+            // the meson tensors are linear in cos(theta_18) and sin(theta_18), so that three evaluations fix the decomposition
+            const auto & octet = psd_octet.at(meson);
+
+            rank2 m0, m90, m180;
+            octet(0.0, m0);
+            octet(M_PI / 2.0, m90);
+            octet(M_PI, m180);
+
+            std::array<rank2, 3> result;
+            for (unsigned i = 0; i < 3; ++i)
+            {
+                for (unsigned j = 0; j < 3; ++j)
+                {
+                    result[0][i][j] = (m0[i][j] + m180[i][j]) / 2.0;
+                    result[1][i][j] = (m0[i][j] - m180[i][j]) / 2.0;
+                    result[2][i][j] = m90[i][j] - result[0][i][j];
+                }
+            }
+
+            if (transposed)
+            {
+                for (auto & m : result)
+                {
+                    transpose(m);
+                }
+            }
+
+            return result;
+        }
+
+        std::array<double, 9>
+        psd_octet_weights(const double & theta_18)
+        {
+            const std::array<double, 3> f{ 1.0, std::cos(theta_18), std::sin(theta_18) };
+
+            std::array<double, 9> result;
+            for (unsigned a = 0; a < 3; ++a)
+            {
+                for (unsigned b = 0; b < 3; ++b)
+                {
+                    result[3 * a + b] = f[a] * f[b];
+                }
+            }
+
+            return result;
+        }
     } // namespace su3f
 
     NonleptonicAmplitudes<PToPP>::~NonleptonicAmplitudes(){};
@@ -55,6 +55,125 @@ namespace eos
         };
 
         extern const std::map<LightMeson, std::function<void(const double &, rank2 &)>> psd_octet;
+
+        // Decomposition M(theta_18) = M_0 + cos(theta_18) M_c + sin(theta_18) M_s of the meson tensors, returned as { M_0, M_c, M_s }
+        std::array<rank2, 3> psd_octet_basis(const LightMeson & meson, const bool & transposed = false);
+
+        // Products f_a f_b of the basis functions f = { 1, cos(theta_18), sin(theta_18) }, indexed by 3 a + b
+        std::array<double, 9> psd_octet_weights(const double & theta_18);
+
+        /*
+         * Precontracted flavour coefficients of an amplitude
+         *
+         *   A = sum_n X_n sum_{a,b} f_a f_b (lambda_d K_{n,d,ab} + lambda_s K_{n,s,ab}),
+         *
+         * which is linear in the N_ hadronic parameters X_n and in the CKM factors lambda_d and lambda_s,
+         * and bilinear in the two meson tensors. The coefficients K are computed once from the basis of
+         * the meson tensors, so that evaluating A does not require any tensor contractions.
+         */
+        template <std::size_t N_> class Coefficients
+        {
+            private:
+                // indexed by (2 n + q) * 9 + 3 a + b, with q = 0 (1) for lambda_d (lambda_s)
+                std::array<complex<double>, 18 * N_> _values;
+
+            public:
+                // Products X_n lambda_q f_a f_b, shared among all channels with the same parameters
+                using Inputs = std::array<complex<double>, 18 * N_>;
+
+                Coefficients() :
+                    _values{}
+                {
+                }
+
+                /*
+                 * The contraction returns the contributions of all hadronic parameters for unit parameters,
+                 * and is called as contraction(p1, p2, lambda_d, lambda_s).
+                 */
+                template <typename Contraction_>
+                Coefficients(const std::array<rank2, 3> & p1, const std::array<rank2, 3> & p2, const Contraction_ & contraction) :
+                    _values{}
+                {
+                    for (unsigned q = 0; q < 2; ++q)
+                    {
+                        const complex<double> lambda_d = (0 == q) ? 1.0 : 0.0, lambda_s = (0 == q) ? 0.0 : 1.0;
+
+                        for (unsigned a = 0; a < 3; ++a)
+                        {
+                            for (unsigned b = 0; b < 3; ++b)
+                            {
+                                const std::array<complex<double>, N_> c = contraction(p1[a], p2[b], lambda_d, lambda_s);
+
+                                for (unsigned n = 0; n < N_; ++n)
+                                {
+                                    _values[(2 * n + q) * 9 + 3 * a + b] = c[n];
+                                }
+                            }
+                        }
+                    }
+                }
+
+                Coefficients &
+                operator+= (const Coefficients & rhs)
+                {
+                    for (unsigned i = 0; i < _values.size(); ++i)
+                    {
+                        _values[i] += rhs._values[i];
+                    }
+
+                    return *this;
+                }
+
+                complex<double>
+                evaluate(const std::array<complex<double>, N_> & parameters, const complex<double> & lambda_d, const complex<double> & lambda_s,
+                         const std::array<double, 9> & weights) const
+                {
+                    complex<double> result = 0.0;
+
+                    for (unsigned n = 0; n < N_; ++n)
+                    {
+                        complex<double> d = 0.0, s = 0.0;
+                        for (unsigned ab = 0; ab < 9; ++ab)
+                        {
+                            d += _values[(2 * n + 0) * 9 + ab] * weights[ab];
+                            s += _values[(2 * n + 1) * 9 + ab] * weights[ab];
+                        }
+
+                        result += parameters[n] * (lambda_d * d + lambda_s * s);
+                    }
+
+                    return result;
+                }
+
+                // Add the products of the parameters, the CKM factors, and the weights to the inputs
+                static void
+                accumulate(Inputs & inputs, const std::array<complex<double>, N_> & parameters, const complex<double> & lambda_d, const complex<double> & lambda_s,
+                           const std::array<double, 9> & weights)
+                {
+                    for (unsigned n = 0; n < N_; ++n)
+                    {
+                        const complex<double> d = parameters[n] * lambda_d, s = parameters[n] * lambda_s;
+                        for (unsigned ab = 0; ab < 9; ++ab)
+                        {
+                            inputs[(2 * n + 0) * 9 + ab] += d * weights[ab];
+                            inputs[(2 * n + 1) * 9 + ab] += s * weights[ab];
+                        }
+                    }
+                }
+
+                complex<double>
+                contract(const Inputs & inputs) const
+                {
+                    complex<double> result = 0.0;
+
+                    for (unsigned i = 0; i < _values.size(); ++i)
+                    {
+                        result += _values[i] * inputs[i];
+                    }
+
+                    return result;
+                }
+        };
     } // namespace su3f
 
     /* P -> PP transitions */
@@ -69,7 +188,7 @@ namespace eos
             virtual complex<double> inverse_amplitude() const = 0;
 
             // Amplitude for B -> [P2 P1 + P1 P2]
-            complex<double>
+            virtual complex<double>
             amplitude() const
             {
                 return ordered_amplitude() + inverse_amplitude();
@@ -30,6 +30,97 @@ namespace eos
     using std::sqrt;
     using namespace std::literals::string_literals;
 
+    namespace
+    {
+        su3f::rank1
+        Lambda(const complex<double> & lambda_d, const complex<double> & lambda_s)
+        {
+            return su3f::rank1{
+                { 0.0, lambda_d, lambda_s }
+            };
+        }
+
+        // Contraction of the flavour structure C in the a-th term of the amplitudes, with C = T[a] U + P1_u[a] I or C = 3/2 P2_c[a] U + P1_c[a] I
+        complex<double>
+        contract(const unsigned & a, const su3f::rank1 & B, const su3f::rank2 & p1, const su3f::rank2 & p2, const su3f::rank2 & C, const su3f::rank1 & Lambda)
+        {
+            complex<double> result = 0.0;
+
+            for (unsigned i = 0; i < 3; i++)
+            {
+                for (unsigned j = 0; j < 3; j++)
+                {
+                    for (unsigned k = 0; k < 3; k++)
+                    {
+                        for (unsigned l = 0; l < 3; l++)
+                        {
+                            switch (a)
+                            {
+                                case 0: result += B[i] * p1[i][j] * C[j][k] * p2[k][l] * Lambda[l]; break;
+                                case 1: result += B[i] * p1[i][j] * Lambda[j] * C[l][k] * p2[k][l]; break;
+                                case 2: result += B[i] * C[i][k] * p1[k][l] * p2[l][j] * Lambda[j]; break;
+                                case 3: result += B[i] * Lambda[i] * C[l][k] * p1[k][j] * p2[j][l]; break;
+                                case 4: result += B[i] * C[i][k] * p1[k][j] * Lambda[j] * p2[l][l]; break;
+                                case 5: result += B[i] * Lambda[i] * C[j][k] * p1[k][j] * p2[l][l]; break;
+                            }
+                        }
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        su3f::rank2
+        scale(const su3f::rank2 & M, const double & factor)
+        {
+            su3f::rank2 result = M;
+            for (auto & row : result)
+            {
+                for (auto & m : row)
+                {
+                    m *= factor;
+                }
+            }
+
+            return result;
+        }
+
+        // Contributions of the alpha parameters, with u = 1 for the parameters multiplying lambda_u and u = 3/2 for those multiplying lambda_c
+        std::array<complex<double>, 4>
+        contract_alpha(const su3f::rank1 & B, const su3f::rank2 & p1, const su3f::rank2 & p2, const su3f::rank2 & U, const su3f::rank2 & I, const double & u,
+                       const su3f::rank1 & Lambda)
+        {
+            const su3f::rank2 uU = scale(U, u);
+
+            return { contract(0, B, p1, p2, uU, Lambda), contract(1, B, p1, p2, uU, Lambda), contract(0, B, p1, p2, I, Lambda), contract(1, B, p1, p2, I, Lambda) };
+        }
+
+        // Contributions of the b parameters, with u as for the alpha parameters
+        std::array<complex<double>, 6>
+        contract_b(const su3f::rank1 & B, const su3f::rank2 & p1, const su3f::rank2 & p2, const su3f::rank2 & U, const su3f::rank2 & I, const double & u,
+                   const su3f::rank1 & Lambda)
+        {
+            const su3f::rank2 uU = scale(U, u);
+
+            return { contract(2, B, p1, p2, uU, Lambda), contract(3, B, p1, p2, uU, Lambda), contract(4, B, p1, p2, uU, Lambda),
+                     contract(5, B, p1, p2, uU, Lambda), contract(3, B, p1, p2, I, Lambda),  contract(5, B, p1, p2, I, Lambda) };
+        }
+
+        template <std::size_t N_>
+        complex<double>
+        dot(const std::array<complex<double>, N_> & parameters, const std::array<complex<double>, N_> & contributions)
+        {
+            complex<double> result = 0.0;
+            for (unsigned n = 0; n < N_; ++n)
+            {
+                result += parameters[n] * contributions[n];
+            }
+
+            return result;
+        }
+    } // namespace
+
     NonleptonicAmplitudes<PToPP> *
     QCDFRepresentation<PToPP>::make(const Parameters & p, const Options & o)
     {
@@ -123,18 +214,11 @@ namespace eos
         I[1][1] = 1;
         I[2][2] = 1;
 
-        Lambda_u = [this]()
-        {
-            return su3f::rank1{
-                { 0.0, lamdu(), lamsu() }
-            };
-        };
-        Lambda_c = [this]()
-        {
-            return su3f::rank1{
-                { 0.0, lamdc(), lamsc() }
-            };
-        };
+        const bool transposed = opt_B_bar.value();
+        const auto p1 = su3f::psd_octet_basis(opt_p1.value(), transposed), p2 = su3f::psd_octet_basis(opt_p2.value(), transposed);
+
+        ordered_coefficients = make_coefficients(p1, p2);
+        inverse_coefficients = make_coefficients(p2, p1);
     }
 
     const std::vector<OptionSpecification> QCDFRepresentation<PToPP>::options{
@@ -146,85 +230,81 @@ namespace eos
         {           "P2"_ok, { "pi^0"s, "pi^+"s, "pi^-"s, "K_d"s, "Kbar_d"s, "K_S"s, "K_u"s, "Kbar_u"s, "eta"s, "eta_prime"s },      ""s },
     };
 
-    complex<double>
-    QCDFRepresentation<PToPP>::alpha_amplitude(su3f::rank2 & p1, su3f::rank2 & p2) const
+    std::array<complex<double>, 4>
+    QCDFRepresentation<PToPP>::alpha_u_parameters() const
     {
-        complex<double> A_alpha_qcdf = 0.0;
-
-        const complex<double> alpha1 = complex<double>(this->re_alpha1(), this->im_alpha1()), alpha2 = complex<double>(this->re_alpha2(), this->im_alpha2()),
-                              b1 = complex<double>(this->re_b1(), this->im_b1()), b2 = complex<double>(this->re_b2(), this->im_b2()),
-                              bS1 = complex<double>(this->re_bS1(), this->im_bS1()), bS2 = complex<double>(this->re_bS2(), this->im_bS2()),
-
-                              alpha3_u = complex<double>(this->re_alpha3_u(), this->im_alpha3_u()), alpha3_c = complex<double>(this->re_alpha3_c(), this->im_alpha3_c()),
-                              alpha4_u = complex<double>(this->re_alpha4_u(), this->im_alpha4_u()), alpha4_c = complex<double>(this->re_alpha4_c(), this->im_alpha4_c()),
-                              b4_u = complex<double>(this->re_b4_u(), this->im_b4_u()), b4_c = complex<double>(this->re_b4_c(), this->im_b4_c()),
-                              bS4_u = complex<double>(this->re_bS4_u(), this->im_bS4_u()), bS4_c = complex<double>(this->re_bS4_c(), this->im_bS4_c()),
-
-                              alpha3EW_c = complex<double>(this->re_alpha3EW_c(), this->im_alpha3EW_c()),
-                              alpha4EW_c = complex<double>(this->re_alpha4EW_c(), this->im_alpha4EW_c()), b3EW_c = complex<double>(this->re_b3EW_c(), this->im_b3EW_c()),
-                              bS3EW_c = complex<double>(this->re_bS3EW_c(), this->im_bS3EW_c()), b4EW_c = complex<double>(this->re_b4EW_c(), this->im_b4EW_c()),
-                              bS4EW_c = complex<double>(this->re_bS4EW_c(), this->im_bS4EW_c());
-
-        std::array<complex<double>, 6> T, P1_c, P1_u, P2_c;
-
-        std::array<std::array<std::array<complex<double>, 6>, 6>, 6> C_u, C_c;
-
-        T[0] = alpha1;
-        T[1] = alpha2;
-        T[2] = b2;
-        T[3] = b1;
-        T[4] = bS2;
-        T[5] = bS1;
-
-        P1_u[0] = alpha4_u;
-        P1_u[1] = alpha3_u;
-        P1_u[3] = b4_u;
-        P1_u[5] = bS4_u;
-
-        P1_c[0] = alpha4_c;
-        P1_c[1] = alpha3_c;
-        P1_c[3] = b4_c;
-        P1_c[5] = bS4_c;
-
-        P2_c[0] = alpha4EW_c;
-        P2_c[1] = alpha3EW_c;
-        P2_c[2] = b3EW_c;
-        P2_c[3] = b4EW_c;
-        P2_c[4] = bS3EW_c;
-        P2_c[5] = bS4EW_c;
-
-        for (unsigned i = 0; i < 3; i++)
-        {
-            for (unsigned j = 0; j < 3; j++)
-            {
-                for (unsigned a = 0; a < 6; a++)
-                {
-                    C_u[a][i][j] = T[a] * U[i][j] + P1_u[a] * I[i][j];
-                    C_c[a][i][j] = 3.0 / 2.0 * P2_c[a] * U[i][j] + P1_c[a] * I[i][j];
-                }
-            }
-        }
+        return { complex<double>(this->re_alpha1(), this->im_alpha1()), complex<double>(this->re_alpha2(), this->im_alpha2()),
+                 complex<double>(this->re_alpha4_u(), this->im_alpha4_u()), complex<double>(this->re_alpha3_u(), this->im_alpha3_u()) };
+    }
+
+    std::array<complex<double>, 4>
+    QCDFRepresentation<PToPP>::alpha_c_parameters() const
+    {
+        return { complex<double>(this->re_alpha4EW_c(), this->im_alpha4EW_c()), complex<double>(this->re_alpha3EW_c(), this->im_alpha3EW_c()),
+                 complex<double>(this->re_alpha4_c(), this->im_alpha4_c()), complex<double>(this->re_alpha3_c(), this->im_alpha3_c()) };
+    }
+
+    std::array<complex<double>, 6>
+    QCDFRepresentation<PToPP>::b_u_parameters() const
+    {
+        return { complex<double>(this->re_b2(), this->im_b2()),     complex<double>(this->re_b1(), this->im_b1()),   complex<double>(this->re_bS2(), this->im_bS2()),
+                 complex<double>(this->re_bS1(), this->im_bS1()),   complex<double>(this->re_b4_u(), this->im_b4_u()), complex<double>(this->re_bS4_u(), this->im_bS4_u()) };
+    }
 
-        const auto Lambda_u = this->Lambda_u();
-        const auto Lambda_c = this->Lambda_c();
+    std::array<complex<double>, 6>
+    QCDFRepresentation<PToPP>::b_c_parameters() const
+    {
+        return { complex<double>(this->re_b3EW_c(), this->im_b3EW_c()),   complex<double>(this->re_b4EW_c(), this->im_b4EW_c()),
+                 complex<double>(this->re_bS3EW_c(), this->im_bS3EW_c()), complex<double>(this->re_bS4EW_c(), this->im_bS4EW_c()),
+                 complex<double>(this->re_b4_c(), this->im_b4_c()),       complex<double>(this->re_bS4_c(), this->im_bS4_c()) };
+    }
 
-        for (unsigned i = 0; i < 3; i++)
+    QCDFRepresentation<PToPP>::Coefficients
+    QCDFRepresentation<PToPP>::make_coefficients(const std::array<su3f::rank2, 3> & p1, const std::array<su3f::rank2, 3> & p2) const
+    {
+        const auto alpha = [this](const double & u)
         {
-            for (unsigned j = 0; j < 3; j++)
-            {
-                for (unsigned k = 0; k < 3; k++)
-                {
-                    for (unsigned l = 0; l < 3; l++)
-                    {
-                        A_alpha_qcdf += B[i] * p1[i][j] * C_u[0][j][k] * p2[k][l] * Lambda_u[l];
-                        A_alpha_qcdf += B[i] * p1[i][j] * Lambda_u[j] * C_u[1][l][k] * p2[k][l];
+            return [this, u](const su3f::rank2 & m1, const su3f::rank2 & m2, const complex<double> & lambda_d, const complex<double> & lambda_s)
+            { return contract_alpha(B, m1, m2, U, I, u, Lambda(lambda_d, lambda_s)); };
+        };
+        const auto b = [this](const double & u)
+        {
+            return [this, u](const su3f::rank2 & m1, const su3f::rank2 & m2, const complex<double> & lambda_d, const complex<double> & lambda_s)
+            { return contract_b(B, m1, m2, U, I, u, Lambda(lambda_d, lambda_s)); };
+        };
 
-                        A_alpha_qcdf += B[i] * p1[i][j] * C_c[0][j][k] * p2[k][l] * Lambda_c[l];
-                        A_alpha_qcdf += B[i] * p1[i][j] * Lambda_c[j] * C_c[1][l][k] * p2[k][l];
-                    }
-                }
-            }
-        }
+        Coefficients result;
+        result.alpha_u = su3f::Coefficients<4>(p1, p2, alpha(1.0));
+        result.alpha_c = su3f::Coefficients<4>(p1, p2, alpha(3.0 / 2.0));
+        result.b_u     = su3f::Coefficients<6>(p1, p2, b(1.0));
+        result.b_c     = su3f::Coefficients<6>(p1, p2, b(3.0 / 2.0));
+
+        return result;
+    }
+
+    std::pair<complex<double>, complex<double>>
+    QCDFRepresentation<PToPP>::evaluate(const Coefficients & coefficients) const
+    {
+        const auto            weights = su3f::psd_octet_weights(theta_18());
+        const complex<double> lamdu = this->lamdu(), lamsu = this->lamsu(), lamdc = this->lamdc(), lamsc = this->lamsc();
+        const complex<double> prefactor = complex<double>(0.0, 1.0) * Gfermi() / sqrt(2.0);
+
+        return { prefactor
+                         * (coefficients.alpha_u.evaluate(this->alpha_u_parameters(), lamdu, lamsu, weights)
+                            + coefficients.alpha_c.evaluate(this->alpha_c_parameters(), lamdc, lamsc, weights)),
+                 prefactor
+                         * (coefficients.b_u.evaluate(this->b_u_parameters(), lamdu, lamsu, weights)
+                            + coefficients.b_c.evaluate(this->b_c_parameters(), lamdc, lamsc, weights)) };
+    }
+
+    complex<double>
+    QCDFRepresentation<PToPP>::alpha_amplitude(su3f::rank2 & p1, su3f::rank2 & p2) const
+    {
+        const auto Lambda_u = Lambda(lamdu(), lamsu());
+        const auto Lambda_c = Lambda(lamdc(), lamsc());
+
+        const complex<double> A_alpha_qcdf = dot(this->alpha_u_parameters(), contract_alpha(B, p1, p2, U, I, 1.0, Lambda_u))
+                                           + dot(this->alpha_c_parameters(), contract_alpha(B, p1, p2, U, I, 3.0 / 2.0, Lambda_c));
 
         return complex<double>(0.0, 1.0) * Gfermi() / sqrt(2.0) * A_alpha_qcdf;
     }
@@ -232,86 +312,11 @@ namespace eos
     complex<double>
     QCDFRepresentation<PToPP>::b_amplitude(su3f::rank2 & p1, su3f::rank2 & p2) const
     {
-        complex<double> A_b_qcdf = 0.0;
-
-        const complex<double> alpha1 = complex<double>(this->re_alpha1(), this->im_alpha1()), alpha2 = complex<double>(this->re_alpha2(), this->im_alpha2()),
-                              b1 = complex<double>(this->re_b1(), this->im_b1()), b2 = complex<double>(this->re_b2(), this->im_b2()),
-                              bS1 = complex<double>(this->re_bS1(), this->im_bS1()), bS2 = complex<double>(this->re_bS2(), this->im_bS2()),
-
-                              alpha3_u = complex<double>(this->re_alpha3_u(), this->im_alpha3_u()), alpha3_c = complex<double>(this->re_alpha3_c(), this->im_alpha3_c()),
-                              alpha4_u = complex<double>(this->re_alpha4_u(), this->im_alpha4_u()), alpha4_c = complex<double>(this->re_alpha4_c(), this->im_alpha4_c()),
-                              b4_u = complex<double>(this->re_b4_u(), this->im_b4_u()), b4_c = complex<double>(this->re_b4_c(), this->im_b4_c()),
-                              bS4_u = complex<double>(this->re_bS4_u(), this->im_bS4_u()), bS4_c = complex<double>(this->re_bS4_c(), this->im_bS4_c()),
-
-                              alpha3EW_c = complex<double>(this->re_alpha3EW_c(), this->im_alpha3EW_c()),
-                              alpha4EW_c = complex<double>(this->re_alpha4EW_c(), this->im_alpha4EW_c()), b3EW_c = complex<double>(this->re_b3EW_c(), this->im_b3EW_c()),
-                              bS3EW_c = complex<double>(this->re_bS3EW_c(), this->im_bS3EW_c()), b4EW_c = complex<double>(this->re_b4EW_c(), this->im_b4EW_c()),
-                              bS4EW_c = complex<double>(this->re_bS4EW_c(), this->im_bS4EW_c());
-
-        std::array<complex<double>, 6> T, P1_c, P1_u, P2_c;
-
-        std::array<std::array<std::array<complex<double>, 6>, 6>, 6> C_u, C_c;
-
-        T[0] = alpha1;
-        T[1] = alpha2;
-        T[2] = b2;
-        T[3] = b1;
-        T[4] = bS2;
-        T[5] = bS1;
-
-        P1_u[0] = alpha4_u;
-        P1_u[1] = alpha3_u;
-        P1_u[3] = b4_u;
-        P1_u[5] = bS4_u;
-
-        P1_c[0] = alpha4_c;
-        P1_c[1] = alpha3_c;
-        P1_c[3] = b4_c;
-        P1_c[5] = bS4_c;
-
-        P2_c[0] = alpha4EW_c;
-        P2_c[1] = alpha3EW_c;
-        P2_c[2] = b3EW_c;
-        P2_c[3] = b4EW_c;
-        P2_c[4] = bS3EW_c;
-        P2_c[5] = bS4EW_c;
-
-        for (unsigned i = 0; i < 3; i++)
-        {
-            for (unsigned j = 0; j < 3; j++)
-            {
-                for (unsigned a = 0; a < 6; a++)
-                {
-                    C_u[a][i][j] = T[a] * U[i][j] + P1_u[a] * I[i][j];
-                    C_c[a][i][j] = 3.0 / 2.0 * P2_c[a] * U[i][j] + P1_c[a] * I[i][j];
-                }
-            }
-        }
-
-        const auto Lambda_u = this->Lambda_u();
-        const auto Lambda_c = this->Lambda_c();
+        const auto Lambda_u = Lambda(lamdu(), lamsu());
+        const auto Lambda_c = Lambda(lamdc(), lamsc());
 
-        for (unsigned i = 0; i < 3; i++)
-        {
-            for (unsigned j = 0; j < 3; j++)
-            {
-                for (unsigned k = 0; k < 3; k++)
-                {
-                    for (unsigned l = 0; l < 3; l++)
-                    {
-                        A_b_qcdf += B[i] * C_u[2][i][k] * p1[k][l] * p2[l][j] * Lambda_u[j];
-                        A_b_qcdf += B[i] * Lambda_u[i] * C_u[3][l][k] * p1[k][j] * p2[j][l];
-                        A_b_qcdf += B[i] * C_u[4][i][k] * p1[k][j] * Lambda_u[j] * p2[l][l];
-                        A_b_qcdf += B[i] * Lambda_u[i] * C_u[5][j][k] * p1[k][j] * p2[l][l];
-
-                        A_b_qcdf += B[i] * C_c[2][i][k] * p1[k][l] * p2[l][j] * Lambda_c[j];
-                        A_b_qcdf += B[i] * Lambda_c[i] * C_c[3][l][k] * p1[k][j] * p2[j][l];
-                        A_b_qcdf += B[i] * C_c[4][i][k] * p1[k][j] * Lambda_c[j] * p2[l][l];
-                        A_b_qcdf += B[i] * Lambda_c[i] * C_c[5][j][k] * p1[k][j] * p2[l][l];
-                    }
-                }
-            }
-        }
+        const complex<double> A_b_qcdf = dot(this->b_u_parameters(), contract_b(B, p1, p2, U, I, 1.0, Lambda_u))
+                                       + dot(this->b_c_parameters(), contract_b(B, p1, p2, U, I, 3.0 / 2.0, Lambda_c));
 
         return complex<double>(0.0, 1.0) * Gfermi() / sqrt(2.0) * A_b_qcdf;
     }
@@ -319,28 +324,16 @@ namespace eos
     complex<double>
     QCDFRepresentation<PToPP>::ordered_amplitude() const
     {
-        this->update();
+        const auto [alpha, b] = this->evaluate(ordered_coefficients);
 
-        if (opt_B_bar.value())
-        {
-            su3f::transpose(P1);
-            su3f::transpose(P2);
-        }
-
-        return power_of<2>(mB()) * FP1() * fP2() / (1 - power_of<2>(mP2() / mB_q_0())) * this->alpha_amplitude(P1, P2) + fB() * fP1() * fP2() * this->b_amplitude(P1, P2);
+        return power_of<2>(mB()) * FP1() * fP2() / (1 - power_of<2>(mP2() / mB_q_0())) * alpha + fB() * fP1() * fP2() * b;
     }
 
     complex<double>
     QCDFRepresentation<PToPP>::inverse_amplitude() const
     {
-        this->update();
-
-        if (opt_B_bar.value())
-        {
-            su3f::transpose(P1);
-            su3f::transpose(P2);
-        }
+        const auto [alpha, b] = this->evaluate(inverse_coefficients);
 
-        return power_of<2>(mB()) * FP2() * fP1() / (1 - power_of<2>(mP1() / mB_q_0())) * this->alpha_amplitude(P2, P1) + fB() * fP1() * fP2() * this->b_amplitude(P2, P1);
+        return power_of<2>(mB()) * FP2() * fP1() / (1 - power_of<2>(mP1() / mB_q_0())) * alpha + fB() * fP1() * fP2() * b;
     }
 } // namespace eos
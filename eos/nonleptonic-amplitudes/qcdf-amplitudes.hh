@@ -45,9 +45,18 @@ namespace eos
 
             UsedParameter theta_18;
 
-            su3f::rank1                  B;
-            std::function<su3f::rank1()> Lambda_u, Lambda_c;
-            mutable su3f::rank2          P1, P2, U, I;
+            su3f::rank1         B;
+            mutable su3f::rank2 P1, P2, U, I;
+
+            // Flavour coefficients of the parameters multiplying the CKM factors lambda_u and lambda_c, respectively
+            struct Coefficients
+            {
+                    su3f::Coefficients<4> alpha_u, alpha_c;
+                    su3f::Coefficients<6> b_u, b_c;
+            };
+
+            // Flavour coefficients of B -> P1 P2 and B -> P2 P1
+            Coefficients ordered_coefficients, inverse_coefficients;
 
             UsedParameter Gfermi;
             UsedParameter mB;
@@ -90,6 +99,20 @@ namespace eos
             std::function<complex<double>()> lamdc;
             std::function<complex<double>()> lamsc;
 
+            // Hadronic parameters in the order alpha1, alpha2, alpha4_u, alpha3_u
+            std::array<complex<double>, 4> alpha_u_parameters() const;
+            // Hadronic parameters in the order alpha4EW_c, alpha3EW_c, alpha4_c, alpha3_c
+            std::array<complex<double>, 4> alpha_c_parameters() const;
+            // Hadronic parameters in the order b2, b1, bS2, bS1, b4_u, bS4_u
+            std::array<complex<double>, 6> b_u_parameters() const;
+            // Hadronic parameters in the order b3EW_c, b4EW_c, bS3EW_c, bS4EW_c, b4_c, bS4_c
+            std::array<complex<double>, 6> b_c_parameters() const;
+
+            Coefficients make_coefficients(const std::array<su3f::rank2, 3> & p1, const std::array<su3f::rank2, 3> & p2) const;
+
+            // Evaluate the alpha and b amplitudes from the coefficients, including the factor i G_F / sqrt(2)
+            std::pair<complex<double>, complex<double>> evaluate(const Coefficients & coefficients) const;
+
         public:
             QCDFRepresentation(const Parameters & p, const Options & o);
 
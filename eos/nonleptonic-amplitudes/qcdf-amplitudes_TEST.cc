@@ -183,6 +183,30 @@ class QCDFAmplitudesTest : public TestCase
                 TEST_CHECK_RELATIVE_ERROR_C(d7.ordered_amplitude(), complex<double>(-7.836971891724648e-7, 2.7757074325068556e-8), eps);
                 TEST_CHECK_RELATIVE_ERROR_C(d7.inverse_amplitude(), complex<double>(-1.886061740105515e-7, -2.4826978870673098e-8), eps);
                 TEST_CHECK_RELATIVE_ERROR_C(d7.amplitude(), complex<double>(-9.723033631830163e-7, 2.930095454395456e-9), eps);
+
+                // the precontracted flavour coefficients agree with the explicit tensor contractions
+                {
+                    p["eta::theta_18"] = 0.4;
+
+                    QCDFRepresentation<PToPP> d8(p, o7 + Options{ { "B-bar"_ok, "true" } });
+
+                    su3f::rank2 p1, p2;
+                    su3f::psd_octet.at(LightMeson::K0)(0.4, p1);
+                    su3f::psd_octet.at(LightMeson::etap)(0.4, p2);
+                    su3f::transpose(p1);
+                    su3f::transpose(p2);
+
+                    const double mB = p["mass::B_d"](), mB_0 = p["mass::B_d,0@BSZ2015"](), mP1 = p["mass::K_d"](), mP2 = p["mass::eta_prime"]();
+                    const double FP1 = p["B_d->K_d::f_+(0)"](), FP2 = p["B_d->eta_prime::f_+(0)"]();
+                    const double fB = p["decay-constant::B_d"](), fP1 = p["decay-constant::K_d"](), fP2 = p["decay-constant::eta_prime"]();
+
+                    TEST_CHECK_RELATIVE_ERROR_C(d8.ordered_amplitude(),
+                                                mB * mB * FP1 * fP2 / (1.0 - mP2 * mP2 / (mB_0 * mB_0)) * d8.alpha_amplitude(p1, p2) + fB * fP1 * fP2 * d8.b_amplitude(p1, p2),
+                                                eps);
+                    TEST_CHECK_RELATIVE_ERROR_C(d8.inverse_amplitude(),
+                                                mB * mB * FP2 * fP1 / (1.0 - mP1 * mP1 / (mB_0 * mB_0)) * d8.alpha_amplitude(p2, p1) + fB * fP1 * fP2 * d8.b_amplitude(p2, p1),
+                                                eps);
+                }
             }
         }
 } qcdf_amplitudes_test;
@@ -30,6 +30,96 @@ namespace eos
     using std::sqrt;
     using namespace std::literals::string_literals;
 
+    namespace
+    {
+        // Hamiltonian tensors in terms of the CKM factors lambda_d and lambda_s, identical for the tree (bar) and penguin (tilde) parts
+        su3f::rank1
+        H3(const complex<double> & lambda_d, const complex<double> & lambda_s)
+        {
+            return su3f::rank1{
+                { 0.0, lambda_d, lambda_s }
+            };
+        }
+
+        su3f::rank3
+        H6(const complex<double> & lambda_d, const complex<double> & lambda_s)
+        {
+            su3f::rank3 result;
+            result[0][1][0] = +lambda_d;
+            result[1][0][0] = -lambda_d;
+            result[1][2][2] = +lambda_d;
+            result[2][1][2] = -lambda_d;
+            result[0][2][0] = +lambda_s;
+            result[2][0][0] = -lambda_s;
+            result[2][1][1] = +lambda_s; // Corrected with respect to typo in [HTX:2021A]
+            result[1][2][1] = -lambda_s; // Corrected with respect to typo in [HTX:2021A]
+            return result;
+        }
+
+        su3f::rank3
+        H15(const complex<double> & lambda_d, const complex<double> & lambda_s)
+        {
+            su3f::rank3 result;
+            result[0][1][0] = +3.0 * lambda_d;
+            result[1][0][0] = +3.0 * lambda_d;
+            result[1][1][1] = -2.0 * lambda_d;
+            result[1][2][2] = -lambda_d;
+            result[2][1][2] = -lambda_d;
+            result[0][2][0] = +3.0 * lambda_s;
+            result[2][0][0] = +3.0 * lambda_s;
+            result[2][2][2] = -2.0 * lambda_s;
+            result[2][1][1] = -lambda_s; // Corrected with respect to typo in [HTX:2021A]
+            result[1][2][1] = -lambda_s; // Corrected with respect to typo in [HTX:2021A]
+            return result;
+        }
+
+        // Contributions of each hadronic parameter, in the order A3, C3, A6, C6, A15, C15, B3, B6, B15, D3
+        std::array<complex<double>, 10>
+        contract(const su3f::rank1 & B, const su3f::rank2 & p1, const su3f::rank2 & p2, const su3f::rank1 & H3, const su3f::rank3 & H6, const su3f::rank3 & H15)
+        {
+            std::array<complex<double>, 10> result{};
+
+            for (unsigned i = 0; i < 3; i++)
+            {
+                for (unsigned j = 0; j < 3; j++)
+                {
+                    for (unsigned k = 0; k < 3; k++)
+                    {
+                        result[0] += B[i] * H3[i] * p1[j][k] * p2[k][j];
+                        result[1] += B[i] * p1[i][j] * p2[j][k] * H3[k];
+                        result[6] += B[i] * H3[i] * p1[k][k] * p2[j][j];
+                        result[9] += B[i] * p1[i][j] * H3[j] * p2[k][k];
+
+                        for (unsigned l = 0; l < 3; l++)
+                        {
+                            result[2] += B[i] * H6[i][j][k] * p1[l][j] * p2[k][l];
+                            result[3] += B[i] * p1[i][j] * H6[j][l][k] * p2[k][l];
+                            result[7] += B[i] * H6[i][j][k] * p1[k][j] * p2[l][l];
+
+                            result[4] += B[i] * H15[i][j][k] * p1[l][j] * p2[k][l];
+                            result[5] += B[i] * p1[i][j] * H15[j][k][l] * p2[l][k];
+                            result[8] += B[i] * H15[i][j][k] * p1[k][j] * p2[l][l];
+                        }
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        complex<double>
+        dot(const std::array<complex<double>, 10> & parameters, const std::array<complex<double>, 10> & contributions)
+        {
+            complex<double> result = 0.0;
+            for (unsigned n = 0; n < 10; ++n)
+            {
+                result += parameters[n] * contributions[n];
+            }
+
+            return result;
+        }
+    } // namespace
+
     NonleptonicAmplitudes<PToPP> *
     SU3FRepresentation<PToPP>::make(const Parameters & p, const Options & o)
     {
@@ -106,78 +196,21 @@ namespace eos
             lamst = [this]() { return conj(model->ckm_tb()) * model->ckm_ts(); };
         }
 
-        H3bar = [this]()
-        {
-            return su3f::rank1{
-                { 0.0, lamdu(), lamsu() }
-            };
-        };
-        H3tilde = [this]()
-        {
-            return su3f::rank1{
-                { 0.0, lamdt(), lamst() }
-            };
-        };
-
-        H6bar = [this]()
-        {
-            su3f::rank3 result;
-            result[0][1][0] = +lamdu();
-            result[1][0][0] = -lamdu();
-            result[1][2][2] = +lamdu();
-            result[2][1][2] = -lamdu();
-            result[0][2][0] = +lamsu();
-            result[2][0][0] = -lamsu();
-            result[2][1][1] = +lamsu(); // Corrected with respect to typo in [HTX:2021A]
-            result[1][2][1] = -lamsu(); // Corrected with respect to typo in [HTX:2021A]
-            return result;
-        };
-
-        H15bar = [this]()
+        const bool transposed = opt_B_bar.value();
+        const auto p1 = su3f::psd_octet_basis(opt_p1.value(), transposed), p2 = su3f::psd_octet_basis(opt_p2.value(), transposed);
+        const auto contraction = [this](const su3f::rank2 & m1, const su3f::rank2 & m2, const complex<double> & lambda_d, const complex<double> & lambda_s)
         {
-            su3f::rank3 result;
-            result[0][1][0] = +3.0 * lamdu();
-            result[1][0][0] = +3.0 * lamdu();
-            result[1][1][1] = -2.0 * lamdu();
-            result[1][2][2] = -lamdu();
-            result[2][1][2] = -lamdu();
-            result[0][2][0] = +3.0 * lamsu();
-            result[2][0][0] = +3.0 * lamsu();
-            result[2][2][2] = -2.0 * lamsu();
-            result[2][1][1] = -lamsu(); // Corrected with respect to typo in [HTX:2021A]
-            result[1][2][1] = -lamsu(); // Corrected with respect to typo in [HTX:2021A]
-            return result;
+            return contract(B, m1, m2, H3(lambda_d, lambda_s), H6(lambda_d, lambda_s), H15(lambda_d, lambda_s));
         };
 
-        H6tilde = [this]()
-        {
-            su3f::rank3 result;
-            result[0][1][0] = +lamdt();
-            result[1][0][0] = -lamdt();
-            result[1][2][2] = +lamdt();
-            result[2][1][2] = -lamdt();
-            result[0][2][0] = +lamst();
-            result[2][0][0] = -lamst();
-            result[2][1][1] = +lamst(); // Corrected with respect to typo in [HTX:2021A]
-            result[1][2][1] = -lamst(); // Corrected with respect to typo in [HTX:2021A]
-            return result;
-        };
+        ordered_coefficients   = su3f::Coefficients<10>(p1, p2, contraction);
+        inverse_coefficients   = su3f::Coefficients<10>(p2, p1, contraction);
+        amplitude_coefficients = ordered_coefficients;
+        amplitude_coefficients += inverse_coefficients;
 
-        H15tilde = [this]()
-        {
-            su3f::rank3 result;
-            result[0][1][0] = +3.0 * lamdt();
-            result[1][0][0] = +3.0 * lamdt();
-            result[1][1][1] = -2.0 * lamdt();
-            result[1][2][2] = -lamdt();
-            result[2][1][2] = -lamdt();
-            result[0][2][0] = +3.0 * lamst();
-            result[2][0][0] = +3.0 * lamst();
-            result[2][2][2] = -2.0 * lamst();
-            result[2][1][1] = -lamst(); // Corrected with respect to typo in [HTX:2021A]
-            result[1][2][1] = -lamst(); // Corrected with respect to typo in [HTX:2021A]
-            return result;
-        };
+        const auto q1 = su3f::psd_octet_basis(opt_p1.value()), q2 = su3f::psd_octet_basis(opt_p2.value());
+        symmetric_coefficients = su3f::Coefficients<10>(q1, q2, contraction);
+        symmetric_coefficients += su3f::Coefficients<10>(q2, q1, contraction);
     }
 
     const std::vector<OptionSpecification> SU3FRepresentation<PToPP>::options{
@@ -189,126 +222,134 @@ namespace eos
         {           "P2"_ok, { "pi^0"s, "pi^+"s, "pi^-"s, "K_d"s, "Kbar_d"s, "K_S"s, "K_u"s, "Kbar_u"s, "eta"s, "eta_prime"s },      ""s },
     };
 
-    complex<double>
-    SU3FRepresentation<PToPP>::tree_amplitude(su3f::rank2 & p1, su3f::rank2 & p2) const
+    std::array<complex<double>, 10>
+    SU3FRepresentation<PToPP>::tree_parameters() const
     {
-        complex<double>       T_ira = 0.0;
-        const complex<double> AT3 = complex<double>(this->re_AT3(), this->im_AT3()), CT3 = complex<double>(this->re_CT3(), this->im_CT3()),
-                              AT6 = complex<double>(this->re_AT6(), this->im_AT6()), CT6 = complex<double>(this->re_CT6(), this->im_CT6()),
-                              AT15 = complex<double>(this->re_AT15(), this->im_AT15()), CT15 = complex<double>(this->re_CT15(), this->im_CT15()),
-                              BT3 = complex<double>(this->re_BT3(), this->im_BT3()), BT6 = complex<double>(this->re_BT6(), this->im_BT6()),
-                              BT15 = complex<double>(this->re_BT15(), this->im_BT15()), DT3 = complex<double>(this->re_DT3(), this->im_DT3());
-
-        const auto H3bar  = this->H3bar();
-        const auto H6bar  = this->H6bar();
-        const auto H15bar = this->H15bar();
-
-        for (unsigned i = 0; i < 3; i++)
-        {
-            for (unsigned j = 0; j < 3; j++)
-            {
-                for (unsigned k = 0; k < 3; k++)
-                {
-                    T_ira += AT3 * B[i] * H3bar[i] * p1[j][k] * p2[k][j];
-                    T_ira += CT3 * B[i] * p1[i][j] * p2[j][k] * H3bar[k];
-                    T_ira += BT3 * B[i] * H3bar[i] * p1[k][k] * p2[j][j];
-                    T_ira += DT3 * B[i] * p1[i][j] * H3bar[j] * p2[k][k];
+        return { complex<double>(this->re_AT3(), this->im_AT3()),   complex<double>(this->re_CT3(), this->im_CT3()),   complex<double>(this->re_AT6(), this->im_AT6()),
+                 complex<double>(this->re_CT6(), this->im_CT6()),   complex<double>(this->re_AT15(), this->im_AT15()), complex<double>(this->re_CT15(), this->im_CT15()),
+                 complex<double>(this->re_BT3(), this->im_BT3()),   complex<double>(this->re_BT6(), this->im_BT6()),   complex<double>(this->re_BT15(), this->im_BT15()),
+                 complex<double>(this->re_DT3(), this->im_DT3()) };
+    }
 
-                    for (unsigned l = 0; l < 3; l++)
-                    {
-                        T_ira += AT6 * B[i] * H6bar[i][j][k] * p1[l][j] * p2[k][l];
-                        T_ira += CT6 * B[i] * p1[i][j] * H6bar[j][l][k] * p2[k][l];
-                        T_ira += BT6 * B[i] * H6bar[i][j][k] * p1[k][j] * p2[l][l];
+    std::array<complex<double>, 10>
+    SU3FRepresentation<PToPP>::penguin_parameters() const
+    {
+        return { complex<double>(this->re_AP3(), this->im_AP3()),   complex<double>(this->re_CP3(), this->im_CP3()),   complex<double>(this->re_AP6(), this->im_AP6()),
+                 complex<double>(this->re_CP6(), this->im_CP6()),   complex<double>(this->re_AP15(), this->im_AP15()), complex<double>(this->re_CP15(), this->im_CP15()),
+                 complex<double>(this->re_BP3(), this->im_BP3()),   complex<double>(this->re_BP6(), this->im_BP6()),   complex<double>(this->re_BP15(), this->im_BP15()),
+                 complex<double>(this->re_DP3(), this->im_DP3()) };
+    }
 
-                        T_ira += AT15 * B[i] * H15bar[i][j][k] * p1[l][j] * p2[k][l];
-                        T_ira += CT15 * B[i] * p1[i][j] * H15bar[j][k][l] * p2[l][k];
-                        T_ira += BT15 * B[i] * H15bar[i][j][k] * p1[k][j] * p2[l][l];
-                    }
-                }
-            }
-        }
+    complex<double>
+    SU3FRepresentation<PToPP>::tree_amplitude(su3f::rank2 & p1, su3f::rank2 & p2) const
+    {
+        const complex<double> lamdu = this->lamdu(), lamsu = this->lamsu();
 
-        return T_ira;
+        return dot(this->tree_parameters(), contract(B, p1, p2, H3(lamdu, lamsu), H6(lamdu, lamsu), H15(lamdu, lamsu)));
     }
 
     complex<double>
     SU3FRepresentation<PToPP>::penguin_amplitude(su3f::rank2 & p1, su3f::rank2 & p2) const
     {
-        complex<double>       P_ira = 0.0;
-        const complex<double> AP3 = complex<double>(this->re_AP3(), this->im_AP3()), CP3 = complex<double>(this->re_CP3(), this->im_CP3()),
-                              AP6 = complex<double>(this->re_AP6(), this->im_AP6()), CP6 = complex<double>(this->re_CP6(), this->im_CP6()),
-                              AP15 = complex<double>(this->re_AP15(), this->im_AP15()), CP15 = complex<double>(this->re_CP15(), this->im_CP15()),
-                              BP3 = complex<double>(this->re_BP3(), this->im_BP3()), BP6 = complex<double>(this->re_BP6(), this->im_BP6()),
-                              BP15 = complex<double>(this->re_BP15(), this->im_BP15()), DP3 = complex<double>(this->re_DP3(), this->im_DP3());
-
-        const auto H3tilde  = this->H3tilde();
-        const auto H6tilde  = this->H6tilde();
-        const auto H15tilde = this->H15tilde();
-
-        for (unsigned i = 0; i < 3; i++)
-        {
-            for (unsigned j = 0; j < 3; j++)
-            {
-                for (unsigned k = 0; k < 3; k++)
-                {
-                    P_ira += AP3 * B[i] * H3tilde[i] * p1[j][k] * p2[k][j];
-                    P_ira += CP3 * B[i] * p1[i][j] * p2[j][k] * H3tilde[k];
-                    P_ira += BP3 * B[i] * H3tilde[i] * p1[k][k] * p2[j][j];
-                    P_ira += DP3 * B[i] * p1[i][j] * H3tilde[j] * p2[k][k];
-
-                    for (unsigned l = 0; l < 3; l++)
-                    {
-                        P_ira += AP6 * B[i] * H6tilde[i][j][k] * p1[l][j] * p2[k][l];
-                        P_ira += CP6 * B[i] * p1[i][j] * H6tilde[j][l][k] * p2[k][l];
-                        P_ira += BP6 * B[i] * H6tilde[i][j][k] * p1[k][j] * p2[l][l];
+        const complex<double> lamdt = this->lamdt(), lamst = this->lamst();
 
-                        P_ira += AP15 * B[i] * H15tilde[i][j][k] * p1[l][j] * p2[k][l];
-                        P_ira += CP15 * B[i] * p1[i][j] * H15tilde[j][k][l] * p2[l][k];
-                        P_ira += BP15 * B[i] * H15tilde[i][j][k] * p1[k][j] * p2[l][l];
-                    }
-                }
-            }
-        }
-
-        return P_ira;
+        return dot(this->penguin_parameters(), contract(B, p1, p2, H3(lamdt, lamst), H6(lamdt, lamst), H15(lamdt, lamst)));
     }
 
     complex<double>
     SU3FRepresentation<PToPP>::ordered_amplitude() const
     {
-        this->update();
+        const auto weights = su3f::psd_octet_weights(theta_18());
 
-        if (opt_B_bar.value())
-        {
-            su3f::transpose(P1);
-            su3f::transpose(P2);
-        }
-
-        return complex<double>(0.0, 1.0) * Gfermi() / sqrt(2.0) * (this->tree_amplitude(P1, P2) + this->penguin_amplitude(P1, P2));
+        return complex<double>(0.0, 1.0) * Gfermi() / sqrt(2.0)
+               * (ordered_coefficients.evaluate(this->tree_parameters(), lamdu(), lamsu(), weights)
+                  + ordered_coefficients.evaluate(this->penguin_parameters(), lamdt(), lamst(), weights));
     }
 
     complex<double>
     SU3FRepresentation<PToPP>::inverse_amplitude() const
     {
-        this->update();
+        const auto weights = su3f::psd_octet_weights(theta_18());
 
-        if (opt_B_bar.value())
-        {
-            su3f::transpose(P1);
-            su3f::transpose(P2);
-        }
+        return complex<double>(0.0, 1.0) * Gfermi() / sqrt(2.0)
+               * (inverse_coefficients.evaluate(this->tree_parameters(), lamdu(), lamsu(), weights)
+                  + inverse_coefficients.evaluate(this->penguin_parameters(), lamdt(), lamst(), weights));
+    }
+
+    complex<double>
+    SU3FRepresentation<PToPP>::amplitude() const
+    {
+        const auto weights = su3f::psd_octet_weights(theta_18());
 
-        return complex<double>(0.0, 1.0) * Gfermi() / sqrt(2.0) * (this->tree_amplitude(P2, P1) + this->penguin_amplitude(P2, P1));
+        return complex<double>(0.0, 1.0) * Gfermi() / sqrt(2.0)
+               * (amplitude_coefficients.evaluate(this->tree_parameters(), lamdu(), lamsu(), weights)
+                  + amplitude_coefficients.evaluate(this->penguin_parameters(), lamdt(), lamst(), weights));
     }
 
     complex<double>
     SU3FRepresentation<PToPP>::penguin_correction() const
     {
-        this->update();
+        const auto            weights = su3f::psd_octet_weights(theta_18());
+        const complex<double> lamdu = this->lamdu(), lamdt = this->lamdt();
 
-        auto penguin = (this->penguin_amplitude(P1, P2) + this->penguin_amplitude(P2, P1)) / lamdt();
-        auto tree    = (this->tree_amplitude(P1, P2) + this->tree_amplitude(P2, P1)) / lamdu();
+        auto penguin = symmetric_coefficients.evaluate(this->penguin_parameters(), lamdt, lamst(), weights) / lamdt;
+        auto tree    = symmetric_coefficients.evaluate(this->tree_parameters(), lamdu, lamsu(), weights) / lamdu;
 
         return -penguin / (tree - penguin);
     }
+
+    SU3FRepresentation<PToPP>::Channels::Channels(const Parameters & p, const Options & o, const std::vector<Options> & channels)
+    {
+        Context ctx("When constructing B->PP SU3 amplitudes for several channels");
+
+        for (const auto & c : channels)
+        {
+            if (c.has("model"_ok) && (c["model"_ok] != o.get("model"_ok, "SM")))
+            {
+                throw InternalError("SU3FRepresentation<PToPP>::Channels: all channels must share the same model");
+            }
+
+            _channels.push_back(std::make_shared<SU3FRepresentation<PToPP>>(p, o + c));
+            uses(*_channels.back());
+        }
+    }
+
+    std::vector<complex<double>>
+    SU3FRepresentation<PToPP>::Channels::amplitudes() const
+    {
+        std::vector<complex<double>> result(_channels.size(), 0.0);
+
+        if (_channels.empty())
+        {
+            return result;
+        }
+
+        const auto & first     = *_channels.front();
+        const auto   tree      = first.tree_parameters();
+        const auto   penguin   = first.penguin_parameters();
+        const auto   weights   = su3f::psd_octet_weights(first.theta_18());
+        const auto   prefactor = complex<double>(0.0, 1.0) * first.Gfermi() / sqrt(2.0);
+
+        // the CKM factors depend on the channel only through their conjugation; the inputs are built on first use
+        std::array<su3f::Coefficients<10>::Inputs, 2> inputs;
+        std::array<bool, 2>                           has_inputs{ false, false };
+
+        for (unsigned i = 0; i < _channels.size(); ++i)
+        {
+            const auto &   c = *_channels[i];
+            const unsigned k = (c.opt_cp_conjugate.value() != c.opt_B_bar.value()) ? 0 : 1;
+
+            if (! has_inputs[k])
+            {
+                inputs[k].fill(0.0);
+                su3f::Coefficients<10>::accumulate(inputs[k], tree, c.lamdu(), c.lamsu(), weights);
+                su3f::Coefficients<10>::accumulate(inputs[k], penguin, c.lamdt(), c.lamst(), weights);
+                has_inputs[k] = true;
+            }
+
+            result[i] = prefactor * c.amplitude_coefficients.contract(inputs[k]);
+        }
+
+        return result;
+    }
 } // namespace eos
@@ -342,6 +342,54 @@ class SU3AmplitudesTest : public TestCase
 
                 TEST_CHECK_RELATIVE_ERROR_C(ddd.amplitude(), complex<double>(-7.954812813802883e-7, -2.7323931112216412e-8), eps);
 
+                // the precontracted flavour coefficients agree with the explicit tensor contractions
+                {
+                    Options oB{
+                        {            "q"_ok,         "s" },
+                        {           "P1"_ok, "eta_prime" },
+                        {           "P2"_ok,       "K_S" },
+                        {        "model"_ok,       "CKM" },
+                        {        "B-bar"_ok,      "true" },
+                        { "cp-conjugate"_ok,     "false" }
+                    };
+
+                    SU3FRepresentation<PToPP> dB(p, oB);
+
+                    const complex<double> prefactor = complex<double>(0.0, 1.0) * p["WET::G_Fermi"]() / std::sqrt(2.0);
+                    const auto            model     = Model::make("CKM", p, Options{});
+                    const complex<double> lamdu     = model->ckm_ub() * conj(model->ckm_ud());
+                    const complex<double> lamdt     = model->ckm_tb() * conj(model->ckm_td());
+
+                    su3f::rank2 p1, p2;
+                    su3f::psd_octet.at(LightMeson::etap)(p["eta::theta_18"](), p1);
+                    su3f::psd_octet.at(LightMeson::KS)(p["eta::theta_18"](), p2);
+
+                    const complex<double> penguin = (dB.penguin_amplitude(p1, p2) + dB.penguin_amplitude(p2, p1)) / lamdt;
+                    const complex<double> tree    = (dB.tree_amplitude(p1, p2) + dB.tree_amplitude(p2, p1)) / lamdu;
+                    TEST_CHECK_RELATIVE_ERROR_C(dB.penguin_correction(), -penguin / (tree - penguin), eps);
+
+                    su3f::transpose(p1);
+                    su3f::transpose(p2);
+
+                    const complex<double> ordered = prefactor * (dB.tree_amplitude(p1, p2) + dB.penguin_amplitude(p1, p2));
+                    const complex<double> inverse = prefactor * (dB.tree_amplitude(p2, p1) + dB.penguin_amplitude(p2, p1));
+                    TEST_CHECK_RELATIVE_ERROR_C(dB.ordered_amplitude(), ordered, eps);
+                    TEST_CHECK_RELATIVE_ERROR_C(dB.inverse_amplitude(), inverse, eps);
+                    TEST_CHECK_RELATIVE_ERROR_C(dB.amplitude(), ordered + inverse, eps);
+
+                    // all channels at once
+                    SU3FRepresentation<PToPP>::Channels channels(p, Options{ { "model"_ok, "CKM" } }, { o, oo, ooo, oB });
+
+                    const auto amplitudes = channels.amplitudes();
+                    TEST_CHECK_EQUAL(amplitudes.size(), 4u);
+                    TEST_CHECK_RELATIVE_ERROR_C(amplitudes[0], d.amplitude(), eps);
+                    TEST_CHECK_RELATIVE_ERROR_C(amplitudes[1], dd.amplitude(), eps);
+                    TEST_CHECK_RELATIVE_ERROR_C(amplitudes[2], ddd.amplitude(), eps);
+                    TEST_CHECK_RELATIVE_ERROR_C(amplitudes[3], dB.amplitude(), eps);
+
+                    TEST_CHECK_THROWS(InternalError, SU3FRepresentation<PToPP>::Channels(p, Options{ { "model"_ok, "CKM" } }, { Options{ { "model"_ok, "SM" } } }));
+                }
+
                 Options o4{
                     { "representation"_ok,  "SU3F" },
                     {              "q"_ok,     "d" },
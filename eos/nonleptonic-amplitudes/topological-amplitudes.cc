@@ -30,6 +30,104 @@ namespace eos
     using std::sqrt;
     using namespace std::literals::string_literals;
 
+    namespace
+    {
+        // Hamiltonian tensors in terms of the CKM factors lambda_d and lambda_s
+        su3f::rank1
+        H1(const complex<double> & lambda_d, const complex<double> & lambda_s)
+        {
+            return su3f::rank1{
+                { 0.0, lambda_d, lambda_s }
+            };
+        }
+
+        su3f::rank3
+        H3(const complex<double> & lambda_d, const complex<double> & lambda_s)
+        {
+            su3f::rank3 result;
+            result[0][1][0] = lambda_d;
+            result[0][2][0] = lambda_s;
+            return result;
+        }
+
+        // Contributions of each tree parameter, in the order T, C, A, E, TES, TAS, TS, TPA, TP, TSS
+        std::array<complex<double>, 10>
+        contract_tree(const su3f::rank1 & B, const su3f::rank2 & p1, const su3f::rank2 & p2, const su3f::rank3 & Hbar)
+        {
+            std::array<complex<double>, 10> result{};
+
+            for (unsigned i = 0; i < 3; i++)
+            {
+                for (unsigned j = 0; j < 3; j++)
+                {
+                    for (unsigned k = 0; k < 3; k++)
+                    {
+                        for (unsigned l = 0; l < 3; l++)
+                        {
+                            result[0] += B[i] * p1[i][j] * Hbar[j][l][k] * p2[k][l];
+                            result[1] += B[i] * p1[i][j] * Hbar[l][j][k] * p2[k][l];
+                            result[2] += B[i] * Hbar[i][l][j] * p1[j][k] * p2[k][l];
+                            result[3] += B[i] * Hbar[l][i][j] * p1[j][k] * p2[k][l];
+                            result[4] += B[i] * Hbar[i][j][l] * p1[l][j] * p2[k][k];
+                            result[5] += B[i] * Hbar[j][i][l] * p1[l][j] * p2[k][k];
+                            result[6] += B[i] * p1[i][j] * Hbar[l][j][l] * p2[k][k];
+                            result[7] += B[i] * Hbar[l][i][l] * p1[j][k] * p2[k][j];
+                            result[8] += B[i] * p1[i][j] * p2[j][k] * Hbar[l][k][l];
+                            result[9] += B[i] * Hbar[l][i][l] * p1[j][j] * p2[k][k];
+                        }
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        // Contributions of each penguin parameter, in the order P, PT, S, PC, PTA, PA, PTE, PAS, PSS, PES
+        std::array<complex<double>, 10>
+        contract_penguin(const su3f::rank1 & B, const su3f::rank2 & p1, const su3f::rank2 & p2, const su3f::rank1 & H1tilde, const su3f::rank3 & H3tilde)
+        {
+            std::array<complex<double>, 10> result{};
+
+            for (unsigned i = 0; i < 3; i++)
+            {
+                for (unsigned j = 0; j < 3; j++)
+                {
+                    for (unsigned k = 0; k < 3; k++)
+                    {
+                        result[0] += B[i] * p1[i][j] * p2[j][k] * H1tilde[k];
+                        result[2] += B[i] * p1[i][j] * H1tilde[j] * p2[k][k];
+                        result[5] += B[i] * H1tilde[i] * p1[j][k] * p2[k][j];
+                        result[8] += B[i] * H1tilde[i] * p1[j][j] * p2[k][k];
+
+                        for (unsigned l = 0; l < 3; l++)
+                        {
+                            result[1] += B[i] * p1[i][j] * H3tilde[j][l][k] * p2[k][l];
+                            result[3] += B[i] * p1[i][j] * H3tilde[l][j][k] * p2[k][l];
+                            result[4] += B[i] * H3tilde[i][l][j] * p1[j][k] * p2[k][l];
+                            result[6] += B[i] * H3tilde[j][i][k] * p1[k][l] * p2[l][j];
+                            result[7] += B[i] * H3tilde[j][i][l] * p1[l][j] * p2[k][k];
+                            result[9] += B[i] * H3tilde[i][j][l] * p1[l][j] * p2[k][k];
+                        }
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        complex<double>
+        dot(const std::array<complex<double>, 10> & parameters, const std::array<complex<double>, 10> & contributions)
+        {
+            complex<double> result = 0.0;
+            for (unsigned n = 0; n < 10; ++n)
+            {
+                result += parameters[n] * contributions[n];
+            }
+
+            return result;
+        }
+    } // namespace
+
     NonleptonicAmplitudes<PToPP> *
     TopologicalRepresentation<PToPP>::make(const Parameters & p, const Options & o)
     {
@@ -106,28 +204,20 @@ namespace eos
             lamst = [this]() { return conj(model->ckm_tb()) * model->ckm_ts(); };
         }
 
-        H1tilde = [this]()
-        {
-            return su3f::rank1{
-                { 0.0, lamdt(), lamst() }
-            };
-        };
+        const bool transposed = opt_B_bar.value();
+        const auto p1 = su3f::psd_octet_basis(opt_p1.value(), transposed), p2 = su3f::psd_octet_basis(opt_p2.value(), transposed);
 
-        Hbar = [this]()
-        {
-            su3f::rank3 result;
-            result[0][1][0] = lamdu();
-            result[0][2][0] = lamsu();
-            return result;
-        };
+        ordered_coefficients   = make_coefficients(p1, p2);
+        inverse_coefficients   = make_coefficients(p2, p1);
+        amplitude_coefficients = ordered_coefficients;
+        amplitude_coefficients.tree += inverse_coefficients.tree;
+        amplitude_coefficients.penguin += inverse_coefficients.penguin;
 
-        H3tilde = [this]()
-        {
-            su3f::rank3 result;
-            result[0][1][0] = lamdt();
-            result[0][2][0] = lamst();
-            return result;
-        };
+        const auto q1 = su3f::psd_octet_basis(opt_p1.value()), q2 = su3f::psd_octet_basis(opt_p2.value());
+        symmetric_coefficients = make_coefficients(q1, q2);
+        const auto swapped     = make_coefficients(q2, q1);
+        symmetric_coefficients.tree += swapped.tree;
+        symmetric_coefficients.penguin += swapped.penguin;
     }
 
     const std::vector<OptionSpecification> TopologicalRepresentation<PToPP>::options{
@@ -139,121 +229,147 @@ namespace eos
         {           "P2"_ok, { "pi^0"s, "pi^+"s, "pi^-"s, "K_d"s, "Kbar_d"s, "K_S"s, "K_u"s, "Kbar_u"s, "eta"s, "eta_prime"s },      ""s },
     };
 
-    complex<double>
-    TopologicalRepresentation<PToPP>::tree_amplitude(su3f::rank2 & p1, su3f::rank2 & p2) const
+    std::array<complex<double>, 10>
+    TopologicalRepresentation<PToPP>::tree_parameters() const
     {
-        complex<double>       T_tda = 0.0;
-        const complex<double> T = complex<double>(this->re_T(), this->im_T()), C = complex<double>(this->re_C(), this->im_C()), A = complex<double>(this->re_A(), this->im_A()),
-                              E = complex<double>(this->re_E(), this->im_E()), TES = complex<double>(this->re_TES(), this->im_TES()),
-                              TAS = complex<double>(this->re_TAS(), this->im_TAS()), TS = complex<double>(this->re_TS(), this->im_TS()),
-                              TPA = complex<double>(this->re_TPA(), this->im_TPA()), TP = complex<double>(this->re_TP(), this->im_TP()),
-                              TSS = complex<double>(this->re_TSS(), this->im_TSS());
+        return { complex<double>(this->re_T(), this->im_T()),     complex<double>(this->re_C(), this->im_C()),     complex<double>(this->re_A(), this->im_A()),
+                 complex<double>(this->re_E(), this->im_E()),     complex<double>(this->re_TES(), this->im_TES()), complex<double>(this->re_TAS(), this->im_TAS()),
+                 complex<double>(this->re_TS(), this->im_TS()),   complex<double>(this->re_TPA(), this->im_TPA()), complex<double>(this->re_TP(), this->im_TP()),
+                 complex<double>(this->re_TSS(), this->im_TSS()) };
+    }
 
-        const auto Hbar = this->Hbar();
+    std::array<complex<double>, 10>
+    TopologicalRepresentation<PToPP>::penguin_parameters() const
+    {
+        return { complex<double>(this->re_P(), this->im_P()),     complex<double>(this->re_PT(), this->im_PT()),   complex<double>(this->re_S(), this->im_S()),
+                 complex<double>(this->re_PC(), this->im_PC()),   complex<double>(this->re_PTA(), this->im_PTA()), complex<double>(this->re_PA(), this->im_PA()),
+                 complex<double>(this->re_PTE(), this->im_PTE()), complex<double>(this->re_PAS(), this->im_PAS()), complex<double>(this->re_PSS(), this->im_PSS()),
+                 complex<double>(this->re_PES(), this->im_PES()) };
+    }
 
-        for (unsigned i = 0; i < 3; i++)
-        {
-            for (unsigned j = 0; j < 3; j++)
-            {
-                for (unsigned k = 0; k < 3; k++)
-                {
-                    for (unsigned l = 0; l < 3; l++)
-                    {
-                        T_tda += T * B[i] * p1[i][j] * Hbar[j][l][k] * p2[k][l];
-                        T_tda += C * B[i] * p1[i][j] * Hbar[l][j][k] * p2[k][l];
-                        T_tda += A * B[i] * Hbar[i][l][j] * p1[j][k] * p2[k][l];
-                        T_tda += E * B[i] * Hbar[l][i][j] * p1[j][k] * p2[k][l];
-                        T_tda += TES * B[i] * Hbar[i][j][l] * p1[l][j] * p2[k][k];
-                        T_tda += TAS * B[i] * Hbar[j][i][l] * p1[l][j] * p2[k][k];
-                        T_tda += TS * B[i] * p1[i][j] * Hbar[l][j][l] * p2[k][k];
-                        T_tda += TPA * B[i] * Hbar[l][i][l] * p1[j][k] * p2[k][j];
-                        T_tda += TP * B[i] * p1[i][j] * p2[j][k] * Hbar[l][k][l];
-                        T_tda += TSS * B[i] * Hbar[l][i][l] * p1[j][j] * p2[k][k];
-                    }
-                }
-            }
-        }
+    TopologicalRepresentation<PToPP>::Coefficients
+    TopologicalRepresentation<PToPP>::make_coefficients(const std::array<su3f::rank2, 3> & p1, const std::array<su3f::rank2, 3> & p2) const
+    {
+        Coefficients result;
+        result.tree = su3f::Coefficients<10>(p1, p2,
+                [this](const su3f::rank2 & m1, const su3f::rank2 & m2, const complex<double> & lambda_d, const complex<double> & lambda_s)
+                { return contract_tree(B, m1, m2, H3(lambda_d, lambda_s)); });
+        result.penguin = su3f::Coefficients<10>(p1, p2,
+                [this](const su3f::rank2 & m1, const su3f::rank2 & m2, const complex<double> & lambda_d, const complex<double> & lambda_s)
+                { return contract_penguin(B, m1, m2, H1(lambda_d, lambda_s), H3(lambda_d, lambda_s)); });
 
-        return T_tda;
+        return result;
     }
 
     complex<double>
-    TopologicalRepresentation<PToPP>::penguin_amplitude(su3f::rank2 & p1, su3f::rank2 & p2) const
+    TopologicalRepresentation<PToPP>::tree_amplitude(su3f::rank2 & p1, su3f::rank2 & p2) const
     {
-        complex<double>       P_tda = 0.0;
-        const complex<double> P = complex<double>(this->re_P(), this->im_P()), PT = complex<double>(this->re_PT(), this->im_PT()), S = complex<double>(this->re_S(), this->im_S()),
-                              PC = complex<double>(this->re_PC(), this->im_PC()), PTA = complex<double>(this->re_PTA(), this->im_PTA()),
-                              PA = complex<double>(this->re_PA(), this->im_PA()), PTE = complex<double>(this->re_PTE(), this->im_PTE()),
-                              PAS = complex<double>(this->re_PAS(), this->im_PAS()), PSS = complex<double>(this->re_PSS(), this->im_PSS()),
-                              PES = complex<double>(this->re_PES(), this->im_PES());
-
-
-        const auto H1tilde = this->H1tilde();
-        const auto H3tilde = this->H3tilde();
-
-        for (unsigned i = 0; i < 3; i++)
-        {
-            for (unsigned j = 0; j < 3; j++)
-            {
-                for (unsigned k = 0; k < 3; k++)
-                {
-                    P_tda += P * B[i] * p1[i][j] * p2[j][k] * H1tilde[k];
-                    P_tda += S * B[i] * p1[i][j] * H1tilde[j] * p2[k][k];
-                    P_tda += PA * B[i] * H1tilde[i] * p1[j][k] * p2[k][j];
-                    P_tda += PSS * B[i] * H1tilde[i] * p1[j][j] * p2[k][k];
+        return dot(this->tree_parameters(), contract_tree(B, p1, p2, H3(lamdu(), lamsu())));
+    }
 
-                    for (unsigned l = 0; l < 3; l++)
-                    {
-                        P_tda += PT * B[i] * p1[i][j] * H3tilde[j][l][k] * p2[k][l];
-                        P_tda += PC * B[i] * p1[i][j] * H3tilde[l][j][k] * p2[k][l];
-                        P_tda += PTA * B[i] * H3tilde[i][l][j] * p1[j][k] * p2[k][l];
-                        P_tda += PTE * B[i] * H3tilde[j][i][k] * p1[k][l] * p2[l][j];
-                        P_tda += PAS * B[i] * H3tilde[j][i][l] * p1[l][j] * p2[k][k];
-                        P_tda += PES * B[i] * H3tilde[i][j][l] * p1[l][j] * p2[k][k];
-                    }
-                }
-            }
-        }
+    complex<double>
+    TopologicalRepresentation<PToPP>::penguin_amplitude(su3f::rank2 & p1, su3f::rank2 & p2) const
+    {
+        const complex<double> lamdt = this->lamdt(), lamst = this->lamst();
 
-        return P_tda;
+        return dot(this->penguin_parameters(), contract_penguin(B, p1, p2, H1(lamdt, lamst), H3(lamdt, lamst)));
     }
 
     complex<double>
     TopologicalRepresentation<PToPP>::ordered_amplitude() const
     {
-        this->update();
-
-        if (opt_B_bar.value())
-        {
-            su3f::transpose(P1);
-            su3f::transpose(P2);
-        }
+        const auto weights = su3f::psd_octet_weights(theta_18());
 
-        return complex<double>(0.0, 1.0) * Gfermi() / sqrt(2.0) * (this->tree_amplitude(P1, P2) + this->penguin_amplitude(P1, P2));
+        return complex<double>(0.0, 1.0) * Gfermi() / sqrt(2.0)
+               * (ordered_coefficients.tree.evaluate(this->tree_parameters(), lamdu(), lamsu(), weights)
+                  + ordered_coefficients.penguin.evaluate(this->penguin_parameters(), lamdt(), lamst(), weights));
     }
 
     complex<double>
     TopologicalRepresentation<PToPP>::inverse_amplitude() const
     {
-        this->update();
+        const auto weights = su3f::psd_octet_weights(theta_18());
 
-        if (opt_B_bar.value())
-        {
-            su3f::transpose(P1);
-            su3f::transpose(P2);
-        }
+        return complex<double>(0.0, 1.0) * Gfermi() / sqrt(2.0)
+               * (inverse_coefficients.tree.evaluate(this->tree_parameters(), lamdu(), lamsu(), weights)
+                  + inverse_coefficients.penguin.evaluate(this->penguin_parameters(), lamdt(), lamst(), weights));
+    }
 
-        return complex<double>(0.0, 1.0) * Gfermi() / sqrt(2.0) * (this->tree_amplitude(P2, P1) + this->penguin_amplitude(P2, P1));
+    complex<double>
+    TopologicalRepresentation<PToPP>::amplitude() const
+    {
+        const auto weights = su3f::psd_octet_weights(theta_18());
+
+        return complex<double>(0.0, 1.0) * Gfermi() / sqrt(2.0)
+               * (amplitude_coefficients.tree.evaluate(this->tree_parameters(), lamdu(), lamsu(), weights)
+                  + amplitude_coefficients.penguin.evaluate(this->penguin_parameters(), lamdt(), lamst(), weights));
     }
 
     complex<double>
     TopologicalRepresentation<PToPP>::penguin_correction() const
     {
-        this->update();
+        const auto            weights = su3f::psd_octet_weights(theta_18());
+        const complex<double> lamdu = this->lamdu(), lamdt = this->lamdt();
 
-        auto penguin = (this->penguin_amplitude(P1, P2) + this->penguin_amplitude(P2, P1)) / lamdt();
-        auto tree    = (this->tree_amplitude(P1, P2) + this->tree_amplitude(P2, P1)) / lamdu();
+        auto penguin = symmetric_coefficients.penguin.evaluate(this->penguin_parameters(), lamdt, lamst(), weights) / lamdt;
+        auto tree    = symmetric_coefficients.tree.evaluate(this->tree_parameters(), lamdu, lamsu(), weights) / lamdu;
 
         return -penguin / (tree - penguin);
     }
+
+    TopologicalRepresentation<PToPP>::Channels::Channels(const Parameters & p, const Options & o, const std::vector<Options> & channels)
+    {
+        Context ctx("When constructing B->PP topological amplitudes for several channels");
+
+        for (const auto & c : channels)
+        {
+            if (c.has("model"_ok) && (c["model"_ok] != o.get("model"_ok, "SM")))
+            {
+                throw InternalError("TopologicalRepresentation<PToPP>::Channels: all channels must share the same model");
+            }
+
+            _channels.push_back(std::make_shared<TopologicalRepresentation<PToPP>>(p, o + c));
+            uses(*_channels.back());
+        }
+    }
+
+    std::vector<complex<double>>
+    TopologicalRepresentation<PToPP>::Channels::amplitudes() const
+    {
+        std::vector<complex<double>> result(_channels.size(), 0.0);
+
+        if (_channels.empty())
+        {
+            return result;
+        }
+
+        const auto & first     = *_channels.front();
+        const auto   tree      = first.tree_parameters();
+        const auto   penguin   = first.penguin_parameters();
+        const auto   weights   = su3f::psd_octet_weights(first.theta_18());
+        const auto   prefactor = complex<double>(0.0, 1.0) * first.Gfermi() / sqrt(2.0);
+
+        // the CKM factors depend on the channel only through their conjugation; the inputs are built on first use
+        std::array<su3f::Coefficients<10>::Inputs, 2> tree_inputs, penguin_inputs;
+        std::array<bool, 2>                           has_inputs{ false, false };
+
+        for (unsigned i = 0; i < _channels.size(); ++i)
+        {
+            const auto &   c = *_channels[i];
+            const unsigned k = (c.opt_cp_conjugate.value() != c.opt_B_bar.value()) ? 0 : 1;
+
+            if (! has_inputs[k])
+            {
+                tree_inputs[k].fill(0.0);
+                penguin_inputs[k].fill(0.0);
+                su3f::Coefficients<10>::accumulate(tree_inputs[k], tree, c.lamdu(), c.lamsu(), weights);
+                su3f::Coefficients<10>::accumulate(penguin_inputs[k], penguin, c.lamdt(), c.lamst(), weights);
+                has_inputs[k] = true;
+            }
+
+            result[i] = prefactor * (c.amplitude_coefficients.tree.contract(tree_inputs[k]) + c.amplitude_coefficients.penguin.contract(penguin_inputs[k]));
+        }
+
+        return result;
+    }
 } // namespace eos
@@ -28,6 +28,8 @@
 
 #include <array>
 #include <map>
+#include <memory>
+#include <vector>
 
 namespace eos
 {
@@ -45,10 +47,20 @@ namespace eos
 
             UsedParameter theta_18;
 
-            su3f::rank1                  B;
-            mutable su3f::rank2          P1, P2;
-            std::function<su3f::rank1()> H1tilde;
-            std::function<su3f::rank3()> Hbar, H3tilde;
+            su3f::rank1         B;
+            // Meson tensors at the current theta_18, only used by the diagnostic functions below;
+            // the amplitudes are evaluated from the precontracted coefficients
+            mutable su3f::rank2 P1, P2;
+
+            struct Coefficients
+            {
+                    su3f::Coefficients<10> tree, penguin;
+            };
+
+            // Flavour coefficients of B -> P1 P2, B -> P2 P1, and their sum
+            Coefficients ordered_coefficients, inverse_coefficients, amplitude_coefficients;
+            // Flavour coefficients of the sum of B -> P1 P2 and B -> P2 P1 without transposition of the meson tensors
+            Coefficients symmetric_coefficients;
 
             UsedParameter Gfermi;
 
@@ -81,11 +93,19 @@ namespace eos
             std::function<complex<double>()> lamdt;
             std::function<complex<double>()> lamst;
 
+            // Hadronic parameters in the order T, C, A, E, TES, TAS, TS, TPA, TP, TSS
+            std::array<complex<double>, 10> tree_parameters() const;
+            // Hadronic parameters in the order P, PT, S, PC, PTA, PA, PTE, PAS, PSS, PES
+            std::array<complex<double>, 10> penguin_parameters() const;
+
+            Coefficients make_coefficients(const std::array<su3f::rank2, 3> & p1, const std::array<su3f::rank2, 3> & p2) const;
+
         public:
             TopologicalRepresentation(const Parameters & p, const Options & o);
 
             ~TopologicalRepresentation() {}
 
+            // Updates the meson tensors P1 and P2 for the diagnostic functions
             inline void
             update() const
             {
@@ -119,8 +139,27 @@ namespace eos
             complex<double> ordered_amplitude() const;
             // Amplitude for B -> P2 P1
             complex<double> inverse_amplitude() const;
+            // Amplitude for B -> [P2 P1 + P1 P2]
+            complex<double> amplitude() const override;
             // CP-conserving penguin vs tree correction defined as - |(Vub Vud*) / (Vcb Vcd*)| penguin / (tree - penguin), cf. [FJV:2016A]
             complex<double> penguin_correction() const override;
+
+            /*
+             * Amplitudes for B -> [P2 P1 + P1 P2] of several channels that share the same parameters and model, as
+             * needed in global fits of B -> PP decays. The hadronic parameters, the CKM factors, and the mixing angle
+             * are evaluated once per call, after which each channel requires a single contraction of its coefficients.
+             */
+            class Channels : public ParameterUser
+            {
+                private:
+                    std::vector<std::shared_ptr<TopologicalRepresentation<PToPP>>> _channels;
+
+                public:
+                    // The options of each channel are combined with the common options o, and must not change the model
+                    Channels(const Parameters & p, const Options & o, const std::vector<Options> & channels);
+
+                    std::vector<complex<double>> amplitudes() const;
+            };
     };
 } // namespace eos
 #endif
@@ -27,10 +27,12 @@
 #include <eos/nonlocal-form-factors/long-distance.hh>
 #include <eos/utils/exception.hh>
 #include <eos/utils/log.hh>
+#include <eos/utils/memoise.hh>
 #include <eos/utils/options-impl.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 #include <eos/utils/stringify.hh>
 
+#include <array>
 #include <cmath>
 #include <complex>
 #include <cstring>
@@ -334,6 +336,42 @@ namespace eos
     }
 
     /* Two-Loop functions for charm-quark loops */
+    namespace impl
+    {
+        // terms of the massive two-loop functions that depend on log(mu / m_b), cf. [AAGW:2001A], Eqs. (54) and (56), pp. 19-20
+        complex<double> f17_log_mu_terms(const double & log_mu)
+        {
+            return -208.0 / 243.0 * log_mu;
+        }
+
+        complex<double> f27_log_mu_terms(const double & log_mu)
+        {
+            return 416.0 / 81.0 * log_mu;
+        }
+
+        complex<double> f19_log_mu_terms(const double & log_mu, const double & s_hat, const complex<double> & log_s_hat, const double & m_q_hat)
+        {
+            return (-1424.0 / 729.0 + 64.0 / 27.0 * log(m_q_hat)) * log_mu
+                - 16.0 / 243.0 * log_mu * log_s_hat
+                + (16.0 / 1215.0 - 32.0 / 135.0 /power_of<2>(m_q_hat)) * log_mu * s_hat
+                + (4.0 / 2835.0 - 8.0 / 315.0 /power_of<4>(m_q_hat)) * log_mu * s_hat * s_hat
+                + (16.0 / 76545.0 - 32.0 /8505.0 / power_of<6>(m_q_hat)) * log_mu * power_of<3>(s_hat)
+                - 256.0 / 243.0 * power_of<2>(log_mu)
+                + complex<double>(0.0, 16.0 / 243.0 * M_PI * log_mu);
+        }
+
+        complex<double> f29_log_mu_terms(const double & log_mu, const double & s_hat, const complex<double> & log_s_hat, const double & m_q_hat)
+        {
+            return (256.0 / 243.0 - 128.0 / 9.0 * log(m_q_hat)) * log_mu
+                + 32.0 / 81.0 * log_mu * log_s_hat
+                + (-32.0 / 405.0 + 64.0 / 45 / power_of<2>(m_q_hat)) * log_mu * s_hat
+                + (-8.0 / 945.0 + 16.0 / 105 / power_of<4>(m_q_hat)) * log_mu * s_hat * s_hat
+                + (-32.0 / 25515.0 + 64.0 / 2835 / power_of<6>(m_q_hat)) * log_mu * power_of<3>(s_hat)
+                + 512.0 / 81.0 * power_of<2>(log_mu)
+                + complex<double>(0.0, -32.0 / 81.0 * M_PI * log_mu);
+        }
+    }
+
     // cf. [AAGW:2001A], Eq. (56), p. 20
     complex<double>
     CharmLoops::F17_massive(const double & mu, const double & s, const double & m_b, const double & m_c)
@@ -431,7 +469,7 @@ namespace eos
         };
 
         // real part
-        complex<double> r = -208.0 / 243.0 * log(mu / m_b);
+        complex<double> r = impl::f17_log_mu_terms(log(mu / m_b));
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 4 ; m++)
@@ -638,7 +676,7 @@ namespace eos
         }
 
         // real part
-        complex<double> r = 416.0 / 81.0 * log(mu / m_b);
+        complex<double> r = impl::f27_log_mu_terms(log(mu / m_b));
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 4 ; m++)
@@ -816,12 +854,7 @@ namespace eos
         };
 
         // real part
-        complex<double> r = (-1424.0 / 729.0 + 64.0 / 27.0 * log(m_q_hat)) * log(mu/m_b)
-            - 16.0 / 243.0 * log(mu/m_b) * log_s_hat
-            + (16.0 / 1215.0 - 32.0 / 135.0 /power_of<2>(m_q_hat)) * log(mu/m_b) * s_hat
-            + (4.0 / 2835.0 - 8.0 / 315.0 /power_of<4>(m_q_hat)) * log(mu/m_b) * s_hat * s_hat
-            + (16.0 / 76545.0 - 32.0 /8505.0 / power_of<6>(m_q_hat)) * log(mu/m_b) * power_of<3>(s_hat)
-            - 256.0 / 243.0 * power_of<2>(log(mu/m_b));
+        complex<double> r = impl::f19_log_mu_terms(log(mu / m_b), s_hat, log_s_hat, m_q_hat);
 
         for (int l = 3  ; l < 7 ; l++)
             for (int m = 0  ; m < 4  ; m++)
@@ -859,7 +892,7 @@ namespace eos
             r = r + rho19[l] * pow(s_hat, l);
 
         // imaginary part
-        complex<double> i = 16.0 / 243.0 * M_PI * log(mu/m_b);
+        complex<double> i = 0.0;
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
@@ -1006,12 +1039,7 @@ namespace eos
         };
 
         // real part
-        complex<double> r = (256.0 / 243.0 - 128.0 / 9.0 * log(m_q_hat)) * log(mu / m_b)
-            + 32.0 / 81.0 * log(mu / m_b) * log_s_hat
-            + (-32.0 / 405.0 + 64.0 / 45 / power_of<2>(m_q_hat)) * log(mu / m_b) * s_hat
-            + (-8.0 / 945.0 + 16.0 / 105 / power_of<4>(m_q_hat)) * log(mu / m_b) * s_hat * s_hat
-            + (-32.0 / 25515.0 + 64.0 / 2835 / power_of<6>(m_q_hat)) * log(mu / m_b) * power_of<3>(s_hat)
-            + 512.0 / 81.0 * power_of<2>(log(mu / m_b));
+        complex<double> r = impl::f29_log_mu_terms(log(mu / m_b), s_hat, log_s_hat, m_q_hat);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 4 ; m++)
@@ -1049,7 +1077,7 @@ namespace eos
             r = r + rho29[l] * pow(s_hat, l);
 
         // imaginary part
-        complex<double> i = - 32.0 / 81.0 * M_PI * log(mu/m_b);
+        complex<double> i = 0.0;
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
@@ -1086,6 +1114,247 @@ namespace eos
         return r + complex<double>(0.0, 1.0) * i;
     }
 
+    namespace impl
+    {
+        /*
+         * Chebyshev table of one of the massive two-loop functions at mu = m_b.
+         *
+         * The functions F_{17,19,27,29} are polynomials of third order in s_hat, with and without a factor of log(s_hat),
+         * whose coefficients depend only on m_q_hat = m_q / m_b. At each Chebyshev node in m_q_hat, these coefficients are
+         * recovered from eight evaluations of the exact function, and are subsequently expanded in Chebyshev polynomials.
+         */
+        class ChebyshevCharmLoopsTable
+        {
+            public:
+                using Function = complex<double> (*)(const double &, const double &, const double &, const double &);
+
+            private:
+                // range of m_q_hat covered by the table
+                static constexpr double m_q_hat_min = 0.15, m_q_hat_max = 0.50;
+
+                // number of Chebyshev polynomials
+                static constexpr unsigned order = 32;
+
+                // basis functions s_hat^k (index k) and s_hat^k log(s_hat) (index 4 + k), with k = 0, ..., 3
+                static constexpr unsigned n_basis = 8;
+
+                std::array<std::array<complex<double>, order>, n_basis> _coefficients;
+
+            public:
+                ChebyshevCharmLoopsTable(const Function & f)
+                {
+                    // the values of s_hat used to recover the coefficients of the basis functions
+                    std::array<double, n_basis> s_hat;
+                    for (unsigned j = 0 ; j < n_basis ; ++j)
+                    {
+                        s_hat[j] = 0.01 * std::pow(45.0, double(j) / (n_basis - 1));
+                    }
+
+                    // invert the matrix of basis functions by Gauss-Jordan elimination with partial pivoting
+                    std::array<std::array<double, 2 * n_basis>, n_basis> m;
+                    for (unsigned j = 0 ; j < n_basis ; ++j)
+                    {
+                        for (unsigned k = 0 ; k < 4 ; ++k)
+                        {
+                            m[j][k]     = std::pow(s_hat[j], k);
+                            m[j][4 + k] = std::pow(s_hat[j], k) * std::log(s_hat[j]);
+                        }
+
+                        for (unsigned k = 0 ; k < n_basis ; ++k)
+                        {
+                            m[j][n_basis + k] = (j == k) ? 1.0 : 0.0;
+                        }
+                    }
+
+                    for (unsigned c = 0 ; c < n_basis ; ++c)
+                    {
+                        unsigned pivot = c;
+                        for (unsigned j = c + 1 ; j < n_basis ; ++j)
+                        {
+                            if (std::abs(m[j][c]) > std::abs(m[pivot][c]))
+                                pivot = j;
+                        }
+                        std::swap(m[c], m[pivot]);
+
+                        const double diagonal = m[c][c];
+                        for (auto & e : m[c])
+                        {
+                            e /= diagonal;
+                        }
+
+                        for (unsigned j = 0 ; j < n_basis ; ++j)
+                        {
+                            if (j == c)
+                                continue;
+
+                            const double factor = m[j][c];
+                            for (unsigned k = 0 ; k < 2 * n_basis ; ++k)
+                            {
+                                m[j][k] -= factor * m[c][k];
+                            }
+                        }
+                    }
+
+                    // coefficients of the basis functions at the Chebyshev nodes
+                    std::array<std::array<complex<double>, n_basis>, order> a;
+                    for (unsigned n = 0 ; n < order ; ++n)
+                    {
+                        const double m_q_hat = 0.5 * (m_q_hat_max + m_q_hat_min) + 0.5 * (m_q_hat_max - m_q_hat_min) * std::cos(M_PI * (n + 0.5) / order);
+
+                        std::array<complex<double>, n_basis> values;
+                        for (unsigned j = 0 ; j < n_basis ; ++j)
+                        {
+                            values[j] = f(1.0, s_hat[j], 1.0, m_q_hat);
+                        }
+
+                        for (unsigned b = 0 ; b < n_basis ; ++b)
+                        {
+                            a[n][b] = 0.0;
+                            for (unsigned j = 0 ; j < n_basis ; ++j)
+                            {
+                                a[n][b] += m[b][n_basis + j] * values[j];
+                            }
+                        }
+                    }
+
+                    // discrete Chebyshev transform
+                    for (unsigned b = 0 ; b < n_basis ; ++b)
+                    {
+                        for (unsigned k = 0 ; k < order ; ++k)
+                        {
+                            complex<double> c = 0.0;
+                            for (unsigned n = 0 ; n < order ; ++n)
+                            {
+                                c += a[n][b] * std::cos(M_PI * k * (n + 0.5) / order);
+                            }
+
+                            _coefficients[b][k] = ((k == 0) ? 1.0 : 2.0) / order * c;
+                        }
+                    }
+                }
+
+                static bool covers(const double & m_q_hat)
+                {
+                    return (m_q_hat_min <= m_q_hat) && (m_q_hat <= m_q_hat_max);
+                }
+
+                complex<double> operator() (const double & s_hat, const complex<double> & log_s_hat, const double & m_q_hat) const
+                {
+                    const double x = (2.0 * m_q_hat - m_q_hat_max - m_q_hat_min) / (m_q_hat_max - m_q_hat_min);
+
+                    std::array<double, order> t;
+                    t[0] = 1.0;
+                    t[1] = x;
+                    for (unsigned k = 2 ; k < order ; ++k)
+                    {
+                        t[k] = 2.0 * x * t[k - 1] - t[k - 2];
+                    }
+
+                    std::array<complex<double>, n_basis> a;
+                    for (unsigned b = 0 ; b < n_basis ; ++b)
+                    {
+                        a[b] = 0.0;
+                        for (unsigned k = 0 ; k < order ; ++k)
+                        {
+                            a[b] += _coefficients[b][k] * t[k];
+                        }
+                    }
+
+                    return ((a[3] * s_hat + a[2]) * s_hat + a[1]) * s_hat + a[0]
+                        + log_s_hat * (((a[7] * s_hat + a[6]) * s_hat + a[5]) * s_hat + a[4]);
+                }
+        };
+
+        // the tables are only used for |s| >= 1e-6 and |s_hat| <= 0.45; this excludes the divergence of F19 and F29 at s = 0
+        inline bool use_chebyshev_table(const double & s, const double & s_hat, const double & m_q_hat)
+        {
+            return (1e-6 <= std::abs(s)) && (std::abs(s_hat) <= 0.45) && ChebyshevCharmLoopsTable::covers(m_q_hat);
+        }
+
+        inline complex<double> log_s_hat(const double & s_hat)
+        {
+            return complex<double>(std::log(std::abs(s_hat)), (s_hat < 0.0) ? M_PI : 0.0);
+        }
+    }
+
+    complex<double>
+    ChebyshevCharmLoops::F17_massive(const double & mu, const double & s, const double & m_b, const double & m_q)
+    {
+        static const impl::ChebyshevCharmLoopsTable table(&CharmLoops::F17_massive);
+
+        const double m_q_hat = m_q / m_b, s_hat = s / power_of<2>(m_b);
+
+        if (! impl::use_chebyshev_table(s, s_hat, m_q_hat))
+            return CharmLoops::F17_massive(mu, s, m_b, m_q);
+
+        return table(s_hat, impl::log_s_hat(s_hat), m_q_hat) + impl::f17_log_mu_terms(log(mu / m_b));
+    }
+
+    complex<double>
+    ChebyshevCharmLoops::F19_massive(const double & mu, const double & s, const double & m_b, const double & m_q)
+    {
+        static const impl::ChebyshevCharmLoopsTable table(&CharmLoops::F19_massive);
+
+        const double m_q_hat = m_q / m_b, s_hat = s / power_of<2>(m_b);
+
+        if (! impl::use_chebyshev_table(s, s_hat, m_q_hat))
+            return CharmLoops::F19_massive(mu, s, m_b, m_q);
+
+        const complex<double> log_s_hat = impl::log_s_hat(s_hat);
+
+        return table(s_hat, log_s_hat, m_q_hat) + impl::f19_log_mu_terms(log(mu / m_b), s_hat, log_s_hat, m_q_hat);
+    }
+
+    complex<double>
+    ChebyshevCharmLoops::F27_massive(const double & mu, const double & s, const double & m_b, const double & m_q)
+    {
+        static const impl::ChebyshevCharmLoopsTable table(&CharmLoops::F27_massive);
+
+        const double m_q_hat = m_q / m_b, s_hat = s / power_of<2>(m_b);
+
+        if (! impl::use_chebyshev_table(s, s_hat, m_q_hat))
+            return CharmLoops::F27_massive(mu, s, m_b, m_q);
+
+        return table(s_hat, impl::log_s_hat(s_hat), m_q_hat) + impl::f27_log_mu_terms(log(mu / m_b));
+    }
+
+    complex<double>
+    ChebyshevCharmLoops::F29_massive(const double & mu, const double & s, const double & m_b, const double & m_q)
+    {
+        static const impl::ChebyshevCharmLoopsTable table(&CharmLoops::F29_massive);
+
+        const double m_q_hat = m_q / m_b, s_hat = s / power_of<2>(m_b);
+
+        if (! impl::use_chebyshev_table(s, s_hat, m_q_hat))
+            return CharmLoops::F29_massive(mu, s, m_b, m_q);
+
+        const complex<double> log_s_hat = impl::log_s_hat(s_hat);
+
+        return table(s_hat, log_s_hat, m_q_hat) + impl::f29_log_mu_terms(log(mu / m_b), s_hat, log_s_hat, m_q_hat);
+    }
+
+    MassiveCharmLoops::MassiveCharmLoops(const std::string & implementation)
+    {
+        if ("exact" == implementation)
+        {
+            F17 = [] (const double & mu, const double & s, const double & m_b, const double & m_c) { return memoise(CharmLoops::F17_massive, mu, s, m_b, m_c); };
+            F19 = [] (const double & mu, const double & s, const double & m_b, const double & m_c) { return memoise(CharmLoops::F19_massive, mu, s, m_b, m_c); };
+            F27 = [] (const double & mu, const double & s, const double & m_b, const double & m_c) { return memoise(CharmLoops::F27_massive, mu, s, m_b, m_c); };
+            F29 = [] (const double & mu, const double & s, const double & m_b, const double & m_c) { return memoise(CharmLoops::F29_massive, mu, s, m_b, m_c); };
+        }
+        else if ("chebyshev" == implementation)
+        {
+            F17 = &ChebyshevCharmLoops::F17_massive;
+            F19 = &ChebyshevCharmLoops::F19_massive;
+            F27 = &ChebyshevCharmLoops::F27_massive;
+            F29 = &ChebyshevCharmLoops::F29_massive;
+        }
+        else
+        {
+            throw InternalError("MassiveCharmLoops: unknown implementation '" + implementation + "'");
+        }
+    }
+
     // cf. [AAGW:2001A], eqs. (48) and (49), p. 18
     complex<double>
     CharmLoops::delta_F29_massive(const double & mu, const double & s, const double & m_q)
@@ -26,6 +26,8 @@
 #include <eos/utils/diagnostics.hh>
 #include <eos/utils/reference-name.hh>
 
+#include <functional>
+#include <string>
 #include <vector>
 
 namespace eos
@@ -92,6 +94,37 @@ namespace eos
         static complex<double> F29_massive_Qsb(const double & s);
     };
 
+    /*!
+     * Tabulated versions of the massive two-loop functions F_{17,19,27,29}.
+     *
+     * The dependence on s / m_b^2 and log(mu / m_b) is evaluated exactly, while the coefficients
+     * of the powers of s / m_b^2 are interpolated in m_c / m_b by Chebyshev series. The tables cover
+     * 0.15 <= m_c / m_b <= 0.50, and are built at first use. Outside of this range, and for |s| < 1e-6,
+     * the exact functions are used instead.
+     */
+    struct ChebyshevCharmLoops
+    {
+        static complex<double> F17_massive(const double & mu, const double & s, const double & m_b, const double & m_c);
+        static complex<double> F19_massive(const double & mu, const double & s, const double & m_b, const double & m_c);
+        static complex<double> F27_massive(const double & mu, const double & s, const double & m_b, const double & m_c);
+        static complex<double> F29_massive(const double & mu, const double & s, const double & m_b, const double & m_c);
+    };
+
+    /*!
+     * Implementation of the massive two-loop functions F_{17,19,27,29}, as selected by the option "charm-loops".
+     *
+     * "exact" memoises the exact functions for identical arguments, while "chebyshev" uses the
+     * tabulated functions of ChebyshevCharmLoops.
+     */
+    struct MassiveCharmLoops
+    {
+        using Function = std::function<complex<double> (const double & mu, const double & s, const double & m_b, const double & m_c)>;
+
+        Function F17, F19, F27, F29;
+
+        MassiveCharmLoops(const std::string & implementation);
+    };
+
     struct ShortDistanceLowRecoil
     {
         /*!
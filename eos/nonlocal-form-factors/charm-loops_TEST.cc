@@ -420,6 +420,72 @@ class FormFactorsTest :
         }
 } two_loop_test;
 
+class ChebyshevCharmLoopsTest :
+    public TestCase
+{
+    public:
+        ChebyshevCharmLoopsTest() :
+            TestCase("chebyshev_charm_loops_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            using Function = complex<double> (*)(const double &, const double &, const double &, const double &);
+
+            static const std::vector<std::pair<Function, Function>> functions
+            {
+                { &CharmLoops::F17_massive, &ChebyshevCharmLoops::F17_massive },
+                { &CharmLoops::F19_massive, &ChebyshevCharmLoops::F19_massive },
+                { &CharmLoops::F27_massive, &ChebyshevCharmLoops::F27_massive },
+                { &CharmLoops::F29_massive, &ChebyshevCharmLoops::F29_massive },
+            };
+
+            /* Comparison with the exact functions within the range of the tables */
+            for (const auto & [exact, tabulated] : functions)
+            {
+                for (const double m_b : { 4.2, 4.6, 4.8 })
+                {
+                    for (const double m_c : { 0.9, 1.27, 1.6 })
+                    {
+                        for (const double s : { -6.0, -1.0, 0.05, 1.0, 3.5, 6.0, 7.5 })
+                        {
+                            for (const double mu : { 2.5, 4.2, 8.0 })
+                            {
+                                const complex<double> reference = exact(mu, s, m_b, m_c);
+                                const complex<double> value     = tabulated(mu, s, m_b, m_c);
+                                const double eps = 1.0e-6 * std::abs(reference);
+
+                                TEST_CHECK_NEARLY_EQUAL(real(value), real(reference), eps);
+                                TEST_CHECK_NEARLY_EQUAL(imag(value), imag(reference), eps);
+                            }
+                        }
+                    }
+                }
+            }
+
+            /* Outside of the range of the tables, the exact functions are used */
+            {
+                static const double mu = 4.2, s = 6.0, m_b = 4.6, m_c = 0.4;
+
+                TEST_CHECK_EQUAL(ChebyshevCharmLoops::F17_massive(mu, s, m_b, m_c), CharmLoops::F17_massive(mu, s, m_b, m_c));
+                TEST_CHECK_EQUAL(ChebyshevCharmLoops::F29_massive(mu, s, m_b, m_c), CharmLoops::F29_massive(mu, s, m_b, m_c));
+                TEST_CHECK_EQUAL(ChebyshevCharmLoops::F27_massive(mu, 0.0, m_b, 1.4), CharmLoops::F27_massive(mu, 0.0, m_b, 1.4));
+                TEST_CHECK_THROWS(InternalError, ChebyshevCharmLoops::F19_massive(mu, 0.0, m_b, 1.4));
+            }
+
+            /* Selection of the implementation */
+            {
+                static const double mu = 4.2, s = 6.0, m_b = 4.6, m_c = 1.4;
+
+                MassiveCharmLoops exact("exact"), chebyshev("chebyshev");
+                TEST_CHECK_EQUAL(exact.F27(mu, s, m_b, m_c),     CharmLoops::F27_massive(mu, s, m_b, m_c));
+                TEST_CHECK_EQUAL(chebyshev.F27(mu, s, m_b, m_c), ChebyshevCharmLoops::F27_massive(mu, s, m_b, m_c));
+                TEST_CHECK_THROWS(InternalError, MassiveCharmLoops("spline"));
+            }
+        }
+} chebyshev_charm_loops_test;
+
 class LowRecoilTest :
     public TestCase
 {
@@ -40,6 +40,7 @@
 #include <eos/utils/log.hh>
 #include <eos/utils/observable_stub.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
 #include <algorithm>
@@ -49,6 +50,34 @@ namespace eos
 {
     Observable::~Observable() = default;
 
+    void
+    Observable::evaluate_many(const std::string & kinematic_name, std::span<const double> values, std::span<double> results)
+    {
+        if (values.size() != results.size())
+        {
+            throw InternalError("Observable::evaluate_many: expected " + stringify(values.size()) + " results, got " + stringify(results.size()));
+        }
+
+        KinematicVariable variable = this->kinematics()[kinematic_name];
+        const double present = variable.evaluate();
+
+        try
+        {
+            for (std::size_t j = 0 ; j < values.size() ; ++j)
+            {
+                variable = values[j];
+                results[j] = this->evaluate();
+            }
+        }
+        catch (...)
+        {
+            variable = present;
+            throw;
+        }
+
+        variable = present;
+    }
+
     namespace impl
     {
         std::map<QualifiedName, ObservableEntryPtr> observable_entries;
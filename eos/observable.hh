@@ -32,6 +32,7 @@
 #include <eos/utils/units.hh>
 
 #include <map>
+#include <span>
 #include <string>
 
 namespace eos
@@ -49,6 +50,18 @@ namespace eos
 
             virtual double evaluate() const = 0;
 
+            /*!
+             * Evaluate the observable for a sequence of values of one of its kinematic variables.
+             *
+             * The default implementation sets the kinematic variable to each value in turn, and
+             * restores its present value afterwards.
+             *
+             * @param kinematic_name The name of the kinematic variable that is varied.
+             * @param values         The values of the kinematic variable.
+             * @param results        The values of the observable; must have the same size as values.
+             */
+            virtual void evaluate_many(const std::string & kinematic_name, std::span<const double> values, std::span<double> results);
+
             virtual Kinematics kinematics() = 0;
 
             virtual Parameters parameters() = 0;
@@ -26,6 +26,7 @@
 
 #include <iostream>
 #include <ranges>
+#include <vector>
 
 using namespace test;
 using namespace eos;
@@ -304,6 +305,95 @@ class ObservableTest : public TestCase
                 TEST_CHECK_EQUAL(o.has("B_c->lnu::BR"), true);
                 TEST_CHECK_EQUAL(o.has("B_c->lnu::TEST"), false);
             }
+
+            // Observable::evaluate_many
+            {
+                Parameters p = Parameters::Defaults();
+                Kinematics k{ { "q2", 5.0 } };
+                Options    o{ { "l"_ok, "mu" } };
+
+                ObservablePtr observable = Observable::make("B->pilnu::dBR/dq2", p, k, o);
+                ObservablePtr reference  = Observable::make("B->pilnu::dBR/dq2", p, k.clone(), o);
+
+                // enough points to be distributed across threads
+                std::vector<double> q2(300), results(300);
+                for (std::size_t j = 0 ; j < q2.size() ; ++j)
+                {
+                    q2[j] = 0.1 + 20.0 * j / q2.size();
+                }
+
+                observable->evaluate_many("q2", q2, results);
+                for (std::size_t j = 0 ; j < q2.size() ; ++j)
+                {
+                    reference->kinematics()["q2"] = q2[j];
+                    TEST_CHECK_NEARLY_EQUAL(results[j], reference->evaluate(), 1e-14 * std::abs(results[j]));
+                }
+
+                // the kinematic variable is left unchanged
+                TEST_CHECK_EQUAL(k["q2"].evaluate(), 5.0);
+
+                // the generic implementation yields the same results
+                observable->Observable::evaluate_many("q2", std::span<const double>(q2).first(10), std::span<double>(results).first(10));
+                for (std::size_t j = 0 ; j < 10 ; ++j)
+                {
+                    reference->kinematics()["q2"] = q2[j];
+                    TEST_CHECK_NEARLY_EQUAL(results[j], reference->evaluate(), 1e-14 * std::abs(results[j]));
+                }
+                TEST_CHECK_EQUAL(k["q2"].evaluate(), 5.0);
+
+                TEST_CHECK_THROWS(InternalError, observable->evaluate_many("q2", q2, std::span<double>(results).first(10)));
+            }
+
+            // ObservableCache evaluates expression observables level by level
+            {
+                auto observables = Observables();
+                // test::obs1 returns p[mass::c] * multiplier * (q2_max - q2_min)
+                observables.insert("test::obs1-asymmetry", R"()", Unit::Undefined(), Options(),
+                                   R"(
+                                (<<test::obs1>>[q2_min=>q2_a] - <<test::obs1>>[q2_min=>q2_b]) / (<<test::obs1>>[q2_min=>q2_a] + <<test::obs1>>[q2_min=>q2_b])
+                                )");
+                observables.insert("test::obs1-asymmetry-squared", R"()", Unit::Undefined(), Options(),
+                                   R"(
+                                <<test::obs1-asymmetry>> * <<test::obs1-asymmetry>>
+                                )");
+
+                Parameters      p = Parameters::Defaults();
+                ObservableCache cache(p);
+
+                // enough expressions on the first level to be distributed across threads
+                std::vector<ObservablePtr>       asymmetries, squares;
+                std::vector<ObservableCache::Id> asymmetry_ids, square_ids;
+                for (unsigned i = 0 ; i < 200 ; ++i)
+                {
+                    Kinematics k{
+                        { "q2_a",   1.0 },
+                        { "q2_b",   0.0 },
+                        { "q2_max", 2.0 + 0.1 * i }
+                    };
+
+                    asymmetries.push_back(Observable::make("test::obs1-asymmetry", p, k, Options()));
+                    asymmetry_ids.push_back(cache.add(asymmetries.back()));
+
+                    squares.push_back(Observable::make("test::obs1-asymmetry-squared", p, k, Options()));
+                    square_ids.push_back(cache.add(squares.back()));
+                }
+
+                TEST_CHECK_NO_THROW(cache.update());
+                for (unsigned i = 0 ; i < 200 ; ++i)
+                {
+                    const double q2_max = 2.0 + 0.1 * i;
+                    const double a      = -1.0 / (2.0 * q2_max - 1.0);
+
+                    TEST_CHECK_NEARLY_EQUAL(cache[asymmetry_ids[i]], a,                          1e-14);
+                    TEST_CHECK_NEARLY_EQUAL(cache[asymmetry_ids[i]], asymmetries[i]->evaluate(), 1e-14);
+                    TEST_CHECK_NEARLY_EQUAL(cache[square_ids[i]],    a * a,                      1e-14);
+                }
+
+                // the cached predictions follow changes of the parameters
+                p["mass::c"] = 2.0 * p["mass::c"].evaluate();
+                TEST_CHECK_NO_THROW(cache.update());
+                TEST_CHECK_NEARLY_EQUAL(cache[square_ids[0]], 1.0 / 9.0, 1e-14);
+            }
         }
 
 } observable_test;
@@ -24,7 +24,6 @@
 #include <eos/rare-b-decays/b-to-k-ll-bfs2004.hh>
 #include <eos/nonlocal-form-factors/charm-loops.hh>
 #include <eos/rare-b-decays/qcdf-integrals.hh>
-#include <eos/utils/memoise.hh>
 
 #include <gsl/gsl_sf.h>
 
@@ -46,7 +45,9 @@ namespace eos
         a_2(p["K::a_2@1GeV"], *this),
         lambda_psd(p["B->Pll::Lambda_pseudo@LargeRecoil"], *this),
         sl_phase_psd(p["B->Pll::sl_phase_pseudo@LargeRecoil"], *this),
-        q(o, options, "q"_ok)
+        q(o, options, "q"_ok),
+        opt_charm_loops(o, options, "charm-loops"_ok),
+        charm_loops(opt_charm_loops.value())
     {
         Context ctx("When constructing B->Kll BFS2004 amplitudes");
 
@@ -93,9 +94,27 @@ namespace eos
             qcdf_dilepton_bottom_case = std::bind(&QCDFIntegralCalculator<BToKstarDilepton, tag::Analytical>::dilepton_bottom_case,
                         _1, _2, _3, _4, _5, _6, _7, _8, _9);
         }
+        else if ("mixed-linearised" == qcdf_integrals)
+        {
+            qcdf_dilepton_massless_case = std::bind(&QCDFIntegralCalculator<BToKstarDilepton, tag::Linearised<tag::Mixed>>::dilepton_massless_case,
+                        _1, _2, _3, _4, _5, _6, _7, _8);
+            qcdf_dilepton_charm_case = std::bind(&QCDFIntegralCalculator<BToKstarDilepton, tag::Linearised<tag::Mixed>>::dilepton_charm_case,
+                        _1, _2, _3, _4, _5, _6, _7, _8, _9);
+            qcdf_dilepton_bottom_case = std::bind(&QCDFIntegralCalculator<BToKstarDilepton, tag::Linearised<tag::Mixed>>::dilepton_bottom_case,
+                        _1, _2, _3, _4, _5, _6, _7, _8, _9);
+        }
+        else if ("numerical-linearised" == qcdf_integrals)
+        {
+            qcdf_dilepton_massless_case = std::bind(&QCDFIntegralCalculator<BToKstarDilepton, tag::Linearised<tag::Numerical>>::dilepton_massless_case,
+                        _1, _2, _3, _4, _5, _6, _7, _8);
+            qcdf_dilepton_charm_case = std::bind(&QCDFIntegralCalculator<BToKstarDilepton, tag::Linearised<tag::Numerical>>::dilepton_charm_case,
+                        _1, _2, _3, _4, _5, _6, _7, _8, _9);
+            qcdf_dilepton_bottom_case = std::bind(&QCDFIntegralCalculator<BToKstarDilepton, tag::Linearised<tag::Numerical>>::dilepton_bottom_case,
+                        _1, _2, _3, _4, _5, _6, _7, _8, _9);
+        }
         else
         {
-            throw InvalidOptionValueError("qcdf-integrals"_ok, qcdf_integrals, "mixed, numerical, analytical");
+            throw InvalidOptionValueError("qcdf-integrals"_ok, qcdf_integrals, "mixed, numerical, analytical, mixed-linearised, numerical-linearised");
         }
     }
 
@@ -107,6 +126,7 @@ namespace eos
     BToKDileptonAmplitudes<tag::BFS2004>::options
     {
         { "q"_ok, { "d"s, "u"s }, "d"s },
+        { "charm-loops"_ok, { "exact"s, "chebyshev"s }, "exact"s },
     };
 
     BToKDilepton::DipoleFormFactors
@@ -176,11 +196,11 @@ namespace eos
         complex<double> C1f_top_psd = 1.0 * (c7eff + wc.c7prime()) * (8.0 * std::log(m_b_PS / mu) + 2.0 * L - 4.0 * (1.0 - mu_f() / m_b_PS));
         // cf. [BHP:2007A], Eq. (B.2) and [BFS:2001A], Eqs. (38), p. 9
         complex<double> C1nf_top_psd = -(+1.0 / QCD::casimir_f) * (
-                (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole)
+                (wc.c2() - wc.c1() / 6.0) * charm_loops.F27(mu(), s, m_b_PS, m_c_pole)
                 + c8eff * CharmLoops::F87_massless(mu, s, m_b_PS)
                 + (m_B / (2.0 * m_b_PS)) * (
-                    wc.c1() * memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole)
-                    + wc.c2() * memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole)
+                    wc.c1() * charm_loops.F19(mu(), s, m_b_PS, m_c_pole)
+                    + wc.c2() * charm_loops.F29(mu(), s, m_b_PS, m_c_pole)
                     + c8eff * CharmLoops::F89_massless(s, m_b_PS)));
 
         /* parallel, up sector */
@@ -192,10 +212,10 @@ namespace eos
         // Use here FF_massive - FF_massless because FF_massless is defined with an extra '-'
         // compared to [S:2004A]
         complex<double> C1nf_up_psd = -(+1.0 / QCD::casimir_f) * (
-                (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F27_massless(mu, s, m_b_PS))
+                (wc.c2() - wc.c1() / 6.0) * (charm_loops.F27(mu(), s, m_b_PS, m_c_pole) - CharmLoops::F27_massless(mu, s, m_b_PS))
                 + (m_B / (2.0 * m_b_PS)) * (
-                    wc.c1() * (memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F19_massless(mu, s, m_b_PS))
-                    + wc.c2() * (memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F29_massless(mu, s, m_b_PS))));
+                    wc.c1() * (charm_loops.F19(mu(), s, m_b_PS, m_c_pole) - CharmLoops::F19_massless(mu, s, m_b_PS))
+                    + wc.c2() * (charm_loops.F29(mu(), s, m_b_PS, m_c_pole) - CharmLoops::F29_massless(mu, s, m_b_PS))));
 
         // compute the factorizing contributions
         complex<double> C_psd = C0_top_psd + lambda_hat_u * C0_up_psd
@@ -23,6 +23,7 @@
 #ifndef MASTER_GUARD_EOS_RARE_B_DECAYS_B_TO_K_LL_BFS2004_HH
 #define MASTER_GUARD_EOS_RARE_B_DECAYS_B_TO_K_LL_BFS2004_HH 1
 
+#include <eos/nonlocal-form-factors/charm-loops.hh>
 #include <eos/rare-b-decays/b-to-k-ll-base.hh>
 #include <eos/rare-b-decays/qcdf-integrals.hh>
 
@@ -50,6 +51,9 @@ namespace eos
 
             QuarkFlavorOption q;
 
+            RestrictedOption opt_charm_loops;
+            MassiveCharmLoops charm_loops;
+
             static const std::vector<OptionSpecification> options;
 
             std::function<QCDFIntegrals<BToKstarDilepton> (const double &, const double &,
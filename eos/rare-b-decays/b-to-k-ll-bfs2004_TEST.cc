@@ -133,10 +133,12 @@ class BToKDileptonBFS2004BobethCompatibilityTest :
             TEST_CHECK_RELATIVE_ERROR(a[2], -2.756810607e-20, eps);
 
             const double tau_over_hbar = p["life_time::B_u"] / p["QM::hbar"];
-            TEST_CHECK_RELATIVE_ERROR(d.integrated_branching_ratio(1, 6),
+            auto ir = d.prepare(1, 6);
+            TEST_CHECK_RELATIVE_ERROR(d.integrated_branching_ratio(ir),
                                       2.898727023e-19 * tau_over_hbar, eps);
-            TEST_CHECK_RELATIVE_ERROR(d.integrated_forward_backward_asymmetry(1, 6), 0.1097985735, eps);
-            TEST_CHECK_RELATIVE_ERROR(d.integrated_flat_term(1, 6), 0.2788261376, eps);
+            TEST_CHECK_RELATIVE_ERROR(d.integrated_forward_backward_asymmetry(ir), 0.1097985735, eps);
+            TEST_CHECK_RELATIVE_ERROR(d.integrated_flat_term(ir), 0.2788261376, eps);
+            TEST_CHECK_RELATIVE_ERROR(d.integrated_decay_width(1, 6), 2.898727023e-19, eps);
 
             Kinematics k_mu  = Kinematics({{"q2_min", 1.0}, {"q2_max", 6.0}});
             TEST_CHECK_RELATIVE_ERROR(Observable::make("B->Kll::BR", p, k_mu, oo)->evaluate(),     2.8855929e-19 * tau_over_hbar, eps);
@@ -22,6 +22,7 @@
 #include <eos/maths/integrate-impl.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/rare-b-decays/b-to-k-ll-base.hh>
+#include <eos/rare-b-decays/b-to-k-ll-impl.hh>
 #include <eos/rare-b-decays/b-to-k-ll-bfs2004.hh>
 #include <eos/rare-b-decays/b-to-k-ll-gp2004.hh>
 #include <eos/rare-b-decays/b-to-k-ll-gvdv2020.hh>
@@ -62,6 +63,8 @@ namespace eos
 
         std::shared_ptr<Model> model;
 
+        BToKDilepton::IntermediateResult intermediate_result;
+
         LeptonFlavorOption opt_l;
         QuarkFlavorOption opt_q;
 
@@ -180,13 +183,17 @@ namespace eos
             return a.b_l;
         }
 
-        BToKDilepton::AngularCoefficients integrated_angular_coefficients(const double & s_min, const double & s_max) const
+        std::array<double, 3> integrated_angular_coefficients_array(const double & s_min, const double & s_max) const
         {
             std::function<std::array<double, 3> (const double &)> integrand =
                     std::bind(&Implementation<BToKDilepton>::differential_angular_coefficients_array, this, std::placeholders::_1);
-            std::array<double, 3> integrated_angular_coefficients_array = integrate<1, 3>(integrand, s_min, s_max, cubature::Config().epsrel(1e-5));
 
-            return BToKDilepton::AngularCoefficients(integrated_angular_coefficients_array);
+            return integrate<1, 3>(integrand, s_min, s_max, cubature::Config().epsrel(1e-5));
+        }
+
+        BToKDilepton::AngularCoefficients integrated_angular_coefficients(const double & s_min, const double & s_max) const
+        {
+            return BToKDilepton::AngularCoefficients(integrated_angular_coefficients_array(s_min, s_max));
         }
 
         inline double beta_l(const double & s) const
@@ -256,26 +263,34 @@ namespace eos
         return _imp->unnormalized_decay_width(a);
     }
 
+    const BToKDilepton::IntermediateResult *
+    BToKDilepton::prepare(const double & s_min, const double & s_max) const
+    {
+        _imp->intermediate_result.a = _imp->integrated_angular_coefficients_array(s_min, s_max);
+
+        return &_imp->intermediate_result;
+    }
+
     double
-    BToKDilepton::integrated_branching_ratio(const double & s_min, const double & s_max) const
+    BToKDilepton::integrated_branching_ratio(const IntermediateResult * ir) const
     {
-        AngularCoefficients a = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a(ir->a);
 
         return _imp->differential_branching_ratio(a);
     }
 
     double
-    BToKDilepton::integrated_flat_term(const double & s_min, const double & s_max) const
+    BToKDilepton::integrated_flat_term(const IntermediateResult * ir) const
     {
-        AngularCoefficients a = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a(ir->a);
 
         return _imp->differential_flat_term_numerator(a) / _imp->unnormalized_decay_width(a);
     }
 
     double
-    BToKDilepton::integrated_forward_backward_asymmetry(const double & s_min, const double & s_max) const
+    BToKDilepton::integrated_forward_backward_asymmetry(const IntermediateResult * ir) const
     {
-        AngularCoefficients a = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a(ir->a);
 
         return _imp->differential_forward_backward_asymmetry_numerator(a) / _imp->unnormalized_decay_width(a);
 
@@ -19,7 +19,7 @@
  */
 
 #ifndef EOS_GUARD_EOS_RARE_B_DECAYS_B_TO_K_LL_HH
-#define EOS_GUARD_SRC_RARE_B_DECAYS_B_TO_K_LL_HH 1
+#define EOS_GUARD_EOS_RARE_B_DECAYS_B_TO_K_LL_HH 1
 
 #include <eos/maths/complex.hh>
 #include <eos/utils/options.hh>
@@ -57,9 +57,13 @@ namespace eos
 
             // Integrated Observables
             double integrated_decay_width(const double & s_min, const double & s_max) const;
-            double integrated_branching_ratio(const double & s_min, const double & s_max) const;
-            double integrated_flat_term(const double & s_min, const double & s_max) const;
-            double integrated_forward_backward_asymmetry(const double & s_min, const double & s_max) const;
+
+            class IntermediateResult;
+            const IntermediateResult * prepare(const double & s_min, const double & s_max) const;
+
+            double integrated_branching_ratio(const IntermediateResult *) const;
+            double integrated_flat_term(const IntermediateResult *) const;
+            double integrated_forward_backward_asymmetry(const IntermediateResult *) const;
             double integrated_ratio_muons_electrons(const double & s_min, const double & s_max) const;
 
             /*!
@@ -23,6 +23,7 @@
 #ifndef MASTER_GUARD_EOS_RARE_B_DECAYS_B_TO_KSTAR_LL_BFS2004_HH
 #define MASTER_GUARD_EOS_RARE_B_DECAYS_B_TO_KSTAR_LL_BFS2004_HH 1
 
+#include <eos/nonlocal-form-factors/charm-loops.hh>
 #include <eos/rare-b-decays/b-to-kstar-ll-base.hh>
 #include <eos/rare-b-decays/qcdf-integrals.hh>
 
@@ -60,6 +61,9 @@ namespace eos
             BooleanOption opt_ccbar_resonance;
             BooleanOption opt_use_nlo;
 
+            RestrictedOption opt_charm_loops;
+            MassiveCharmLoops charm_loops;
+
             bool ccbar_resonance;
             bool use_nlo;
 
@@ -25,7 +25,6 @@
 #include <eos/rare-b-decays/qcdf-integrals.hh>
 #include <eos/utils/destringify.hh>
 #include <eos/utils/kinematic.hh>
-#include <eos/utils/memoise.hh>
 
 #include <functional>
 
@@ -56,6 +55,8 @@ namespace eos
         uncertainty_xi_par(p["formfactors::xi_par_uncertainty"], *this),
         opt_ccbar_resonance(o, options, "ccbar-resonance"_ok),
         opt_use_nlo(o, options, "nlo"_ok),
+        opt_charm_loops(o, options, "charm-loops"_ok),
+        charm_loops(opt_charm_loops.value()),
         ccbar_resonance(opt_ccbar_resonance.value()),
         use_nlo(opt_use_nlo.value())
     {
@@ -90,9 +91,27 @@ namespace eos
             qcdf_dilepton_bottom_case = std::bind(&QCDFIntegralCalculator<BToKstarDilepton, tag::Analytical>::dilepton_bottom_case,
                         _1, _2, _3, _4, _5, _6, _7, _8, _9);
         }
+        else if ("mixed-linearised" == qcdf_integrals)
+        {
+            qcdf_dilepton_massless_case = std::bind(&QCDFIntegralCalculator<BToKstarDilepton, tag::Linearised<tag::Mixed>>::dilepton_massless_case,
+                        _1, _2, _3, _4, _5, _6, _7, _8);
+            qcdf_dilepton_charm_case = std::bind(&QCDFIntegralCalculator<BToKstarDilepton, tag::Linearised<tag::Mixed>>::dilepton_charm_case,
+                        _1, _2, _3, _4, _5, _6, _7, _8, _9);
+            qcdf_dilepton_bottom_case = std::bind(&QCDFIntegralCalculator<BToKstarDilepton, tag::Linearised<tag::Mixed>>::dilepton_bottom_case,
+                        _1, _2, _3, _4, _5, _6, _7, _8, _9);
+        }
+        else if ("numerical-linearised" == qcdf_integrals)
+        {
+            qcdf_dilepton_massless_case = std::bind(&QCDFIntegralCalculator<BToKstarDilepton, tag::Linearised<tag::Numerical>>::dilepton_massless_case,
+                        _1, _2, _3, _4, _5, _6, _7, _8);
+            qcdf_dilepton_charm_case = std::bind(&QCDFIntegralCalculator<BToKstarDilepton, tag::Linearised<tag::Numerical>>::dilepton_charm_case,
+                        _1, _2, _3, _4, _5, _6, _7, _8, _9);
+            qcdf_dilepton_bottom_case = std::bind(&QCDFIntegralCalculator<BToKstarDilepton, tag::Linearised<tag::Numerical>>::dilepton_bottom_case,
+                        _1, _2, _3, _4, _5, _6, _7, _8, _9);
+        }
         else
         {
-            throw InvalidOptionValueError("qcdf-integrals"_ok, qcdf_integrals, "mixed, numerical, analytical");
+            throw InvalidOptionValueError("qcdf-integrals"_ok, qcdf_integrals, "mixed, numerical, analytical, mixed-linearised, numerical-linearised");
         }
     }
 
@@ -105,6 +124,7 @@ namespace eos
     {
         { "ccbar-resonance"_ok, { "true"s, "false"s },  "false"s },
         { "nlo"_ok, { "true"s, "false"s },  "true"s },
+        { "charm-loops"_ok, { "exact"s, "chebyshev"s }, "exact"s },
     };
 
     BsToPhiDilepton::DipoleFormFactors
@@ -175,10 +195,10 @@ namespace eos
         complex<double> C1f_top_perp_right = (c7eff + wc.c7prime()) * (8.0 * std::log(m_b_PS / mu()) - L - 4.0 * (1.0 - mu_f() / m_b_PS));
         // cf. [BFS:2001A], Eqs. (34), (37), p. 9
         complex<double> C1nf_top_perp = (-1.0 / QCD::casimir_f) * (
-                (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) + c8eff * CharmLoops::F87_massless(mu, s, m_b_PS)
+                (wc.c2() - wc.c1() / 6.0) * charm_loops.F27(mu(), s, m_b_PS, m_c_pole) + c8eff * CharmLoops::F87_massless(mu, s, m_b_PS)
                 + (s / (2.0 * m_b_PS * m_B)) * (
-                    wc.c1() * memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole)
-                    + wc.c2() * memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole)
+                    wc.c1() * charm_loops.F19(mu(), s, m_b_PS, m_c_pole)
+                    + wc.c2() * charm_loops.F29(mu(), s, m_b_PS, m_c_pole)
                     + c8eff * CharmLoops::F89_massless(s, m_b_PS)));
 
         /* perpendicular, up sector */
@@ -188,10 +208,10 @@ namespace eos
         // cf. [BFS:2001A], Eqs. (34), (37), p. 9
         // [BFS:2004A], [S:2004A] have a different sign convention for F{12}{79}_massless than we!
         complex<double> C1nf_up_perp = (-1.0 / QCD::casimir_f) * (
-                (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F27_massless(mu, s, m_b_PS))
+                (wc.c2() - wc.c1() / 6.0) * (charm_loops.F27(mu(), s, m_b_PS, m_c_pole) - CharmLoops::F27_massless(mu, s, m_b_PS))
                 + (s / (2.0 * m_b_PS * m_B)) * (
-                    wc.c1() * (memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F19_massless(mu, s, m_b_PS))
-                    + wc.c2() * (memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F29_massless(mu, s, m_b_PS))));
+                    wc.c1() * (charm_loops.F19(mu(), s, m_b_PS, m_c_pole) - CharmLoops::F19_massless(mu, s, m_b_PS))
+                    + wc.c2() * (charm_loops.F29(mu(), s, m_b_PS, m_c_pole) - CharmLoops::F29_massless(mu, s, m_b_PS))));
 
         /* parallel, top sector */
         // cf. [BFS:2001A], Eqs. (14), (15), p. 5, in comparison with \delta_{2,3} = 1
@@ -200,11 +220,11 @@ namespace eos
         complex<double> C1f_top_par = -1.0 * (c7eff - wc.c7prime()) * (8.0 * std::log(m_b_PS / mu) + 2.0 * L - 4.0 * (1.0 - mu_f() / m_b_PS));
         // cf. [BFS:2001A], Eqs. (38), p. 9
         complex<double> C1nf_top_par = (+1.0 / QCD::casimir_f) * (
-                (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole)
+                (wc.c2() - wc.c1() / 6.0) * charm_loops.F27(mu(), s, m_b_PS, m_c_pole)
                 + c8eff * CharmLoops::F87_massless(mu, s, m_b_PS)
                 + (m_B / (2.0 * m_b_PS)) * (
-                    wc.c1() * memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole)
-                    + wc.c2() * memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole)
+                    wc.c1() * charm_loops.F19(mu(), s, m_b_PS, m_c_pole)
+                    + wc.c2() * charm_loops.F29(mu(), s, m_b_PS, m_c_pole)
                     + c8eff * CharmLoops::F89_massless(s, m_b_PS)));
 
         /* parallel, up sector */
@@ -214,10 +234,10 @@ namespace eos
         // cf. [BFS:2004A], last paragraph in Sec A.1, p. 24
         // [BFS:2004A], [S:2004A] have a different sign convention for F{12}{79}_massless than we!
         complex<double> C1nf_up_par = (+1.0 / QCD::casimir_f) * (
-                (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F27_massless(mu, s, m_b_PS))
+                (wc.c2() - wc.c1() / 6.0) * (charm_loops.F27(mu(), s, m_b_PS, m_c_pole) - CharmLoops::F27_massless(mu, s, m_b_PS))
                 + (m_B / (2.0 * m_b_PS)) * (
-                    wc.c1() * (memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F19_massless(mu, s, m_b_PS))
-                    + wc.c2() * (memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F29_massless(mu, s, m_b_PS))));
+                    wc.c1() * (charm_loops.F19(mu(), s, m_b_PS, m_c_pole) - CharmLoops::F19_massless(mu, s, m_b_PS))
+                    + wc.c2() * (charm_loops.F29(mu(), s, m_b_PS, m_c_pole) - CharmLoops::F29_massless(mu, s, m_b_PS))));
 
         // compute the factorizing contributions
         complex<double> C_perp_left  = C0_top_perp_left  + lambda_hat_u * C0_up_perp
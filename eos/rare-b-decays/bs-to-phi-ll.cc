@@ -21,6 +21,7 @@
 #include <eos/maths/integrate.hh>
 #include <eos/maths/integrate-impl.hh>
 #include <eos/rare-b-decays/bs-to-phi-ll-base.hh>
+#include <eos/rare-b-decays/bs-to-phi-ll-impl.hh>
 #include <eos/rare-b-decays/bs-to-phi-ll-bfs2004.hh>
 #include <eos/rare-b-decays/bs-to-phi-ll-gvdv2020.hh>
 #include <eos/rare-b-decays/bs-to-phi-ll-naive.hh>
@@ -71,6 +72,8 @@ namespace eos
 
         std::shared_ptr<Model> model;
 
+        BsToPhiDilepton::IntermediateResult intermediate_result;
+
         LeptonFlavorOption opt_l;
 
         UsedParameter hbar;
@@ -229,13 +232,17 @@ namespace eos
             return BsToPhiDilepton::AngularCoefficients(differential_angular_coefficients_array(s));
         }
 
-        BsToPhiDilepton::AngularCoefficients integrated_angular_coefficients(const double & s_min, const double & s_max) const
+        std::array<double, 12> integrated_angular_coefficients_array(const double & s_min, const double & s_max) const
         {
             std::function<std::array<double, 12> (const double &)> integrand =
                     std::bind(&Implementation<BsToPhiDilepton>::differential_angular_coefficients_array, this, std::placeholders::_1);
-            std::array<double, 12> integrated_angular_coefficients_array = integrate<1, 12>(integrand, s_min, s_max, cubature::Config().epsrel(1e-5));
 
-            return BsToPhiDilepton::AngularCoefficients(integrated_angular_coefficients_array);
+            return integrate<1, 12>(integrand, s_min, s_max, cubature::Config().epsrel(1e-5));
+        }
+
+        BsToPhiDilepton::AngularCoefficients integrated_angular_coefficients(const double & s_min, const double & s_max) const
+        {
+            return BsToPhiDilepton::AngularCoefficients(integrated_angular_coefficients_array(s_min, s_max));
         }
 
         inline double decay_width(const BsToPhiDilepton::AngularCoefficients & a_c)
@@ -577,22 +584,30 @@ namespace eos
         return a_c.j9;
     }
 
+    const BsToPhiDilepton::IntermediateResult *
+    BsToPhiDilepton::prepare(const double & q2_min, const double & q2_max) const
+    {
+        _imp->intermediate_result.a = _imp->integrated_angular_coefficients_array(q2_min, q2_max);
+
+        return &_imp->intermediate_result;
+    }
+
     double
-    BsToPhiDilepton::integrated_decay_width(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_decay_width(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return _imp->decay_width(a_c);
     }
 
     double
-    BsToPhiDilepton::integrated_branching_ratio(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_branching_ratio(const IntermediateResult * ir) const
     {
-        return integrated_decay_width(s_min, s_max) * _imp->tau() / _imp->hbar();
+        return integrated_decay_width(ir) * _imp->tau() / _imp->hbar();
     }
 
 
     double
-    BsToPhiDilepton::integrated_unnormalized_forward_backward_asymmetry(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_unnormalized_forward_backward_asymmetry(const IntermediateResult * ir) const
     {
         // Convert from asymmetry in the decay width to asymmetry in the BR
         // cf. [PDG:2008A] : Gamma = hbar / tau_B, pp. 5, 79
@@ -601,66 +616,66 @@ namespace eos
 
         // cf. [BHvD:2010A], eq. (2.8), p. 6
         // cf. [BHvD:2012A], eq. (A7)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
 
         return (a_c.j6s + 0.5 * a_c.j6c) / Gamma;
      }
 
     double
-    BsToPhiDilepton::integrated_forward_backward_asymmetry(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_forward_backward_asymmetry(const IntermediateResult * ir) const
     {
         // cf. [BHvD:2010A], eq. (2.8), p. 6
         // cf. [BHvD:2012A], eq. (A7)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return (a_c.j6s + 0.5 * a_c.j6c) / _imp->decay_width(a_c);
     }
 
     double
-    BsToPhiDilepton::integrated_longitudinal_polarisation(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_longitudinal_polarisation(const IntermediateResult * ir) const
     {
         // cf. [BHvD:2012A], eq. (A9)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return (a_c.j1c - a_c.j2c / 3.0) / _imp->decay_width(a_c);
     }
 
     double
-    BsToPhiDilepton::integrated_transversal_polarisation(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_transversal_polarisation(const IntermediateResult * ir) const
     {
         // cf. [BHvD:2012A], eq. (A10)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return 2.0 * (a_c.j1s - a_c.j2s / 3.0) / _imp->decay_width(a_c);
     }
 
     double
-    BsToPhiDilepton::integrated_transverse_asymmetry_2(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_transverse_asymmetry_2(const IntermediateResult * ir) const
     {
         // cf. [BHvD:2010A], eq. (2.10), p. 6
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return 0.5 * a_c.j3 / a_c.j2s;
     }
 
     double
-    BsToPhiDilepton::integrated_transverse_asymmetry_3(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_transverse_asymmetry_3(const IntermediateResult * ir) const
     {
         // cf. [BHvD:2010A], eq. (2.11), p. 6
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
 
         return sqrt((4.0 * power_of<2>(a_c.j4) + power_of<2>(a_c.j7)) / (-2.0 * a_c.j2c * (2.0 * a_c.j2s + a_c.j3)));
     }
 
     double
-    BsToPhiDilepton::integrated_transverse_asymmetry_4(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_transverse_asymmetry_4(const IntermediateResult * ir) const
     {
         // cf. [BHvD:2010A], eq. (2.12), p. 6
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
 
         return sqrt((power_of<2>(a_c.j5) + 4.0 * power_of<2>(a_c.j8)) / (4.0 * power_of<2>(a_c.j4) + power_of<2>(a_c.j7)));
     }
 
     double
-    BsToPhiDilepton::integrated_transverse_asymmetry_5(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_transverse_asymmetry_5(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
 
         // cf. [BS:2011A], eq. (34), p. 9 for the massless case
         return std::sqrt(16.0 * power_of<2>(a_c.j2s) - power_of<2>(a_c.j6s) - 4.0 * (power_of<2>(a_c.j3) + power_of<2>(a_c.j9)))
@@ -668,141 +683,141 @@ namespace eos
     }
 
     double
-    BsToPhiDilepton::integrated_transverse_asymmetry_re(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_transverse_asymmetry_re(const IntermediateResult * ir) const
     {
         // cf. [BS:2011A], eq. (38), p. 10
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return 0.25 * a_c.j6s / a_c.j2s;
     }
 
     double
-    BsToPhiDilepton::integrated_transverse_asymmetry_im(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_transverse_asymmetry_im(const IntermediateResult * ir) const
     {
         // cf. [BS:2011A], eq. (30), p. 8
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return 0.5 * a_c.j9 / a_c.j2s;
     }
 
     double
-    BsToPhiDilepton::integrated_h_1(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_h_1(const IntermediateResult * ir) const
     {
         // cf. [BHvD:2010A], p. 7, eq. (2.13)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return sqrt(2.0) * a_c.j4 / sqrt(-a_c.j2c * (2.0 * a_c.j2s - a_c.j3));
     }
 
     double
-    BsToPhiDilepton::integrated_h_2(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_h_2(const IntermediateResult * ir) const
     {
         // cf. [BHvD:2010A], p. 7, eq. (2.14)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return  a_c.j5 / sqrt(-2.0 * a_c.j2c * (2.0 * a_c.j2s + a_c.j3));
     }
 
     double
-    BsToPhiDilepton::integrated_h_3(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_h_3(const IntermediateResult * ir) const
     {
         // cf. [BHvD:2010A], p. 7, eq. (2.15)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return a_c.j6s / (2.0 * sqrt(power_of<2>(2.0 * a_c.j2s) - power_of<2>(a_c.j3)));
     }
 
     double
-    BsToPhiDilepton::integrated_h_4(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_h_4(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return sqrt(2.0) * a_c.j8 / sqrt(-a_c.j2c * (2.0 * a_c.j2s + a_c.j3));
     }
 
     double
-    BsToPhiDilepton::integrated_h_5(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_h_5(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return -a_c.j9 / sqrt(power_of<2>(2.0 * a_c.j2s) + power_of<2>(a_c.j3));
     }
 
     // integrated angular coefficients
     double
-    BsToPhiDilepton::integrated_j_1c(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_1c(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return a_c.j1c;
     }
 
     double
-    BsToPhiDilepton::integrated_j_1s(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_1s(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return a_c.j1s;
     }
 
     double
-    BsToPhiDilepton::integrated_j_2c(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_2c(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return a_c.j2c;
     }
 
     double
-    BsToPhiDilepton::integrated_j_2s(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_2s(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return a_c.j2s;
     }
 
     double
-    BsToPhiDilepton::integrated_j_3(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_3(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return a_c.j3;
     }
 
     double
-    BsToPhiDilepton::integrated_j_4(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_4(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return a_c.j4;
     }
 
     double
-    BsToPhiDilepton::integrated_j_5(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_5(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return a_c.j5;
     }
 
     double
-    BsToPhiDilepton::integrated_j_6c(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_6c(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return a_c.j6c;
     }
 
     double
-    BsToPhiDilepton::integrated_j_6s(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_6s(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return a_c.j6s;
     }
 
     double
-    BsToPhiDilepton::integrated_j_7(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_7(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return a_c.j7;
     }
 
     double
-    BsToPhiDilepton::integrated_j_8(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_8(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return a_c.j8;
     }
 
     double
-    BsToPhiDilepton::integrated_j_9(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_9(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c(ir->a);
         return a_c.j9;
     }
 
@@ -57,6 +57,10 @@ namespace eos
 
         LeptonFlavorOption opt_l;
 
+        RestrictedOption opt_charm_loops;
+
+        MassiveCharmLoops charm_loops;
+
         UsedParameter gfermi;
 
         UsedParameter hbar;
@@ -88,6 +92,8 @@ namespace eos
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             model(Model::make(o.get("model"_ok, "SM"), p, o)),
             opt_l(o, options, "l"_ok),
+            opt_charm_loops(o, options, "charm-loops"_ok),
+            charm_loops(opt_charm_loops.value()),
             gfermi(p["WET::G_Fermi"], u),
             hbar(p["QM::hbar"], u),
             tau_B(p["life_time::B" + (destringify<bool>(o.get("admixture"_ok, "true")) ? ("@Y(4S)") : ("_" + o.get("q"_ok, "d")))], u),
@@ -369,8 +375,8 @@ namespace eos
 
             /* Corrections, cf. [HLMW:2005A], Table 6, p. 18 */
             std::vector<complex<double>> m7 = {
-                -power_of<2>(alpha_s_tilde) * kappa * memoise(CharmLoops::F17_massive, mu(), s, m_b_msbar, m_c),
-                -power_of<2>(alpha_s_tilde) * kappa * memoise(CharmLoops::F27_massive, mu(), s, m_b_msbar, m_c),
+                -power_of<2>(alpha_s_tilde) * kappa * charm_loops.F17(mu(), s, m_b_msbar, m_c),
+                -power_of<2>(alpha_s_tilde) * kappa * charm_loops.F27(mu(), s, m_b_msbar, m_c),
                 0.0,
                 0.0,
                 0.0,
@@ -386,8 +392,8 @@ namespace eos
             };
 
             std::vector<complex<double>> m9 = {
-                alpha_s_tilde * kappa * f(1, s_hat) - power_of<2>(alpha_s_tilde) * kappa * memoise(CharmLoops::F19_massive, mu(), s, m_b_msbar, m_c),
-                alpha_s_tilde * kappa * f(2, s_hat) - power_of<2>(alpha_s_tilde) * kappa * memoise(CharmLoops::F29_massive, mu(), s, m_b_msbar, m_c),
+                alpha_s_tilde * kappa * f(1, s_hat) - power_of<2>(alpha_s_tilde) * kappa * charm_loops.F19(mu(), s, m_b_msbar, m_c),
+                alpha_s_tilde * kappa * f(2, s_hat) - power_of<2>(alpha_s_tilde) * kappa * charm_loops.F29(mu(), s, m_b_msbar, m_c),
                 alpha_s_tilde * kappa * f(3, s_hat),
                 alpha_s_tilde * kappa * f(4, s_hat),
                 alpha_s_tilde * kappa * f(5, s_hat),
@@ -561,7 +567,8 @@ namespace eos
     Implementation<BToXsDilepton<HLMW2005>>::options
     {
         { "l"_ok, { "e"s, "mu"s, "tau"s }, "mu"s },
-        { "q"_ok, { "d"s, "u"s }, "d"s }
+        { "q"_ok, { "d"s, "u"s }, "d"s },
+        { "charm-loops"_ok, { "exact"s, "chebyshev"s }, "exact"s }
     };
 
     double
@@ -25,6 +25,7 @@
 #include <eos/models/model.hh>
 #include <eos/nonlocal-form-factors/charm-loops.hh>
 #include <eos/rare-b-decays/lambda-b-to-lambda-dilepton.hh>
+#include <eos/rare-b-decays/lambda-b-to-lambda-dilepton-impl.hh>
 #include <eos/utils/destringify.hh>
 #include <eos/utils/kinematic.hh>
 #include <eos/utils/log.hh>
@@ -306,6 +307,10 @@ namespace eos
 
     template <> struct Implementation<LambdaBToLambdaDilepton<LargeRecoil>>
     {
+        using IntermediateResult = LambdaBToLambdaDilepton<LargeRecoil>::IntermediateResult;
+
+        IntermediateResult intermediate_result;
+
         std::shared_ptr<Model> model;
 
         UsedParameter hbar;
@@ -499,9 +504,16 @@ namespace eos
             return lambdab_to_lambda_dilepton::AngularObservables{ _differential_angular_observables(s) };
         }
 
-        inline lambdab_to_lambda_dilepton::AngularObservables integrated_angular_observables(const double & s_min, const double & s_max)
+        const IntermediateResult * prepare(const double & s_min, const double & s_max)
         {
-            return lambdab_to_lambda_dilepton::AngularObservables{ _integrated_angular_observables(s_min, s_max) };
+            intermediate_result.k = _integrated_angular_observables(s_min, s_max);
+
+            return &intermediate_result;
+        }
+
+        inline lambdab_to_lambda_dilepton::AngularObservables integrated_angular_observables(const IntermediateResult * ir)
+        {
+            return lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         }
     };
 
@@ -552,273 +564,279 @@ namespace eos
     }
 
     /* q^2-integrated observables */
+    const LambdaBToLambdaDilepton<LargeRecoil>::IntermediateResult *
+    LambdaBToLambdaDilepton<LargeRecoil>::prepare(const double & s_min, const double & s_max) const
+    {
+        return _imp->prepare(s_min, s_max);
+    }
+
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_branching_ratio(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_branching_ratio(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).decay_width() * _imp->tau_Lambda_b / _imp->hbar;
+        return _imp->integrated_angular_observables(ir).decay_width() * _imp->tau_Lambda_b / _imp->hbar;
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_leptonic(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_leptonic(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_leptonic();
+        return _imp->integrated_angular_observables(ir).a_fb_leptonic();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_hadronic(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_hadronic(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_hadronic();
+        return _imp->integrated_angular_observables(ir).a_fb_hadronic();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_combined(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_combined(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_combined();
+        return _imp->integrated_angular_observables(ir).a_fb_combined();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_fzero(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_fzero(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).f_zero();
+        return _imp->integrated_angular_observables(ir).f_zero();
     }
 
     /* Polarised angular observables */
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m1(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m1(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k1() / o.decay_width();
     }
 
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m2(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m2(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k2() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m3(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m3(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k3() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m4(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m4(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k4() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m5(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m5(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k5() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m6(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m6(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k6() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m7(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m7(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k7() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m8(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m8(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k8() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m9(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m9(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k9() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m10(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m10(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k10() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m11(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m11(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k11() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m12(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m12(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k12() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m13(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m13(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k13() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m14(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m14(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k14() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m15(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m15(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k15() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m16(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m16(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k16() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m17(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m17(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k17() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m18(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m18(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k18() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m19(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m19(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k19() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m20(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m20(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k20() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m21(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m21(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k21() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m22(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m22(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k22() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m23(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m23(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k23() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m24(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m24(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k24() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m25(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m25(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k25() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m26(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m26(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k26() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m27(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m27(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k27() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m28(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m28(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k28() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m29(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m29(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k29() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m30(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m30(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k30() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m31(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m31(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k31() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m32(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m32(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k32() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m33(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m33(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k33() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m34(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m34(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k34() / o.decay_width();
     }
 
@@ -844,6 +862,10 @@ namespace eos
 
     template <> struct Implementation<LambdaBToLambdaDilepton<LowRecoil>>
     {
+        using IntermediateResult = LambdaBToLambdaDilepton<LowRecoil>::IntermediateResult;
+
+        IntermediateResult intermediate_result;
+
         std::shared_ptr<Model> model;
 
         LeptonFlavorOption opt_l;
@@ -968,9 +990,16 @@ namespace eos
             return lambdab_to_lambda_dilepton::AngularObservables{ _differential_angular_observables(s) };
         }
 
-        inline lambdab_to_lambda_dilepton::AngularObservables integrated_angular_observables(const double & s_min, const double & s_max)
+        const IntermediateResult * prepare(const double & s_min, const double & s_max)
         {
-            return lambdab_to_lambda_dilepton::AngularObservables{ _integrated_angular_observables(s_min, s_max) };
+            intermediate_result.k = _integrated_angular_observables(s_min, s_max);
+
+            return &intermediate_result;
+        }
+
+        inline lambdab_to_lambda_dilepton::AngularObservables integrated_angular_observables(const IntermediateResult * ir)
+        {
+            return lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         }
     };
 
@@ -1022,342 +1051,348 @@ namespace eos
     }
 
     /* q^2-integrated observables */
+    const LambdaBToLambdaDilepton<LowRecoil>::IntermediateResult *
+    LambdaBToLambdaDilepton<LowRecoil>::prepare(const double & s_min, const double & s_max) const
+    {
+        return _imp->prepare(s_min, s_max);
+    }
+
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_branching_ratio(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_branching_ratio(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).decay_width() * _imp->tau_Lambda_b / _imp->hbar;
+        return _imp->integrated_angular_observables(ir).decay_width() * _imp->tau_Lambda_b / _imp->hbar;
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_leptonic(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_leptonic(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_leptonic();
+        return _imp->integrated_angular_observables(ir).a_fb_leptonic();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_hadronic(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_hadronic(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_hadronic();
+        return _imp->integrated_angular_observables(ir).a_fb_hadronic();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_combined(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_combined(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_combined();
+        return _imp->integrated_angular_observables(ir).a_fb_combined();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_fzero(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_fzero(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).f_zero();
+        return _imp->integrated_angular_observables(ir).f_zero();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_k1ss(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k1ss(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k1ss() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_k1cc(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k1cc(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k1cc() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_k1c(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k1c(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k1c() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_k2ss(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k2ss(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k2ss() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_k2cc(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k2cc(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k2cc() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_k2c(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k2c(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k2c() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_k3sc(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k3sc(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k3sc() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_k3s(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k3s(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k3s() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_k4sc(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k4sc(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k4sc() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_k4s(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k4s(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k4s() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m1(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m1(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k1() / o.decay_width();
     }
 
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m2(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m2(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k2() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m3(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m3(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k3() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m4(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m4(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k4() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m5(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m5(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k5() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m6(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m6(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k6() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m7(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m7(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k7() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m8(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m8(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k8() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m9(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m9(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k9() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m10(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m10(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k10() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m11(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m11(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k11() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m12(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m12(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k12() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m13(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m13(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k13() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m14(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m14(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k14() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m15(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m15(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k15() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m16(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m16(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k16() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m17(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m17(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k17() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m18(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m18(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k18() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m19(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m19(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k19() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m20(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m20(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k20() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m21(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m21(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k21() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m22(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m22(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k22() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m23(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m23(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k23() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m24(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m24(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k24() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m25(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m25(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k25() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m26(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m26(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k26() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m27(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m27(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k27() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m28(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m28(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k28() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m29(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m29(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k29() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m30(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m30(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k30() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m31(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m31(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k31() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m32(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m32(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k32() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m33(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m33(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k33() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m34(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m34(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k34() / o.decay_width();
     }
 
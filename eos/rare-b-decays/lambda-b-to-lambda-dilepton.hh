@@ -46,46 +46,50 @@ namespace eos
             double differential_a_fb_combined(const double & s) const;
             double differential_fzero(const double & s) const;
 
-            double integrated_branching_ratio(const double & s_min, const double & s_max) const;
-            double integrated_a_fb_leptonic(const double & s_min, const double & s_max) const;
-            double integrated_a_fb_hadronic(const double & s_min, const double & s_max) const;
-            double integrated_a_fb_combined(const double & s_min, const double & s_max) const;
-            double integrated_fzero(const double & s_min, const double & s_max) const;
-
-            double integrated_m1(const double & s_min, const double & s_max) const;
-            double integrated_m2(const double & s_min, const double & s_max) const;
-            double integrated_m3(const double & s_min, const double & s_max) const;
-            double integrated_m4(const double & s_min, const double & s_max) const;
-            double integrated_m5(const double & s_min, const double & s_max) const;
-            double integrated_m6(const double & s_min, const double & s_max) const;
-            double integrated_m7(const double & s_min, const double & s_max) const;
-            double integrated_m8(const double & s_min, const double & s_max) const;
-            double integrated_m9(const double & s_min, const double & s_max) const;
-            double integrated_m10(const double & s_min, const double & s_max) const;
-            double integrated_m11(const double & s_min, const double & s_max) const;
-            double integrated_m12(const double & s_min, const double & s_max) const;
-            double integrated_m13(const double & s_min, const double & s_max) const;
-            double integrated_m14(const double & s_min, const double & s_max) const;
-            double integrated_m15(const double & s_min, const double & s_max) const;
-            double integrated_m16(const double & s_min, const double & s_max) const;
-            double integrated_m17(const double & s_min, const double & s_max) const;
-            double integrated_m18(const double & s_min, const double & s_max) const;
-            double integrated_m19(const double & s_min, const double & s_max) const;
-            double integrated_m20(const double & s_min, const double & s_max) const;
-            double integrated_m21(const double & s_min, const double & s_max) const;
-            double integrated_m22(const double & s_min, const double & s_max) const;
-            double integrated_m23(const double & s_min, const double & s_max) const;
-            double integrated_m24(const double & s_min, const double & s_max) const;
-            double integrated_m25(const double & s_min, const double & s_max) const;
-            double integrated_m26(const double & s_min, const double & s_max) const;
-            double integrated_m27(const double & s_min, const double & s_max) const;
-            double integrated_m28(const double & s_min, const double & s_max) const;
-            double integrated_m29(const double & s_min, const double & s_max) const;
-            double integrated_m30(const double & s_min, const double & s_max) const;
-            double integrated_m31(const double & s_min, const double & s_max) const;
-            double integrated_m32(const double & s_min, const double & s_max) const;
-            double integrated_m33(const double & s_min, const double & s_max) const;
-            double integrated_m34(const double & s_min, const double & s_max) const;
+            // Intermediate result shared by all q^2-integrated observables of one bin
+            class IntermediateResult;
+            const IntermediateResult * prepare(const double & s_min, const double & s_max) const;
+
+            double integrated_branching_ratio(const IntermediateResult *) const;
+            double integrated_a_fb_leptonic(const IntermediateResult *) const;
+            double integrated_a_fb_hadronic(const IntermediateResult *) const;
+            double integrated_a_fb_combined(const IntermediateResult *) const;
+            double integrated_fzero(const IntermediateResult *) const;
+
+            double integrated_m1(const IntermediateResult *) const;
+            double integrated_m2(const IntermediateResult *) const;
+            double integrated_m3(const IntermediateResult *) const;
+            double integrated_m4(const IntermediateResult *) const;
+            double integrated_m5(const IntermediateResult *) const;
+            double integrated_m6(const IntermediateResult *) const;
+            double integrated_m7(const IntermediateResult *) const;
+            double integrated_m8(const IntermediateResult *) const;
+            double integrated_m9(const IntermediateResult *) const;
+            double integrated_m10(const IntermediateResult *) const;
+            double integrated_m11(const IntermediateResult *) const;
+            double integrated_m12(const IntermediateResult *) const;
+            double integrated_m13(const IntermediateResult *) const;
+            double integrated_m14(const IntermediateResult *) const;
+            double integrated_m15(const IntermediateResult *) const;
+            double integrated_m16(const IntermediateResult *) const;
+            double integrated_m17(const IntermediateResult *) const;
+            double integrated_m18(const IntermediateResult *) const;
+            double integrated_m19(const IntermediateResult *) const;
+            double integrated_m20(const IntermediateResult *) const;
+            double integrated_m21(const IntermediateResult *) const;
+            double integrated_m22(const IntermediateResult *) const;
+            double integrated_m23(const IntermediateResult *) const;
+            double integrated_m24(const IntermediateResult *) const;
+            double integrated_m25(const IntermediateResult *) const;
+            double integrated_m26(const IntermediateResult *) const;
+            double integrated_m27(const IntermediateResult *) const;
+            double integrated_m28(const IntermediateResult *) const;
+            double integrated_m29(const IntermediateResult *) const;
+            double integrated_m30(const IntermediateResult *) const;
+            double integrated_m31(const IntermediateResult *) const;
+            double integrated_m32(const IntermediateResult *) const;
+            double integrated_m33(const IntermediateResult *) const;
+            double integrated_m34(const IntermediateResult *) const;
 
             /*!
              * References used in the computation of our observables.
@@ -116,57 +120,61 @@ namespace eos
             double differential_a_fb_combined(const double & s) const;
             double differential_fzero(const double & s) const;
 
-            double integrated_branching_ratio(const double & s_min, const double & s_max) const;
-            double integrated_a_fb_leptonic(const double & s_min, const double & s_max) const;
-            double integrated_a_fb_hadronic(const double & s_min, const double & s_max) const;
-            double integrated_a_fb_combined(const double & s_min, const double & s_max) const;
-            double integrated_fzero(const double & s_min, const double & s_max) const;
-
-            double integrated_k1ss(const double & s_min, const double & s_max) const;
-            double integrated_k1cc(const double & s_min, const double & s_max) const;
-            double integrated_k1c(const double & s_min, const double & s_max) const;
-            double integrated_k2ss(const double & s_min, const double & s_max) const;
-            double integrated_k2cc(const double & s_min, const double & s_max) const;
-            double integrated_k2c(const double & s_min, const double & s_max) const;
-            double integrated_k3sc(const double & s_min, const double & s_max) const;
-            double integrated_k3s(const double & s_min, const double & s_max) const;
-            double integrated_k4sc(const double & s_min, const double & s_max) const;
-            double integrated_k4s(const double & s_min, const double & s_max) const;
-
-            double integrated_m1(const double & s_min, const double & s_max) const;
-            double integrated_m2(const double & s_min, const double & s_max) const;
-            double integrated_m3(const double & s_min, const double & s_max) const;
-            double integrated_m4(const double & s_min, const double & s_max) const;
-            double integrated_m5(const double & s_min, const double & s_max) const;
-            double integrated_m6(const double & s_min, const double & s_max) const;
-            double integrated_m7(const double & s_min, const double & s_max) const;
-            double integrated_m8(const double & s_min, const double & s_max) const;
-            double integrated_m9(const double & s_min, const double & s_max) const;
-            double integrated_m10(const double & s_min, const double & s_max) const;
-            double integrated_m11(const double & s_min, const double & s_max) const;
-            double integrated_m12(const double & s_min, const double & s_max) const;
-            double integrated_m13(const double & s_min, const double & s_max) const;
-            double integrated_m14(const double & s_min, const double & s_max) const;
-            double integrated_m15(const double & s_min, const double & s_max) const;
-            double integrated_m16(const double & s_min, const double & s_max) const;
-            double integrated_m17(const double & s_min, const double & s_max) const;
-            double integrated_m18(const double & s_min, const double & s_max) const;
-            double integrated_m19(const double & s_min, const double & s_max) const;
-            double integrated_m20(const double & s_min, const double & s_max) const;
-            double integrated_m21(const double & s_min, const double & s_max) const;
-            double integrated_m22(const double & s_min, const double & s_max) const;
-            double integrated_m23(const double & s_min, const double & s_max) const;
-            double integrated_m24(const double & s_min, const double & s_max) const;
-            double integrated_m25(const double & s_min, const double & s_max) const;
-            double integrated_m26(const double & s_min, const double & s_max) const;
-            double integrated_m27(const double & s_min, const double & s_max) const;
-            double integrated_m28(const double & s_min, const double & s_max) const;
-            double integrated_m29(const double & s_min, const double & s_max) const;
-            double integrated_m30(const double & s_min, const double & s_max) const;
-            double integrated_m31(const double & s_min, const double & s_max) const;
-            double integrated_m32(const double & s_min, const double & s_max) const;
-            double integrated_m33(const double & s_min, const double & s_max) const;
-            double integrated_m34(const double & s_min, const double & s_max) const;
+            // Intermediate result shared by all q^2-integrated observables of one bin
+            class IntermediateResult;
+            const IntermediateResult * prepare(const double & s_min, const double & s_max) const;
+
+            double integrated_branching_ratio(const IntermediateResult *) const;
+            double integrated_a_fb_leptonic(const IntermediateResult *) const;
+            double integrated_a_fb_hadronic(const IntermediateResult *) const;
+            double integrated_a_fb_combined(const IntermediateResult *) const;
+            double integrated_fzero(const IntermediateResult *) const;
+
+            double integrated_k1ss(const IntermediateResult *) const;
+            double integrated_k1cc(const IntermediateResult *) const;
+            double integrated_k1c(const IntermediateResult *) const;
+            double integrated_k2ss(const IntermediateResult *) const;
+            double integrated_k2cc(const IntermediateResult *) const;
+            double integrated_k2c(const IntermediateResult *) const;
+            double integrated_k3sc(const IntermediateResult *) const;
+            double integrated_k3s(const IntermediateResult *) const;
+            double integrated_k4sc(const IntermediateResult *) const;
+            double integrated_k4s(const IntermediateResult *) const;
+
+            double integrated_m1(const IntermediateResult *) const;
+            double integrated_m2(const IntermediateResult *) const;
+            double integrated_m3(const IntermediateResult *) const;
+            double integrated_m4(const IntermediateResult *) const;
+            double integrated_m5(const IntermediateResult *) const;
+            double integrated_m6(const IntermediateResult *) const;
+            double integrated_m7(const IntermediateResult *) const;
+            double integrated_m8(const IntermediateResult *) const;
+            double integrated_m9(const IntermediateResult *) const;
+            double integrated_m10(const IntermediateResult *) const;
+            double integrated_m11(const IntermediateResult *) const;
+            double integrated_m12(const IntermediateResult *) const;
+            double integrated_m13(const IntermediateResult *) const;
+            double integrated_m14(const IntermediateResult *) const;
+            double integrated_m15(const IntermediateResult *) const;
+            double integrated_m16(const IntermediateResult *) const;
+            double integrated_m17(const IntermediateResult *) const;
+            double integrated_m18(const IntermediateResult *) const;
+            double integrated_m19(const IntermediateResult *) const;
+            double integrated_m20(const IntermediateResult *) const;
+            double integrated_m21(const IntermediateResult *) const;
+            double integrated_m22(const IntermediateResult *) const;
+            double integrated_m23(const IntermediateResult *) const;
+            double integrated_m24(const IntermediateResult *) const;
+            double integrated_m25(const IntermediateResult *) const;
+            double integrated_m26(const IntermediateResult *) const;
+            double integrated_m27(const IntermediateResult *) const;
+            double integrated_m28(const IntermediateResult *) const;
+            double integrated_m29(const IntermediateResult *) const;
+            double integrated_m30(const IntermediateResult *) const;
+            double integrated_m31(const IntermediateResult *) const;
+            double integrated_m32(const IntermediateResult *) const;
+            double integrated_m33(const IntermediateResult *) const;
+            double integrated_m34(const IntermediateResult *) const;
 
             /*!
              * References used in the computation of our observables.
@@ -23,6 +23,7 @@
 #include <eos/rare-b-decays/b-to-ll.hh>
 #include <eos/rare-b-decays/b-to-k-charmonium.hh>
 #include <eos/rare-b-decays/b-to-k-ll.hh>
+#include <eos/rare-b-decays/b-to-k-ll-impl.hh>
 #include <eos/rare-b-decays/b-to-kstar-charmonium.hh>
 #include <eos/rare-b-decays/b-to-kstar-gamma.hh>
 #include <eos/rare-b-decays/b-to-kstar-ll.hh>
@@ -31,9 +32,11 @@
 #include <eos/rare-b-decays/b-to-vec-nu-nu.hh>
 #include <eos/rare-b-decays/bs-to-phi-charmonium.hh>
 #include <eos/rare-b-decays/bs-to-phi-ll.hh>
+#include <eos/rare-b-decays/bs-to-phi-ll-impl.hh>
 #include <eos/rare-b-decays/inclusive-b-to-s-dilepton.hh>
 #include <eos/rare-b-decays/inclusive-b-to-s-gamma.hh>
 #include <eos/rare-b-decays/lambda-b-to-lambda-dilepton.hh>
+#include <eos/rare-b-decays/lambda-b-to-lambda-dilepton-impl.hh>
 #include <eos/rare-b-decays/lambda-b-to-lambda-nu-nu.hh>
 #include <eos/rare-b-decays/lambda-b-to-lambda-nu-nu-impl.hh>
 #include <eos/rare-b-decays/lambda-b-to-lambda1520-ll.hh>
@@ -347,8 +350,9 @@ namespace eos
                         <<B->Kll::dBR/ds;l=e>>
                         )"),
 
-                make_observable("B->Kll::BR_CP_specific", R"(\mathcal{B}(\bar{B}\to \bar{K}\ell^+\ell^-))",
+                make_cacheable_observable("B->Kll::BR_CP_specific", R"(\mathcal{B}(\bar{B}\to \bar{K}\ell^+\ell^-))",
                         Unit::None(),
+                        &BToKDilepton::prepare,
                         &BToKDilepton::integrated_branching_ratio,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -381,8 +385,9 @@ namespace eos
                         &BToKDilepton::integrated_decay_width,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->Kll::F_H_CP_specific", R"(F_\mathrm{H}(\bar{B}\to \bar{K}\ell^+\ell^-))",
+                make_cacheable_observable("B->Kll::F_H_CP_specific", R"(F_\mathrm{H}(\bar{B}\to \bar{K}\ell^+\ell^-))",
                         Unit::None(),
+                        &BToKDilepton::prepare,
                         &BToKDilepton::integrated_flat_term,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -396,8 +401,9 @@ namespace eos
                                )
                         )"),
 
-                make_observable("B->Kll::A_FB_CP_specific", R"(A_\mathrm{FB}(\bar{B}\to \bar{K}\ell^+\ell^-))",
+                make_cacheable_observable("B->Kll::A_FB_CP_specific", R"(A_\mathrm{FB}(\bar{B}\to \bar{K}\ell^+\ell^-))",
                         Unit::None(),
+                        &BToKDilepton::prepare,
                         &BToKDilepton::integrated_forward_backward_asymmetry,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -1420,14 +1426,16 @@ namespace eos
                         <<B_s->phill::dBR/ds;l=e>>
                         )"),
 
-                make_observable("B_s->phill::A_FB", R"(A_\mathrm{FB}(\bar{B}_s\to \phi\ell^+\ell^-))",
+                make_cacheable_observable("B_s->phill::A_FB", R"(A_\mathrm{FB}(\bar{B}_s\to \phi\ell^+\ell^-))",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_forward_backward_asymmetry,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "q"_ok, "s" } }),
 
-                make_observable("B_s->phill::BR_CP_specific", R"(\mathcal{B}(\bar{B}_s\to \phi\ell^+\ell^-))",
+                make_cacheable_observable("B_s->phill::BR_CP_specific", R"(\mathcal{B}(\bar{B}_s\to \phi\ell^+\ell^-))",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_branching_ratio,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "q"_ok, "s" } }),
@@ -1442,14 +1450,16 @@ namespace eos
                                )
                         )"),
 
-                make_observable("B_s->phill::F_L", R"(F_L(\bar{B}_s\to \phi\ell^+\ell^-))",
+                make_cacheable_observable("B_s->phill::F_L", R"(F_L(\bar{B}_s\to \phi\ell^+\ell^-))",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_longitudinal_polarisation,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "q"_ok, "s" } }),
 
-                make_observable("B_s->phill::Gamma_CP_specific",
+                make_cacheable_observable("B_s->phill::Gamma_CP_specific",
                         Unit::GeV(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_decay_width,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "q"_ok, "s" } }),
@@ -1532,74 +1542,86 @@ namespace eos
                         &BsToPhiDilepton::differential_j_9,
                         std::make_tuple("q2")),
 
-                make_observable("B_s->phill::J_1s", R"(J_{1s}(\bar{B}_s\to \phi\ell^+\ell^-))",
+                make_cacheable_observable("B_s->phill::J_1s", R"(J_{1s}(\bar{B}_s\to \phi\ell^+\ell^-))",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_j_1s,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "q"_ok, "s" } }),
 
-                make_observable("B_s->phill::J_1c", R"(J_{1c}(\bar{B}_s\to \phi\ell^+\ell^-))",
+                make_cacheable_observable("B_s->phill::J_1c", R"(J_{1c}(\bar{B}_s\to \phi\ell^+\ell^-))",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_j_1c,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "q"_ok, "s" } }),
 
-                make_observable("B_s->phill::J_2s", R"(J_{2s}(\bar{B}_s\to \phi\ell^+\ell^-))",
+                make_cacheable_observable("B_s->phill::J_2s", R"(J_{2s}(\bar{B}_s\to \phi\ell^+\ell^-))",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_j_2s,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "q"_ok, "s" } }),
 
-                make_observable("B_s->phill::J_2c", R"(J_{2c}(\bar{B}_s\to \phi\ell^+\ell^-))",
+                make_cacheable_observable("B_s->phill::J_2c", R"(J_{2c}(\bar{B}_s\to \phi\ell^+\ell^-))",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_j_2c,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "q"_ok, "s" } }),
 
-                make_observable("B_s->phill::J_3", R"(J_3(\bar{B}_s\to \phi\ell^+\ell^-))",
+                make_cacheable_observable("B_s->phill::J_3", R"(J_3(\bar{B}_s\to \phi\ell^+\ell^-))",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_j_3,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "q"_ok, "s" } }),
 
-                make_observable("B_s->phill::J_4", R"(J_4(\bar{B}_s\to \phi\ell^+\ell^-))",
+                make_cacheable_observable("B_s->phill::J_4", R"(J_4(\bar{B}_s\to \phi\ell^+\ell^-))",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_j_4,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "q"_ok, "s" } }),
 
-                make_observable("B_s->phill::J_5", R"(J_5(\bar{B}_s\to \phi\ell^+\ell^-))",
+                make_cacheable_observable("B_s->phill::J_5", R"(J_5(\bar{B}_s\to \phi\ell^+\ell^-))",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_j_5,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "q"_ok, "s" } }),
 
-                make_observable("B_s->phill::J_6s", R"(J_{6s}(\bar{B}_s\to \phi\ell^+\ell^-))",
+                make_cacheable_observable("B_s->phill::J_6s", R"(J_{6s}(\bar{B}_s\to \phi\ell^+\ell^-))",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_j_6s,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "q"_ok, "s" } }),
 
-                make_observable("B_s->phill::J_6c", R"(J_{6c}(\bar{B}_s\to \phi\ell^+\ell^-))",
+                make_cacheable_observable("B_s->phill::J_6c", R"(J_{6c}(\bar{B}_s\to \phi\ell^+\ell^-))",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_j_6c,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "q"_ok, "s" } }),
 
-                make_observable("B_s->phill::J_7", R"(J_7(\bar{B}_s\to \phi\ell^+\ell^-))",
+                make_cacheable_observable("B_s->phill::J_7", R"(J_7(\bar{B}_s\to \phi\ell^+\ell^-))",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_j_7,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "q"_ok, "s" } }),
 
-                make_observable("B_s->phill::J_8", R"(J_8(\bar{B}_s\to \phi\ell^+\ell^-))",
+                make_cacheable_observable("B_s->phill::J_8", R"(J_8(\bar{B}_s\to \phi\ell^+\ell^-))",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_j_8,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "q"_ok, "s" } }),
 
-                make_observable("B_s->phill::J_9", R"(J_9(\bar{B}_s\to \phi\ell^+\ell^-))",
+                make_cacheable_observable("B_s->phill::J_9", R"(J_9(\bar{B}_s\to \phi\ell^+\ell^-))",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_j_9,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "q"_ok, "s" } }),
@@ -2083,8 +2105,9 @@ namespace eos
                         &LambdaBToLambdaDilepton<LargeRecoil>::differential_fzero,
                         std::make_tuple("q2")),
 
-                make_observable("Lambda_b->Lambdall::BR@LargeRecoil", R"(\mathcal{B}(\Lambda_b\to\Lambda\ell^+\ell^-))",
+                make_cacheable_observable("Lambda_b->Lambdall::BR@LargeRecoil", R"(\mathcal{B}(\Lambda_b\to\Lambda\ell^+\ell^-))",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LargeRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LargeRecoil>::integrated_branching_ratio,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -2096,23 +2119,27 @@ namespace eos
                         <<Lambda_b->Lambdall::BR@LargeRecoil;l=e>>[q2_max=>q2_e_max,q2_min=>q2_e_min]
                         )"),
 
-                make_observable("Lambda_b->Lambdall::A_FB^l@LargeRecoil", R"(A_\mathrm{FB}^\ell(\Lambda_b\to\Lambda\ell^+\ell^-))",
+                make_cacheable_observable("Lambda_b->Lambdall::A_FB^l@LargeRecoil", R"(A_\mathrm{FB}^\ell(\Lambda_b\to\Lambda\ell^+\ell^-))",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LargeRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_leptonic,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::A_FB^h@LargeRecoil", R"(A_\mathrm{FB}^h(\Lambda_b\to\Lambda\ell^+\ell^-))",
+                make_cacheable_observable("Lambda_b->Lambdall::A_FB^h@LargeRecoil", R"(A_\mathrm{FB}^h(\Lambda_b\to\Lambda\ell^+\ell^-))",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LargeRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_hadronic,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::A_FB^c@LargeRecoil", R"(A_\mathrm{FB}^{h,\ell}(\Lambda_b\to\Lambda\ell^+\ell^-))",
+                make_cacheable_observable("Lambda_b->Lambdall::A_FB^c@LargeRecoil", R"(A_\mathrm{FB}^{h,\ell}(\Lambda_b\to\Lambda\ell^+\ell^-))",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LargeRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_combined,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::F_0@LargeRecoil", R"(F_0(\Lambda_b\to\Lambda\ell^+\ell^-))",
+                make_cacheable_observable("Lambda_b->Lambdall::F_0@LargeRecoil", R"(F_0(\Lambda_b\to\Lambda\ell^+\ell^-))",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LargeRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LargeRecoil>::integrated_fzero,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -2142,248 +2169,297 @@ namespace eos
                         &LambdaBToLambdaDilepton<LowRecoil>::differential_fzero,
                         std::make_tuple("q2")),
 
-                make_observable("Lambda_b->Lambdall::BR@LowRecoil", R"(\mathcal{B}(\Lambda_b\to\Lambda\ell^+\ell^-))",
+                make_cacheable_observable("Lambda_b->Lambdall::BR@LowRecoil", R"(\mathcal{B}(\Lambda_b\to\Lambda\ell^+\ell^-))",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_branching_ratio,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::A_FB^l@LowRecoil", R"(A_\mathrm{FB}^\ell(\Lambda_b\to\Lambda\ell^+\ell^-))",
+                make_cacheable_observable("Lambda_b->Lambdall::A_FB^l@LowRecoil", R"(A_\mathrm{FB}^\ell(\Lambda_b\to\Lambda\ell^+\ell^-))",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_leptonic,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::A_FB^h@LowRecoil", R"(A_\mathrm{FB}^h(\Lambda_b\to\Lambda\ell^+\ell^-))",
+                make_cacheable_observable("Lambda_b->Lambdall::A_FB^h@LowRecoil", R"(A_\mathrm{FB}^h(\Lambda_b\to\Lambda\ell^+\ell^-))",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_hadronic,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::A_FB^c@LowRecoil", R"(A_\mathrm{FB}^{h,\ell}(\Lambda_b\to\Lambda\ell^+\ell^-))",
+                make_cacheable_observable("Lambda_b->Lambdall::A_FB^c@LowRecoil", R"(A_\mathrm{FB}^{h,\ell}(\Lambda_b\to\Lambda\ell^+\ell^-))",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_combined,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::F_0@LowRecoil", R"(F_0(\Lambda_b\to\Lambda\ell^+\ell^-))",
+                make_cacheable_observable("Lambda_b->Lambdall::F_0@LowRecoil", R"(F_0(\Lambda_b\to\Lambda\ell^+\ell^-))",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_fzero,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::K_1ss@LowRecoil",
+                make_cacheable_observable("Lambda_b->Lambdall::K_1ss@LowRecoil",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_k1ss,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::K_1cc@LowRecoil",
+                make_cacheable_observable("Lambda_b->Lambdall::K_1cc@LowRecoil",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_k1cc,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::K_1c@LowRecoil",
+                make_cacheable_observable("Lambda_b->Lambdall::K_1c@LowRecoil",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_k1c,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::K_2ss@LowRecoil",
+                make_cacheable_observable("Lambda_b->Lambdall::K_2ss@LowRecoil",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_k2ss,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::K_2cc@LowRecoil",
+                make_cacheable_observable("Lambda_b->Lambdall::K_2cc@LowRecoil",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_k2cc,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::K_2c@LowRecoil",
+                make_cacheable_observable("Lambda_b->Lambdall::K_2c@LowRecoil",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_k2c,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::K_3sc@LowRecoil",
+                make_cacheable_observable("Lambda_b->Lambdall::K_3sc@LowRecoil",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_k3sc,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::K_3s@LowRecoil",
+                make_cacheable_observable("Lambda_b->Lambdall::K_3s@LowRecoil",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_k3s,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::K_4sc@LowRecoil",
+                make_cacheable_observable("Lambda_b->Lambdall::K_4sc@LowRecoil",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_k4sc,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::K_4s@LowRecoil",
+                make_cacheable_observable("Lambda_b->Lambdall::K_4s@LowRecoil",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_k4s,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_1@LowRecoil", R"(M_1)",
+                make_cacheable_observable("Lambda_b->Lambdall::M_1@LowRecoil", R"(M_1)",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m1,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_2@LowRecoil", R"(M_2)",
+                make_cacheable_observable("Lambda_b->Lambdall::M_2@LowRecoil", R"(M_2)",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m2,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_3@LowRecoil", R"(M_3)",
+                make_cacheable_observable("Lambda_b->Lambdall::M_3@LowRecoil", R"(M_3)",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m3,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_4@LowRecoil", R"(M_4)",
+                make_cacheable_observable("Lambda_b->Lambdall::M_4@LowRecoil", R"(M_4)",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m4,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_5@LowRecoil", R"(M_5)",
+                make_cacheable_observable("Lambda_b->Lambdall::M_5@LowRecoil", R"(M_5)",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m5,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_6@LowRecoil", R"(M_6)",
+                make_cacheable_observable("Lambda_b->Lambdall::M_6@LowRecoil", R"(M_6)",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m6,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_7@LowRecoil", R"(M_7)",
+                make_cacheable_observable("Lambda_b->Lambdall::M_7@LowRecoil", R"(M_7)",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m7,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_8@LowRecoil", R"(M_8)",
+                make_cacheable_observable("Lambda_b->Lambdall::M_8@LowRecoil", R"(M_8)",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m8,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_9@LowRecoil", R"(M_9)",
+                make_cacheable_observable("Lambda_b->Lambdall::M_9@LowRecoil", R"(M_9)",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m9,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_10@LowRecoil", R"(M_{10})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_10@LowRecoil", R"(M_{10})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m10,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_11@LowRecoil", R"(M_{11})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_11@LowRecoil", R"(M_{11})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m11,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_12@LowRecoil", R"(M_{12})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_12@LowRecoil", R"(M_{12})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m12,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_13@LowRecoil", R"(M_{13})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_13@LowRecoil", R"(M_{13})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m13,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_14@LowRecoil", R"(M_{14})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_14@LowRecoil", R"(M_{14})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m14,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_15@LowRecoil", R"(M_{15})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_15@LowRecoil", R"(M_{15})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m15,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_16@LowRecoil", R"(M_{16})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_16@LowRecoil", R"(M_{16})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m16,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_17@LowRecoil", R"(M_{17})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_17@LowRecoil", R"(M_{17})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m17,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_18@LowRecoil", R"(M_{18})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_18@LowRecoil", R"(M_{18})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m18,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_19@LowRecoil", R"(M_{19})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_19@LowRecoil", R"(M_{19})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m19,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_20@LowRecoil", R"(M_{20})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_20@LowRecoil", R"(M_{20})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m20,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_21@LowRecoil", R"(M_{21})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_21@LowRecoil", R"(M_{21})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m21,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_22@LowRecoil", R"(M_{22})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_22@LowRecoil", R"(M_{22})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m22,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_23@LowRecoil", R"(M_{23})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_23@LowRecoil", R"(M_{23})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m23,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_24@LowRecoil", R"(M_{24})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_24@LowRecoil", R"(M_{24})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m24,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_25@LowRecoil", R"(M_{25})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_25@LowRecoil", R"(M_{25})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m25,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_26@LowRecoil", R"(M_{26})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_26@LowRecoil", R"(M_{26})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m26,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_27@LowRecoil", R"(M_{27})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_27@LowRecoil", R"(M_{27})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m27,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_28@LowRecoil", R"(M_{28})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_28@LowRecoil", R"(M_{28})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m28,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_29@LowRecoil", R"(M_{29})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_29@LowRecoil", R"(M_{29})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m29,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_30@LowRecoil", R"(M_{30})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_30@LowRecoil", R"(M_{30})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m30,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_31@LowRecoil", R"(M_{31})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_31@LowRecoil", R"(M_{31})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m31,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_32@LowRecoil", R"(M_{32})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_32@LowRecoil", R"(M_{32})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m32,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_33@LowRecoil", R"(M_{33})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_33@LowRecoil", R"(M_{33})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m33,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_34@LowRecoil", R"(M_{34})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_34@LowRecoil", R"(M_{34})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m34,
                         std::make_tuple("q2_min", "q2_max")),
             }
@@ -26,5 +26,8 @@ namespace eos
         const std::string Analytical::name = "analytical";
         const std::string Mixed::name      = "mixed";
         const std::string Numerical::name  = "numerical";
+
+        template <> const std::string Linearised<Mixed>::name      = "mixed-linearised";
+        template <> const std::string Linearised<Numerical>::name  = "numerical-linearised";
     }
 }
@@ -74,6 +74,15 @@ namespace eos
         {
             static const std::string name;
         };
+
+        template <typename Tag_>
+        struct Linearised
+        {
+            static const std::string name;
+        };
+
+        template <> const std::string Linearised<Mixed>::name;
+        template <> const std::string Linearised<Numerical>::name;
     }
 
     template <typename Process_, typename Tag_>
@@ -174,10 +183,54 @@ namespace eos
                     const double & a_1_parallel, const double & a_2_parallel);
     };
 
+    /*!
+     * Linearised calculation of the QCDF integrals.
+     *
+     * All integrals depend linearly on the Gegenbauer moments. This calculator obtains the integrals
+     * for the basis of moments (1, a_1, a_2) from QCDFIntegralCalculator<BToKstarDilepton, Tag_> on a grid
+     * in s, the quark mass, and mu, memoises them, and interpolates them multilinearly within the grid cell.
+     * The results are assembled as linear combinations with the actual moments. Varying the moments, and
+     * varying s, the quark masses, or mu within a cell, therefore does not trigger further integrations.
+     * Grid cells that include s = 0 or the quark-pair threshold are calculated directly.
+     */
+    template <typename Tag_>
+    class QCDFIntegralCalculator<BToKstarDilepton, tag::Linearised<Tag_>>
+    {
+        public:
+            using ResultsType = QCDFIntegrals<BToKstarDilepton>;
+
+            static ResultsType photon_bottom_case(const double & m_b, const double & m_B, const double & m_V, const double & mu,
+                    const double & a_1_perp, const double & a_2_perp,
+                    const double & a_1_parallel, const double & a_2_parallel);
+
+            static ResultsType photon_charm_case(const double & m_c, const double & m_B, const double & m_V, const double & mu,
+                    const double & a_1_perp, const double & a_2_perp,
+                    const double & a_1_parallel, const double & a_2_parallel);
+
+            static ResultsType photon_massless_case(const double & m_B, const double & m_V, const double & mu,
+                    const double & a_1_perp, const double & a_2_perp,
+                    const double & a_1_parallel, const double & a_2_parallel);
+
+            static ResultsType dilepton_bottom_case(const double & s, const double & m_b, const double & m_B, const double & m_V, const double & mu,
+                    const double & a_1_perp, const double & a_2_perp,
+                    const double & a_1_parallel, const double & a_2_parallel);
+
+            static ResultsType dilepton_charm_case(const double & s, const double & m_c, const double & m_B, const double & m_V, const double & mu,
+                    const double & a_1_perp, const double & a_2_perp,
+                    const double & a_1_parallel, const double & a_2_parallel);
+
+            static ResultsType dilepton_massless_case(const double & s, const double & m_B, const double & m_V, const double & mu,
+                    const double & a_1_perp, const double & a_2_perp,
+                    const double & a_1_parallel, const double & a_2_parallel);
+    };
+
     // explicit instantiation
     template class QCDFIntegralCalculator<BToKstarDilepton, tag::Analytical>;
     template class QCDFIntegralCalculator<BToKstarDilepton, tag::Mixed>;
     template class QCDFIntegralCalculator<BToKstarDilepton, tag::Numerical>;
+
+    extern template class QCDFIntegralCalculator<BToKstarDilepton, tag::Linearised<tag::Mixed>>;
+    extern template class QCDFIntegralCalculator<BToKstarDilepton, tag::Linearised<tag::Numerical>>;
 }
 
 #endif
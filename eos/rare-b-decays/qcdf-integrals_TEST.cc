@@ -20,8 +20,10 @@
 #include <test/test.hh>
 #include <eos/rare-b-decays/qcdf-integrals.hh>
 
+#include <array>
 #include <iostream>
 #include <string>
+#include <vector>
 
 using namespace test;
 using namespace eos;
@@ -926,3 +928,67 @@ class QCDFIntegralsDileptonMasslessTest :
 QCDFIntegralsDileptonMasslessTest<tag::Analytical> qcdf_integrals_dilepton_massless_test_analytical;
 QCDFIntegralsDileptonMasslessTest<tag::Mixed> qcdf_integrals_dilepton_massless_test_mixed;
 QCDFIntegralsDileptonMasslessTest<tag::Numerical>  qcdf_integrals_dilepton_massless_test_numerical;
+
+class QCDFIntegralsLinearisedTest :
+    public TestCase
+{
+    public:
+        QCDFIntegralsLinearisedTest() :
+            TestCase("qcdf_integrals_linearised_test")
+        {
+        }
+
+        static void check(const QCDFIntegrals<BToKstarDilepton> & value, const QCDFIntegrals<BToKstarDilepton> & reference, const double & eps)
+        {
+            const std::vector<std::pair<complex<double>, complex<double>>> pairs
+            {
+                { value.j0_perp,          reference.j0_perp          },
+                { value.j0bar_perp,       reference.j0bar_perp       },
+                { value.j1_perp,          reference.j1_perp          },
+                { value.j2_perp,          reference.j2_perp          },
+                { value.j4_perp,          reference.j4_perp          },
+                { value.j5_perp,          reference.j5_perp          },
+                { value.j6_perp,          reference.j6_perp          },
+                { value.j7_perp,          reference.j7_perp          },
+                { value.j0_parallel,      reference.j0_parallel      },
+                { value.j1_parallel,      reference.j1_parallel      },
+                { value.j3_parallel,      reference.j3_parallel      },
+                { value.j4_parallel,      reference.j4_parallel      },
+                { value.jtilde1_perp,     reference.jtilde1_perp     },
+                { value.jtilde2_parallel, reference.jtilde2_parallel },
+            };
+
+            for (const auto & [v, r] : pairs)
+            {
+                TEST_CHECK_NEARLY_EQUAL(real(v), real(r), eps * std::abs(r));
+                TEST_CHECK_NEARLY_EQUAL(imag(v), imag(r), eps * std::abs(r));
+            }
+        }
+
+        virtual void run() const
+        {
+            using Mixed = QCDFIntegralCalculator<BToKstarDilepton, tag::Mixed>;
+            using LinearisedMixed = QCDFIntegralCalculator<BToKstarDilepton, tag::Linearised<tag::Mixed>>;
+
+            static const double m_b = 4.8, m_B = 5.279, m_Kstar = 0.892;
+
+            // the interpolated linear combination reproduces the direct results for arbitrary moments, both on and off the grid
+            for (const auto & [a_1_perp, a_2_perp, a_1_para, a_2_para] : std::vector<std::array<double, 4>>{
+                    { 0.0, 0.0, 0.0, 0.0 }, { 0.1, 0.2, 0.3, 0.4 }, { -0.06, 0.15, 0.03, 0.11 } })
+            {
+                // accuracy of the interpolation, cf. the 0.2% quoted for the grid
+                static const double eps = 2.0e-3;
+
+                for (const auto & [s, m_c, mu] : std::vector<std::array<double, 3>>{
+                        { 1.0, 1.6, 4.2 }, { 1.234, 1.357, 4.321 }, { 6.0, 1.6, 4.2 }, { 5.987, 1.389, 2.468 } })
+                {
+                    check(LinearisedMixed::dilepton_massless_case(s, m_B, m_Kstar, mu, a_1_perp, a_2_perp, a_1_para, a_2_para),
+                          Mixed::dilepton_massless_case(s, m_B, m_Kstar, mu, a_1_perp, a_2_perp, a_1_para, a_2_para), eps);
+                    check(LinearisedMixed::dilepton_charm_case(s, m_c, m_B, m_Kstar, mu, a_1_perp, a_2_perp, a_1_para, a_2_para),
+                          Mixed::dilepton_charm_case(s, m_c, m_B, m_Kstar, mu, a_1_perp, a_2_perp, a_1_para, a_2_para), eps);
+                    check(LinearisedMixed::dilepton_bottom_case(s, m_b, m_B, m_Kstar, mu, a_1_perp, a_2_perp, a_1_para, a_2_para),
+                          Mixed::dilepton_bottom_case(s, m_b, m_B, m_Kstar, mu, a_1_perp, a_2_perp, a_1_para, a_2_para), eps);
+                }
+            }
+        }
+} qcdf_integrals_linearised_test;
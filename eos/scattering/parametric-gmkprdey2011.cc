@@ -212,7 +212,9 @@ namespace eos
         _f_phase_P1(std::bind(&GMKPRDEY2011ScatteringAmplitudes::_phase_P1, this, std::placeholders::_1)),
         _f_phase_D0(std::bind(&GMKPRDEY2011ScatteringAmplitudes::_phase_D0, this, std::placeholders::_1)),
         _omnes_P1(_intervals_P1, _f_phase_P1, 0.0),
-        _omnes_D0(_intervals_D0, _f_phase_D0, 0.0)
+        _omnes_D0(_intervals_D0, _f_phase_D0, 0.0),
+        _parameters(p),
+        _generation(p.generation())
     {
     }
 
@@ -268,6 +270,8 @@ namespace eos
 
     complex<double> GMKPRDEY2011ScatteringAmplitudes::omnes_factor(const double & s, const unsigned & l, const IsospinRepresentation & i) const
     {
+        _update();
+
         if ((l == 0) && (i == IsospinRepresentation::zero))
         {
             throw InternalError("Current Omnes factor solution strategy does not allow for phases exceeding 2 Pi! Consider implementing coupled-channel treatment!");
@@ -300,6 +304,48 @@ namespace eos
         }
     }
 
+    void
+    GMKPRDEY2011ScatteringAmplitudes::_update() const
+    {
+        if (_parameters.generation() == _generation)
+        {
+            return;
+        }
+
+        // solutions for phases encountered before are obtained from the OmnesFactorCache
+        _omnes_P1.update();
+        _omnes_D0.update();
+        _outer_functions.clear();
+
+        _generation = _parameters.generation();
+    }
+
+    complex<double>
+    GMKPRDEY2011ScatteringAmplitudes::_outer_function(const std::function<complex<double>(const complex<double> &)> & integrand, const complex<double> & z,
+            const double & sp, const double & s0, const double & prec, const unsigned & l, const IsospinRepresentation & i) const
+    {
+        _update();
+
+        const auto key = std::make_tuple(sp, s0, prec, l, i);
+        auto o = _outer_functions.find(key);
+        if (o == _outer_functions.end())
+        {
+            std::shared_ptr<const OuterFunction> outer_function;
+            try
+            {
+                outer_function = std::make_shared<const OuterFunction>(integrand, prec);
+            }
+            catch (InternalError &)
+            {
+                // the Fourier series does not converge if the Omnes factor is not smooth on the unit circle; integrate per point instead
+            }
+
+            o = _outer_functions.emplace(key, outer_function).first;
+        }
+
+        return o->second ? (*o->second)(z) : outer(integrand, z, prec);
+    }
+
     // Note: all our omnes factors go like 1/s for large s. Thus we need to take out a factor of (1 - z)^2 which would cause issues with the integration
     complex<double> GMKPRDEY2011ScatteringAmplitudes::omnes_outer_function(const double & s, const double & sp, const double & s0, const double & prec, const unsigned & l, const IsospinRepresentation & i) const
     {
@@ -330,7 +376,7 @@ namespace eos
                 }
             };
 
-            return power_of<2>(zeval - 1.0) * outer(integrand, zeval, prec);
+            return power_of<2>(zeval - 1.0) * _outer_function(integrand, zeval, sp, s0, prec, l, i);
         }
         else if ((s < sp) && (s0 < sp) && (l == 2) && (i == IsospinRepresentation::zero))
         {
@@ -352,7 +398,7 @@ namespace eos
                 }
             };
 
-            return power_of<2>(zeval - 1.0) * outer(integrand, zeval, prec);
+            return power_of<2>(zeval - 1.0) * _outer_function(integrand, zeval, sp, s0, prec, l, i);
         }
         else
         {
@@ -25,6 +25,7 @@
 #include <eos/maths/complex.hh>
 #include <eos/maths/interpolation.hh>
 #include <eos/maths/omnes-factor.hh>
+#include <eos/maths/outer-function.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/utils/diagnostics.hh>
 #include <eos/utils/options.hh>
@@ -32,6 +33,9 @@
 #include <eos/utils/reference-name.hh>
 
 #include <array>
+#include <map>
+#include <memory>
+#include <tuple>
 
 namespace eos
 {
@@ -85,8 +89,21 @@ namespace eos
             std::array<double, 4> _intervals_P1;
             std::array<double, 5> _intervals_D0;
             std::function<double(const double &)> _f_phase_P1, _f_phase_D0;
-            OmnesFactor<30, 4> _omnes_P1;
-            OmnesFactor<40, 5> _omnes_D0;
+            mutable OmnesFactor<30, 4> _omnes_P1;
+            mutable OmnesFactor<40, 5> _omnes_D0;
+
+            // Outer functions of the Omnes factors, sampled once per parameter point
+            mutable std::map<std::tuple<double, double, double, unsigned, IsospinRepresentation>, std::shared_ptr<const OuterFunction>> _outer_functions;
+
+            // Parameter point for which the Omnes factors and their outer functions are valid
+            Parameters _parameters;
+            mutable std::uint64_t _generation;
+
+            // Update the Omnes factors and discard their outer functions if any parameter has changed
+            void _update() const;
+
+            complex<double> _outer_function(const std::function<complex<double>(const complex<double> &)> & integrand, const complex<double> & z,
+                    const double & sp, const double & s0, const double & prec, const unsigned & l, const IsospinRepresentation & i) const;
 
             QualifiedName _par_name(const std::string & partial_wave, const std::string & par_name, unsigned idx) const;
             QualifiedName _par_name(const std::string & partial_wave, const std::string & par_name) const;
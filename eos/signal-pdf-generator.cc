@@ -0,0 +1,432 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2024 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/signal-pdf-generator.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/kinematic.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <gsl/gsl_rng.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+
+namespace eos
+{
+    template <>
+    struct Implementation<SignalPDFGenerator>
+    {
+        // one clone of the PDF and its kinematic variables per concurrent job
+        struct Worker
+        {
+            DensityPtr density;
+
+            std::vector<MutablePtr> variables;
+
+            gsl_rng * rng;
+
+            unsigned long proposals;
+
+            // largest ratio of PDF to envelope per violating cell
+            std::map<unsigned, double> violations;
+
+            std::string error;
+        };
+
+        SignalPDFPtr pdf;
+
+        SignalPDFGenerator::Config config;
+
+        std::vector<std::string> names;
+
+        unsigned dim;
+
+        std::vector<double> lower, width;
+
+        // number of bins per dimension and total number of cells
+        unsigned bins, cells;
+
+        // log(PDF) used to scale the envelope, and the envelope relative to exp(log_scale)
+        double log_scale;
+
+        std::vector<double> envelope, cumulative;
+
+        std::vector<Worker> workers;
+
+        gsl_rng * rng;
+
+        double efficiency;
+
+        unsigned long envelope_violations;
+
+        Implementation(const SignalPDFPtr & pdf, const SignalPDFGenerator::Config & config) :
+            pdf(pdf),
+            config(config),
+            dim(0),
+            bins(1),
+            cells(1),
+            log_scale(0.0),
+            rng(gsl_rng_alloc(gsl_rng_mt19937)),
+            efficiency(0.0),
+            envelope_violations(0)
+        {
+            if (config.probes == 0)
+            {
+                throw InternalError("SignalPDFGenerator: the number of probes per cell must be positive");
+            }
+
+            if (config.safety < 1.0)
+            {
+                throw InternalError("SignalPDFGenerator: the safety factor must not be smaller than 1");
+            }
+
+            if (config.chunk_size == 0)
+            {
+                throw InternalError("SignalPDFGenerator: the chunk size must be positive");
+            }
+
+            // the phase space is bounded by the kinematic variables NAME_min and NAME_max, if present, or the PDF's kinematic ranges otherwise
+            Kinematics kinematics = pdf->kinematics();
+            for (const auto & d : *pdf)
+            {
+                const std::string name = d.parameter->name();
+                double min = d.min, max = d.max;
+
+                try
+                {
+                    min = kinematics[name + "_min"].evaluate();
+                    max = kinematics[name + "_max"].evaluate();
+                }
+                catch (UnknownKinematicVariableError &)
+                {
+                }
+
+                if (! (min < max))
+                {
+                    throw InternalError("SignalPDFGenerator: empty range for kinematic variable '" + name + "'");
+                }
+
+                names.push_back(name);
+                lower.push_back(min);
+                width.push_back(max - min);
+            }
+
+            dim = names.size();
+            if (dim == 0)
+            {
+                throw InternalError("SignalPDFGenerator: the PDF does not have any kinematic variables");
+            }
+
+            bins  = std::max(1u, unsigned(std::floor(std::pow(double(config.cells), 1.0 / dim) + 1.0e-9)));
+            cells = 1;
+            for (unsigned i = 0 ; i < dim ; ++i)
+            {
+                cells *= bins;
+            }
+
+            gsl_rng_set(rng, config.seed);
+
+            for (unsigned j = 0 ; j < ThreadPool::instance()->number_of_threads() ; ++j)
+            {
+                Worker w{ pdf->clone(), {}, gsl_rng_alloc(gsl_rng_mt19937), 0, {}, "" };
+                for (const auto & d : *w.density)
+                {
+                    w.variables.push_back(d.parameter);
+                }
+                workers.push_back(std::move(w));
+            }
+
+            build_envelope();
+        }
+
+        ~Implementation()
+        {
+            for (auto & w : workers)
+            {
+                gsl_rng_free(w.rng);
+            }
+
+            gsl_rng_free(rng);
+        }
+
+        // set the kinematic variables to a uniformly distributed point within the cell
+        inline void
+        place(Worker & w, unsigned cell, double * point) const
+        {
+            for (unsigned i = 0 ; i < dim ; ++i)
+            {
+                const unsigned bin = cell % bins;
+                cell /= bins;
+
+                point[i] = lower[i] + width[i] * (bin + gsl_rng_uniform(w.rng)) / bins;
+                w.variables[i]->set(point[i]);
+            }
+        }
+
+        void
+        probe_cells(Worker & w, const unsigned long & seed, const unsigned & first, const unsigned & last, std::vector<double> & log_max) const
+        {
+            std::vector<double> point(dim);
+
+            try
+            {
+                for (unsigned c = first ; c < last ; ++c)
+                {
+                    // seed per cell, so that the envelope does not depend on the number of threads
+                    gsl_rng_set(w.rng, seed + c);
+
+                    double result = -std::numeric_limits<double>::infinity();
+                    for (unsigned p = 0 ; p < config.probes ; ++p)
+                    {
+                        place(w, c, point.data());
+                        result = std::max(result, w.density->evaluate());
+                    }
+
+                    log_max[c] = result;
+                }
+            }
+            catch (eos::Exception & e)
+            {
+                w.error = e.what();
+            }
+        }
+
+        void
+        build_envelope()
+        {
+            auto thread_pool = ThreadPool::instance();
+
+            std::vector<double> log_max(cells, -std::numeric_limits<double>::infinity());
+            const unsigned long seed = gsl_rng_get(rng);
+
+            std::vector<Ticket> tickets;
+            const unsigned per_job = (cells + workers.size() - 1) / workers.size();
+            for (unsigned j = 0 ; j < workers.size() ; ++j)
+            {
+                const unsigned first = std::min(cells, j * per_job), last = std::min(cells, (j + 1) * per_job);
+                tickets.push_back(thread_pool->enqueue([this, j, seed, first, last, &log_max]() { this->probe_cells(workers[j], seed, first, last, log_max); }));
+            }
+
+            for (auto & t : tickets)
+            {
+                t.wait();
+            }
+
+            for (auto & w : workers)
+            {
+                if (! w.error.empty())
+                {
+                    throw InternalError("SignalPDFGenerator: " + w.error);
+                }
+            }
+
+            log_scale = *std::max_element(log_max.cbegin(), log_max.cend());
+            if (! std::isfinite(log_scale) || (log_scale <= -std::numeric_limits<double>::max()))
+            {
+                throw InternalError("SignalPDFGenerator: the PDF does not take positive values in any cell");
+            }
+
+            envelope.resize(cells);
+            for (unsigned c = 0 ; c < cells ; ++c)
+            {
+                envelope[c] = config.safety * std::max(std::exp(log_max[c] - log_scale), config.floor);
+            }
+
+            update_cumulative();
+
+            Log::instance()->message("SignalPDFGenerator::build_envelope", ll_informational)
+                << "Built envelope with " << cells << " cells for " << dim << " kinematic variable(s)";
+        }
+
+        void
+        update_cumulative()
+        {
+            cumulative.resize(cells);
+
+            double sum = 0.0;
+            for (unsigned c = 0 ; c < cells ; ++c)
+            {
+                sum += envelope[c];
+                cumulative[c] = sum;
+            }
+        }
+
+        void
+        generate_chunk(Worker & w, const unsigned long & seed, const unsigned long & first, const unsigned long & last, double * events, double * log_pdf)
+        {
+            const double total = cumulative.back();
+
+            gsl_rng_set(w.rng, seed);
+
+            try
+            {
+                for (unsigned long i = first ; i < last ; )
+                {
+                    const unsigned c = std::min<unsigned>(cells - 1,
+                            std::upper_bound(cumulative.cbegin(), cumulative.cend(), gsl_rng_uniform(w.rng) * total) - cumulative.cbegin());
+
+                    double * point = events + i * dim;
+                    place(w, c, point);
+                    ++w.proposals;
+
+                    const double value = w.density->evaluate();
+                    const double ratio = std::exp(value - log_scale);
+
+                    if (ratio > envelope[c])
+                    {
+                        double & violation = w.violations[c];
+                        violation = std::max(violation, ratio);
+                    }
+
+                    if (gsl_rng_uniform(w.rng) * envelope[c] < ratio)
+                    {
+                        if (log_pdf)
+                        {
+                            log_pdf[i] = value;
+                        }
+
+                        ++i;
+                    }
+                }
+            }
+            catch (eos::Exception & e)
+            {
+                w.error = e.what();
+            }
+        }
+
+        void
+        generate(const unsigned long & n, double * events, double * log_pdf)
+        {
+            auto thread_pool = ThreadPool::instance();
+
+            const unsigned long chunks = (n + config.chunk_size - 1) / config.chunk_size;
+
+            // seeds are drawn up front, so that each chunk's events do not depend on the number of threads
+            std::vector<unsigned long> seeds(chunks);
+            for (auto & s : seeds)
+            {
+                s = gsl_rng_get(rng);
+            }
+
+            for (auto & w : workers)
+            {
+                w.proposals = 0;
+                w.violations.clear();
+            }
+
+            std::vector<Ticket> tickets;
+            for (unsigned j = 0 ; j < workers.size() ; ++j)
+            {
+                tickets.push_back(thread_pool->enqueue([this, j, n, chunks, &seeds, events, log_pdf]()
+                {
+                    for (unsigned long k = j ; k < chunks ; k += workers.size())
+                    {
+                        const unsigned long first = k * config.chunk_size;
+                        const unsigned long last  = std::min(n, first + config.chunk_size);
+                        this->generate_chunk(workers[j], seeds[k], first, last, events, log_pdf);
+                    }
+                }));
+            }
+
+            for (auto & t : tickets)
+            {
+                t.wait();
+            }
+
+            unsigned long proposals = 0;
+            std::map<unsigned, double> violations;
+            for (auto & w : workers)
+            {
+                if (! w.error.empty())
+                {
+                    throw InternalError("SignalPDFGenerator: " + w.error);
+                }
+
+                proposals += w.proposals;
+                for (const auto & [c, ratio] : w.violations)
+                {
+                    double & violation = violations[c];
+                    violation = std::max(violation, ratio);
+                }
+            }
+
+            efficiency = (proposals > 0) ? double(n) / proposals : 0.0;
+            envelope_violations = violations.size();
+
+            if (! violations.empty())
+            {
+                Log::instance()->message("SignalPDFGenerator::generate", ll_warning)
+                    << "The PDF exceeded the envelope in " << violations.size() << " cell(s); enlarging the envelope for subsequent events";
+
+                for (const auto & [c, ratio] : violations)
+                {
+                    envelope[c] = config.safety * ratio;
+                }
+
+                update_cumulative();
+            }
+        }
+    };
+
+    SignalPDFGenerator::SignalPDFGenerator(const SignalPDFPtr & pdf, const Config & config) :
+        PrivateImplementationPattern<SignalPDFGenerator>(new Implementation<SignalPDFGenerator>(pdf, config))
+    {
+    }
+
+    SignalPDFGenerator::~SignalPDFGenerator() = default;
+
+    const std::vector<std::string> &
+    SignalPDFGenerator::variables() const
+    {
+        return _imp->names;
+    }
+
+    void
+    SignalPDFGenerator::generate(const unsigned long & n, double * events, double * log_pdf)
+    {
+        _imp->generate(n, events, log_pdf);
+    }
+
+    std::vector<double>
+    SignalPDFGenerator::generate(const unsigned long & n)
+    {
+        std::vector<double> result(n * _imp->dim);
+
+        _imp->generate(n, result.data(), nullptr);
+
+        return result;
+    }
+
+    double
+    SignalPDFGenerator::efficiency() const
+    {
+        return _imp->efficiency;
+    }
+
+    unsigned long
+    SignalPDFGenerator::envelope_violations() const
+    {
+        return _imp->envelope_violations;
+    }
+}
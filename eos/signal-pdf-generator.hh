@@ -0,0 +1,113 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2024 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_SIGNAL_PDF_GENERATOR_HH
+#define EOS_GUARD_EOS_SIGNAL_PDF_GENERATOR_HH 1
+
+#include <eos/signal-pdf.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * Generates independent events from a SignalPDF by accept-reject sampling.
+     *
+     * The phase space, as bounded by the kinematic variables NAME_min and NAME_max, is divided
+     * into a regular grid of cells. The envelope is piecewise constant, using the largest value
+     * of the PDF found at a number of probe points within each cell, multiplied by a safety factor.
+     * Events are generated in chunks of fixed size, each with its own random number generator seeded
+     * from a master generator, and the chunks are distributed across the ThreadPool using one clone
+     * of the PDF per thread. The events are therefore reproducible for a fixed seed, independent of
+     * the number of threads.
+     */
+    class SignalPDFGenerator :
+        public PrivateImplementationPattern<SignalPDFGenerator>
+    {
+        public:
+            struct Config
+            {
+                /// Approximate total number of cells of the envelope.
+                unsigned cells = 4096;
+
+                /// Number of random probe points per cell used to estimate the cell's maximum.
+                unsigned probes = 16;
+
+                /// Factor by which each cell's estimated maximum is enlarged.
+                double safety = 1.5;
+
+                /// Lower bound on each cell's envelope, relative to the largest value of the PDF found.
+                double floor = 1.0e-3;
+
+                /// Seed for the master random number generator.
+                unsigned long seed = 1701;
+
+                /// Number of events generated with a single random number generator.
+                unsigned chunk_size = 10000;
+            };
+
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * Evaluates the envelope concurrently.
+             *
+             * @param pdf     The signal PDF from which events shall be generated.
+             * @param config  The configuration of the generator.
+             */
+            SignalPDFGenerator(const SignalPDFPtr & pdf, const Config & config);
+
+            /// Destructor.
+            ~SignalPDFGenerator();
+            ///@}
+
+            /// Retrieve the names of the kinematic variables, in the order in which they are stored for each event.
+            const std::vector<std::string> & variables() const;
+
+            /*!
+             * Generate events.
+             *
+             * Successive calls continue the master random number generator's sequence.
+             *
+             * @param n        The number of events.
+             * @param events   Storage for n * variables().size() values, filled row by row.
+             * @param log_pdf  Storage for n values of the log(PDF), or nullptr.
+             */
+            void generate(const unsigned long & n, double * events, double * log_pdf);
+
+            /// Convenience version of generate(), returning the events row by row.
+            std::vector<double> generate(const unsigned long & n);
+
+            /// Retrieve the fraction of accepted proposals during the last call to generate().
+            double efficiency() const;
+
+            /*!
+             * Retrieve the number of cells in which the PDF exceeded the envelope during the last call to generate().
+             *
+             * Events in such cells are slightly undersampled. The envelope is enlarged after each call to avoid
+             * further violations.
+             */
+            unsigned long envelope_violations() const;
+    };
+}
+
+#endif
@@ -0,0 +1,96 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2024 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/signal-pdf-generator.hh>
+#include <eos/utils/options.hh>
+
+#include <test/test.hh>
+
+#include <cmath>
+
+using namespace test;
+using namespace eos;
+
+class SignalPDFGeneratorTest : public TestCase
+{
+    public:
+        SignalPDFGeneratorTest() :
+            TestCase("signal_pdf_generator_test")
+        {
+        }
+
+        virtual void
+        run() const
+        {
+            // 9 + 8 z + 9 z^2 on z in [-1, +1]: <z> = 2/9, <z^2> = 7/15
+            {
+                Parameters p = Parameters::Defaults();
+                Kinematics k{ { "z_min", -1.0 }, { "z_max", +1.0 } };
+                SignalPDFPtr pdf = SignalPDF::make("Test::Legendre1D", p, k, Options{ });
+
+                SignalPDFGenerator::Config config;
+                config.cells      = 64;
+                config.chunk_size = 1000;
+
+                SignalPDFGenerator generator(pdf, config);
+                TEST_CHECK_EQUAL(generator.variables().size(), 1u);
+                TEST_CHECK_EQUAL(generator.variables()[0],     "z");
+
+                const unsigned long n = 100000;
+                std::vector<double> events(n), log_pdf(n);
+                generator.generate(n, events.data(), log_pdf.data());
+
+                double mean = 0.0, mean2 = 0.0;
+                for (unsigned long i = 0 ; i < n ; ++i)
+                {
+                    const double & z = events[i];
+                    TEST_CHECK(-1.0 <= z);
+                    TEST_CHECK(z <= +1.0);
+                    TEST_CHECK_RELATIVE_ERROR(log_pdf[i], std::log(9.0 + 8.0 * z + 9.0 * z * z), 1.0e-12);
+
+                    mean  += z / n;
+                    mean2 += z * z / n;
+                }
+
+                TEST_CHECK_NEARLY_EQUAL(mean,  2.0 / 9.0,  0.01);
+                TEST_CHECK_NEARLY_EQUAL(mean2, 7.0 / 15.0, 0.01);
+                TEST_CHECK(generator.efficiency() > 0.5);
+                TEST_CHECK_EQUAL(generator.envelope_violations(), 0u);
+
+                // events are reproducible for a fixed seed
+                SignalPDFGenerator repeated(pdf, config);
+                std::vector<double> repeated_events = repeated.generate(n);
+                TEST_CHECK(repeated_events == events);
+            }
+
+            // the normalization bounds restrict the phase space
+            {
+                Parameters p = Parameters::Defaults();
+                Kinematics k{ { "z_min", 0.0 }, { "z_max", 0.5 } };
+                SignalPDFPtr pdf = SignalPDF::make("Test::Legendre1D", p, k, Options{ });
+
+                SignalPDFGenerator generator(pdf, SignalPDFGenerator::Config());
+                for (const auto & z : generator.generate(10000))
+                {
+                    TEST_CHECK(0.0 <= z);
+                    TEST_CHECK(z <= 0.5);
+                }
+            }
+        }
+} signal_pdf_generator_test;
@@ -0,0 +1,167 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2024 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/event-sample.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace eos
+{
+    EventSampleError::EventSampleError(const std::string & message) :
+        Exception(message)
+    {
+    }
+
+    template <>
+    struct Implementation<EventSample>
+    {
+        unsigned columns;
+
+        unsigned long size;
+
+        // in-memory storage; unused if the events are mapped from a file
+        std::vector<double> values;
+
+        void * mapping;
+
+        std::size_t mapping_length;
+
+        const double * data;
+
+        Implementation(const std::string & file, const unsigned & columns) :
+            columns(columns),
+            size(0),
+            mapping(nullptr),
+            mapping_length(0),
+            data(nullptr)
+        {
+            if (columns == 0)
+            {
+                throw EventSampleError("EventSample: the number of columns must be positive");
+            }
+
+            int fd = ::open(file.c_str(), O_RDONLY);
+            if (fd < 0)
+            {
+                throw EventSampleError("EventSample: cannot open '" + file + "': " + std::strerror(errno));
+            }
+
+            struct stat st;
+            if (::fstat(fd, &st) < 0)
+            {
+                ::close(fd);
+                throw EventSampleError("EventSample: cannot determine the size of '" + file + "': " + std::strerror(errno));
+            }
+
+            mapping_length = st.st_size;
+            if (0 != mapping_length % (columns * sizeof(double)))
+            {
+                ::close(fd);
+                throw EventSampleError("EventSample: the size of '" + file + "' is not a multiple of " + std::to_string(columns) + " double-precision values");
+            }
+
+            size = mapping_length / (columns * sizeof(double));
+
+            if (mapping_length > 0)
+            {
+                mapping = ::mmap(nullptr, mapping_length, PROT_READ, MAP_SHARED, fd, 0);
+                if (MAP_FAILED == mapping)
+                {
+                    mapping = nullptr;
+                    ::close(fd);
+                    throw EventSampleError("EventSample: cannot map '" + file + "' into memory: " + std::strerror(errno));
+                }
+
+                // the events are read sequentially
+                ::madvise(mapping, mapping_length, MADV_SEQUENTIAL);
+            }
+
+            // the mapping remains valid after closing the file
+            ::close(fd);
+
+            data = static_cast<const double *>(mapping);
+        }
+
+        Implementation(const std::vector<double> & values, const unsigned & columns) :
+            columns(columns),
+            size(0),
+            values(values),
+            mapping(nullptr),
+            mapping_length(0),
+            data(this->values.data())
+        {
+            if (columns == 0)
+            {
+                throw EventSampleError("EventSample: the number of columns must be positive");
+            }
+
+            if (0 != values.size() % columns)
+            {
+                throw EventSampleError("EventSample: the number of values is not a multiple of " + std::to_string(columns));
+            }
+
+            size = values.size() / columns;
+        }
+
+        ~Implementation()
+        {
+            if (mapping)
+            {
+                ::munmap(mapping, mapping_length);
+            }
+        }
+    };
+
+    EventSample::EventSample(const std::string & file, const unsigned & columns) :
+        PrivateImplementationPattern<EventSample>(new Implementation<EventSample>(file, columns))
+    {
+    }
+
+    EventSample::EventSample(const std::vector<double> & values, const unsigned & columns) :
+        PrivateImplementationPattern<EventSample>(new Implementation<EventSample>(values, columns))
+    {
+    }
+
+    EventSample::~EventSample() = default;
+
+    unsigned
+    EventSample::columns() const
+    {
+        return _imp->columns;
+    }
+
+    unsigned long
+    EventSample::size() const
+    {
+        return _imp->size;
+    }
+
+    const double *
+    EventSample::data() const
+    {
+        return _imp->data;
+    }
+}
@@ -0,0 +1,87 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2024 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_EVENT_SAMPLE_HH
+#define EOS_GUARD_EOS_STATISTICS_EVENT_SAMPLE_HH 1
+
+#include <eos/utils/exception.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * EventSampleError is thrown when an EventSample cannot be created.
+     */
+    class EventSampleError :
+        public Exception
+    {
+        public:
+            EventSampleError(const std::string & message);
+    };
+
+    /*!
+     * EventSample holds a read-only table of events, stored row by row as double-precision values.
+     *
+     * The table is either kept in memory or mapped from a binary file, which allows to use
+     * samples that are larger than the available memory. Copies of an EventSample share the
+     * same data.
+     */
+    class EventSample :
+        public PrivateImplementationPattern<EventSample>
+    {
+        public:
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * Maps a file of raw double-precision values in the native byte order into memory.
+             *
+             * @param file     The name of the file.
+             * @param columns  The number of values per event.
+             */
+            EventSample(const std::string & file, const unsigned & columns);
+
+            /*!
+             * Constructor.
+             *
+             * @param values   The values of all events, row by row.
+             * @param columns  The number of values per event.
+             */
+            EventSample(const std::vector<double> & values, const unsigned & columns);
+
+            /// Destructor.
+            ~EventSample();
+            ///@}
+
+            /// Retrieve the number of values per event.
+            unsigned columns() const;
+
+            /// Retrieve the number of events.
+            unsigned long size() const;
+
+            /// Retrieve the values of all events, row by row.
+            const double * data() const;
+    };
+}
+
+#endif
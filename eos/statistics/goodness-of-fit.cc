@@ -17,13 +17,25 @@
  * Place, Suite 330, Boston, MA  02111-1307  USA
  */
 
+#include <eos/maths/gsl-interface.hh>
 #include <eos/statistics/goodness-of-fit.hh>
 #include <eos/statistics/log-posterior.hh>
 #include <eos/statistics/test-statistic-impl.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/log.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/thread_pool.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_multimin.h>
+#include <gsl/gsl_rng.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <map>
+#include <memory>
 
 namespace
 {
@@ -90,6 +102,435 @@ namespace eos
                 }
             }
         }
+
+        // one clone of the log(posterior) per concurrent job, with the informative blocks grouped by constraint
+        struct ToyWorker
+        {
+            LogPosteriorPtr log_posterior;
+
+            ObservableCache cache;
+
+            std::vector<std::string> constraints;
+
+            std::vector<std::vector<LogLikelihoodBlockPtr>> blocks;
+
+            // blocks without observations do not contribute to the test statistic, but to the fits
+            std::vector<LogLikelihoodBlockPtr> fixed_blocks;
+
+            // the pseudo data of the current data set
+            std::vector<std::vector<LogLikelihoodBlockPtr>> pseudo_blocks;
+
+            // the varied parameters, via their priors, and their values at the current point
+            std::vector<Parameter> parameters;
+            std::vector<LogPriorPtr> priors;
+            std::vector<double> start;
+
+            GSLRNGPtr rng;
+
+            std::vector<unsigned long> n_low;
+
+            unsigned long unconverged;
+
+            std::string error;
+
+            ToyWorker(const LogPosterior & original) :
+                log_posterior(original.clone()),
+                cache(log_posterior->log_likelihood().observable_cache()),
+                rng(make_gsl_rng(gsl_rng_mt19937, 0)),
+                unconverged(0)
+            {
+                // the blocks' data are drawn around the current predictions
+                auto log_likelihood = log_posterior->log_likelihood();
+                cache.update();
+
+                for (auto c = log_likelihood.begin(), c_end = log_likelihood.end() ; c != c_end ; ++c)
+                {
+                    std::vector<LogLikelihoodBlockPtr> informative;
+                    for (auto b = c->begin_blocks(), b_end = c->end_blocks() ; b != b_end ; ++b)
+                    {
+                        if (0 == (*b)->number_of_observations())
+                        {
+                            fixed_blocks.push_back(*b);
+                            continue;
+                        }
+
+                        informative.push_back(*b);
+                    }
+
+                    if (informative.empty())
+                        continue;
+
+                    constraints.push_back(c->name().str());
+                    blocks.push_back(informative);
+                }
+
+                pseudo_blocks.resize(blocks.size());
+                n_low.resize(blocks.size(), 0);
+
+                for (auto p = log_posterior->begin_priors(), p_end = log_posterior->end_priors() ; p != p_end ; ++p)
+                {
+                    for (auto q = (*p)->begin(), q_end = (*p)->end() ; q != q_end ; ++q)
+                    {
+                        parameters.push_back(*q);
+                    }
+
+                    priors.push_back(*p);
+                }
+
+                start.resize(parameters.size());
+                get(start.data());
+            }
+
+            // set the parameters from unbounded variables y, via their generator values u = (1 + sin y) / 2
+            void
+            set(const double * y)
+            {
+                for (unsigned i = 0 ; i < parameters.size() ; ++i)
+                {
+                    const double u = std::clamp(0.5 * (1.0 + std::sin(y[i])), 1.0e-12, 1.0 - 1.0e-12);
+                    parameters[i].set_generator(u);
+                }
+
+                for (auto & p : priors)
+                {
+                    p->sample();
+                }
+            }
+
+            // the inverse of set()
+            void
+            get(double * y)
+            {
+                for (auto & p : priors)
+                {
+                    p->compute_cdf();
+                }
+
+                for (unsigned i = 0 ; i < parameters.size() ; ++i)
+                {
+                    const double u = parameters[i].evaluate_generator();
+                    y[i] = std::asin(std::clamp(2.0 * u - 1.0, -1.0, 1.0));
+                }
+            }
+
+            // the log(posterior) of the current pseudo data
+            double
+            evaluate()
+            {
+                cache.update();
+
+                double result = 0.0;
+                for (const auto & p : priors)
+                {
+                    result += (*p)();
+                }
+
+                for (const auto & b : fixed_blocks)
+                {
+                    result += b->evaluate();
+                }
+
+                for (const auto & blocks : pseudo_blocks)
+                {
+                    for (const auto & b : blocks)
+                    {
+                        result += b->evaluate();
+                    }
+                }
+
+                return result;
+            }
+
+            static double
+            negative_log_posterior(const gsl_vector * y, void * data)
+            {
+                ToyWorker * w = static_cast<ToyWorker *>(data);
+
+                // no exceptions must pass through the GSL's C code
+                try
+                {
+                    w->set(y->data);
+                    const double result = -w->evaluate();
+
+                    return std::isfinite(result) ? result : std::numeric_limits<double>::max();
+                }
+                catch (Exception & e)
+                {
+                    if (w->error.empty())
+                    {
+                        w->error = e.what();
+                    }
+
+                    return std::numeric_limits<double>::max();
+                }
+            }
+
+            // maximise the log(posterior) of the current pseudo data, starting from the current point
+            void
+            maximise(const GoodnessOfFit::ToyConfig & config)
+            {
+                const unsigned n = parameters.size();
+
+                std::vector<double> y(start);
+                if (0 == n)
+                {
+                    evaluate();
+                    return;
+                }
+
+                gsl_multimin_function f{ &ToyWorker::negative_log_posterior, n, this };
+
+                GSLVectorPtr x = make_gsl_vector(n);
+                GSLVectorPtr steps = make_gsl_vector(n);
+                std::unique_ptr<gsl_multimin_fminimizer, decltype(&gsl_multimin_fminimizer_free)> minimizer(
+                        gsl_multimin_fminimizer_alloc(gsl_multimin_fminimizer_nmsimplex2, n), &gsl_multimin_fminimizer_free);
+
+                for (unsigned i = 0 ; i < n ; ++i)
+                {
+                    gsl_vector_set(x.get(), i, y[i]);
+                    gsl_vector_set(steps.get(), i, config.step_size);
+                }
+
+                gsl_multimin_fminimizer_set(minimizer.get(), &f, x.get(), steps.get());
+
+                unsigned iterations = 0;
+                int status = GSL_CONTINUE;
+                while ((GSL_CONTINUE == status) && (iterations < config.max_iterations) && error.empty())
+                {
+                    ++iterations;
+                    if (GSL_SUCCESS != gsl_multimin_fminimizer_iterate(minimizer.get()))
+                        break;
+
+                    status = gsl_multimin_test_size(gsl_multimin_fminimizer_size(minimizer.get()), config.tolerance);
+                }
+
+                if (iterations == config.max_iterations)
+                {
+                    ++unconverged;
+                }
+
+                const gsl_vector * solution = gsl_multimin_fminimizer_x(minimizer.get());
+                for (unsigned i = 0 ; i < n ; ++i)
+                {
+                    y[i] = gsl_vector_get(solution, i);
+                }
+
+                // leave the parameters and predictions at the solution
+                set(y.data());
+                evaluate();
+            }
+
+            // the log(likelihood) of the informative blocks of constraint c, for one simulated data set
+            double
+            simulate(const unsigned & c, const bool & optimize) const
+            {
+                double result = 0.0;
+                if (optimize)
+                {
+                    for (const auto & b : pseudo_blocks[c])
+                    {
+                        result += b->evaluate();
+                    }
+                }
+                else
+                {
+                    for (const auto & b : blocks[c])
+                    {
+                        result += b->sample(rng.get());
+                    }
+                }
+
+                return result;
+            }
+        };
+
+        void simulate_chunk(ToyWorker & w, const GoodnessOfFit::ToyConfig & config, const unsigned long & seed, const unsigned & first, const unsigned & last,
+                const std::vector<double> & t_obs, const double & t_obs_total, std::vector<double> & t, unsigned long & n_low_total) const
+        {
+            gsl_rng_set(w.rng.get(), seed);
+
+            try
+            {
+                for (unsigned i = first ; (i < last) && w.error.empty() ; ++i)
+                {
+                    if (config.optimize)
+                    {
+                        // draw the pseudo data around the predictions at the current point, then refit
+                        w.set(w.start.data());
+                        w.cache.update();
+
+                        for (unsigned c = 0 ; c < w.blocks.size() ; ++c)
+                        {
+                            w.pseudo_blocks[c].clear();
+                            for (const auto & b : w.blocks[c])
+                            {
+                                w.pseudo_blocks[c].push_back(b->pseudo_data(w.rng.get()));
+                            }
+                        }
+
+                        w.maximise(config);
+                    }
+
+                    double total = 0.0;
+                    for (unsigned c = 0 ; c < w.blocks.size() ; ++c)
+                    {
+                        const double value = w.simulate(c, config.optimize);
+
+                        if (value < t_obs[c])
+                        {
+                            ++w.n_low[c];
+                        }
+
+                        total += value;
+                    }
+
+                    t[i] = total;
+
+                    if (total < t_obs_total)
+                    {
+                        ++n_low_total;
+                    }
+                }
+            }
+            catch (eos::Exception & e)
+            {
+                w.error = e.what();
+            }
+        }
+
+        GoodnessOfFit::ToyResults simulate_p_values(const GoodnessOfFit::ToyConfig & config) const
+        {
+            if (config.toys == 0)
+            {
+                throw InternalError("GoodnessOfFit: the number of simulated data sets must be positive");
+            }
+
+            if (config.chunk_size == 0)
+            {
+                throw InternalError("GoodnessOfFit: the chunk size must be positive");
+            }
+
+            GoodnessOfFit::ToyResults results;
+
+            auto thread_pool = ThreadPool::instance();
+
+            // if a clone fails, the previous workers and their random number generators are released with the vector
+            std::vector<ToyWorker> workers;
+            for (unsigned j = 0 ; j < thread_pool->number_of_threads() ; ++j)
+            {
+                workers.emplace_back(log_posterior);
+            }
+
+            results.constraints = workers.front().constraints;
+
+            // reject blocks that cannot simulate data sets up front, rather than aborting the first data set
+            for (unsigned c = 0 ; c < workers.front().blocks.size() ; ++c)
+            {
+                for (const auto & b : workers.front().blocks[c])
+                {
+                    if (config.optimize ? b->supports_pseudo_data() : b->supports_sampling())
+                        continue;
+
+                    throw InternalError("GoodnessOfFit: cannot simulate data sets for constraint '" + results.constraints[c] + "', since its block '"
+                            + b->as_string() + "' does not support " + (config.optimize ? "pseudo data; disable the optimization" : "sampling"));
+                }
+            }
+
+            // observed values of the test statistic
+            std::vector<double> t_obs;
+            results.t_obs = 0.0;
+            for (const auto & blocks : workers.front().blocks)
+            {
+                double value = 0.0;
+                for (const auto & b : blocks)
+                {
+                    value += b->evaluate();
+                }
+
+                t_obs.push_back(value);
+                results.t_obs += value;
+            }
+
+            Log::instance()->message("GoodnessOfFit::simulate_p_values", ll_informational)
+                << "Simulating " << config.toys << " data sets for " << t_obs.size() << " constraint(s); the observed test statistic is " << results.t_obs;
+
+            // seeds are drawn up front, so that each chunk's data sets do not depend on the number of threads
+            GSLRNGPtr rng = make_gsl_rng(gsl_rng_mt19937, config.seed);
+
+            const unsigned chunks = (config.toys + config.chunk_size - 1) / config.chunk_size;
+            std::vector<unsigned long> seeds(chunks);
+            for (auto & s : seeds)
+            {
+                s = gsl_rng_get(rng.get());
+            }
+
+            results.t.resize(config.toys);
+            std::vector<unsigned long> n_low_total(workers.size(), 0);
+
+            std::vector<Ticket> tickets;
+            for (unsigned j = 0 ; j < workers.size() ; ++j)
+            {
+                tickets.push_back(thread_pool->enqueue([this, j, chunks, &config, &seeds, &workers, &t_obs, &results, &n_low_total]()
+                {
+                    for (unsigned k = j ; (k < chunks) && workers[j].error.empty() ; k += workers.size())
+                    {
+                        const unsigned first = k * config.chunk_size;
+                        const unsigned last  = std::min(config.toys, first + config.chunk_size);
+                        this->simulate_chunk(workers[j], config, seeds[k], first, last, t_obs, results.t_obs, results.t, n_low_total[j]);
+                    }
+                }));
+            }
+
+            for (auto & t : tickets)
+            {
+                t.wait();
+            }
+
+            std::string error;
+            unsigned long n_low = 0, unconverged = 0;
+            std::vector<unsigned long> n_low_constraints(t_obs.size(), 0);
+            for (unsigned j = 0 ; j < workers.size() ; ++j)
+            {
+                if (error.empty())
+                {
+                    error = workers[j].error;
+                }
+
+                n_low += n_low_total[j];
+                unconverged += workers[j].unconverged;
+                for (unsigned c = 0 ; c < t_obs.size() ; ++c)
+                {
+                    n_low_constraints[c] += workers[j].n_low[c];
+                }
+            }
+
+            if (! error.empty())
+            {
+                throw InternalError("GoodnessOfFit: " + error);
+            }
+
+            if (unconverged > 0)
+            {
+                Log::instance()->message("GoodnessOfFit::simulate_p_values", ll_warning)
+                    << "The minimisation did not converge within " << config.max_iterations << " iterations for " << unconverged << " data set(s)";
+            }
+
+            // mode and standard deviation of the binomial posterior, as in LogLikelihood::bootstrap_p_value
+            const double toys = config.toys;
+            results.p_value = n_low / toys;
+            const double p_expected = (n_low + 1.0) / (toys + 2.0);
+            results.p_value_uncertainty = std::sqrt(p_expected * (1.0 - p_expected) / (toys + 3.0));
+
+            for (const auto & n : n_low_constraints)
+            {
+                results.constraint_p_values.push_back(n / toys);
+            }
+
+            Log::instance()->message("GoodnessOfFit::simulate_p_values", ll_informational)
+                << "The simulated p-value is " << results.p_value << " with uncertainty " << results.p_value_uncertainty;
+
+            return results;
+        }
     };
 
     template <>
@@ -129,4 +570,10 @@ namespace eos
     {
         return _imp->chi_squares.end();
     }
+
+    GoodnessOfFit::ToyResults
+    GoodnessOfFit::simulate_p_values(const ToyConfig & config) const
+    {
+        return _imp->simulate_p_values(config);
+    }
 }
@@ -25,6 +25,9 @@
 #include <eos/utils/private_implementation_pattern.hh>
 #include <eos/utils/wrapped_forward_iterator-fwd.hh>
 
+#include <string>
+#include <vector>
+
 namespace eos
 {
     class GoodnessOfFit :
@@ -45,6 +48,66 @@ namespace eos
             ChiSquareIterator begin_chi_square() const;
             ChiSquareIterator end_chi_square() const;
             ///q}
+
+            ///@name Simulated p-values
+            ///@{
+            struct ToyConfig
+            {
+                /// Number of simulated data sets.
+                unsigned toys = 10000;
+
+                /// Seed for the master random number generator.
+                unsigned long seed = 1701;
+
+                /// Number of simulated data sets generated with a single random number generator.
+                unsigned chunk_size = 1000;
+
+                /// Maximise the log(posterior) of each simulated data set with respect to the varied parameters.
+                bool optimize = true;
+
+                /// Maximal number of iterations of the minimiser per simulated data set.
+                unsigned max_iterations = 10000;
+
+                /// Stop once the size of the simplex falls below this value.
+                double tolerance = 1.0e-8;
+
+                /// Initial step size of the minimiser, in units of the transformed parameters.
+                double step_size = 0.1;
+            };
+
+            struct ToyResults
+            {
+                /// Observed value of the test statistic, i.e., the log(likelihood) of all constraints.
+                double t_obs;
+
+                /// Simulated values of the test statistic, one per data set.
+                std::vector<double> t;
+
+                /// Fraction of simulated data sets with a smaller test statistic, and its uncertainty.
+                double p_value, p_value_uncertainty;
+
+                /// Names of the constraints and the corresponding p-values, obtained from the same data sets.
+                std::vector<std::string> constraints;
+                std::vector<double> constraint_p_values;
+            };
+
+            /*!
+             * Simulate p-values for the current parameter point, which should be the best-fit point.
+             *
+             * Pseudo data are drawn around the current predictions from every log-likelihood block of
+             * every constraint, using LogLikelihoodBlock::pseudo_data(). The log(posterior) of each
+             * simulated data set is maximised with respect to the varied parameters, and the test
+             * statistic is evaluated at its maximum. If optimization is disabled, the test statistic
+             * is sampled at the current point instead, using LogLikelihoodBlock::sample().
+             * Contrary to the chi-square test statistics, this also covers non-Gaussian blocks.
+             * The data sets are simulated concurrently in chunks, using one clone of the log(posterior)
+             * per thread and one random number generator per chunk. Results are therefore reproducible
+             * for a fixed seed, independent of the number of threads.
+             *
+             * @param config  The configuration of the simulation.
+             */
+            ToyResults simulate_p_values(const ToyConfig & config) const;
+            ///@}
     };
     extern template class WrappedForwardIterator<GoodnessOfFit::ChiSquareIteratorTag, const std::pair<const QualifiedName, test_statistics::ChiSquare>>;
 }
@@ -0,0 +1,141 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2024 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/statistics/goodness-of-fit.hh>
+#include <eos/statistics/log-posterior_TEST.hh>
+
+using namespace test;
+using namespace eos;
+
+class GoodnessOfFitTest :
+    public TestCase
+{
+    public:
+        GoodnessOfFitTest() :
+            TestCase("goodness_of_fit_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // simulated p-values
+            {
+                Parameters parameters = Parameters::Defaults();
+                LogLikelihood llh(parameters);
+                llh.add(ObservablePtr(new ObservableStub(parameters, "mass::c")), 1.182, 1.192, 1.202);
+                llh.add(ObservablePtr(new ObservableStub(parameters, "mass::c")), 1.19, 1.2, 1.21);
+
+                LogPosterior log_posterior(llh);
+                log_posterior.add(LogPrior::Flat(parameters, "mass::c", 1.0, 1.4));
+
+                parameters["mass::c"] = 1.196;
+
+                GoodnessOfFit::ToyConfig config;
+                config.toys = 50000;
+                config.optimize = false;
+
+                GoodnessOfFit gof(log_posterior);
+                GoodnessOfFit::ToyResults results = gof.simulate_p_values(config);
+
+                TEST_CHECK_EQUAL(results.t.size(), 50000u);
+                TEST_CHECK_EQUAL(results.constraints.size(), 2u);
+                TEST_CHECK_EQUAL(results.constraint_p_values.size(), 2u);
+
+                // p-value from chi^2=0.32 and two degrees-of-freedom, as for LogLikelihood::bootstrap_p_value;
+                // since data restricted to three sigma around central value, p-value should be slightly biased upwards
+                TEST_CHECK_NEARLY_EQUAL(results.p_value, 0.852143788, 5e-3);
+
+                // p-values from chi^2=0.16 and one degree-of-freedom each
+                TEST_CHECK_NEARLY_EQUAL(results.constraint_p_values[0], 0.689156, 1e-2);
+                TEST_CHECK_NEARLY_EQUAL(results.constraint_p_values[1], 0.689156, 1e-2);
+
+                // results are reproducible for a fixed seed
+                GoodnessOfFit::ToyResults repeated = gof.simulate_p_values(config);
+                TEST_CHECK(repeated.t == results.t);
+                TEST_CHECK_EQUAL(repeated.p_value, results.p_value);
+            }
+
+            // simulated p-values, refitting each data set
+            {
+                Parameters parameters = Parameters::Defaults();
+                LogLikelihood llh(parameters);
+                llh.add(ObservablePtr(new ObservableStub(parameters, "mass::c")), 1.182, 1.192, 1.202);
+                llh.add(ObservablePtr(new ObservableStub(parameters, "mass::c")), 1.19, 1.2, 1.21);
+
+                LogPosterior log_posterior(llh);
+                log_posterior.add(LogPrior::Flat(parameters, "mass::c", 1.0, 1.4));
+
+                // the best-fit point
+                parameters["mass::c"] = 1.196;
+
+                GoodnessOfFit::ToyConfig config;
+                config.toys = 4000;
+                config.chunk_size = 250;
+
+                GoodnessOfFit gof(log_posterior);
+                GoodnessOfFit::ToyResults results = gof.simulate_p_values(config);
+
+                TEST_CHECK_EQUAL(results.t.size(), 4000u);
+
+                // the fit removes one degree-of-freedom: p-value from chi^2=0.32 and one degree-of-freedom
+                TEST_CHECK_NEARLY_EQUAL(results.p_value, 0.571608, 2.5e-2);
+
+                // each constraint's chi^2 at the best-fit point is half of the total chi^2
+                TEST_CHECK_NEARLY_EQUAL(results.constraint_p_values[0], 0.571608, 2.5e-2);
+                TEST_CHECK_NEARLY_EQUAL(results.constraint_p_values[1], 0.571608, 2.5e-2);
+
+                // the parameter point of the log(posterior) is left unchanged
+                TEST_CHECK_EQUAL(parameters["mass::c"].evaluate(), 1.196);
+
+                // results are reproducible for a fixed seed
+                GoodnessOfFit::ToyResults repeated = gof.simulate_p_values(config);
+                TEST_CHECK(repeated.t == results.t);
+            }
+
+            // blocks that cannot simulate data sets are rejected up front
+            {
+                Parameters parameters = Parameters::Defaults();
+                LogLikelihood llh(parameters);
+
+                auto obs = ObservablePtr(new ObservableStub(parameters, "mass::c"));
+                std::vector<LogLikelihoodBlockPtr> components
+                {
+                    LogLikelihoodBlock::Gaussian(llh.observable_cache(), obs, 1.182, 1.192, 1.202),
+                    LogLikelihoodBlock::Gaussian(llh.observable_cache(), obs, 1.19, 1.2, 1.21)
+                };
+                llh.add(Constraint("test::mixture", std::vector<ObservablePtr>{ obs },
+                    std::vector<LogLikelihoodBlockPtr>{ LogLikelihoodBlock::Mixture(components, { 0.5, 0.5 }, { }) }));
+
+                LogPosterior log_posterior(llh);
+                log_posterior.add(LogPrior::Flat(parameters, "mass::c", 1.0, 1.4));
+
+                parameters["mass::c"] = 1.196;
+
+                GoodnessOfFit::ToyConfig config;
+                config.toys = 10;
+
+                GoodnessOfFit gof(log_posterior);
+                TEST_CHECK_THROWS(InternalError, gof.simulate_p_values(config));
+
+                config.optimize = false;
+                TEST_CHECK_THROWS(InternalError, gof.simulate_p_values(config));
+            }
+        }
+} goodness_of_fit_test;
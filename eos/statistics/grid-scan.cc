@@ -0,0 +1,375 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2025 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/grid-scan.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace eos
+{
+    template <> struct Implementation<GridScan>
+    {
+        std::vector<GridScan::Dimension> dimensions;
+
+        GridScan::FunctionFactory factory;
+
+        // one instance of the function per worker thread
+        std::vector<GridScan::Function> functions;
+
+        // the points are identified by their indices on the finest grid, encoded as one integer
+        std::vector<std::uint64_t> sizes;
+
+        std::unordered_map<std::uint64_t, double> values;
+
+        double minimum;
+
+        Implementation(const std::vector<GridScan::Dimension> & dimensions, const GridScan::FunctionFactory & factory) :
+            dimensions(dimensions),
+            factory(factory),
+            minimum(std::numeric_limits<double>::infinity())
+        {
+            if (dimensions.empty())
+            {
+                throw InternalError("GridScan: at least one dimension is required");
+            }
+
+            for (const auto & d : dimensions)
+            {
+                if (0 == d.intervals)
+                {
+                    throw InternalError("GridScan: the number of intervals for '" + d.name + "' must be positive");
+                }
+
+                if (! (d.min < d.max))
+                {
+                    throw InternalError("GridScan: the range for '" + d.name + "' is empty");
+                }
+            }
+        }
+
+        std::uint64_t
+        encode(const std::vector<std::uint64_t> & indices) const
+        {
+            std::uint64_t result = 0;
+            for (unsigned d = 0 ; d < dimensions.size() ; ++d)
+            {
+                result = result * sizes[d] + indices[d];
+            }
+
+            return result;
+        }
+
+        void
+        decode(std::uint64_t key, std::vector<std::uint64_t> & indices) const
+        {
+            for (unsigned d = dimensions.size() ; d > 0 ; --d)
+            {
+                indices[d - 1] = key % sizes[d - 1];
+                key /= sizes[d - 1];
+            }
+        }
+
+        // evaluate the function at the given points, and pass the results on in batches
+        void
+        evaluate(const std::vector<std::uint64_t> & keys, const unsigned & batch_size, const GridScan::Output & output)
+        {
+            const unsigned n_dims = dimensions.size();
+            auto thread_pool = ThreadPool::instance();
+
+            std::vector<std::uint64_t> indices(n_dims);
+            for (std::size_t first = 0 ; first < keys.size() ; first += batch_size)
+            {
+                const std::size_t last = std::min(keys.size(), first + batch_size);
+                const std::size_t n = last - first;
+
+                std::vector<double> points(n * n_dims);
+                for (std::size_t k = 0 ; k < n ; ++k)
+                {
+                    decode(keys[first + k], indices);
+                    for (unsigned d = 0 ; d < n_dims ; ++d)
+                    {
+                        const auto & dim = dimensions[d];
+                        points[k * n_dims + d] = dim.min + (dim.max - dim.min) * double(indices[d]) / double(sizes[d] - 1);
+                    }
+                }
+
+                std::vector<double> results(n);
+                std::vector<std::string> errors(functions.size());
+                auto work = [&](const unsigned & j)
+                {
+                    try
+                    {
+                        std::vector<double> point(n_dims);
+                        for (std::size_t k = j ; k < n ; k += functions.size())
+                        {
+                            std::copy(points.begin() + k * n_dims, points.begin() + (k + 1) * n_dims, point.begin());
+                            results[k] = functions[j](point);
+                        }
+                    }
+                    catch (Exception & e)
+                    {
+                        errors[j] = e.what();
+                    }
+                };
+
+                // jobs must not wait for further jobs, so run serially when called from within the pool
+                if ((1 == functions.size()) || ThreadPool::is_worker_thread())
+                {
+                    for (unsigned j = 0 ; j < functions.size() ; ++j)
+                    {
+                        work(j);
+                    }
+                }
+                else
+                {
+                    std::vector<Ticket> tickets;
+                    for (unsigned j = 0 ; j < functions.size() ; ++j)
+                    {
+                        tickets.push_back(thread_pool->enqueue([&work, j]() { work(j); }));
+                    }
+
+                    for (auto & t : tickets)
+                    {
+                        t.wait();
+                    }
+                }
+
+                for (const auto & e : errors)
+                {
+                    if (! e.empty())
+                    {
+                        throw InternalError("GridScan: " + e);
+                    }
+                }
+
+                for (std::size_t k = 0 ; k < n ; ++k)
+                {
+                    values[keys[first + k]] = results[k];
+
+                    if (results[k] < minimum)
+                    {
+                        minimum = results[k];
+                    }
+                }
+
+                output(points, results);
+            }
+        }
+
+        // does the contour of any level pass through the cell with the given lower corner and edge length?
+        bool
+        is_straddling(const std::vector<std::uint64_t> & corner, const std::uint64_t & edge, const std::vector<double> & levels) const
+        {
+            const unsigned n_dims = dimensions.size();
+
+            double lower = std::numeric_limits<double>::infinity(), upper = -std::numeric_limits<double>::infinity();
+            std::vector<std::uint64_t> indices(n_dims);
+            for (unsigned mask = 0 ; mask < (1u << n_dims) ; ++mask)
+            {
+                for (unsigned d = 0 ; d < n_dims ; ++d)
+                {
+                    indices[d] = corner[d] + ((mask >> d) & 1u) * edge;
+                }
+
+                const double value = values.at(encode(indices));
+                if (! std::isfinite(value))
+                {
+                    return false;
+                }
+
+                lower = std::min(lower, value);
+                upper = std::max(upper, value);
+            }
+
+            return std::any_of(levels.cbegin(), levels.cend(), [&](const double & level)
+            {
+                return (lower <= minimum + level) && (minimum + level <= upper);
+            });
+        }
+
+        void
+        scan(const GridScan::Config & config, const GridScan::Output & output)
+        {
+            const unsigned n_dims = dimensions.size();
+
+            if (0 == config.batch_size)
+            {
+                throw InternalError("GridScan: the batch size must be positive");
+            }
+
+            if ((n_dims > 16) || (config.refinements > 32))
+            {
+                throw InternalError("GridScan: too many dimensions or refinement steps");
+            }
+
+            // the finest grid must be representable by the encoded indices
+            const std::uint64_t scale = std::uint64_t(1) << config.refinements;
+            double total = 1.0;
+            sizes.clear();
+            for (const auto & d : dimensions)
+            {
+                sizes.push_back(d.intervals * scale + 1);
+                total *= sizes.back();
+            }
+
+            if (total >= std::ldexp(1.0, 63))
+            {
+                throw InternalError("GridScan: the finest grid has too many points; reduce the number of intervals or refinement steps");
+            }
+
+            if (functions.empty())
+            {
+                for (unsigned j = 0, j_end = std::max(1u, ThreadPool::instance()->number_of_threads()) ; j < j_end ; ++j)
+                {
+                    functions.push_back(factory());
+                }
+            }
+
+            values.clear();
+            minimum = std::numeric_limits<double>::infinity();
+
+            // the initial grid, and its cells identified by their lower corners
+            std::uint64_t n_initial = 1;
+            for (const auto & d : dimensions)
+            {
+                n_initial *= d.intervals + 1;
+            }
+
+            std::vector<std::uint64_t> keys, cells;
+            std::vector<std::uint64_t> indices(n_dims);
+            for (std::uint64_t i = 0 ; i < n_initial ; ++i)
+            {
+                bool is_corner = true;
+                std::uint64_t q = i;
+                for (unsigned d = n_dims ; d > 0 ; --d)
+                {
+                    const std::uint64_t index = q % (dimensions[d - 1].intervals + 1);
+                    q /= dimensions[d - 1].intervals + 1;
+                    indices[d - 1] = index * scale;
+                    is_corner = is_corner && (index < dimensions[d - 1].intervals);
+                }
+
+                keys.push_back(encode(indices));
+                if (is_corner)
+                {
+                    cells.push_back(keys.back());
+                }
+            }
+
+            evaluate(keys, config.batch_size, output);
+
+            Log::instance()->message("GridScan::scan", ll_informational)
+                << "Evaluated " << keys.size() << " points on the initial grid; minimal chi-square is " << minimum;
+
+            if (config.levels.empty())
+                return;
+
+            unsigned n_subcells = 1;
+            for (unsigned d = 0 ; d < n_dims ; ++d)
+            {
+                n_subcells *= 3;
+            }
+
+            for (unsigned r = 1 ; r <= config.refinements ; ++r)
+            {
+                const std::uint64_t edge = scale >> (r - 1), half = edge / 2;
+
+                std::vector<std::uint64_t> new_cells, new_keys;
+                std::unordered_set<std::uint64_t> pending;
+                std::vector<std::uint64_t> corner(n_dims), point(n_dims);
+                for (const auto & c : cells)
+                {
+                    decode(c, corner);
+                    if (! is_straddling(corner, edge, config.levels))
+                        continue;
+
+                    for (unsigned mask = 0 ; mask < (1u << n_dims) ; ++mask)
+                    {
+                        for (unsigned d = 0 ; d < n_dims ; ++d)
+                        {
+                            point[d] = corner[d] + ((mask >> d) & 1u) * half;
+                        }
+
+                        new_cells.push_back(encode(point));
+                    }
+
+                    // all points of the bisected cell, i.e., three per dimension
+                    for (unsigned p = 0 ; p < n_subcells ; ++p)
+                    {
+                        for (unsigned d = 0, q = p ; d < n_dims ; ++d, q /= 3)
+                        {
+                            point[d] = corner[d] + (q % 3) * half;
+                        }
+
+                        const auto key = encode(point);
+                        if ((0 == values.count(key)) && pending.insert(key).second)
+                        {
+                            new_keys.push_back(key);
+                        }
+                    }
+                }
+
+                if (new_cells.empty())
+                    break;
+
+                evaluate(new_keys, config.batch_size, output);
+                cells = std::move(new_cells);
+
+                Log::instance()->message("GridScan::scan", ll_informational)
+                    << "Refinement step " << r << " evaluated " << new_keys.size() << " points in " << cells.size() << " cells; minimal chi-square is " << minimum;
+            }
+        }
+    };
+
+    GridScan::GridScan(const std::vector<Dimension> & dimensions, const FunctionFactory & factory) :
+        PrivateImplementationPattern<GridScan>(new Implementation<GridScan>(dimensions, factory))
+    {
+    }
+
+    GridScan::~GridScan()
+    {
+    }
+
+    void
+    GridScan::scan(const Config & config, const Output & output)
+    {
+        _imp->scan(config, output);
+    }
+
+    unsigned long
+    GridScan::size() const
+    {
+        return _imp->values.size();
+    }
+
+    double
+    GridScan::minimum() const
+    {
+        return _imp->minimum;
+    }
+}
@@ -0,0 +1,104 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2025 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_GRID_SCAN_HH
+#define EOS_GUARD_EOS_STATISTICS_GRID_SCAN_HH 1
+
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*
+     * Scan of a chi-square function on a regular Cartesian grid.
+     *
+     * The grid points are evaluated concurrently, using one instance of the function per worker
+     * thread. Instances are obtained from a factory, so that each of them can hold its own clones
+     * of the parameters and observables. Optionally, the grid is refined adaptively: each cell
+     * whose corners straddle one of the requested delta-chi-square levels is bisected along
+     * all dimensions, and only the corners of the new cells are evaluated.
+     */
+    class GridScan :
+        public PrivateImplementationPattern<GridScan>
+    {
+        public:
+            struct Dimension
+            {
+                /// Name of the scanned parameter.
+                std::string name;
+
+                /// Lower and upper boundaries of the scanned range.
+                double min, max;
+
+                /// Number of intervals of the initial grid; the grid has intervals + 1 points.
+                unsigned intervals;
+            };
+
+            struct Config
+            {
+                /// Values of delta chi-square = chi-square - min(chi-square) whose contours are refined.
+                std::vector<double> levels;
+
+                /// Number of refinement steps; each step halves the cell size around the contours.
+                unsigned refinements = 0;
+
+                /// Number of points evaluated between two calls of the output function.
+                unsigned batch_size = 4096;
+            };
+
+            /// Function to be scanned; it is passed the coordinates of one grid point.
+            using Function = std::function<double (const std::vector<double> &)>;
+
+            /// Factory for instances of the function; it is called once for each worker thread.
+            using FunctionFactory = std::function<Function ()>;
+
+            /*!
+             * Output of a batch of evaluated points.
+             *
+             * @param points The coordinates of the points in row-major order, one row per point.
+             * @param values The values of the function at the points.
+             */
+            using Output = std::function<void (const std::vector<double> & points, const std::vector<double> & values)>;
+
+            GridScan(const std::vector<Dimension> & dimensions, const FunctionFactory & factory);
+            ~GridScan();
+
+            /*!
+             * Scan the grid, and refine it as configured.
+             *
+             * The output function is called from the calling thread, once per batch of evaluated points.
+             * It can therefore write the results to disk while the scan is still ongoing.
+             *
+             * @param config The configuration of the scan.
+             * @param output The output function.
+             */
+            void scan(const Config & config, const Output & output);
+
+            /// Number of points that have been evaluated.
+            unsigned long size() const;
+
+            /// Smallest value of the function encountered during the scan.
+            double minimum() const;
+    };
+}
+
+#endif
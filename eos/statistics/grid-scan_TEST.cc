@@ -0,0 +1,154 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2025 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/statistics/grid-scan.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <atomic>
+#include <cmath>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+class GridScanTest :
+    public TestCase
+{
+    public:
+        GridScanTest() :
+            TestCase("grid_scan_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            std::atomic<unsigned> instances(0);
+            auto factory = [&instances]() -> GridScan::Function
+            {
+                ++instances;
+                return [](const std::vector<double> & x) { return x[0] * x[0] + x[1] * x[1]; };
+            };
+
+            const std::vector<GridScan::Dimension> dimensions
+            {
+                { "x", -2.0, 2.0, 4 },
+                { "y", -2.0, 2.0, 4 }
+            };
+
+            // the initial grid only
+            {
+                GridScan scan(dimensions, factory);
+
+                std::vector<double> points, values;
+                scan.scan(GridScan::Config(), [&](const std::vector<double> & p, const std::vector<double> & v)
+                {
+                    points.insert(points.end(), p.begin(), p.end());
+                    values.insert(values.end(), v.begin(), v.end());
+                });
+
+                TEST_CHECK_EQUAL(25u, scan.size());
+                TEST_CHECK_EQUAL(25u, values.size());
+                TEST_CHECK_EQUAL(50u, points.size());
+                TEST_CHECK_EQUAL(0.0, scan.minimum());
+                TEST_CHECK_EQUAL(std::max(1u, ThreadPool::instance()->number_of_threads()), instances.load());
+
+                for (unsigned k = 0 ; k < values.size() ; ++k)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(points[2 * k] * points[2 * k] + points[2 * k + 1] * points[2 * k + 1], values[k], 1e-14);
+                }
+            }
+
+            // refinement around the contour of delta chi^2 = 1, in small batches
+            {
+                GridScan scan(dimensions, factory);
+
+                GridScan::Config config;
+                config.levels      = { 1.0 };
+                config.refinements = 3;
+                config.batch_size  = 7;
+
+                std::set<std::pair<double, double>> points;
+                unsigned batches = 0, near = 0;
+                scan.scan(config, [&](const std::vector<double> & p, const std::vector<double> & v)
+                {
+                    TEST_CHECK(v.size() <= 7u);
+                    ++batches;
+
+                    for (unsigned k = 0 ; k < v.size() ; ++k)
+                    {
+                        // each point is evaluated only once
+                        TEST_CHECK(points.insert(std::make_pair(p[2 * k], p[2 * k + 1])).second);
+                        TEST_CHECK_NEARLY_EQUAL(p[2 * k] * p[2 * k] + p[2 * k + 1] * p[2 * k + 1], v[k], 1e-14);
+
+                        if (std::abs(std::hypot(p[2 * k], p[2 * k + 1]) - 1.0) < 0.125)
+                        {
+                            ++near;
+                        }
+                    }
+                });
+
+                TEST_CHECK_EQUAL(points.size(), scan.size());
+                TEST_CHECK(batches > 4u);
+
+                // fewer points than on the full grid of the finest resolution, with most of them close to the contour
+                TEST_CHECK(points.size() > 100u);
+                TEST_CHECK(points.size() < 33u * 33u / 2u);
+                TEST_CHECK(near > 40u);
+
+                // all points of the finest grid close to the contour have been evaluated
+                for (unsigned i = 0 ; i <= 32 ; ++i)
+                {
+                    for (unsigned j = 0 ; j <= 32 ; ++j)
+                    {
+                        const double x = -2.0 + 0.125 * i, y = -2.0 + 0.125 * j;
+                        if (std::abs(std::hypot(x, y) - 1.0) < 0.05)
+                        {
+                            TEST_CHECK(points.count(std::make_pair(x, y)) > 0);
+                        }
+                    }
+                }
+            }
+
+            // errors in the function are propagated
+            {
+                GridScan scan(dimensions, []() -> GridScan::Function
+                {
+                    return [](const std::vector<double> & x) -> double
+                    {
+                        if (x[0] > 1.0)
+                        {
+                            throw InternalError("out of range");
+                        }
+
+                        return x[0];
+                    };
+                });
+
+                TEST_CHECK_THROWS(InternalError, scan.scan(GridScan::Config(), [](const std::vector<double> &, const std::vector<double> &) { }));
+            }
+
+            TEST_CHECK_THROWS(InternalError, GridScan({ }, factory));
+            TEST_CHECK_THROWS(InternalError, GridScan({ { "x", 1.0, -1.0, 4 } }, factory));
+            TEST_CHECK_THROWS(InternalError, GridScan({ { "x", -1.0, 1.0, 0 } }, factory));
+        }
+} grid_scan_test;
@@ -0,0 +1,592 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2025 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/kernel-density-estimate.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <gsl/gsl_fft_complex.h>
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+namespace eos
+{
+    namespace
+    {
+        // the kernel is truncated beyond this many standard deviations
+        constexpr double kernel_cutoff = 6.0;
+
+        // minimal number of grid points per kernel standard deviation
+        constexpr double points_per_sigma = 8.0;
+
+        std::size_t
+        next_power_of_two(const std::size_t & n)
+        {
+            std::size_t result = 1;
+            while (result < n)
+            {
+                result *= 2;
+            }
+
+            return result;
+        }
+
+        double
+        bandwidth_factor(const kde::Config & config, const double & neff, const unsigned & dim)
+        {
+            if (! (config.factor > 0.0))
+            {
+                throw InternalError("kde: the relative bandwidth factor must be positive");
+            }
+
+            if ("silverman" == config.bandwidth)
+            {
+                return std::pow(neff * (dim + 2.0) / 4.0, -1.0 / (dim + 4.0)) * config.factor;
+            }
+            else if ("scott" == config.bandwidth)
+            {
+                return std::pow(neff, -1.0 / (dim + 4.0)) * config.factor;
+            }
+
+            throw InternalError("kde: unknown bandwidth rule '" + config.bandwidth + "'; expected 'silverman' or 'scott'");
+        }
+
+        // indices of all samples with finite values and weights
+        std::vector<std::size_t>
+        valid_samples(const std::vector<std::span<const double>> & samples, std::span<const double> weights)
+        {
+            const std::size_t n = samples.front().size();
+
+            for (const auto & s : samples)
+            {
+                if (s.size() != n)
+                {
+                    throw InternalError("kde: the samples must have the same size in all dimensions");
+                }
+            }
+
+            if ((! weights.empty()) && (weights.size() != n))
+            {
+                throw InternalError("kde: the number of weights must match the number of samples");
+            }
+
+            std::vector<std::size_t> result;
+            result.reserve(n);
+
+            for (std::size_t i = 0 ; i < n ; ++i)
+            {
+                if ((! weights.empty()) && (! std::isfinite(weights[i])))
+                {
+                    continue;
+                }
+
+                if ((! weights.empty()) && (weights[i] < 0.0))
+                {
+                    throw InternalError("kde: the sample weights cannot be negative");
+                }
+
+                if (std::all_of(samples.begin(), samples.end(), [i](const auto & s) { return std::isfinite(s[i]); }))
+                {
+                    result.push_back(i);
+                }
+            }
+
+            return result;
+        }
+
+        // weighted mean and covariance of the valid samples, with the effective sample size
+        struct Moments
+        {
+            double sum_of_weights;
+
+            double neff;
+
+            std::vector<double> mean;
+
+            // row-major
+            std::vector<double> covariance;
+
+            Moments(const std::vector<std::span<const double>> & samples, std::span<const double> weights, const std::vector<std::size_t> & indices) :
+                sum_of_weights(0.0),
+                neff(0.0),
+                mean(samples.size(), 0.0),
+                covariance(samples.size() * samples.size(), 0.0)
+            {
+                const std::size_t dim = samples.size();
+
+                double sum_of_squared_weights = 0.0;
+                for (const auto & i : indices)
+                {
+                    const double w = weights.empty() ? 1.0 : weights[i];
+                    sum_of_weights         += w;
+                    sum_of_squared_weights += w * w;
+
+                    for (std::size_t a = 0 ; a < dim ; ++a)
+                    {
+                        mean[a] += w * samples[a][i];
+                    }
+                }
+
+                if (! (sum_of_weights > 0.0))
+                {
+                    throw InternalError("kde: the sum of the sample weights evaluated to zero");
+                }
+
+                neff = sum_of_weights * sum_of_weights / sum_of_squared_weights;
+                if (! (neff > 1.0))
+                {
+                    throw InternalError("kde: at least two samples with non-zero weight are required");
+                }
+
+                for (std::size_t a = 0 ; a < dim ; ++a)
+                {
+                    mean[a] /= sum_of_weights;
+                }
+
+                for (const auto & i : indices)
+                {
+                    const double w = weights.empty() ? 1.0 : weights[i];
+
+                    for (std::size_t a = 0 ; a < dim ; ++a)
+                    {
+                        for (std::size_t b = a ; b < dim ; ++b)
+                        {
+                            covariance[a * dim + b] += w * (samples[a][i] - mean[a]) * (samples[b][i] - mean[b]);
+                        }
+                    }
+                }
+
+                // unbiased estimator for reliability weights, as numpy.cov with aweights
+                const double norm = sum_of_weights * (1.0 - 1.0 / neff);
+                for (std::size_t a = 0 ; a < dim ; ++a)
+                {
+                    for (std::size_t b = a ; b < dim ; ++b)
+                    {
+                        covariance[a * dim + b] /= norm;
+                        covariance[b * dim + a]  = covariance[a * dim + b];
+                    }
+
+                    if (! (covariance[a * dim + a] > 0.0))
+                    {
+                        throw InternalError("kde: the samples have vanishing variance");
+                    }
+                }
+            }
+        };
+
+        // equidistant grid covering both the samples and the points of evaluation
+        struct Grid
+        {
+            double lower;
+
+            double delta;
+
+            std::size_t size;
+
+            Grid(std::span<const double> samples, const std::vector<std::size_t> & indices, std::span<const double> points,
+                    const double & sigma, const std::size_t & min_size, const std::size_t & max_size)
+            {
+                double upper = -std::numeric_limits<double>::infinity();
+                lower = std::numeric_limits<double>::infinity();
+
+                for (const auto & i : indices)
+                {
+                    lower = std::min(lower, samples[i]);
+                    upper = std::max(upper, samples[i]);
+                }
+
+                for (const auto & p : points)
+                {
+                    lower = std::min(lower, p);
+                    upper = std::max(upper, p);
+                }
+
+                if (! (upper > lower))
+                {
+                    lower -= sigma;
+                    upper += sigma;
+                }
+
+                const double desired = std::ceil(points_per_sigma * (upper - lower) / sigma) + 1.0;
+                size  = std::clamp<std::size_t>(desired < max_size ? std::size_t(desired) : max_size, min_size, std::max(min_size, max_size));
+                delta = (upper - lower) / (size - 1);
+            }
+
+            // distribute a weight onto the two neighbouring grid points
+            inline std::pair<std::size_t, double>
+            locate(const double & x) const
+            {
+                const double t = (x - lower) / delta;
+                const std::size_t j = std::min<std::size_t>(static_cast<std::size_t>(std::max(t, 0.0)), size - 2);
+
+                return { j, std::clamp(t - j, 0.0, 1.0) };
+            }
+
+            // number of grid spacings covered by the truncated kernel
+            std::size_t
+            lags(const double & sigma) const
+            {
+                return std::min<std::size_t>(size - 1, static_cast<std::size_t>(std::ceil(kernel_cutoff * sigma / delta)));
+            }
+        };
+
+        // in-place FFT of a packed complex array of rows x columns entries, both powers of two
+        void
+        fft(std::vector<double> & data, const std::size_t & rows, const std::size_t & columns, const bool & forward)
+        {
+            auto transform = forward ? &gsl_fft_complex_radix2_forward : &gsl_fft_complex_radix2_inverse;
+
+            if (columns > 1)
+            {
+                for (std::size_t r = 0 ; r < rows ; ++r)
+                {
+                    transform(data.data() + 2 * r * columns, 1, columns);
+                }
+            }
+
+            if (rows > 1)
+            {
+                for (std::size_t c = 0 ; c < columns ; ++c)
+                {
+                    transform(data.data() + 2 * c, columns, rows);
+                }
+            }
+        }
+
+        // circular convolution of the binned samples with the kernel; the result replaces the binned samples
+        void
+        convolve(std::vector<double> & counts, std::vector<double> & kernel, const std::size_t & rows, const std::size_t & columns)
+        {
+            fft(counts, rows, columns, true);
+            fft(kernel, rows, columns, true);
+
+            for (std::size_t i = 0 ; i < rows * columns ; ++i)
+            {
+                const double re = counts[2 * i] * kernel[2 * i] - counts[2 * i + 1] * kernel[2 * i + 1];
+                const double im = counts[2 * i] * kernel[2 * i + 1] + counts[2 * i + 1] * kernel[2 * i];
+                counts[2 * i]     = re;
+                counts[2 * i + 1] = im;
+            }
+
+            fft(counts, rows, columns, false);
+        }
+    }
+
+    namespace kde
+    {
+        std::vector<double>
+        density(std::span<const double> samples, std::span<const double> weights, std::span<const double> points, const Config & config)
+        {
+            const std::vector<std::span<const double>> all_samples{ samples };
+            const auto indices = valid_samples(all_samples, weights);
+            const Moments moments(all_samples, weights, indices);
+
+            const double h = bandwidth_factor(config, moments.neff, 1) * std::sqrt(moments.covariance[0]);
+
+            const Grid grid(samples, indices, points, h, std::max(config.grid_size, 1024u), 1u << 20);
+            const std::size_t lags = grid.lags(h);
+            const std::size_t size = next_power_of_two(grid.size + lags);
+
+            // linear binning
+            std::vector<double> counts(2 * size, 0.0);
+            for (const auto & i : indices)
+            {
+                const double w = weights.empty() ? 1.0 : weights[i];
+                const auto [j, f] = grid.locate(samples[i]);
+                counts[2 * j]       += w * (1.0 - f);
+                counts[2 * (j + 1)] += w * f;
+            }
+
+            // normalised kernel, including the normalisation of the weights
+            std::vector<double> kernel(2 * size, 0.0);
+            const double norm = 1.0 / (std::sqrt(2.0 * M_PI) * h * moments.sum_of_weights);
+            for (std::size_t l = 0 ; l <= lags ; ++l)
+            {
+                const double u = l * grid.delta / h;
+                const double k = norm * std::exp(-0.5 * u * u);
+                kernel[2 * l] = k;
+                if (l > 0)
+                {
+                    kernel[2 * (size - l)] = k;
+                }
+            }
+
+            convolve(counts, kernel, 1, size);
+
+            std::vector<double> result;
+            result.reserve(points.size());
+            for (const auto & p : points)
+            {
+                const auto [j, f] = grid.locate(p);
+                result.push_back(std::max(0.0, (1.0 - f) * counts[2 * j] + f * counts[2 * (j + 1)]));
+            }
+
+            return result;
+        }
+
+        std::vector<double>
+        density(std::span<const double> xsamples, std::span<const double> ysamples, std::span<const double> weights,
+                std::span<const double> xpoints, std::span<const double> ypoints, const Config & config)
+        {
+            const std::vector<std::span<const double>> all_samples{ xsamples, ysamples };
+            const auto indices = valid_samples(all_samples, weights);
+            const Moments moments(all_samples, weights, indices);
+
+            // covariance of the kernel
+            const double factor = bandwidth_factor(config, moments.neff, 2);
+            const double sxx = factor * factor * moments.covariance[0];
+            const double sxy = factor * factor * moments.covariance[1];
+            const double syy = factor * factor * moments.covariance[3];
+            const double det = sxx * syy - sxy * sxy;
+            if (! (det > 0.0))
+            {
+                throw InternalError("kde: the samples are perfectly correlated");
+            }
+
+            const Grid xgrid(xsamples, indices, xpoints, std::sqrt(sxx), std::max(config.grid_size, 256u), 512);
+            const Grid ygrid(ysamples, indices, ypoints, std::sqrt(syy), std::max(config.grid_size, 256u), 512);
+            const std::size_t xlags = xgrid.lags(std::sqrt(sxx));
+            const std::size_t ylags = ygrid.lags(std::sqrt(syy));
+            const std::size_t rows    = next_power_of_two(xgrid.size + xlags);
+            const std::size_t columns = next_power_of_two(ygrid.size + ylags);
+
+            // bilinear binning
+            std::vector<double> counts(2 * rows * columns, 0.0);
+            for (const auto & i : indices)
+            {
+                const double w = weights.empty() ? 1.0 : weights[i];
+                const auto [jx, fx] = xgrid.locate(xsamples[i]);
+                const auto [jy, fy] = ygrid.locate(ysamples[i]);
+                counts[2 * (jx * columns + jy)]           += w * (1.0 - fx) * (1.0 - fy);
+                counts[2 * (jx * columns + jy + 1)]       += w * (1.0 - fx) * fy;
+                counts[2 * ((jx + 1) * columns + jy)]     += w * fx * (1.0 - fy);
+                counts[2 * ((jx + 1) * columns + jy + 1)] += w * fx * fy;
+            }
+
+            // normalised kernel, including the normalisation of the weights
+            std::vector<double> kernel(2 * rows * columns, 0.0);
+            const double norm = 1.0 / (2.0 * M_PI * std::sqrt(det) * moments.sum_of_weights);
+            for (long lx = -long(xlags) ; lx <= long(xlags) ; ++lx)
+            {
+                const double dx = lx * xgrid.delta;
+                const std::size_t r = (lx < 0) ? rows + lx : lx;
+
+                for (long ly = -long(ylags) ; ly <= long(ylags) ; ++ly)
+                {
+                    const double dy = ly * ygrid.delta;
+                    const std::size_t c = (ly < 0) ? columns + ly : ly;
+
+                    const double q = (syy * dx * dx - 2.0 * sxy * dx * dy + sxx * dy * dy) / det;
+                    kernel[2 * (r * columns + c)] = norm * std::exp(-0.5 * q);
+                }
+            }
+
+            convolve(counts, kernel, rows, columns);
+
+            std::vector<double> result;
+            result.reserve(xpoints.size() * ypoints.size());
+            for (const auto & x : xpoints)
+            {
+                const auto [jx, fx] = xgrid.locate(x);
+
+                for (const auto & y : ypoints)
+                {
+                    const auto [jy, fy] = ygrid.locate(y);
+
+                    const double value = (1.0 - fx) * (1.0 - fy) * counts[2 * (jx * columns + jy)]
+                        + (1.0 - fx) * fy * counts[2 * (jx * columns + jy + 1)]
+                        + fx * (1.0 - fy) * counts[2 * ((jx + 1) * columns + jy)]
+                        + fx * fy * counts[2 * ((jx + 1) * columns + jy + 1)];
+                    result.push_back(std::max(0.0, value));
+                }
+            }
+
+            return result;
+        }
+
+        double
+        hpd_threshold(std::span<const double> density, const double & probability)
+        {
+            if (density.empty())
+            {
+                throw InternalError("kde::hpd_threshold: the density must not be empty");
+            }
+
+            std::vector<double> values(density.begin(), density.end());
+            std::sort(values.begin(), values.end(), std::greater<double>());
+
+            const double target = std::clamp(probability, 0.0, 1.0) * std::accumulate(values.begin(), values.end(), 0.0);
+
+            double sum = 0.0;
+            for (const auto & v : values)
+            {
+                sum += v;
+                if (sum >= target)
+                {
+                    return v;
+                }
+            }
+
+            return values.back();
+        }
+
+        std::vector<double>
+        weighted_quantiles(std::span<const double> samples, const std::size_t & columns, std::span<const double> weights, std::span<const double> quantiles)
+        {
+            if ((0 == columns) || (0 != samples.size() % columns))
+            {
+                throw InternalError("kde::weighted_quantiles: the size of the samples must be a multiple of the number of columns");
+            }
+
+            const std::size_t n = samples.size() / columns;
+
+            if ((! weights.empty()) && (weights.size() != n))
+            {
+                throw InternalError("kde::weighted_quantiles: the number of weights must match the number of samples");
+            }
+
+            for (const auto & q : quantiles)
+            {
+                if (! ((0.0 <= q) && (q <= 1.0)))
+                {
+                    throw InternalError("kde::weighted_quantiles: quantiles must be in [0, 1]");
+                }
+            }
+
+            for (const auto & w : weights)
+            {
+                if (w < 0.0)
+                {
+                    throw InternalError("kde::weighted_quantiles: the sample weights cannot be negative");
+                }
+            }
+
+            std::vector<double> result(quantiles.size() * columns);
+
+            auto column = [&](const std::size_t & c)
+            {
+                std::vector<std::pair<double, double>> values;
+                values.reserve(n);
+                for (std::size_t i = 0 ; i < n ; ++i)
+                {
+                    const double x = samples[i * columns + c];
+                    const double w = weights.empty() ? 1.0 : weights[i];
+                    if ((! std::isnan(x)) && (! std::isnan(w)))
+                    {
+                        values.emplace_back(x, w);
+                    }
+                }
+
+                std::stable_sort(values.begin(), values.end(), [](const auto & lhs, const auto & rhs) { return lhs.first < rhs.first; });
+
+                double total = 0.0;
+                std::vector<double> cumulative;
+                cumulative.reserve(values.size());
+                for (const auto & [x, w] : values)
+                {
+                    cumulative.push_back(total + 0.5 * w);
+                    total += w;
+                }
+
+                if (! (total > 0.0))
+                {
+                    throw InternalError("kde::weighted_quantiles: the sum of the sample weights evaluated to zero");
+                }
+
+                for (auto & cu : cumulative)
+                {
+                    cu /= total;
+                }
+
+                // linear interpolation, constant beyond the first and last sample
+                for (std::size_t k = 0 ; k < quantiles.size() ; ++k)
+                {
+                    const double q = quantiles[k];
+                    const std::size_t j = std::upper_bound(cumulative.begin(), cumulative.end(), q) - cumulative.begin();
+
+                    double value;
+                    if (0 == j)
+                    {
+                        value = values.front().first;
+                    }
+                    else if (cumulative.size() == j)
+                    {
+                        value = values.back().first;
+                    }
+                    else
+                    {
+                        const double f = (q - cumulative[j - 1]) / (cumulative[j] - cumulative[j - 1]);
+                        value = values[j - 1].first + f * (values[j].first - values[j - 1].first);
+                    }
+
+                    result[k * columns + c] = value;
+                }
+            };
+
+            if ((columns < 2) || ThreadPool::is_worker_thread())
+            {
+                for (std::size_t c = 0 ; c < columns ; ++c)
+                {
+                    column(c);
+                }
+
+                return result;
+            }
+
+            std::vector<Ticket> tickets;
+            std::vector<std::exception_ptr> errors(columns);
+            tickets.reserve(columns);
+            for (std::size_t c = 0 ; c < columns ; ++c)
+            {
+                tickets.push_back(ThreadPool::instance()->enqueue([&, c]()
+                {
+                    try
+                    {
+                        column(c);
+                    }
+                    catch (...)
+                    {
+                        errors[c] = std::current_exception();
+                    }
+                }));
+            }
+
+            for (auto & ticket : tickets)
+            {
+                ticket.wait();
+            }
+
+            for (const auto & error : errors)
+            {
+                if (error)
+                {
+                    std::rethrow_exception(error);
+                }
+            }
+
+            return result;
+        }
+    }
+}
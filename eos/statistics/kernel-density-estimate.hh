@@ -0,0 +1,108 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2025 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_KERNEL_DENSITY_ESTIMATE_HH
+#define EOS_GUARD_EOS_STATISTICS_KERNEL_DENSITY_ESTIMATE_HH 1
+
+#include <span>
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*
+     * Weighted Gaussian kernel density estimates (KDEs) and weighted quantiles of large samples.
+     *
+     * The KDEs follow the conventions of scipy.stats.gaussian_kde: the kernel's covariance is the
+     * weighted covariance of the samples, scaled by the square of the bandwidth factor, which is
+     * determined from the effective sample size. Rather than summing over all samples for each point,
+     * the samples are binned linearly onto a fine grid and convolved with the kernel by means of FFTs.
+     * The cost is therefore O(N + M log M) for N samples and M grid points.
+     *
+     * Samples with non-finite values or weights are ignored. Empty weights mean unit weights.
+     */
+    namespace kde
+    {
+        struct Config
+        {
+            /// Rule that determines the bandwidth factor; either 'silverman' or 'scott'.
+            std::string bandwidth = "silverman";
+
+            /// Relative factor that multiplies the bandwidth factor determined by the rule.
+            double factor = 1.0;
+
+            /// Minimal number of grid points per dimension; 0 selects a default suitable for plotting.
+            unsigned grid_size = 0;
+        };
+
+        /*!
+         * Evaluate the one-dimensional KDE of a weighted sample.
+         *
+         * @param samples The values of the samples.
+         * @param weights The weights of the samples.
+         * @param points  The points at which the density is evaluated.
+         * @param config  The configuration of the KDE.
+         */
+        std::vector<double> density(std::span<const double> samples, std::span<const double> weights,
+                std::span<const double> points, const Config & config = Config());
+
+        /*!
+         * Evaluate the two-dimensional KDE of a weighted sample on a rectangular grid.
+         *
+         * The result has the entry for (xpoints[i], ypoints[j]) at index i * ypoints.size() + j.
+         *
+         * @param xsamples The x values of the samples.
+         * @param ysamples The y values of the samples.
+         * @param weights  The weights of the samples.
+         * @param xpoints  The x coordinates of the grid on which the density is evaluated.
+         * @param ypoints  The y coordinates of the grid on which the density is evaluated.
+         * @param config   The configuration of the KDE.
+         */
+        std::vector<double> density(std::span<const double> xsamples, std::span<const double> ysamples, std::span<const double> weights,
+                std::span<const double> xpoints, std::span<const double> ypoints, const Config & config = Config());
+
+        /*!
+         * Determine the threshold of a highest-density region from a density on a grid.
+         *
+         * Returns the smallest value among the largest values of the density whose sum accounts for
+         * at least the given fraction of the total sum.
+         *
+         * @param density     The values of the density on a grid of equally-sized cells.
+         * @param probability The probability content of the region, in [0, 1].
+         */
+        double hpd_threshold(std::span<const double> density, const double & probability);
+
+        /*!
+         * Compute the quantiles of each column of a weighted sample.
+         *
+         * Each sample's weight is assigned half to the left and half to the right of its value,
+         * and the quantiles are obtained by linear interpolation. Columns are processed in parallel.
+         * The result has the entry for quantile q and column c at index q * columns + c.
+         *
+         * @param samples   The samples in row-major order, i.e., one row of length columns per sample.
+         * @param columns   The number of columns.
+         * @param weights   The weights of the samples.
+         * @param quantiles The quantiles to compute, in [0, 1].
+         */
+        std::vector<double> weighted_quantiles(std::span<const double> samples, const std::size_t & columns,
+                std::span<const double> weights, std::span<const double> quantiles);
+    }
+}
+
+#endif
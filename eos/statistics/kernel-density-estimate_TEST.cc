@@ -0,0 +1,189 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2025 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/statistics/kernel-density-estimate.hh>
+#include <eos/utils/exception.hh>
+
+#include <cmath>
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+class KernelDensityEstimateTest :
+    public TestCase
+{
+    public:
+        KernelDensityEstimateTest() :
+            TestCase("kernel_density_estimate_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // deterministic, weighted and correlated samples
+            const unsigned n = 1000;
+            std::vector<double> x(n), y(n), w(n);
+            for (unsigned i = 0 ; i < n ; ++i)
+            {
+                const double u = (i + 0.5) / n;
+                x[i] = std::sqrt(-2.0 * std::log(u)) * std::cos(2.0 * M_PI * std::fmod(0.618033988749895 * i, 1.0));
+                y[i] = 2.0 + 0.5 * x[i] + 0.3 * std::sqrt(-2.0 * std::log(u)) * std::sin(2.0 * M_PI * std::fmod(0.618033988749895 * i, 1.0));
+                w[i] = 0.5 + std::fmod(0.7548776662466927 * i, 1.0);
+            }
+
+            // weighted moments and effective sample size
+            double sw = 0.0, sw2 = 0.0, mx = 0.0, my = 0.0;
+            for (unsigned i = 0 ; i < n ; ++i)
+            {
+                sw  += w[i];
+                sw2 += w[i] * w[i];
+                mx  += w[i] * x[i];
+                my  += w[i] * y[i];
+            }
+            mx /= sw;
+            my /= sw;
+            const double neff = sw * sw / sw2;
+
+            double cxx = 0.0, cxy = 0.0, cyy = 0.0;
+            for (unsigned i = 0 ; i < n ; ++i)
+            {
+                cxx += w[i] * (x[i] - mx) * (x[i] - mx);
+                cxy += w[i] * (x[i] - mx) * (y[i] - my);
+                cyy += w[i] * (y[i] - my) * (y[i] - my);
+            }
+            cxx /= sw * (1.0 - 1.0 / neff);
+            cxy /= sw * (1.0 - 1.0 / neff);
+            cyy /= sw * (1.0 - 1.0 / neff);
+
+            // 1D KDE agrees with the direct sum over all samples
+            {
+                const double h = std::pow(neff * 3.0 / 4.0, -1.0 / 5.0) * std::sqrt(cxx);
+
+                std::vector<double> points;
+                for (unsigned k = 0 ; k < 41 ; ++k)
+                {
+                    points.push_back(-4.0 + 0.2 * k);
+                }
+
+                const auto density = kde::density(x, w, points);
+                TEST_CHECK_EQUAL(density.size(), points.size());
+
+                for (unsigned k = 0 ; k < points.size() ; ++k)
+                {
+                    double reference = 0.0;
+                    for (unsigned i = 0 ; i < n ; ++i)
+                    {
+                        const double u = (points[k] - x[i]) / h;
+                        reference += w[i] * std::exp(-0.5 * u * u);
+                    }
+                    reference /= sw * h * std::sqrt(2.0 * M_PI);
+
+                    TEST_CHECK_NEARLY_EQUAL(density[k], reference, 1e-4);
+                }
+
+                // the relative factor scales the bandwidth
+                kde::Config config;
+                config.bandwidth = "scott";
+                config.factor    = 2.0;
+                const double h_scott = 2.0 * std::pow(neff, -1.0 / 5.0) * std::sqrt(cxx);
+                const auto density_scott = kde::density(x, w, std::vector<double>{ 0.5 }, config);
+
+                double reference = 0.0;
+                for (unsigned i = 0 ; i < n ; ++i)
+                {
+                    const double u = (0.5 - x[i]) / h_scott;
+                    reference += w[i] * std::exp(-0.5 * u * u);
+                }
+                reference /= sw * h_scott * std::sqrt(2.0 * M_PI);
+                TEST_CHECK_NEARLY_EQUAL(density_scott[0], reference, 1e-4);
+
+                config.bandwidth = "unknown";
+                TEST_CHECK_THROWS(InternalError, kde::density(x, w, points, config));
+            }
+
+            // 2D KDE agrees with the direct sum over all samples
+            {
+                const double f2  = std::pow(neff, -1.0 / 3.0);
+                const double sxx = f2 * cxx, sxy = f2 * cxy, syy = f2 * cyy;
+                const double det = sxx * syy - sxy * sxy;
+
+                const std::vector<double> xpoints{ -2.0, -1.0, 0.0, 0.5, 1.0, 2.0 };
+                const std::vector<double> ypoints{  1.0,  1.5, 2.0, 2.5, 3.0 };
+
+                const auto density = kde::density(x, y, w, xpoints, ypoints);
+                TEST_CHECK_EQUAL(density.size(), xpoints.size() * ypoints.size());
+
+                for (unsigned i = 0 ; i < xpoints.size() ; ++i)
+                {
+                    for (unsigned j = 0 ; j < ypoints.size() ; ++j)
+                    {
+                        double reference = 0.0;
+                        for (unsigned k = 0 ; k < n ; ++k)
+                        {
+                            const double dx = xpoints[i] - x[k], dy = ypoints[j] - y[k];
+                            reference += w[k] * std::exp(-0.5 * (syy * dx * dx - 2.0 * sxy * dx * dy + sxx * dy * dy) / det);
+                        }
+                        reference /= sw * 2.0 * M_PI * std::sqrt(det);
+
+                        TEST_CHECK_NEARLY_EQUAL(density[i * ypoints.size() + j], reference, 5e-3);
+                    }
+                }
+            }
+
+            // highest-density regions
+            {
+                const std::vector<double> density{ 0.1, 0.4, 0.3, 0.2 };
+
+                TEST_CHECK_EQUAL(kde::hpd_threshold(density, 0.0), 0.4);
+                TEST_CHECK_EQUAL(kde::hpd_threshold(density, 0.4), 0.4);
+                TEST_CHECK_EQUAL(kde::hpd_threshold(density, 0.5), 0.3);
+                TEST_CHECK_EQUAL(kde::hpd_threshold(density, 0.95), 0.1);
+                TEST_CHECK_THROWS(InternalError, kde::hpd_threshold(std::vector<double>{ }, 0.5));
+            }
+
+            // weighted quantiles
+            {
+                const std::vector<double> samples{ 3.0, 1.0,
+                                                   1.0, 2.0,
+                                                   2.0, NAN,
+                                                   4.0, 3.0 };
+                const std::vector<double> weights{ 1.0, 1.0, 1.0, 1.0 };
+                const std::vector<double> quantiles{ 0.0, 0.5, 1.0 };
+
+                const auto result = kde::weighted_quantiles(samples, 2, weights, quantiles);
+                TEST_CHECK_EQUAL(result.size(), 6u);
+                TEST_CHECK_NEARLY_EQUAL(result[0], 1.0, 1e-14);
+                TEST_CHECK_NEARLY_EQUAL(result[1], 1.0, 1e-14);
+                TEST_CHECK_NEARLY_EQUAL(result[2], 2.5, 1e-14);
+                TEST_CHECK_NEARLY_EQUAL(result[3], 2.0, 1e-14);
+                TEST_CHECK_NEARLY_EQUAL(result[4], 4.0, 1e-14);
+                TEST_CHECK_NEARLY_EQUAL(result[5], 3.0, 1e-14);
+
+                // a heavy sample pulls the median
+                const std::vector<double> heavy{ 1.0, 1.0, 1.0, 5.0 };
+                const auto weighted = kde::weighted_quantiles(samples, 2, heavy, std::vector<double>{ 0.5 });
+                TEST_CHECK_NEARLY_EQUAL(weighted[0], 3.5, 1e-14);
+
+                TEST_CHECK_THROWS(InternalError, kde::weighted_quantiles(samples, 2, weights, std::vector<double>{ 1.5 }));
+                TEST_CHECK_THROWS(InternalError, kde::weighted_quantiles(samples, 3, weights, quantiles));
+            }
+        }
+} kernel_density_estimate_test;
@@ -18,12 +18,14 @@
  * Place, Suite 330, Boston, MA  02111-1307  USA
  */
 
+#include <eos/signal-pdf.hh>
 #include <eos/statistics/log-likelihood.hh>
 #include <eos/statistics/test-statistic-impl.hh>
 #include <eos/utils/log.hh>
 #include <eos/utils/observable_cache.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/thread_pool.hh>
 #include <eos/utils/verify.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
@@ -155,10 +157,9 @@ namespace eos
              * theory value that is likely under exp. should yield
              * likely value of exp. assuming theory.
              *
-             * This procedure is used in both sample() and significance()
+             * This procedure is used in sample(), pseudo_data() and significance()
              */
-
-            virtual double sample(gsl_rng * rng) const
+            double draw(gsl_rng * rng, double & sigma) const
             {
                 // find out if sample in upper or lower part
                 double u = gsl_rng_uniform(rng);
@@ -171,24 +172,43 @@ namespace eos
                 const double & theory = cache[id];
 
                 // get a sample observable using the inverse-transform method
-                double obs, sigma;
                 if (u < b / (a + b))
                 {
-                    obs = gsl_cdf_gaussian_Pinv(u / c_b, b) + theory;
                     sigma = b;
+                    return gsl_cdf_gaussian_Pinv(u / c_b, b) + theory;
                 }
                 else
                 {
-                    obs = gsl_cdf_gaussian_Pinv(u - 0.5 * c_b, a) + theory;
                     sigma = a;
+                    return gsl_cdf_gaussian_Pinv(u - 0.5 * c_b, a) + theory;
                 }
+            }
+
+            virtual double sample(gsl_rng * rng) const
+            {
+                double sigma;
+                const double obs = draw(rng, sigma);
 
                 // calculate the properly normalized log likelihood
                 // note that we generate from theory,
-                const double chi = (theory - obs) / sigma;
+                const double chi = (cache[id] - obs) / sigma;
                 return norm - power_of<2>(chi) / 2.0;
             }
 
+            // the pseudo measurement becomes the new mode, with the experimental uncertainties
+            virtual LogLikelihoodBlockPtr pseudo_data(gsl_rng * rng) const
+            {
+                double sigma;
+                const double obs = draw(rng, sigma);
+
+                return LogLikelihoodBlockPtr(new GaussianBlock(cache, id, obs - sigma_lower, obs, obs + sigma_upper, _number_of_observations));
+            }
+
+            virtual bool supports_pseudo_data() const
+            {
+                return true;
+            }
+
             virtual double significance() const
             {
                 const double value = cache[id];
@@ -350,6 +370,25 @@ namespace eos
                 return norm + alpha * value - std::exp(value);
             }
 
+            // shift the experimental distribution such that its central value coincides with the prediction,
+            // and use a draw from it as the central value of the pseudo measurement
+            virtual LogLikelihoodBlockPtr pseudo_data(gsl_rng * rng) const
+            {
+                const double x = lambda * std::log(gsl_ran_gamma(rng, alpha, 1.0)) + nu;
+                const double shift = cache[id] - central + x - central;
+
+                auto result = new LogGammaBlock(*this);
+                result->central += shift;
+                result->nu      += shift;
+
+                return LogLikelihoodBlockPtr(result);
+            }
+
+            virtual bool supports_pseudo_data() const
+            {
+                return true;
+            }
+
             /*
              * To find the significance, it is necessary to determine the smallest interval
              * around the mode. This is achieved by finding the mirror point
@@ -763,6 +802,11 @@ namespace eos
                 throw InternalError("LogLikelihoodBlock::MixtureBlock::sample() not implemented yet");
             }
 
+            bool supports_sampling() const
+            {
+                return false;
+            }
+
             double significance() const
             {
                 double value = -2.0 * evaluate();
@@ -1036,6 +1080,38 @@ namespace eos
                 return result;
             }
 
+            // the pseudo measurements are drawn around the response to the current predictions
+            virtual LogLikelihoodBlockPtr pseudo_data(gsl_rng * rng) const
+            {
+                for (auto i = 0u ; i < _dim_pred ; ++i)
+                {
+                    gsl_vector_set(_observables, i, _cache[_ids[i]]);
+                }
+
+                for (auto i = 0u ; i < _dim_meas ; ++i)
+                {
+                    gsl_vector_set(_measurements_2, i, gsl_ran_ugaussian(rng));
+                }
+
+                // mean <- R * observables + _chol * standard normals
+                gsl_vector * mean = gsl_vector_alloc(_dim_meas);
+                gsl_blas_dgemv(CblasNoTrans, 1.0, _response, _observables, 0.0, mean);
+                gsl_blas_dgemv(CblasNoTrans, 1.0, _chol, _measurements_2, 1.0, mean);
+
+                gsl_matrix * covariance = gsl_matrix_alloc(_dim_meas, _dim_meas);
+                gsl_matrix_memcpy(covariance, _covariance);
+
+                gsl_matrix * response = gsl_matrix_alloc(_dim_meas, _dim_pred);
+                gsl_matrix_memcpy(response, _response);
+
+                return LogLikelihoodBlockPtr(new MultivariateGaussianBlock(_cache, std::vector<ObservableCache::Id>(_ids), mean, covariance, response, _number_of_observations));
+            }
+
+            virtual bool supports_pseudo_data() const
+            {
+                return true;
+            }
+
             virtual double significance() const
             {
                 const auto chi_squared = this->chi_square();
@@ -1180,12 +1256,259 @@ namespace eos
                 return LogLikelihoodBlockPtr(new UniformBoundBlock(cache, std::move(ids), bound, uncertainty));
             }
         };
+
+        struct UnbinnedBlock :
+            public LogLikelihoodBlock
+        {
+            // number of events per partial sum; fixed to make the result independent of the number of threads
+            static constexpr unsigned long chunk_size = 4096;
+
+            ObservableCache cache;
+
+            // one clone of the PDF and its kinematic variables per concurrent job
+            std::vector<SignalPDFPtr> pdfs;
+
+            std::vector<std::vector<MutablePtr>> variables;
+
+            EventSample events;
+
+            const bool weighted;
+
+            const bool extended;
+
+            ObservableCache::Id yield_id;
+
+            unsigned dim;
+
+            double sum_of_weights;
+
+            UnbinnedBlock(const ObservableCache & cache, const SignalPDFPtr & pdf, const EventSample & events,
+                          const bool & weighted, const bool & extended, const ObservableCache::Id & yield_id) :
+                cache(cache),
+                events(events),
+                weighted(weighted),
+                extended(extended),
+                yield_id(yield_id),
+                dim(0),
+                sum_of_weights(0.0)
+            {
+                const unsigned threads = ThreadPool::instance()->number_of_threads();
+                for (unsigned j = 0 ; j < threads ; ++j)
+                {
+                    SignalPDFPtr clone = std::dynamic_pointer_cast<SignalPDF>(pdf->clone(cache.parameters()));
+
+                    std::vector<MutablePtr> v;
+                    for (const auto & d : *clone)
+                    {
+                        v.push_back(d.parameter);
+                    }
+
+                    pdfs.push_back(clone);
+                    variables.push_back(v);
+                }
+
+                dim = variables.front().size();
+
+                if (events.columns() != dim + (weighted ? 1 : 0))
+                {
+                    throw InternalError("LogLikelihoodBlock::Unbinned: expected " + stringify(dim + (weighted ? 1 : 0))
+                            + " columns per event, got " + stringify(events.columns()));
+                }
+
+                if (weighted)
+                {
+                    const double * data = events.data();
+                    for (unsigned long i = 0 ; i < events.size() ; ++i)
+                    {
+                        sum_of_weights += data[i * events.columns() + dim];
+                    }
+                }
+                else
+                {
+                    sum_of_weights = events.size();
+                }
+            }
+
+            virtual ~UnbinnedBlock()
+            {
+            }
+
+            virtual std::string as_string() const
+            {
+                std::string result = "Unbinned: ";
+                result += pdfs.front()->name().str() + ", " + stringify(events.size()) + " events";
+
+                if (weighted)
+                {
+                    result += ", weighted";
+                }
+
+                if (extended)
+                {
+                    result += ", yield = " + cache.observable(yield_id)->name().str();
+                }
+
+                return result;
+            }
+
+            // sum of the weighted, unnormalized log(PDF) over the events in one chunk
+            double evaluate_chunk(const unsigned & j, const unsigned long & chunk) const
+            {
+                const auto & pdf = pdfs[j];
+                const auto & v   = variables[j];
+                const unsigned columns = events.columns();
+                const unsigned long last = std::min(events.size(), (chunk + 1) * chunk_size);
+
+                double result = 0.0;
+                for (unsigned long i = chunk * chunk_size ; i < last ; ++i)
+                {
+                    const double * row = events.data() + i * columns;
+                    for (unsigned k = 0 ; k < dim ; ++k)
+                    {
+                        v[k]->set(row[k]);
+                    }
+
+                    result += (weighted ? row[dim] : 1.0) * pdf->evaluate();
+                }
+
+                return result;
+            }
+
+            virtual double evaluate() const
+            {
+                const unsigned long chunks = (events.size() + chunk_size - 1) / chunk_size;
+                std::vector<double> partial_sums(chunks, 0.0);
+
+                // avoid waiting on the thread pool from within one of its own threads
+                if ((pdfs.size() == 1) || (chunks == 1) || ThreadPool::is_worker_thread())
+                {
+                    for (unsigned long c = 0 ; c < chunks ; ++c)
+                    {
+                        partial_sums[c] = evaluate_chunk(0, c);
+                    }
+                }
+                else
+                {
+                    std::vector<std::string> errors(pdfs.size());
+                    std::vector<Ticket> tickets;
+                    for (unsigned j = 0 ; j < pdfs.size() ; ++j)
+                    {
+                        tickets.push_back(ThreadPool::instance()->enqueue([this, j, chunks, &partial_sums, &errors]()
+                        {
+                            try
+                            {
+                                for (unsigned long c = j ; c < chunks ; c += pdfs.size())
+                                {
+                                    partial_sums[c] = this->evaluate_chunk(j, c);
+                                }
+                            }
+                            catch (eos::Exception & e)
+                            {
+                                errors[j] = e.what();
+                            }
+                        }));
+                    }
+
+                    for (auto & t : tickets)
+                    {
+                        t.wait();
+                    }
+
+                    for (const auto & e : errors)
+                    {
+                        if (! e.empty())
+                        {
+                            throw InternalError("LogLikelihoodBlock::Unbinned: " + e);
+                        }
+                    }
+                }
+
+                double result = 0.0;
+                for (const auto & p : partial_sums)
+                {
+                    result += p;
+                }
+
+                // the normalization depends only on the parameters, and is therefore computed once per evaluation
+                result -= sum_of_weights * pdfs.front()->normalization();
+
+                if (extended)
+                {
+                    const double yield = cache[yield_id];
+                    if (yield <= 0.0)
+                    {
+                        return -std::numeric_limits<double>::infinity();
+                    }
+
+                    result += sum_of_weights * std::log(yield) - yield;
+                }
+
+                return result;
+            }
+
+            virtual unsigned number_of_observations() const
+            {
+                return events.size();
+            }
+
+            // simulating event samples requires sampling from the PDF, which is not available here
+            virtual double sample(gsl_rng * /*rng*/) const
+            {
+                throw InternalError("LogLikelihoodBlock::Unbinned: simulated data sets are not supported for unbinned likelihoods");
+                return 0.0;
+            }
+
+            virtual bool supports_sampling() const
+            {
+                return false;
+            }
+
+            virtual double significance() const
+            {
+                throw InternalError("LogLikelihoodBlock::Unbinned: the significance is not defined for unbinned likelihoods");
+                return 0.0;
+            }
+
+            virtual TestStatistic primary_test_statistic() const
+            {
+                return test_statistics::Empty();
+            }
+
+            virtual LogLikelihoodBlockPtr clone(ObservableCache cache) const
+            {
+                ObservableCache::Id id = 0;
+                if (extended)
+                {
+                    id = cache.add(this->cache.observable(yield_id)->clone(cache.parameters()));
+                }
+
+                return LogLikelihoodBlockPtr(new UnbinnedBlock(cache, pdfs.front(), events, weighted, extended, id));
+            }
+        };
     }
 
     LogLikelihoodBlock::~LogLikelihoodBlock()
     {
     }
 
+    LogLikelihoodBlockPtr
+    LogLikelihoodBlock::pseudo_data(gsl_rng * /*rng*/) const
+    {
+        throw InternalError("LogLikelihoodBlock::pseudo_data: the block '" + as_string() + "' does not support pseudo data");
+    }
+
+    bool
+    LogLikelihoodBlock::supports_pseudo_data() const
+    {
+        return false;
+    }
+
+    bool
+    LogLikelihoodBlock::supports_sampling() const
+    {
+        return true;
+    }
+
     LogLikelihoodBlockPtr
     LogLikelihoodBlock::Gaussian(ObservableCache cache, const ObservablePtr & observable,
             const double & min, const double & central, const double & max,
@@ -1298,6 +1621,22 @@ namespace eos
         return LogLikelihoodBlockPtr(new implementation::MixtureBlock(components, norm_weights, test_stat));
     }
 
+    LogLikelihoodBlockPtr
+    LogLikelihoodBlock::Unbinned(ObservableCache cache, const SignalPDFPtr & pdf, const EventSample & events,
+                                 const bool & weighted, const ObservablePtr & yield)
+    {
+        if (! pdf)
+            throw InternalError("LogLikelihoodBlock::Unbinned: no PDF provided");
+
+        ObservableCache::Id id = 0;
+        if (yield)
+        {
+            id = cache.add(yield);
+        }
+
+        return LogLikelihoodBlockPtr(new implementation::UnbinnedBlock(cache, pdf, events, weighted, bool(yield), id));
+    }
+
     LogLikelihoodBlockPtr
     LogLikelihoodBlock::MultivariateGaussian(ObservableCache cache, const std::vector<ObservablePtr> & observables,
             gsl_vector * mean, gsl_matrix * covariance, gsl_matrix * response, const unsigned & number_of_observations)
@@ -23,6 +23,8 @@
 
 #include <eos/constraint.hh>
 #include <eos/observable.hh>
+#include <eos/signal-pdf-fwd.hh>
+#include <eos/statistics/event-sample.hh>
 #include <eos/statistics/log-likelihood-fwd.hh>
 #include <eos/statistics/test-statistic.hh>
 #include <eos/maths/matrix.hh>
@@ -93,6 +95,25 @@ namespace eos
              */
             virtual TestStatistic primary_test_statistic() const = 0;
 
+            /*!
+             * Create a block of pseudo data, drawn around the observables' current values.
+             *
+             * The new block shares the observable cache with this block, and models the
+             * experimental distribution of a simulated measurement. Contrary to sample(), its
+             * log(likelihood) can therefore be maximised with respect to the parameters.
+             *
+             * @note The default implementation throws an InternalError.
+             *
+             * @param rng The random number generator.
+             */
+            virtual LogLikelihoodBlockPtr pseudo_data(gsl_rng * rng) const;
+
+            /// Whether pseudo_data() is supported by this block. Defaults to false.
+            virtual bool supports_pseudo_data() const;
+
+            /// Whether sample() is supported by this block. Defaults to true.
+            virtual bool supports_sampling() const;
+
             /*!
              * Create a new LogLikelihoodBlock for one normally distributed observable.
              *
@@ -299,6 +320,24 @@ namespace eos
              */
             static LogLikelihoodBlockPtr UniformBound(ObservableCache cache, const std::vector<ObservablePtr> & observables,
                                                       const double & bound, const double & uncertainty);
+
+            /*!
+             * Create a new LogLikelihoodBlock for the unbinned likelihood of a sample of events.
+             *
+             * The block evaluates sum_i w_i log(PDF(x_i)), with the PDF's normalization computed once per
+             * evaluation. If an observable for the expected yield nu is provided, the extended likelihood
+             * is used, adding W log(nu) - nu with W = sum_i w_i. The events are processed concurrently, using
+             * one clone of the PDF per thread.
+             *
+             * @param cache       The Observable cache from which we draw the expected yield.
+             * @param pdf         The signal PDF; it is cloned onto the cache's parameters.
+             * @param events      The events, with one column per kinematic variable of the PDF in the order of its
+             *                    kinematic ranges, followed by the event weight if weighted is true.
+             * @param weighted    Whether the last column of the events holds the event weights.
+             * @param yield       The observable for the expected yield, or nullptr for the non-extended likelihood.
+             */
+            static LogLikelihoodBlockPtr Unbinned(ObservableCache cache, const SignalPDFPtr & pdf, const EventSample & events,
+                                                  const bool & weighted = false, const ObservablePtr & yield = ObservablePtr());
     };
 
     /*!
@@ -22,7 +22,10 @@
 #include <eos/statistics/log-likelihood.hh>
 #include <eos/statistics/log-posterior_TEST.hh>
 #include <eos/maths/power-of.hh>
+#include <eos/signal-pdf.hh>
 #include <algorithm>
+#include <cstdio>
+#include <fstream>
 
 using namespace test;
 using namespace eos;
@@ -655,6 +658,68 @@ namespace eos
                     // ratio of pdfs at mode given by weight ratio
                     TEST_CHECK_RELATIVE_ERROR(pdf_favored, pdf_suppressed + std::log(weights[0] / weights[1]), 1e-12);
                 }
+
+                // unbinned likelihood of the PDF 9 + 8 z + 9 z^2, normalized to 24 on z in [-1, +1]
+                {
+                    Kinematics kpdf{ { "z_min", -1.0 }, { "z_max", +1.0 } };
+                    SignalPDFPtr pdf = SignalPDF::make("Test::Legendre1D", p, kpdf, Options{ });
+
+                    std::vector<double> z, zw;
+                    double expected = 0.0, expected_weighted = 0.0, sum_of_weights = 0.0;
+                    for (unsigned i = 0 ; i < 10000 ; ++i)
+                    {
+                        const double x = -1.0 + 2.0 * (i + 0.5) / 10000;
+                        const double w = 0.5 + (i % 3);
+                        const double log_pdf = std::log((9.0 + 8.0 * x + 9.0 * x * x) / 24.0);
+
+                        z.push_back(x);
+                        zw.push_back(x);
+                        zw.push_back(w);
+
+                        expected          += log_pdf;
+                        expected_weighted += w * log_pdf;
+                        sum_of_weights    += w;
+                    }
+
+                    LogLikelihood llh(p);
+                    llh.add(LogLikelihoodBlock::Unbinned(llh.observable_cache(), pdf, EventSample(z, 1)));
+                    TEST_CHECK_RELATIVE_ERROR(llh(), expected, 1e-12);
+
+                    // results do not depend on the log-likelihood's clones
+                    TEST_CHECK_RELATIVE_ERROR(llh.clone()(), expected, 1e-12);
+
+                    LogLikelihood weighted(p);
+                    weighted.add(LogLikelihoodBlock::Unbinned(weighted.observable_cache(), pdf, EventSample(zw, 2), true));
+                    TEST_CHECK_RELATIVE_ERROR(weighted(), expected_weighted, 1e-12);
+
+                    // extended likelihood, using mass::b(MSbar) as a stand-in for the yield
+                    LogLikelihood extended(p);
+                    extended.add(LogLikelihoodBlock::Unbinned(extended.observable_cache(), pdf, EventSample(z, 1), false,
+                                ObservablePtr(new ObservableStub(p, "mass::b(MSbar)"))));
+                    p["mass::b(MSbar)"] = 4.2;
+                    TEST_CHECK_RELATIVE_ERROR(extended(), expected + 10000 * std::log(4.2) - 4.2, 1e-12);
+
+                    // events mapped from a file
+                    const std::string file = "log-likelihood_TEST-events.bin";
+                    {
+                        std::ofstream out(file, std::ios::binary);
+                        out.write(reinterpret_cast<const char *>(zw.data()), zw.size() * sizeof(double));
+                    }
+
+                    EventSample mapped(file, 2);
+                    TEST_CHECK_EQUAL(mapped.size(), 10000u);
+                    TEST_CHECK_EQUAL(mapped.data()[2 * 9999], zw[2 * 9999]);
+
+                    LogLikelihood from_file(p);
+                    from_file.add(LogLikelihoodBlock::Unbinned(from_file.observable_cache(), pdf, mapped, true));
+                    TEST_CHECK_RELATIVE_ERROR(from_file(), expected_weighted, 1e-12);
+
+                    std::remove(file.c_str());
+
+                    // the number of columns must match the PDF's kinematic variables
+                    TEST_CHECK_THROWS(InternalError, LogLikelihoodBlock::Unbinned(llh.observable_cache(), pdf, EventSample(zw, 2)));
+                    TEST_CHECK_THROWS(EventSampleError, EventSample(z, 3));
+                }
             }
     } log_likelihood_test;
 }
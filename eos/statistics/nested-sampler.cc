@@ -0,0 +1,1049 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2024 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/nested-sampler.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <gsl/gsl_randist.h>
+#include <gsl/gsl_rng.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace eos
+{
+    namespace nested_sampling
+    {
+        using Point = std::vector<double>;
+
+        // dynesty uses a large but finite number to avoid NaNs when accumulating the information
+        static const double log_zero = -1.0e300;
+
+        inline double
+        log_add_exp(const double & a, const double & b)
+        {
+            const double max = std::max(a, b);
+
+            if (max == -std::numeric_limits<double>::infinity())
+            {
+                return max;
+            }
+
+            return max + std::log1p(std::exp(-std::abs(a - b)));
+        }
+
+        inline bool
+        in_unit_cube(const Point & u)
+        {
+            return std::all_of(u.cbegin(), u.cend(), [](const double & v) { return (0.0 <= v) && (v < 1.0); });
+        }
+
+        // uniformly distributed point on the surface of the unit sphere
+        Point
+        unit_sphere(gsl_rng * rng, const unsigned & dim)
+        {
+            Point result(dim);
+            double norm = 0.0;
+            do
+            {
+                norm = 0.0;
+                for (auto & r : result)
+                {
+                    r = gsl_ran_ugaussian(rng);
+                    norm += r * r;
+                }
+            }
+            while (norm == 0.0);
+
+            norm = std::sqrt(norm);
+            for (auto & r : result)
+            {
+                r /= norm;
+            }
+
+            return result;
+        }
+
+        // uniformly distributed point within the unit ball
+        Point
+        unit_ball(gsl_rng * rng, const unsigned & dim)
+        {
+            Point result = unit_sphere(rng, dim);
+            const double radius = std::pow(gsl_rng_uniform(rng), 1.0 / dim);
+            for (auto & r : result)
+            {
+                r *= radius;
+            }
+
+            return result;
+        }
+
+        // in-place Cholesky decomposition of a symmetric, row-major matrix; returns false if not positive definite
+        bool
+        cholesky(std::vector<double> & a, const unsigned & dim)
+        {
+            for (unsigned j = 0 ; j < dim ; ++j)
+            {
+                double d = a[j * dim + j];
+                for (unsigned k = 0 ; k < j ; ++k)
+                {
+                    d -= a[j * dim + k] * a[j * dim + k];
+                }
+
+                if (d <= 0.0)
+                {
+                    return false;
+                }
+
+                a[j * dim + j] = std::sqrt(d);
+
+                for (unsigned i = j + 1 ; i < dim ; ++i)
+                {
+                    double s = a[i * dim + j];
+                    for (unsigned k = 0 ; k < j ; ++k)
+                    {
+                        s -= a[i * dim + k] * a[j * dim + k];
+                    }
+                    a[i * dim + j] = s / a[j * dim + j];
+                }
+
+                for (unsigned k = j + 1 ; k < dim ; ++k)
+                {
+                    a[j * dim + k] = 0.0;
+                }
+            }
+
+            return true;
+        }
+
+        /*
+         * Ellipsoid { x | (x - c)^T A^{-1} (x - c) <= 1 }, stored in terms of
+         * the lower triangular Cholesky factor L of A = L L^T.
+         */
+        struct Ellipsoid
+        {
+            unsigned dim;
+
+            Point center;
+
+            std::vector<double> axes;
+
+            double log_volume;
+
+            // returns (x - c)^T A^{-1} (x - c)
+            double distance2(const Point & x) const
+            {
+                Point y(dim);
+                double result = 0.0;
+                for (unsigned i = 0 ; i < dim ; ++i)
+                {
+                    double s = x[i] - center[i];
+                    for (unsigned k = 0 ; k < i ; ++k)
+                    {
+                        s -= axes[i * dim + k] * y[k];
+                    }
+                    y[i] = s / axes[i * dim + i];
+                    result += y[i] * y[i];
+                }
+
+                return result;
+            }
+
+            bool contains(const Point & x) const
+            {
+                return distance2(x) <= 1.0;
+            }
+
+            // returns L y
+            Point direction(const Point & y) const
+            {
+                Point result(dim, 0.0);
+                for (unsigned i = 0 ; i < dim ; ++i)
+                {
+                    for (unsigned k = 0 ; k <= i ; ++k)
+                    {
+                        result[i] += axes[i * dim + k] * y[k];
+                    }
+                }
+
+                return result;
+            }
+
+            Point sample(gsl_rng * rng) const
+            {
+                Point result = direction(unit_ball(rng, dim));
+                for (unsigned i = 0 ; i < dim ; ++i)
+                {
+                    result[i] += center[i];
+                }
+
+                return result;
+            }
+        };
+
+        // smallest ellipsoid centered on the sample mean that encloses all points, with its volume enlarged by a factor of enlarge
+        Ellipsoid
+        bounding_ellipsoid(const std::vector<const Point *> & points, const unsigned & dim, const double & enlarge)
+        {
+            const unsigned n = points.size();
+
+            Ellipsoid result{ dim, Point(dim, 0.0), std::vector<double>(dim * dim, 0.0), 0.0 };
+
+            for (const auto & p : points)
+            {
+                for (unsigned i = 0 ; i < dim ; ++i)
+                {
+                    result.center[i] += (*p)[i] / n;
+                }
+            }
+
+            std::vector<double> covariance(dim * dim, 0.0);
+            for (const auto & p : points)
+            {
+                for (unsigned i = 0 ; i < dim ; ++i)
+                {
+                    for (unsigned j = 0 ; j <= i ; ++j)
+                    {
+                        covariance[i * dim + j] += ((*p)[i] - result.center[i]) * ((*p)[j] - result.center[j]) / std::max(n - 1.0, 1.0);
+                    }
+                }
+            }
+            for (unsigned i = 0 ; i < dim ; ++i)
+            {
+                for (unsigned j = 0 ; j < i ; ++j)
+                {
+                    covariance[j * dim + i] = covariance[i * dim + j];
+                }
+            }
+
+            // regularize (nearly) degenerate sets of points
+            double jitter = 1.0e-12;
+            do
+            {
+                result.axes = covariance;
+                if (cholesky(result.axes, dim))
+                {
+                    break;
+                }
+
+                for (unsigned i = 0 ; i < dim ; ++i)
+                {
+                    covariance[i * dim + i] += jitter;
+                }
+                jitter *= 10.0;
+            }
+            while (true);
+
+            // expand the ellipsoid to enclose all points
+            double max_distance2 = 0.0;
+            for (const auto & p : points)
+            {
+                max_distance2 = std::max(max_distance2, result.distance2(*p));
+            }
+
+            const double scale = std::sqrt(std::max(max_distance2, 1.0e-300) * std::pow(enlarge, 2.0 / dim));
+
+            result.log_volume = dim / 2.0 * std::log(M_PI) - std::lgamma(dim / 2.0 + 1.0);
+            for (unsigned i = 0 ; i < dim ; ++i)
+            {
+                for (unsigned k = 0 ; k <= i ; ++k)
+                {
+                    result.axes[i * dim + k] *= scale;
+                }
+                result.log_volume += std::log(result.axes[i * dim + i]);
+            }
+
+            return result;
+        }
+
+        // recursively split the set of points using 2-means clustering, as long as the total volume decreases significantly
+        void
+        split_ellipsoid(const std::vector<const Point *> & points, const Ellipsoid & parent, const double & enlarge, std::vector<Ellipsoid> & result, const unsigned & depth = 0)
+        {
+            const unsigned dim = parent.dim;
+            const unsigned min_points = 2 * (dim + 1);
+
+            if ((points.size() < 2 * min_points) || (depth > 16))
+            {
+                result.push_back(parent);
+                return;
+            }
+
+            auto distance2 = [dim](const Point & a, const Point & b)
+            {
+                double result = 0.0;
+                for (unsigned i = 0 ; i < dim ; ++i)
+                {
+                    result += (a[i] - b[i]) * (a[i] - b[i]);
+                }
+                return result;
+            };
+
+            // seed the clusters with the outermost point, and the point farthest from it
+            auto outermost = std::max_element(points.cbegin(), points.cend(),
+                    [&parent](const Point * a, const Point * b) { return parent.distance2(*a) < parent.distance2(*b); });
+            auto farthest = std::max_element(points.cbegin(), points.cend(),
+                    [&](const Point * a, const Point * b) { return distance2(*a, **outermost) < distance2(*b, **outermost); });
+
+            std::array<Point, 2> centers{ **outermost, **farthest };
+            std::vector<unsigned> assignment(points.size(), 0);
+
+            for (unsigned iteration = 0 ; iteration < 20 ; ++iteration)
+            {
+                bool changed = false;
+                for (unsigned i = 0 ; i < points.size() ; ++i)
+                {
+                    const unsigned a = distance2(*points[i], centers[0]) <= distance2(*points[i], centers[1]) ? 0 : 1;
+                    changed |= (a != assignment[i]);
+                    assignment[i] = a;
+                }
+
+                if ((! changed) && (iteration > 0))
+                {
+                    break;
+                }
+
+                std::array<unsigned, 2> counts{ 0, 0 };
+                centers = { Point(dim, 0.0), Point(dim, 0.0) };
+                for (unsigned i = 0 ; i < points.size() ; ++i)
+                {
+                    counts[assignment[i]] += 1;
+                    for (unsigned k = 0 ; k < dim ; ++k)
+                    {
+                        centers[assignment[i]][k] += (*points[i])[k];
+                    }
+                }
+
+                if ((counts[0] == 0) || (counts[1] == 0))
+                {
+                    break;
+                }
+
+                for (unsigned c = 0 ; c < 2 ; ++c)
+                {
+                    for (auto & v : centers[c])
+                    {
+                        v /= counts[c];
+                    }
+                }
+            }
+
+            std::array<std::vector<const Point *>, 2> clusters;
+            for (unsigned i = 0 ; i < points.size() ; ++i)
+            {
+                clusters[assignment[i]].push_back(points[i]);
+            }
+
+            if ((clusters[0].size() < min_points) || (clusters[1].size() < min_points))
+            {
+                result.push_back(parent);
+                return;
+            }
+
+            std::array<Ellipsoid, 2> children{ bounding_ellipsoid(clusters[0], dim, enlarge), bounding_ellipsoid(clusters[1], dim, enlarge) };
+
+            // only accept the split if it halves the bounded volume
+            if (log_add_exp(children[0].log_volume, children[1].log_volume) > parent.log_volume + std::log(0.5))
+            {
+                result.push_back(parent);
+                return;
+            }
+
+            split_ellipsoid(clusters[0], children[0], enlarge, result, depth + 1);
+            split_ellipsoid(clusters[1], children[1], enlarge, result, depth + 1);
+        }
+
+        struct LivePoint
+        {
+            Point u;
+
+            Point x;
+
+            double logl;
+
+            unsigned ncall;
+
+            unsigned id;
+
+            unsigned it;
+        };
+
+        struct Proposal
+        {
+            LivePoint point;
+
+            unsigned ncall = 0;
+
+            unsigned accept = 0, reject = 0;
+
+            unsigned expand = 0, contract = 0;
+
+            std::string error;
+        };
+
+        struct Worker
+        {
+            LogPosteriorPtr log_posterior;
+
+            gsl_rng * rng;
+
+            Proposal proposal;
+        };
+    }
+
+    using namespace nested_sampling;
+
+    template <>
+    struct Implementation<NestedSampler>
+    {
+        NestedSampler::Config config;
+
+        unsigned dim;
+
+        unsigned batch_size;
+
+        unsigned update_interval;
+
+        enum class Method { unif, rwalk, rslice } method;
+
+        gsl_rng * rng;
+
+        std::vector<Worker> workers;
+
+        std::vector<LivePoint> live;
+
+        // bounding ellipsoids, also used to shape the proposals of the random walk and slice samplers
+        std::vector<Ellipsoid> ellipsoids;
+
+        std::vector<double> cumulative_volume;
+
+        // whether uniform proposals are drawn from the ellipsoids rather than the unit hypercube
+        bool bounded;
+
+        double scale;
+
+        Implementation(const LogPosterior & log_posterior, const NestedSampler::Config & config) :
+            config(config),
+            dim(log_posterior.varied_parameters().size()),
+            batch_size(config.batch_size > 0 ? config.batch_size : ThreadPool::instance()->number_of_threads()),
+            update_interval(config.update_interval > 0 ? config.update_interval : std::max(config.nlive / 4, 1u)),
+            rng(gsl_rng_alloc(gsl_rng_mt19937)),
+            bounded(false),
+            scale(1.0)
+        {
+            if (0 == dim)
+            {
+                throw InternalError("NestedSampler: the posterior does not vary any parameters");
+            }
+
+            if (config.nlive < 2 * (dim + 1))
+            {
+                throw InternalError("NestedSampler: the number of live points must be at least " + std::to_string(2 * (dim + 1)));
+            }
+
+            if ((config.bound != "none") && (config.bound != "single") && (config.bound != "multi"))
+            {
+                throw InternalError("NestedSampler: unknown bounding method '" + config.bound + "'");
+            }
+
+            if ((config.sample == "unif") || (config.sample == "auto" && dim < 10))
+            {
+                method = Method::unif;
+            }
+            else if ((config.sample == "rwalk") || (config.sample == "auto" && dim <= 20))
+            {
+                method = Method::rwalk;
+            }
+            else if ((config.sample == "rslice") || (config.sample == "auto"))
+            {
+                method = Method::rslice;
+            }
+            else
+            {
+                throw InternalError("NestedSampler: unknown sampling method '" + config.sample + "'");
+            }
+
+            batch_size = std::max(1u, std::min(batch_size, config.nlive - 1));
+
+            gsl_rng_set(rng, config.seed);
+
+            // one independent clone of the posterior per concurrent job
+            for (unsigned i = 0 ; i < batch_size ; ++i)
+            {
+                workers.push_back(Worker{ log_posterior.clone(), gsl_rng_alloc(gsl_rng_mt19937), Proposal() });
+            }
+        }
+
+        ~Implementation()
+        {
+            for (auto & w : workers)
+            {
+                gsl_rng_free(w.rng);
+            }
+
+            gsl_rng_free(rng);
+        }
+
+        // map the point u from the unit hypercube to the parameter space via the priors, and evaluate the log(likelihood)
+        double
+        log_likelihood(LogPosterior & log_posterior, const Point & u, Point & x) const
+        {
+            const auto & varied_parameters = log_posterior.varied_parameters();
+            for (unsigned i = 0 ; i < dim ; ++i)
+            {
+                Parameter p = varied_parameters[i];
+                p.set_generator(u[i]);
+            }
+
+            for (auto p = log_posterior.begin_priors(), p_end = log_posterior.end_priors() ; p != p_end ; ++p)
+            {
+                (*p)->sample();
+            }
+
+            x.resize(dim);
+            for (unsigned i = 0 ; i < dim ; ++i)
+            {
+                x[i] = varied_parameters[i].evaluate();
+            }
+
+            try
+            {
+                const double result = log_posterior.log_likelihood()();
+
+                return std::isnan(result) ? -std::numeric_limits<double>::infinity() : result;
+            }
+            catch (eos::Exception &)
+            {
+                return -std::numeric_limits<double>::infinity();
+            }
+        }
+
+        const Ellipsoid &
+        ellipsoid_for(const Point & u, gsl_rng * r) const
+        {
+            std::vector<unsigned> candidates;
+            for (unsigned i = 0 ; i < ellipsoids.size() ; ++i)
+            {
+                if (ellipsoids[i].contains(u))
+                {
+                    candidates.push_back(i);
+                }
+            }
+
+            if (candidates.empty())
+            {
+                return *std::min_element(ellipsoids.cbegin(), ellipsoids.cend(),
+                        [&u](const Ellipsoid & a, const Ellipsoid & b) { return a.distance2(u) < b.distance2(u); });
+            }
+
+            return ellipsoids[candidates[gsl_rng_uniform_int(r, candidates.size())]];
+        }
+
+        Point
+        sample_bound(gsl_rng * r) const
+        {
+            if (! bounded)
+            {
+                Point result(dim);
+                for (auto & v : result)
+                {
+                    v = gsl_rng_uniform(r);
+                }
+
+                return result;
+            }
+
+            // sample uniformly from the union of the ellipsoids
+            while (true)
+            {
+                const double w = gsl_rng_uniform(r);
+                const unsigned idx = std::upper_bound(cumulative_volume.cbegin(), cumulative_volume.cend() - 1, w) - cumulative_volume.cbegin();
+
+                Point result = ellipsoids[idx].sample(r);
+                if (! in_unit_cube(result))
+                {
+                    continue;
+                }
+
+                const unsigned overlap = std::count_if(ellipsoids.cbegin(), ellipsoids.cend(), [&result](const Ellipsoid & e) { return e.contains(result); });
+                if (gsl_rng_uniform(r) * overlap < 1.0)
+                {
+                    return result;
+                }
+            }
+        }
+
+        void
+        update_bounds()
+        {
+            std::vector<const Point *> points;
+            points.reserve(live.size());
+            for (const auto & l : live)
+            {
+                points.push_back(&l.u);
+            }
+
+            ellipsoids.clear();
+            Ellipsoid single = bounding_ellipsoid(points, dim, config.enlarge);
+            if (config.bound == "multi")
+            {
+                split_ellipsoid(points, single, config.enlarge, ellipsoids);
+            }
+            else
+            {
+                ellipsoids.push_back(single);
+            }
+
+            cumulative_volume.clear();
+            double sum = 0.0;
+            for (const auto & e : ellipsoids)
+            {
+                sum += std::exp(e.log_volume - ellipsoids.front().log_volume);
+                cumulative_volume.push_back(sum);
+            }
+            for (auto & c : cumulative_volume)
+            {
+                c /= sum;
+            }
+        }
+
+        void
+        propose_uniform(Worker & w, const double & logl_star) const
+        {
+            auto & p = w.proposal;
+            do
+            {
+                if (p.ncall > 1000000)
+                {
+                    throw InternalError("NestedSampler: unable to find a point above the likelihood threshold after 10^6 uniform proposals");
+                }
+
+                p.point.u = sample_bound(w.rng);
+                p.point.logl = log_likelihood(*w.log_posterior, p.point.u, p.point.x);
+                p.ncall += 1;
+            }
+            while (p.point.logl <= logl_star);
+        }
+
+        void
+        propose_random_walk(Worker & w, const double & logl_star) const
+        {
+            auto & p = w.proposal;
+            const Ellipsoid & e = ellipsoid_for(p.point.u, w.rng);
+
+            for (unsigned step = 0 ; (step < config.walks) || ((p.accept == 0) && (step < 10 * config.walks)) ; ++step)
+            {
+                Point u = e.direction(unit_ball(w.rng, dim));
+                for (unsigned i = 0 ; i < dim ; ++i)
+                {
+                    u[i] = p.point.u[i] + scale * u[i];
+                }
+
+                if (! in_unit_cube(u))
+                {
+                    p.reject += 1;
+                    continue;
+                }
+
+                Point x;
+                const double logl = log_likelihood(*w.log_posterior, u, x);
+                p.ncall += 1;
+
+                if (logl > logl_star)
+                {
+                    p.point.u = std::move(u);
+                    p.point.x = std::move(x);
+                    p.point.logl = logl;
+                    p.accept += 1;
+                }
+                else
+                {
+                    p.reject += 1;
+                }
+            }
+        }
+
+        void
+        propose_random_slice(Worker & w, const double & logl_star) const
+        {
+            auto & p = w.proposal;
+
+            for (unsigned slice = 0 ; slice < config.slices ; ++slice)
+            {
+                const Ellipsoid & e = ellipsoid_for(p.point.u, w.rng);
+                Point direction = e.direction(unit_sphere(w.rng, dim));
+                for (auto & d : direction)
+                {
+                    d *= scale;
+                }
+
+                auto point_at = [&](const double & t)
+                {
+                    Point result(dim);
+                    for (unsigned i = 0 ; i < dim ; ++i)
+                    {
+                        result[i] = p.point.u[i] + t * direction[i];
+                    }
+                    return result;
+                };
+                auto above_threshold = [&](const Point & u, Point & x, double & logl)
+                {
+                    if (! in_unit_cube(u))
+                    {
+                        return false;
+                    }
+
+                    logl = log_likelihood(*w.log_posterior, u, x);
+                    p.ncall += 1;
+
+                    return logl > logl_star;
+                };
+
+                Point x;
+                double logl;
+
+                // step out
+                const double r = gsl_rng_uniform(w.rng);
+                double t_left = -r, t_right = 1.0 - r;
+                while (above_threshold(point_at(t_left), x, logl))
+                {
+                    t_left -= 1.0;
+                    p.expand += 1;
+                }
+                while (above_threshold(point_at(t_right), x, logl))
+                {
+                    t_right += 1.0;
+                    p.expand += 1;
+                }
+
+                // shrink
+                while (true)
+                {
+                    if (p.contract > 10000)
+                    {
+                        throw InternalError("NestedSampler: slice sampling failed to find a point above the likelihood threshold");
+                    }
+
+                    const double t = t_left + gsl_rng_uniform(w.rng) * (t_right - t_left);
+                    Point u = point_at(t);
+                    if (above_threshold(u, x, logl))
+                    {
+                        p.point.u = std::move(u);
+                        p.point.x = std::move(x);
+                        p.point.logl = logl;
+                        break;
+                    }
+
+                    (t < 0.0 ? t_left : t_right) = t;
+                    p.contract += 1;
+                }
+            }
+        }
+
+        // runs on a worker thread; only reads the shared state
+        void
+        propose(Worker & w, const unsigned long & seed, const unsigned & start, const double & logl_star) const
+        {
+            gsl_rng_set(w.rng, seed);
+            w.proposal = Proposal();
+            w.proposal.point = live[start];
+
+            try
+            {
+                switch (method)
+                {
+                    case Method::unif:
+                        propose_uniform(w, logl_star);
+                        break;
+
+                    case Method::rwalk:
+                        propose_random_walk(w, logl_star);
+                        break;
+
+                    case Method::rslice:
+                        propose_random_slice(w, logl_star);
+                        break;
+                }
+            }
+            catch (eos::Exception & e)
+            {
+                w.proposal.error = e.what();
+            }
+        }
+
+        // runs on a worker thread; evaluates the initial live points assigned to this worker
+        void
+        initialize(Worker & w, const unsigned long & seed, const unsigned & first)
+        {
+            gsl_rng_set(w.rng, seed);
+
+            for (unsigned i = first ; i < live.size() ; i += batch_size)
+            {
+                auto & l = live[i];
+                for (unsigned attempt = 0 ; attempt < 100 ; ++attempt)
+                {
+                    l.logl = log_likelihood(*w.log_posterior, l.u, l.x);
+                    l.ncall += 1;
+
+                    if (std::isfinite(l.logl))
+                    {
+                        break;
+                    }
+
+                    for (auto & v : l.u)
+                    {
+                        v = gsl_rng_uniform(w.rng);
+                    }
+                }
+            }
+        }
+
+        struct State
+        {
+            double logvol = 0.0;
+            double loglstar = log_zero;
+            double logz = log_zero;
+            double h = 0.0;
+            double logzvar = 0.0;
+        };
+
+        // add a dead point with log(prior volume) logvol to the results, following dynesty's bookkeeping
+        void
+        add_sample(NestedSampler::Results & results, State & s, const LivePoint & l, const double & logvol) const
+        {
+            const double logl = std::max(l.logl, log_zero);
+            const double dlv = s.logvol - logvol;
+            const double logdvol = s.logvol + std::log(-0.5 * std::expm1(-dlv));
+            const double logwt = log_add_exp(logl, s.loglstar) + logdvol;
+            const double logz = log_add_exp(s.logz, logwt);
+            const double lzterm = std::exp(s.loglstar - logz + logdvol) * s.loglstar + std::exp(logl - logz + logdvol) * logl;
+            const double h = lzterm + std::exp(s.logz - logz) * (s.h + s.logz) - logz;
+
+            s.logzvar += 2.0 * (h - s.h) * dlv;
+            s.logvol = logvol;
+            s.loglstar = logl;
+            s.logz = logz;
+            s.h = h;
+
+            results.samples.push_back(l.x);
+            results.samples_u.push_back(l.u);
+            results.samples_id.push_back(l.id);
+            results.samples_it.push_back(l.it);
+            results.ncall.push_back(l.ncall);
+            results.logl.push_back(logl);
+            results.logvol.push_back(logvol);
+            results.logwt.push_back(logwt);
+            results.logz.push_back(logz);
+            results.logzerr.push_back(std::sqrt(std::max(s.logzvar, 0.0)));
+            results.information.push_back(h);
+        }
+
+        NestedSampler::Results
+        run()
+        {
+            const unsigned nlive = config.nlive;
+            auto thread_pool = ThreadPool::instance();
+
+            NestedSampler::Results results;
+            results.nlive = nlive;
+
+            // draw and evaluate the initial live points
+            live.assign(nlive, LivePoint{ Point(dim), Point(dim), 0.0, 0, 0, 0 });
+            for (unsigned i = 0 ; i < nlive ; ++i)
+            {
+                live[i].id = i;
+                for (auto & v : live[i].u)
+                {
+                    v = gsl_rng_uniform(rng);
+                }
+            }
+
+            {
+                std::vector<Ticket> tickets;
+                for (unsigned j = 0 ; j < batch_size ; ++j)
+                {
+                    const unsigned long seed = gsl_rng_get(rng);
+                    tickets.push_back(thread_pool->enqueue([this, j, seed]() { this->initialize(workers[j], seed, j); }));
+                }
+
+                for (auto & t : tickets)
+                {
+                    t.wait();
+                }
+            }
+
+            unsigned long total_ncall = 0;
+            for (const auto & l : live)
+            {
+                total_ncall += l.ncall;
+            }
+
+            update_bounds();
+
+            // the initial live points have been redrawn wherever the log(likelihood) is not finite;
+            // account for the excluded fraction of the prior volume
+            State s;
+            s.logvol = std::log(double(nlive) / total_ncall);
+            unsigned niter = 0;
+            unsigned since_update = 0;
+            unsigned next_report = nlive;
+
+            std::vector<unsigned> order(nlive);
+
+            while (true)
+            {
+                const double max_logl = std::max_element(live.cbegin(), live.cend(),
+                        [](const LivePoint & a, const LivePoint & b) { return a.logl < b.logl; })->logl;
+                const double dlogz_remaining = log_add_exp(s.logz, max_logl + s.logvol) - s.logz;
+
+                if (dlogz_remaining < config.dlogz)
+                {
+                    break;
+                }
+
+                if ((config.maxiter > 0) && (niter >= config.maxiter))
+                {
+                    break;
+                }
+
+                unsigned k = batch_size;
+                if (config.maxiter > 0)
+                {
+                    k = std::min(k, config.maxiter - niter);
+                }
+
+                // remove the k worst live points at once
+                std::iota(order.begin(), order.end(), 0);
+                std::stable_sort(order.begin(), order.end(), [this](const unsigned & a, const unsigned & b) { return live[a].logl < live[b].logl; });
+
+                for (unsigned j = 0 ; j < k ; ++j)
+                {
+                    add_sample(results, s, live[order[j]], s.logvol - 1.0 / (nlive - j));
+                }
+
+                const double logl_star = live[order[k - 1]].logl;
+
+                // replace them concurrently, starting from randomly chosen surviving live points
+                std::vector<Ticket> tickets;
+                for (unsigned j = 0 ; j < k ; ++j)
+                {
+                    const unsigned start = order[k + gsl_rng_uniform_int(rng, nlive - k)];
+                    const unsigned long seed = gsl_rng_get(rng);
+                    tickets.push_back(thread_pool->enqueue([this, j, seed, start, logl_star]() { this->propose(workers[j], seed, start, logl_star); }));
+                }
+
+                for (auto & t : tickets)
+                {
+                    t.wait();
+                }
+
+                unsigned accept = 0, reject = 0, expand = 0, contract = 0;
+                for (unsigned j = 0 ; j < k ; ++j)
+                {
+                    const auto & p = workers[j].proposal;
+                    if (! p.error.empty())
+                    {
+                        throw InternalError(p.error);
+                    }
+
+                    auto & l = live[order[j]];
+                    const unsigned id = l.id;
+                    l = p.point;
+                    l.id = id;
+                    l.ncall = p.ncall;
+                    l.it = niter + j + 1;
+
+                    total_ncall += p.ncall;
+                    accept += p.accept;
+                    reject += p.reject;
+                    expand += p.expand;
+                    contract += p.contract;
+                }
+
+                // adapt the proposal scale
+                if (Method::rwalk == method)
+                {
+                    const double acceptance = double(accept) / std::max(accept + reject, 1u);
+                    scale *= std::exp((acceptance - 0.5) / dim / 0.5);
+                }
+                else if (Method::rslice == method)
+                {
+                    scale *= 2.0 * std::max(expand, 1u) / (std::max(expand, 1u) + contract);
+                }
+
+                niter += k;
+                since_update += k;
+
+                if (since_update >= update_interval)
+                {
+                    bounded = (config.bound != "none") && (niter >= nlive);
+                    update_bounds();
+                    since_update = 0;
+                }
+
+                if (niter >= next_report)
+                {
+                    Log::instance()->message("NestedSampler::run", ll_informational)
+                        << "iteration " << niter << " | ncall " << total_ncall << " | eff " << 100.0 * niter / total_ncall << "%"
+                        << " | logz " << s.logz << " +/- " << std::sqrt(std::max(s.logzvar, 0.0)) << " | dlogz " << dlogz_remaining << " > " << config.dlogz;
+                    next_report += nlive;
+                }
+            }
+
+            // add the remaining live points, distributing the remaining prior volume uniformly
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(), [this](const unsigned & a, const unsigned & b) { return live[a].logl < live[b].logl; });
+
+            const double logvol = s.logvol;
+            for (unsigned i = 0 ; i < nlive ; ++i)
+            {
+                add_sample(results, s, live[order[i]], logvol + std::log1p(-(i + 1.0) / (nlive + 1.0)));
+            }
+
+            results.niter = results.samples.size();
+            results.eff = 100.0 * results.samples.size() / total_ncall;
+
+            Log::instance()->message("NestedSampler::run", ll_informational)
+                << "finished after " << niter << " iterations and " << total_ncall << " likelihood calls with logz = " << s.logz << " +/- " << std::sqrt(std::max(s.logzvar, 0.0));
+
+            return results;
+        }
+    };
+
+    NestedSampler::NestedSampler(const LogPosterior & log_posterior, const NestedSampler::Config & config) :
+        PrivateImplementationPattern<NestedSampler>(new Implementation<NestedSampler>(log_posterior, config))
+    {
+    }
+
+    NestedSampler::~NestedSampler()
+    {
+    }
+
+    NestedSampler::Results
+    NestedSampler::run()
+    {
+        return _imp->run();
+    }
+}
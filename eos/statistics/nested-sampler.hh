@@ -0,0 +1,122 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2024 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_NESTED_SAMPLER_HH
+#define EOS_GUARD_EOS_STATISTICS_NESTED_SAMPLER_HH 1
+
+#include <eos/statistics/log-posterior.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * Static nested sampling of the log(likelihood) in the unit hypercube of the prior's generator values.
+     *
+     * In each iteration, the batch_size worst live points are removed at once and
+     * their replacements are drawn concurrently on the ThreadPool. Each concurrent
+     * job uses its own clone of the LogPosterior and its own random number generator,
+     * which is seeded from a master generator. Results are therefore reproducible
+     * for a fixed seed and batch size, independent of the number of threads.
+     */
+    class NestedSampler :
+        public PrivateImplementationPattern<NestedSampler>
+    {
+        public:
+            struct Config
+            {
+                /// Number of live points.
+                unsigned nlive = 250;
+
+                /// Stop once the estimated remaining contribution to log(Z) falls below this value.
+                double dlogz = 1.0;
+
+                /// Maximal number of iterations; 0 means unlimited.
+                unsigned maxiter = 0;
+
+                /// Seed for the master random number generator.
+                unsigned long seed = 10;
+
+                /// Bounding method, one of 'none', 'single', or 'multi'.
+                std::string bound = "multi";
+
+                /// Method to propose new points, one of 'unif', 'rwalk', 'rslice', or 'auto' to select by dimension.
+                std::string sample = "auto";
+
+                /// Minimal number of steps of the random walk.
+                unsigned walks = 25;
+
+                /// Number of slices per proposal for the random slice sampler.
+                unsigned slices = 5;
+
+                /// Number of live points replaced per iteration; 0 selects the number of threads.
+                unsigned batch_size = 0;
+
+                /// Factor by which the volume of each bounding ellipsoid is enlarged.
+                double enlarge = 1.25;
+
+                /// Number of replaced live points between updates of the bounds; 0 selects nlive / 4.
+                unsigned update_interval = 0;
+            };
+
+            /// Results in the format of dynesty's Results class.
+            struct Results
+            {
+                /// Dead points, followed by the final live points, both in parameter space and in the unit hypercube.
+                std::vector<std::vector<double>> samples, samples_u;
+
+                /// Per sample: log(likelihood), log(prior volume), log(weight), and running estimates of log(Z), its uncertainty, and the information.
+                std::vector<double> logl, logvol, logwt, logz, logzerr, information;
+
+                /// Per sample: index of the live point slot, iteration in which it was proposed, and number of likelihood calls needed.
+                std::vector<unsigned> samples_id, samples_it, ncall;
+
+                /// Number of live points.
+                unsigned nlive;
+
+                /// Number of iterations, counting the final live points as in dynesty.
+                unsigned niter;
+
+                /// Overall sampling efficiency in percent.
+                double eff;
+            };
+
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param log_posterior  The LogPosterior whose likelihood shall be sampled. The priors define the mapping
+             *                       from the unit hypercube to the parameter space.
+             * @param config         The configuration of the sampler.
+             */
+            NestedSampler(const LogPosterior & log_posterior, const Config & config);
+
+            /// Destructor.
+            ~NestedSampler();
+            ///@}
+
+            /// Run the sampler until the termination criterion is met.
+            Results run();
+    };
+}
+
+#endif
@@ -0,0 +1,81 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2024 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <config.h>
+
+#include <eos/statistics/log-posterior_TEST.hh>
+#include <eos/statistics/nested-sampler.hh>
+
+#include <cmath>
+
+using namespace test;
+using namespace eos;
+
+class NestedSamplerTest :
+    public TestCase
+{
+    public:
+        NestedSamplerTest() :
+            TestCase("nested_sampler_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // Gaussian likelihood with a flat prior on [3.7, 4.9]; the evidence is 1 / 1.2 up to negligible tails
+            const double logz = -std::log(1.2);
+
+            for (const std::string sample : { "unif", "rwalk", "rslice" })
+            {
+                LogPosterior log_posterior = make_log_posterior(true);
+
+                NestedSampler::Config config;
+                config.nlive      = 200;
+                config.dlogz      = 0.1;
+                config.sample     = sample;
+                config.batch_size = 4;
+
+                NestedSampler::Results results = NestedSampler(log_posterior, config).run();
+
+                TEST_CHECK_EQUAL(results.samples.size(), results.niter);
+                TEST_CHECK_EQUAL(results.logwt.size(),   results.niter);
+                TEST_CHECK_NEARLY_EQUAL(results.logz.back(), logz, 3.0 * results.logzerr.back());
+
+                // all samples lie within the prior's support
+                for (const auto & s : results.samples)
+                {
+                    TEST_CHECK(3.7 <= s[0]);
+                    TEST_CHECK(s[0] <= 4.9);
+                }
+
+                // the weighted mean recovers the likelihood's mode
+                double mean = 0.0;
+                for (unsigned i = 0 ; i < results.niter ; ++i)
+                {
+                    mean += results.samples[i][0] * std::exp(results.logwt[i] - results.logz.back());
+                }
+                TEST_CHECK_NEARLY_EQUAL(mean, 4.2, 0.02);
+
+                // results are reproducible for a fixed seed and batch size
+                NestedSampler::Results repeated = NestedSampler(log_posterior, config).run();
+                TEST_CHECK_EQUAL(repeated.niter,       results.niter);
+                TEST_CHECK_EQUAL(repeated.logz.back(), results.logz.back());
+            }
+        }
+} nested_sampler_test;
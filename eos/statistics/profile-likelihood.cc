@@ -0,0 +1,425 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2025 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/profile-likelihood.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_multimin.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <set>
+
+namespace eos
+{
+    namespace
+    {
+        // Each worker uses its own clone of the log(posterior).
+        struct ProfileWorker
+        {
+            LogPosteriorPtr log_posterior;
+
+            LogLikelihood log_likelihood;
+
+            std::vector<Parameter> parameters;
+
+            std::vector<Parameter> nuisance_parameters;
+
+            // priors that involve at least one nuisance parameter
+            std::vector<LogPriorPtr> priors;
+
+            std::string error;
+
+            ProfileWorker(const LogPosterior & original, const std::vector<QualifiedName> & names) :
+                log_posterior(original.clone()),
+                log_likelihood(log_posterior->log_likelihood())
+            {
+                std::set<std::string> interesting;
+                for (const auto & n : names)
+                {
+                    parameters.push_back(log_posterior->parameters()[n]);
+                    interesting.insert(parameters.back().name());
+                }
+
+                for (auto p = log_posterior->begin_priors(), p_end = log_posterior->end_priors() ; p != p_end ; ++p)
+                {
+                    unsigned n_interesting = 0, n_nuisance = 0;
+                    for (auto q = (*p)->begin(), q_end = (*p)->end() ; q != q_end ; ++q)
+                    {
+                        if (interesting.contains(q->name()))
+                        {
+                            ++n_interesting;
+                        }
+                        else
+                        {
+                            nuisance_parameters.push_back(*q);
+                            ++n_nuisance;
+                        }
+                    }
+
+                    if ((n_interesting > 0) && (n_nuisance > 0))
+                    {
+                        throw InternalError("ProfileLikelihood: the prior '" + (*p)->as_string() + "' involves both parameters of interest and nuisance parameters");
+                    }
+
+                    if (n_nuisance > 0)
+                    {
+                        priors.push_back(*p);
+                    }
+                }
+            }
+
+            // set the nuisance parameters from unbounded variables y, via their generator values u = (1 + sin y) / 2
+            void
+            set(const double * y)
+            {
+                for (unsigned i = 0 ; i < nuisance_parameters.size() ; ++i)
+                {
+                    const double u = std::clamp(0.5 * (1.0 + std::sin(y[i])), 1.0e-12, 1.0 - 1.0e-12);
+                    nuisance_parameters[i].set_generator(u);
+                }
+
+                for (auto & p : priors)
+                {
+                    p->sample();
+                }
+            }
+
+            // the inverse of set()
+            void
+            get(double * y)
+            {
+                for (auto & p : priors)
+                {
+                    p->compute_cdf();
+                }
+
+                for (unsigned i = 0 ; i < nuisance_parameters.size() ; ++i)
+                {
+                    const double u = nuisance_parameters[i].evaluate_generator();
+                    y[i] = std::asin(std::clamp(2.0 * u - 1.0, -1.0, 1.0));
+                }
+            }
+
+            double
+            evaluate() const
+            {
+                double result = log_likelihood();
+                for (const auto & p : priors)
+                {
+                    result += (*p)();
+                }
+
+                return result;
+            }
+
+            static double
+            negative_log_posterior(const gsl_vector * y, void * data)
+            {
+                ProfileWorker * w = static_cast<ProfileWorker *>(data);
+
+                // no exceptions must pass through the GSL's C code
+                try
+                {
+                    w->set(y->data);
+                    const double result = -w->evaluate();
+
+                    return std::isfinite(result) ? result : std::numeric_limits<double>::max();
+                }
+                catch (Exception & e)
+                {
+                    if (w->error.empty())
+                    {
+                        w->error = e.what();
+                    }
+
+                    return std::numeric_limits<double>::max();
+                }
+            }
+
+            // maximise with respect to the nuisance parameters, starting from y; returns the number of iterations
+            unsigned
+            maximise(std::vector<double> & y, double & value, const ProfileLikelihood::Config & config)
+            {
+                const unsigned n = nuisance_parameters.size();
+
+                if (0 == n)
+                {
+                    value = evaluate();
+                    return 0;
+                }
+
+                gsl_multimin_function f{ &ProfileWorker::negative_log_posterior, n, this };
+
+                gsl_vector * x = gsl_vector_alloc(n);
+                gsl_vector * steps = gsl_vector_alloc(n);
+                gsl_multimin_fminimizer * minimizer = gsl_multimin_fminimizer_alloc(gsl_multimin_fminimizer_nmsimplex2, n);
+
+                unsigned iterations = 0;
+                for (unsigned r = 0 ; (r <= config.restarts) && error.empty() ; ++r)
+                {
+                    for (unsigned i = 0 ; i < n ; ++i)
+                    {
+                        gsl_vector_set(x, i, y[i]);
+                        gsl_vector_set(steps, i, config.step_size);
+                    }
+
+                    gsl_multimin_fminimizer_set(minimizer, &f, x, steps);
+
+                    int status = GSL_CONTINUE;
+                    while ((GSL_CONTINUE == status) && (iterations < config.max_iterations) && error.empty())
+                    {
+                        ++iterations;
+                        if (GSL_SUCCESS != gsl_multimin_fminimizer_iterate(minimizer))
+                            break;
+
+                        status = gsl_multimin_test_size(gsl_multimin_fminimizer_size(minimizer), config.tolerance);
+                    }
+
+                    const gsl_vector * solution = gsl_multimin_fminimizer_x(minimizer);
+                    for (unsigned i = 0 ; i < n ; ++i)
+                    {
+                        y[i] = gsl_vector_get(solution, i);
+                    }
+                }
+
+                gsl_multimin_fminimizer_free(minimizer);
+                gsl_vector_free(steps);
+                gsl_vector_free(x);
+
+                // leave the parameters at the solution
+                set(y.data());
+                value = evaluate();
+
+                return iterations;
+            }
+        };
+    }
+
+    template <> struct Implementation<ProfileLikelihood>
+    {
+        LogPosterior log_posterior;
+
+        std::vector<QualifiedName> parameters;
+
+        Implementation(const LogPosterior & log_posterior, const std::vector<QualifiedName> & parameters) :
+            log_posterior(log_posterior),
+            parameters(parameters)
+        {
+            if (parameters.empty())
+            {
+                throw InternalError("ProfileLikelihood: at least one parameter of interest is required");
+            }
+        }
+
+        // the flat indices of the grid points in boustrophedon order
+        static std::vector<std::size_t>
+        traversal(const std::vector<std::size_t> & sizes, const std::size_t & n_points)
+        {
+            std::vector<std::size_t> result(n_points);
+            std::vector<std::size_t> digits(sizes.size());
+            for (std::size_t t = 0 ; t < n_points ; ++t)
+            {
+                std::size_t q = t;
+                for (unsigned d = sizes.size() ; d > 0 ; --d)
+                {
+                    digits[d - 1] = q % sizes[d - 1];
+                    q /= sizes[d - 1];
+                }
+
+                // reverse a digit whenever the sum of the preceding (reversed) digits is odd
+                std::size_t sum = 0, index = 0;
+                for (unsigned d = 0 ; d < sizes.size() ; ++d)
+                {
+                    const std::size_t digit = (sum % 2 == 1) ? sizes[d] - 1 - digits[d] : digits[d];
+                    sum  += digit;
+                    index = index * sizes[d] + digit;
+                }
+
+                result[t] = index;
+            }
+
+            return result;
+        }
+
+        ProfileLikelihood::Results
+        profile(const std::vector<std::vector<double>> & values, const ProfileLikelihood::Config & config) const
+        {
+            if (values.size() != parameters.size())
+            {
+                throw InternalError("ProfileLikelihood: expected values for " + std::to_string(parameters.size()) + " parameters of interest, got " + std::to_string(values.size()));
+            }
+
+            if (0 == config.chunk_size)
+            {
+                throw InternalError("ProfileLikelihood: the chunk size must be positive");
+            }
+
+            std::vector<std::size_t> sizes;
+            std::size_t n_points = 1;
+            for (const auto & v : values)
+            {
+                if (v.empty())
+                {
+                    throw InternalError("ProfileLikelihood: each parameter of interest requires at least one value");
+                }
+
+                sizes.push_back(v.size());
+                n_points *= v.size();
+            }
+
+            auto thread_pool = ThreadPool::instance();
+            const unsigned n_workers = ThreadPool::is_worker_thread() ? 1u : std::max(1u, thread_pool->number_of_threads());
+
+            std::vector<ProfileWorker> workers;
+            for (unsigned j = 0 ; j < n_workers ; ++j)
+            {
+                workers.emplace_back(log_posterior, parameters);
+            }
+
+            const unsigned n_nuisance = workers.front().nuisance_parameters.size();
+
+            ProfileLikelihood::Results results;
+            for (const auto & p : workers.front().parameters)
+            {
+                results.parameters.push_back(p.name());
+            }
+
+            for (const auto & p : workers.front().nuisance_parameters)
+            {
+                results.nuisance_parameters.push_back(p.name());
+            }
+
+            results.points.resize(n_points, std::vector<double>(parameters.size()));
+            results.log_posterior.resize(n_points);
+            results.nuisance_values.resize(n_points, std::vector<double>(n_nuisance));
+            results.iterations.resize(n_points);
+
+            for (std::size_t k = 0 ; k < n_points ; ++k)
+            {
+                std::size_t q = k;
+                for (unsigned d = parameters.size() ; d > 0 ; --d)
+                {
+                    results.points[k][d - 1] = values[d - 1][q % sizes[d - 1]];
+                    q /= sizes[d - 1];
+                }
+            }
+
+            // all chunks start from the current values of the nuisance parameters
+            std::vector<double> start(n_nuisance);
+            workers.front().get(start.data());
+
+            const std::vector<std::size_t> order = traversal(sizes, n_points);
+            const std::size_t n_chunks = (n_points + config.chunk_size - 1) / config.chunk_size;
+
+            Log::instance()->message("ProfileLikelihood::profile", ll_informational)
+                << "Profiling " << n_points << " points in " << parameters.size() << " parameter(s) of interest with respect to "
+                << n_nuisance << " nuisance parameter(s), using " << n_chunks << " chunk(s)";
+
+            auto work = [&](const unsigned & j)
+            {
+                auto & w = workers[j];
+                for (std::size_t c = j ; (c < n_chunks) && w.error.empty() ; c += workers.size())
+                {
+                    std::vector<double> y(start);
+                    for (std::size_t t = c * config.chunk_size, t_end = std::min(n_points, (c + 1) * config.chunk_size) ; t < t_end ; ++t)
+                    {
+                        const std::size_t k = order[t];
+                        for (unsigned d = 0 ; d < parameters.size() ; ++d)
+                        {
+                            w.parameters[d] = results.points[k][d];
+                        }
+
+                        try
+                        {
+                            results.iterations[k] = w.maximise(y, results.log_posterior[k], config);
+                        }
+                        catch (Exception & e)
+                        {
+                            w.error = e.what();
+                        }
+
+                        if (! w.error.empty())
+                            break;
+
+                        for (unsigned i = 0 ; i < n_nuisance ; ++i)
+                        {
+                            results.nuisance_values[k][i] = w.nuisance_parameters[i]();
+                        }
+                    }
+                }
+            };
+
+            if (1 == workers.size())
+            {
+                work(0);
+            }
+            else
+            {
+                std::vector<Ticket> tickets;
+                for (unsigned j = 0 ; j < workers.size() ; ++j)
+                {
+                    tickets.push_back(thread_pool->enqueue([&work, j]() { work(j); }));
+                }
+
+                for (auto & t : tickets)
+                {
+                    t.wait();
+                }
+            }
+
+            for (const auto & w : workers)
+            {
+                if (! w.error.empty())
+                {
+                    throw InternalError("ProfileLikelihood: " + w.error);
+                }
+            }
+
+            const unsigned unconverged = std::count(results.iterations.cbegin(), results.iterations.cend(), config.max_iterations);
+            if ((n_nuisance > 0) && (unconverged > 0))
+            {
+                Log::instance()->message("ProfileLikelihood::profile", ll_warning)
+                    << "The minimisation did not converge within " << config.max_iterations << " iterations for " << unconverged << " point(s)";
+            }
+
+            return results;
+        }
+    };
+
+    ProfileLikelihood::ProfileLikelihood(const LogPosterior & log_posterior, const std::vector<QualifiedName> & parameters) :
+        PrivateImplementationPattern<ProfileLikelihood>(new Implementation<ProfileLikelihood>(log_posterior, parameters))
+    {
+    }
+
+    ProfileLikelihood::~ProfileLikelihood()
+    {
+    }
+
+    ProfileLikelihood::Results
+    ProfileLikelihood::profile(const std::vector<std::vector<double>> & values, const Config & config) const
+    {
+        return _imp->profile(values, config);
+    }
+}
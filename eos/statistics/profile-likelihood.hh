@@ -0,0 +1,110 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2025 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_PROFILE_LIKELIHOOD_HH
+#define EOS_GUARD_EOS_STATISTICS_PROFILE_LIKELIHOOD_HH 1
+
+#include <eos/statistics/log-posterior.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+#include <eos/utils/qualified-name.hh>
+
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * Profile of the log(posterior) in one or more parameters of interest.
+     *
+     * For each point of a Cartesian grid in the parameters of interest, the log(likelihood)
+     * plus the log(priors) of the nuisance parameters is maximised with respect to all other
+     * varied parameters. Priors that only involve parameters of interest are not included.
+     *
+     * The grid is traversed in boustrophedon order, so that consecutive points are neighbours.
+     * This order is split into chunks, which are processed concurrently on the ThreadPool, using
+     * one clone of the LogPosterior per thread. Within a chunk, each minimisation starts from the
+     * solution at the previous point; the first point of each chunk starts from the current values
+     * of the nuisance parameters. Results are therefore independent of the number of threads.
+     */
+    class ProfileLikelihood :
+        public PrivateImplementationPattern<ProfileLikelihood>
+    {
+        public:
+            struct Config
+            {
+                /// Number of consecutive grid points that are processed in sequence, using warm starts.
+                unsigned chunk_size = 16;
+
+                /// Maximal number of iterations of the minimiser per grid point.
+                unsigned max_iterations = 10000;
+
+                /// Stop once the size of the simplex falls below this value.
+                double tolerance = 1.0e-8;
+
+                /// Initial step size of the minimiser, in units of the transformed nuisance parameters.
+                double step_size = 0.1;
+
+                /// Number of times the minimiser is restarted from its solution at each grid point.
+                unsigned restarts = 1;
+            };
+
+            struct Results
+            {
+                /// Names of the parameters of interest and of the nuisance parameters.
+                std::vector<std::string> parameters, nuisance_parameters;
+
+                /// Values of the parameters of interest, one row per grid point in row-major order.
+                std::vector<std::vector<double>> points;
+
+                /// Maximal value of the log(posterior) with respect to the nuisance parameters, per grid point.
+                std::vector<double> log_posterior;
+
+                /// Values of the nuisance parameters at the maximum, one row per grid point.
+                std::vector<std::vector<double>> nuisance_values;
+
+                /// Number of iterations of the minimiser, per grid point.
+                std::vector<unsigned> iterations;
+            };
+
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param log_posterior  The LogPosterior whose profile shall be computed. All of its varied parameters
+             *                       that are not parameters of interest are treated as nuisance parameters.
+             * @param parameters     The names of the parameters of interest.
+             */
+            ProfileLikelihood(const LogPosterior & log_posterior, const std::vector<QualifiedName> & parameters);
+
+            /// Destructor.
+            ~ProfileLikelihood();
+            ///@}
+
+            /*!
+             * Compute the profile on a Cartesian grid.
+             *
+             * @param values  The values of each parameter of interest; the grid is their Cartesian product.
+             * @param config  The configuration of the minimisations.
+             */
+            Results profile(const std::vector<std::vector<double>> & values, const Config & config) const;
+    };
+}
+
+#endif
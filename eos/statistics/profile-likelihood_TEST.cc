@@ -0,0 +1,124 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2025 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/statistics/profile-likelihood.hh>
+#include <eos/statistics/log-posterior_TEST.hh>
+
+#include <array>
+#include <cmath>
+
+using namespace test;
+using namespace eos;
+
+class ProfileLikelihoodTest :
+    public TestCase
+{
+    public:
+        ProfileLikelihoodTest() :
+            TestCase("profile_likelihood_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // correlated Gaussian likelihood in x = mass::b(MSbar) and y = mass::c, with
+            // sigma_x = 0.1, sigma_y = 0.05, and correlation 0.5
+            Parameters parameters = Parameters::Defaults();
+            LogLikelihood llh(parameters);
+            llh.add(LogLikelihoodBlock::MultivariateGaussian(llh.observable_cache(),
+                    std::array<ObservablePtr, 2>{ ObservablePtr(new ObservableStub(parameters, "mass::b(MSbar)")), ObservablePtr(new ObservableStub(parameters, "mass::c")) },
+                    std::array<double, 2>{ 4.2, 1.3 },
+                    std::array<std::array<double, 2>, 2>{ std::array<double, 2>{ 0.01, 0.0025 }, std::array<double, 2>{ 0.0025, 0.0025 } }));
+
+            LogPosterior log_posterior(llh);
+            log_posterior.add(LogPrior::Flat(parameters, "mass::b(MSbar)", 3.7, 4.7));
+            log_posterior.add(LogPrior::Flat(parameters, "mass::c", 1.0, 1.6));
+
+            parameters["mass::b(MSbar)"] = 4.2;
+            parameters["mass::c"] = 1.5;
+
+            const std::vector<double> xs{ 4.0, 4.05, 4.1, 4.15, 4.2, 4.25, 4.3, 4.35, 4.4 };
+
+            // profile in x: the nuisance parameter y follows the conditional mean
+            {
+                ProfileLikelihood profile(log_posterior, { "mass::b(MSbar)" });
+                ProfileLikelihood::Config config;
+                config.chunk_size = 4;
+
+                const auto results = profile.profile({ xs }, config);
+
+                TEST_CHECK_EQUAL(results.parameters.size(), 1u);
+                TEST_CHECK_EQUAL(results.parameters[0], "mass::b(MSbar)");
+                TEST_CHECK_EQUAL(results.nuisance_parameters.size(), 1u);
+                TEST_CHECK_EQUAL(results.nuisance_parameters[0], "mass::c");
+                TEST_CHECK_EQUAL(results.points.size(), xs.size());
+
+                for (unsigned k = 0 ; k < xs.size() ; ++k)
+                {
+                    TEST_CHECK_EQUAL(results.points[k][0], xs[k]);
+                    TEST_CHECK_NEARLY_EQUAL(results.nuisance_values[k][0], 1.3 + 0.25 * (xs[k] - 4.2), 1e-5);
+                    TEST_CHECK_NEARLY_EQUAL(results.log_posterior[k] - results.log_posterior[4], -0.5 * std::pow(xs[k] - 4.2, 2) / 0.01, 1e-6);
+                    TEST_CHECK(results.iterations[k] < config.max_iterations);
+                }
+
+                // the results do not depend on the chunking beyond the tolerance of the minimiser
+                config.chunk_size = 1;
+                const auto cold = profile.profile({ xs }, config);
+                for (unsigned k = 0 ; k < xs.size() ; ++k)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(cold.log_posterior[k], results.log_posterior[k], 1e-8);
+                }
+
+                // the original parameters are not modified
+                TEST_CHECK_EQUAL(parameters["mass::b(MSbar)"](), 4.2);
+                TEST_CHECK_EQUAL(parameters["mass::c"](), 1.5);
+            }
+
+            // profile in both x and y: no nuisance parameters remain
+            {
+                const std::vector<double> ys{ 1.2, 1.3, 1.4 };
+
+                ProfileLikelihood profile(log_posterior, { "mass::b(MSbar)", "mass::c" });
+                const auto results = profile.profile({ xs, ys }, ProfileLikelihood::Config());
+
+                TEST_CHECK_EQUAL(results.nuisance_parameters.size(), 0u);
+                TEST_CHECK_EQUAL(results.points.size(), xs.size() * ys.size());
+
+                for (unsigned i = 0 ; i < xs.size() ; ++i)
+                {
+                    for (unsigned j = 0 ; j < ys.size() ; ++j)
+                    {
+                        const unsigned k = i * ys.size() + j;
+                        TEST_CHECK_EQUAL(results.points[k][0], xs[i]);
+                        TEST_CHECK_EQUAL(results.points[k][1], ys[j]);
+                        TEST_CHECK_EQUAL(results.iterations[k], 0u);
+
+                        parameters["mass::b(MSbar)"] = xs[i];
+                        parameters["mass::c"] = ys[j];
+                        TEST_CHECK_NEARLY_EQUAL(results.log_posterior[k], llh(), 1e-10);
+                    }
+                }
+
+                TEST_CHECK_THROWS(InternalError, profile.profile({ xs }, ProfileLikelihood::Config()));
+            }
+
+            TEST_CHECK_THROWS(InternalError, ProfileLikelihood(log_posterior, { }));
+        }
+} profile_likelihood_test;
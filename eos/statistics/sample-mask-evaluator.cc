@@ -0,0 +1,353 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2025 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/sample-mask-evaluator.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/observable_cache.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace eos
+{
+    namespace
+    {
+        struct Component
+        {
+            // either an observable, identified by its id within the cache ...
+            bool is_mask;
+            ObservableCache::Id id;
+            ObservablePtr observable;
+
+            // ... or a mask
+            std::vector<unsigned> components;
+            SampleMaskEvaluator::Combination combination;
+        };
+
+        // Each worker uses its own clones of the parameters and the observables.
+        struct MaskWorker
+        {
+            Parameters parameters;
+
+            ObservableCache cache;
+
+            std::vector<Parameter> varied_parameters;
+
+            // observables outside of the cache, used to determine which observables fail for a sample
+            std::vector<ObservablePtr> observables;
+
+            std::vector<char> values;
+
+            std::size_t failures;
+
+            std::string error;
+
+            MaskWorker(const ObservableCache & original, const std::vector<QualifiedName> & names, const std::vector<Component> & components) :
+                parameters(original.parameters().clone()),
+                cache(original.clone(parameters)),
+                values(components.size(), false),
+                failures(0)
+            {
+                for (const auto & n : names)
+                {
+                    varied_parameters.push_back(parameters[n]);
+                }
+
+                for (const auto & c : components)
+                {
+                    observables.push_back(c.is_mask ? ObservablePtr() : c.observable->clone(parameters));
+                }
+            }
+
+            void evaluate(const double * sample, const std::vector<Component> & components)
+            {
+                for (unsigned i = 0 ; i < varied_parameters.size() ; ++i)
+                {
+                    varied_parameters[i] = sample[i];
+                }
+
+                // the cache reports observables that throw as NaN, rather than throwing itself
+                bool failed = false, non_finite = false;
+                try
+                {
+                    cache.update();
+
+                    for (const auto & component : components)
+                    {
+                        if ((! component.is_mask) && (! std::isfinite(cache[component.id])))
+                        {
+                            non_finite = true;
+                            break;
+                        }
+                    }
+                }
+                catch (Exception &)
+                {
+                    failed = true;
+                }
+
+                if (failed || non_finite)
+                {
+                    ++failures;
+                }
+
+                for (unsigned c = 0 ; c < components.size() ; ++c)
+                {
+                    const auto & component = components[c];
+
+                    if (component.is_mask)
+                    {
+                        bool value = (SampleMaskEvaluator::Combination::conjunction == component.combination);
+                        for (const auto & i : component.components)
+                        {
+                            value = (SampleMaskEvaluator::Combination::conjunction == component.combination) ? (value && values[i]) : (value || values[i]);
+                        }
+
+                        values[c] = value;
+                    }
+                    else if (! failed)
+                    {
+                        const double value = cache[component.id];
+                        values[c] = std::isfinite(value) && (value > 0.0);
+                    }
+                    else
+                    {
+                        // evaluate each observable on its own, so that only the failing ones fail the sample
+                        try
+                        {
+                            const double value = observables[c]->evaluate();
+                            values[c] = std::isfinite(value) && (value > 0.0);
+                        }
+                        catch (Exception &)
+                        {
+                            values[c] = false;
+                        }
+                    }
+                }
+            }
+        };
+    }
+
+    template <>
+    struct Implementation<SampleMaskEvaluator>
+    {
+        Parameters parameters;
+
+        std::vector<QualifiedName> names;
+
+        ObservableCache cache;
+
+        std::vector<Component> components;
+
+        // indices of the components that are masks
+        std::vector<unsigned> masks;
+
+        Implementation(const Parameters & parameters, const std::vector<QualifiedName> & names) :
+            parameters(parameters),
+            names(names),
+            cache(parameters)
+        {
+            if (names.empty())
+            {
+                throw InternalError("SampleMaskEvaluator: at least one parameter is required");
+            }
+
+            for (const auto & n : names)
+            {
+                // throws for unknown parameters
+                parameters[n];
+            }
+        }
+
+        unsigned add_observable(const ObservablePtr & observable)
+        {
+            if (! observable)
+            {
+                throw InternalError("SampleMaskEvaluator: observable must not be a null pointer");
+            }
+
+            Component c;
+            c.is_mask     = false;
+            c.id          = cache.add(observable);
+            c.observable  = observable;
+            c.combination = SampleMaskEvaluator::Combination::conjunction;
+            components.push_back(c);
+
+            return components.size() - 1;
+        }
+
+        unsigned add_mask(const std::vector<unsigned> & indices, const SampleMaskEvaluator::Combination & combination)
+        {
+            if (indices.empty())
+            {
+                throw InternalError("SampleMaskEvaluator: a mask requires at least one component");
+            }
+
+            for (const auto & i : indices)
+            {
+                if (i >= components.size())
+                {
+                    throw InternalError("SampleMaskEvaluator: mask refers to the unknown component " + std::to_string(i));
+                }
+            }
+
+            Component c;
+            c.is_mask     = true;
+            c.id          = 0;
+            c.components  = indices;
+            c.combination = combination;
+            components.push_back(c);
+            masks.push_back(components.size() - 1);
+
+            return components.size() - 1;
+        }
+
+        SampleMaskEvaluator::Results evaluate(std::span<const double> samples) const
+        {
+            if (0 != samples.size() % names.size())
+            {
+                throw InternalError("SampleMaskEvaluator: the size of the samples must be a multiple of the number of parameters");
+            }
+
+            SampleMaskEvaluator::Results results;
+            results.samples  = samples.size() / names.size();
+            results.masks    = std::vector<unsigned char>(masks.size() * results.samples, 0);
+            results.failures = 0;
+
+            if (masks.empty() || (0 == results.samples))
+            {
+                return results;
+            }
+
+            static const std::size_t chunk_size = 64;
+            const std::size_t n_chunks = (results.samples + chunk_size - 1) / chunk_size;
+
+            auto thread_pool = ThreadPool::instance();
+            const unsigned n_workers = ThreadPool::is_worker_thread() ? 1u : std::max(1u, std::min<unsigned>(thread_pool->number_of_threads(), n_chunks));
+
+            std::vector<MaskWorker> workers;
+            workers.reserve(n_workers);
+            for (unsigned j = 0 ; j < n_workers ; ++j)
+            {
+                workers.emplace_back(cache, names, components);
+            }
+
+            Log::instance()->message("SampleMaskEvaluator::evaluate", ll_informational)
+                << "Evaluating " << masks.size() << " mask(s) with " << cache.size() << " observable(s) on " << results.samples << " samples";
+
+            auto work = [&](const unsigned & j)
+            {
+                auto & w = workers[j];
+                for (std::size_t c = j ; (c < n_chunks) && w.error.empty() ; c += workers.size())
+                {
+                    for (std::size_t s = c * chunk_size, s_end = std::min(results.samples, (c + 1) * chunk_size) ; s < s_end ; ++s)
+                    {
+                        try
+                        {
+                            w.evaluate(samples.data() + s * names.size(), components);
+                        }
+                        catch (Exception & e)
+                        {
+                            w.error = e.what();
+                            break;
+                        }
+
+                        for (unsigned m = 0 ; m < masks.size() ; ++m)
+                        {
+                            results.masks[m * results.samples + s] = w.values[masks[m]];
+                        }
+                    }
+                }
+            };
+
+            if (1 == workers.size())
+            {
+                work(0);
+            }
+            else
+            {
+                std::vector<Ticket> tickets;
+                for (unsigned j = 0 ; j < workers.size() ; ++j)
+                {
+                    tickets.push_back(thread_pool->enqueue([&work, j]() { work(j); }));
+                }
+
+                for (auto & t : tickets)
+                {
+                    t.wait();
+                }
+            }
+
+            for (const auto & w : workers)
+            {
+                if (! w.error.empty())
+                {
+                    throw InternalError("SampleMaskEvaluator: " + w.error);
+                }
+
+                results.failures += w.failures;
+            }
+
+            if (results.failures > 0)
+            {
+                Log::instance()->message("SampleMaskEvaluator::evaluate", ll_warning)
+                    << "Failed to compute at least one observable for " << results.failures << " sample(s); these samples fail the respective observables";
+            }
+
+            return results;
+        }
+    };
+
+    SampleMaskEvaluator::SampleMaskEvaluator(const Parameters & parameters, const std::vector<QualifiedName> & names) :
+        PrivateImplementationPattern<SampleMaskEvaluator>(new Implementation<SampleMaskEvaluator>(parameters, names))
+    {
+    }
+
+    SampleMaskEvaluator::~SampleMaskEvaluator()
+    {
+    }
+
+    unsigned
+    SampleMaskEvaluator::add_observable(const ObservablePtr & observable)
+    {
+        return _imp->add_observable(observable);
+    }
+
+    unsigned
+    SampleMaskEvaluator::add_mask(const std::vector<unsigned> & components, const Combination & combination)
+    {
+        return _imp->add_mask(components, combination);
+    }
+
+    unsigned
+    SampleMaskEvaluator::number_of_masks() const
+    {
+        return _imp->masks.size();
+    }
+
+    SampleMaskEvaluator::Results
+    SampleMaskEvaluator::evaluate(std::span<const double> samples) const
+    {
+        return _imp->evaluate(samples);
+    }
+}
@@ -0,0 +1,108 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2025 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_SAMPLE_MASK_EVALUATOR_HH
+#define EOS_GUARD_EOS_STATISTICS_SAMPLE_MASK_EVALUATOR_HH 1
+
+#include <eos/observable.hh>
+#include <eos/utils/parameters.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+#include <eos/utils/qualified-name.hh>
+
+#include <span>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * Evaluates sample masks on a set of samples.
+     *
+     * A mask is built from components, which are either observables or previously added masks.
+     * A sample passes an observable component if the observable's prediction is positive; it fails
+     * if the prediction is not positive or cannot be computed. The components of a mask are combined
+     * either by logical conjunction or by logical disjunction.
+     *
+     * All observables of all masks are held in one ObservableCache, so that each sample requires
+     * a single update of the cache. The samples are processed concurrently on the ThreadPool,
+     * using one clone of the cache per thread.
+     */
+    class SampleMaskEvaluator :
+        public PrivateImplementationPattern<SampleMaskEvaluator>
+    {
+        public:
+            enum class Combination
+            {
+                conjunction,
+                disjunction
+            };
+
+            struct Results
+            {
+                /// Number of samples.
+                std::size_t samples;
+
+                /// Values of the masks, one row of length samples per mask, in the order in which the masks were added.
+                std::vector<unsigned char> masks;
+
+                /// Number of samples for which at least one observable could not be computed or is not finite.
+                std::size_t failures;
+            };
+
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param parameters  The parameters from which the observables are created.
+             * @param names       The names of the parameters, in the order of the columns of the samples.
+             */
+            SampleMaskEvaluator(const Parameters & parameters, const std::vector<QualifiedName> & names);
+
+            /// Destructor.
+            ~SampleMaskEvaluator();
+            ///@}
+
+            /*!
+             * Add an observable as a component and return its index.
+             *
+             * @param observable  The observable, which must use the parameters passed to the constructor.
+             */
+            unsigned add_observable(const ObservablePtr & observable);
+
+            /*!
+             * Add a mask as a component and return its index.
+             *
+             * @param components   The indices of the components of this mask, as returned by add_observable or add_mask.
+             * @param combination  The logical combination of the components.
+             */
+            unsigned add_mask(const std::vector<unsigned> & components, const Combination & combination);
+
+            /// Retrieve the number of masks.
+            unsigned number_of_masks() const;
+
+            /*!
+             * Evaluate all masks on the samples.
+             *
+             * @param samples  The samples in row-major order, with one column per parameter.
+             */
+            Results evaluate(std::span<const double> samples) const;
+    };
+}
+
+#endif
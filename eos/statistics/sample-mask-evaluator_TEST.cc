@@ -0,0 +1,100 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2025 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/statistics/sample-mask-evaluator.hh>
+#include <eos/utils/observable_stub.hh>
+
+#include <limits>
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+class SampleMaskEvaluatorTest :
+    public TestCase
+{
+    public:
+        SampleMaskEvaluatorTest() :
+            TestCase("sample_mask_evaluator_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            Parameters parameters = Parameters::Defaults();
+            const double x0 = parameters["mass::b(MSbar)"](), y0 = parameters["mass::c"]();
+
+            SampleMaskEvaluator evaluator(parameters, { "mass::b(MSbar)", "mass::c" });
+            const unsigned x = evaluator.add_observable(ObservablePtr(new ObservableStub(parameters, "mass::b(MSbar)")));
+            const unsigned y = evaluator.add_observable(ObservablePtr(new ObservableStub(parameters, "mass::c")));
+            const unsigned both   = evaluator.add_mask({ x, y }, SampleMaskEvaluator::Combination::conjunction);
+            const unsigned either = evaluator.add_mask({ x, y }, SampleMaskEvaluator::Combination::disjunction);
+            // masks can be nested
+            evaluator.add_mask({ both, either }, SampleMaskEvaluator::Combination::disjunction);
+
+            TEST_CHECK_EQUAL(evaluator.number_of_masks(), 3u);
+
+            // enough samples to be split across several threads
+            const std::vector<std::vector<double>> points{ { 1.0, 1.0 }, { 1.0, -1.0 }, { -1.0, 1.0 }, { -1.0, -1.0 } };
+            const std::vector<std::vector<unsigned char>> expected{ { 1, 0, 0, 0 }, { 1, 1, 1, 0 }, { 1, 1, 1, 0 } };
+            const unsigned n = 4 * 250;
+            std::vector<double> samples;
+            for (unsigned i = 0 ; i < n ; ++i)
+            {
+                samples.insert(samples.end(), points[i % 4].begin(), points[i % 4].end());
+            }
+
+            const auto results = evaluator.evaluate(samples);
+            TEST_CHECK_EQUAL(results.samples, n);
+            TEST_CHECK_EQUAL(results.masks.size(), 3u * n);
+            TEST_CHECK_EQUAL(results.failures, 0u);
+
+            for (unsigned m = 0 ; m < 3 ; ++m)
+            {
+                for (unsigned i = 0 ; i < n ; ++i)
+                {
+                    TEST_CHECK_EQUAL(results.masks[m * n + i], expected[m][i % 4]);
+                }
+            }
+
+            // the original parameters are not modified
+            TEST_CHECK_EQUAL(parameters["mass::b(MSbar)"](), x0);
+            TEST_CHECK_EQUAL(parameters["mass::c"](), y0);
+
+            // a sample for which an observable is not finite counts as a failure and fails that observable only
+            {
+                const auto results = evaluator.evaluate(std::vector<double>{ std::numeric_limits<double>::quiet_NaN(), 1.0, 1.0, 1.0 });
+                TEST_CHECK_EQUAL(results.samples, 2u);
+                TEST_CHECK_EQUAL(results.failures, 1u);
+                TEST_CHECK_EQUAL(results.masks[0 * 2 + 0], 0);
+                TEST_CHECK_EQUAL(results.masks[1 * 2 + 0], 1);
+                TEST_CHECK_EQUAL(results.masks[2 * 2 + 0], 1);
+                TEST_CHECK_EQUAL(results.masks[0 * 2 + 1], 1);
+            }
+
+            // no samples
+            TEST_CHECK_EQUAL(evaluator.evaluate(std::vector<double>()).masks.size(), 0u);
+
+            TEST_CHECK_THROWS(InternalError, evaluator.evaluate(std::vector<double>{ 1.0, 2.0, 3.0 }));
+            TEST_CHECK_THROWS(InternalError, evaluator.add_mask({ 7 }, SampleMaskEvaluator::Combination::conjunction));
+            TEST_CHECK_THROWS(InternalError, evaluator.add_mask({ }, SampleMaskEvaluator::Combination::conjunction));
+            TEST_CHECK_THROWS(InternalError, SampleMaskEvaluator(parameters, { }));
+        }
+} sample_mask_evaluator_test;
@@ -23,14 +23,19 @@
 #include <eos/observable-impl.hh>
 #include <eos/utils/join.hh>
 #include <eos/utils/log.hh>
+#include <eos/utils/stringify.hh>
+#include <eos/utils/thread_pool.hh>
 #include <eos/utils/tuple-maker.hh>
 #include <eos/utils/units.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
+#include <algorithm>
 #include <array>
 #include <functional>
+#include <span>
 #include <string>
 #include <tuple>
+#include <vector>
 
 namespace eos
 {
@@ -54,6 +59,36 @@ namespace eos
 
             std::tuple<const Decay_ *, typename impl::ConvertTo<Args_, KinematicVariable>::Type...> _argument_tuple;
 
+            // minimal number of points that justifies the evaluation on a further thread
+            static constexpr std::size_t _points_per_thread = 64;
+
+            // position of a kinematic variable among the arguments of _function, or sizeof...(Args_) if it is not an argument
+            std::size_t
+            _argument_index(const std::string & kinematic_name) const
+            {
+                const std::array<const char *, sizeof...(Args_)> names = std::apply([](auto... names) {
+                    return std::array<const char *, sizeof...(Args_)>{ names... };
+                }, _kinematics_names);
+
+                return std::find_if(names.begin(), names.end(), [&](const char * name) { return kinematic_name == name; }) - names.begin();
+            }
+
+            // evaluates _function with one argument varied, reading the remaining arguments only once
+            void
+            _evaluate_many(const std::size_t & index, std::span<const double> values, std::span<double> results) const
+            {
+                std::tuple<const Decay_ *, typename impl::ConvertTo<Args_, double>::Type...> arguments = _argument_tuple;
+                std::array<double *, sizeof...(Args_)> varied = std::apply([](const Decay_ *, auto &... args) {
+                    return std::array<double *, sizeof...(Args_)>{ &args... };
+                }, arguments);
+
+                for (std::size_t j = 0 ; j < values.size() ; ++j)
+                {
+                    *varied[index] = values[j];
+                    results[j] = std::apply(_function, arguments);
+                }
+            }
+
         public:
             ConcreteObservable(const QualifiedName & name, const Parameters & parameters, const Kinematics & kinematics, const Options & options,
                                const std::function<double(const Decay_ *, const Args_ &...)> &            function,
@@ -94,6 +129,66 @@ namespace eos
                 return std::apply(_function, values);
             }
 
+            virtual void
+            evaluate_many(const std::string & kinematic_name, std::span<const double> values, std::span<double> results)
+            {
+                const std::size_t index = _argument_index(kinematic_name);
+                if ((index == sizeof...(Args_)) || (values.size() != results.size()))
+                {
+                    Observable::evaluate_many(kinematic_name, values, results);
+                    return;
+                }
+
+                const std::size_t workers = std::min<std::size_t>(ThreadPool::instance()->number_of_threads(), values.size() / _points_per_thread);
+
+                // avoid waiting on the thread pool from within one of its own threads
+                if ((workers < 2) || ThreadPool::is_worker_thread())
+                {
+                    _evaluate_many(index, values, results);
+                    return;
+                }
+
+                // each further worker evaluates a contiguous range of points on its own clone, since the decays are not thread-safe
+                const std::size_t size = (values.size() + workers - 1) / workers;
+                std::vector<ObservablePtr> clones;
+                for (std::size_t w = 1 ; w < workers ; ++w)
+                {
+                    clones.push_back(this->clone(_parameters));
+                }
+
+                std::vector<std::string> errors(workers);
+                std::vector<Ticket> tickets;
+                for (std::size_t w = 0 ; w < workers ; ++w)
+                {
+                    tickets.push_back(ThreadPool::instance()->enqueue([&, w]()
+                    {
+                        try
+                        {
+                            const std::size_t first = std::min(values.size(), w * size), last = std::min(values.size(), first + size);
+                            const auto & observable = (0 == w) ? *this : static_cast<const ConcreteObservable &>(*clones[w - 1]);
+                            observable._evaluate_many(index, values.subspan(first, last - first), results.subspan(first, last - first));
+                        }
+                        catch (eos::Exception & e)
+                        {
+                            errors[w] = e.what();
+                        }
+                    }));
+                }
+
+                for (auto & t : tickets)
+                {
+                    t.wait();
+                }
+
+                for (const auto & e : errors)
+                {
+                    if (! e.empty())
+                    {
+                        throw InternalError("ConcreteObservable::evaluate_many: " + e);
+                    }
+                }
+            }
+
             virtual Parameters
             parameters()
             {
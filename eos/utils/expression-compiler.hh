@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2025 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_EXPRESSION_COMPILER_HH
+#define EOS_GUARD_EOS_UTILS_EXPRESSION_COMPILER_HH 1
+
+#include <eos/utils/expression-fwd.hh>
+#include <eos/utils/expression.hh>
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <vector>
+
+namespace eos::exp
+{
+    /*
+     * Flat, register-based form of an expression tree.
+     *
+     * Each instruction writes its result into the register of the same index; the result of
+     * the expression is the last register. Repeated parameters, kinematic variables and
+     * (cached) observables are loaded only once, and constant subexpressions are folded.
+     */
+    class CompiledExpression
+    {
+        public:
+            enum class OpCode : std::uint8_t
+            {
+                constant,
+                parameter,
+                kinematic_variable,
+                observable,
+                cached_observable,
+                sum,
+                difference,
+                product,
+                ratio,
+                power,
+                function
+            };
+
+            struct Instruction
+            {
+                OpCode op;
+
+                // leaves: index into the respective table; operations: the register of the (left-hand) operand
+                unsigned a;
+
+                // binary operations: the register of the right-hand operand
+                unsigned b;
+
+                // constants only
+                double value;
+            };
+
+            std::vector<Instruction> instructions;
+
+            std::vector<Parameter> parameters;
+
+            std::vector<KinematicVariable> kinematic_variables;
+
+            std::vector<ObservablePtr> observables;
+
+            std::vector<FunctionExpression::FunctionType> functions;
+
+            // the ids of all cached observables that the expression reads, without duplicates
+            std::vector<ObservableCache::Id> cached_ids;
+
+            std::optional<ObservableCache> cache;
+
+            double evaluate() const;
+    };
+
+    // Visit the expression tree and emit the instructions; returns the register holding the result
+    class ExpressionCompiler
+    {
+        private:
+            CompiledExpression & _result;
+
+            std::map<Parameter::Id, unsigned> _parameter_registers;
+
+            std::map<KinematicVariable::Id, unsigned> _kinematic_variable_registers;
+
+            std::map<ObservableCache::Id, unsigned> _cached_observable_registers;
+
+            std::vector<unsigned> _observable_registers;
+
+            unsigned emit(const CompiledExpression::Instruction & instruction);
+
+        public:
+            ExpressionCompiler(CompiledExpression & result);
+            ~ExpressionCompiler() = default;
+
+            unsigned operator() (const BinaryExpression & e);
+
+            unsigned operator() (const FunctionExpression & e);
+
+            unsigned operator() (const ConstantExpression & e);
+
+            unsigned operator() (const ObservableNameExpression & e);
+
+            unsigned operator() (const ObservableExpression & e);
+
+            unsigned operator() (const ParameterNameExpression & e);
+
+            unsigned operator() (const ParameterExpression & e);
+
+            unsigned operator() (const KinematicVariableNameExpression & e);
+
+            unsigned operator() (const KinematicVariableExpression & e);
+
+            unsigned operator() (const CachedObservableExpression & e);
+    };
+} // namespace eos::exp
+
+#endif
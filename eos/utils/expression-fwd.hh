@@ -35,6 +35,8 @@ namespace eos::exp
     class ParameterNameExpression;
     class ParameterExpression;
 
+    class CompiledExpression;
+
     using Expression = std::variant<BinaryExpression, FunctionExpression, ConstantExpression, ObservableNameExpression, ObservableExpression, KinematicVariableNameExpression,
                                     KinematicVariableExpression, CachedObservableExpression, ParameterNameExpression, ParameterExpression>;
 
@@ -19,7 +19,7 @@
 #include <eos/observable-impl.hh>
 #include <eos/utils/expression-cacher.hh>
 #include <eos/utils/expression-cloner.hh>
-#include <eos/utils/expression-evaluator.hh>
+#include <eos/utils/expression-compiler.hh>
 #include <eos/utils/expression-kinematic-reader.hh>
 #include <eos/utils/expression-maker.hh>
 #include <eos/utils/expression-observable.hh>
@@ -65,6 +65,8 @@ namespace eos
         {
             this->uses_kinematic(id);
         }
+
+        _compile();
     }
 
     ExpressionObservable::ExpressionObservable(const QualifiedName & name, const ObservableCache & cache, const Kinematics & kinematics, const Options & options,
@@ -97,14 +99,30 @@ namespace eos
         {
             this->uses_kinematic(id);
         }
+
+        _compile();
+    }
+
+    void
+    ExpressionObservable::_compile()
+    {
+        auto                    compiled = std::make_shared<exp::CompiledExpression>();
+        exp::ExpressionCompiler compiler(*compiled);
+        std::visit(compiler, *_expression);
+
+        _compiled = compiled;
     }
 
     double
     ExpressionObservable::evaluate() const
     {
-        exp::ExpressionEvaluator evaluator;
+        return _compiled->evaluate();
+    }
 
-        return std::visit(evaluator, *_expression);
+    const exp::CompiledExpression &
+    ExpressionObservable::compiled() const
+    {
+        return *_compiled;
     }
 
     ObservablePtr
@@ -42,6 +42,10 @@ namespace eos
 
             eos::exp::ExpressionPtr _expression;
 
+            std::shared_ptr<const eos::exp::CompiledExpression> _compiled;
+
+            void _compile();
+
         public:
             ExpressionObservable(const QualifiedName & name, const Parameters & parameters, const Kinematics & kinematics, const Options & options,
                                  const eos::exp::ExpressionPtr & expression);
@@ -84,6 +88,9 @@ namespace eos
             {
                 return _expression;
             }
+
+            // the flat form of the expression, as used by evaluate()
+            const eos::exp::CompiledExpression & compiled() const;
     };
 
     class ExpressionObservableEntry : public ObservableEntry
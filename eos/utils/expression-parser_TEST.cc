@@ -18,6 +18,7 @@
 
 #include <eos/utils/expression-cacher.hh>
 #include <eos/utils/expression-cloner.hh>
+#include <eos/utils/expression-compiler.hh>
 #include <eos/utils/expression-evaluator.hh>
 #include <eos/utils/expression-fwd.hh>
 #include <eos/utils/expression-kinematic-reader.hh>
@@ -492,5 +493,72 @@ class ExpressionParserTest : public TestCase
                 ExpressionEvaluator evaluator;
                 TEST_CHECK_NEARLY_EQUAL(std::visit(evaluator, cached_e), 5.0, 1e-10);
             }
+
+            // testing compiling an expression
+            {
+                // test::obs1 is a test observable that requires two kinematic specifications, q2_min and q2_max
+                // it returns p[mass::c] * multiplier * (q2_max - q2_min)
+                ExpressionTest test("(<<test::obs1>>[q2_min=>q2_a] - <<test::obs1>>[q2_min=>q2_b]) / (<<test::obs1>>[q2_min=>q2_a] + <<test::obs1>>[q2_min=>q2_b])"
+                                    " + 2.0 * 3.0 * [[mass::c]]");
+
+                Parameters p = Parameters::Defaults();
+                p.set("mass::c", 1.0);
+                Kinematics k = Kinematics({
+                    {   "q2_a", 1.0 },
+                    {   "q2_b", 0.0 },
+                    { "q2_max", 3.0 }
+                });
+
+                ExpressionMaker maker(p, k, Options());
+                Expression      e;
+                TEST_CHECK_NO_THROW(e = std::visit(maker, *test.e));
+
+                CompiledExpression compiled;
+                ExpressionCompiler compiler(compiled);
+                TEST_CHECK_NO_THROW(std::visit(compiler, e));
+
+                // identical observables are evaluated once, and 2.0 * 3.0 is folded
+                TEST_CHECK_EQUAL(compiled.observables.size(),  2u);
+                TEST_CHECK_EQUAL(compiled.parameters.size(),   1u);
+                TEST_CHECK_EQUAL(compiled.instructions.size(), 9u);
+
+                ExpressionEvaluator evaluator;
+                TEST_CHECK_NEARLY_EQUAL(compiled.evaluate(), 5.8,                        1e-10);
+                TEST_CHECK_NEARLY_EQUAL(compiled.evaluate(), std::visit(evaluator, e),   1e-14);
+
+                p.set("mass::c", 2.0);
+                TEST_CHECK_NEARLY_EQUAL(compiled.evaluate(), 11.8,                       1e-10);
+
+                // cached observables are read from the cache
+                ObservableCache  c(p);
+                ExpressionCacher cacher(c);
+                Expression       cached_e;
+                TEST_CHECK_NO_THROW(cached_e = std::visit(cacher, e));
+
+                CompiledExpression compiled_cached;
+                ExpressionCompiler compiler_cached(compiled_cached);
+                TEST_CHECK_NO_THROW(std::visit(compiler_cached, cached_e));
+                TEST_CHECK_EQUAL(compiled_cached.observables.size(), 0u);
+                TEST_CHECK_EQUAL(compiled_cached.cached_ids.size(),  2u);
+
+                c.update();
+                TEST_CHECK_NEARLY_EQUAL(compiled_cached.evaluate(), 11.8,                1e-10);
+            }
+
+            // testing folding of constant expressions
+            {
+                ExpressionTest test("2.0 ^ 3.0 + exp(0.0)");
+
+                ExpressionMaker maker(Parameters::Defaults(), Kinematics(), Options());
+                Expression      e;
+                TEST_CHECK_NO_THROW(e = std::visit(maker, *test.e));
+
+                CompiledExpression compiled;
+                ExpressionCompiler compiler(compiled);
+                TEST_CHECK_NO_THROW(std::visit(compiler, e));
+
+                TEST_CHECK_EQUAL(compiled.instructions.size(), 1u);
+                TEST_CHECK_NEARLY_EQUAL(compiled.evaluate(), 9.0, 1e-14);
+            }
         }
 } expression_parser_test;
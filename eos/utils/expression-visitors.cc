@@ -21,6 +21,7 @@
 #include <eos/utils/exception.hh>
 #include <eos/utils/expression-cacher.hh>
 #include <eos/utils/expression-cloner.hh>
+#include <eos/utils/expression-compiler.hh>
 #include <eos/utils/expression-evaluator.hh>
 #include <eos/utils/expression-kinematic-reader.hh>
 #include <eos/utils/expression-maker.hh>
@@ -34,8 +35,11 @@
 #include <eos/utils/parameters.hh>
 #include <eos/utils/qualified-name.hh>
 
+#include <array>
+#include <cmath>
 #include <iostream>
 #include <set>
+#include <unordered_set>
 
 namespace eos::exp
 {
@@ -900,4 +904,251 @@ namespace eos::exp
             this->kinematic_variable_ids.insert(*k);
         }
     }
+
+    /*
+     * CompiledExpression
+     */
+    double
+    CompiledExpression::evaluate() const
+    {
+        static constexpr std::size_t inline_registers = 32;
+
+        std::array<double, inline_registers> inline_storage;
+        std::vector<double>                  heap_storage;
+
+        double * r = inline_storage.data();
+        if (instructions.size() > inline_registers)
+        {
+            heap_storage.resize(instructions.size());
+            r = heap_storage.data();
+        }
+
+        const double * predictions = cache.has_value() ? cache->predictions() : nullptr;
+
+        for (std::size_t i = 0, i_end = instructions.size(); i != i_end; ++i)
+        {
+            const Instruction & instruction = instructions[i];
+
+            switch (instruction.op)
+            {
+                case OpCode::constant:           r[i] = instruction.value;                                        break;
+                case OpCode::parameter:          r[i] = parameters[instruction.a].evaluate();                     break;
+                case OpCode::kinematic_variable: r[i] = kinematic_variables[instruction.a].evaluate();            break;
+                case OpCode::observable:         r[i] = observables[instruction.a]->evaluate();                   break;
+                case OpCode::cached_observable:  r[i] = predictions[instruction.a];                               break;
+                case OpCode::sum:                r[i] = r[instruction.a] + r[instruction.b];                      break;
+                case OpCode::difference:         r[i] = r[instruction.a] - r[instruction.b];                      break;
+                case OpCode::product:            r[i] = r[instruction.a] * r[instruction.b];                      break;
+                case OpCode::ratio:              r[i] = r[instruction.a] / r[instruction.b];                      break;
+                case OpCode::power:              r[i] = std::pow(r[instruction.a], r[instruction.b]);             break;
+                case OpCode::function:           r[i] = functions[instruction.b](r[instruction.a]);               break;
+            }
+        }
+
+        return r[instructions.size() - 1];
+    }
+
+    /*
+     * ExpressionCompiler
+     */
+    namespace
+    {
+        // the same criteria as used by the ObservableCache
+        bool
+        identical_observables(const ObservablePtr & lhs, const ObservablePtr & rhs)
+        {
+            if (lhs == rhs)
+            {
+                return true;
+            }
+
+            if (lhs->name() != rhs->name())
+            {
+                return false;
+            }
+
+            if (lhs->options() != rhs->options())
+            {
+                return false;
+            }
+
+            if (lhs->kinematics() != rhs->kinematics())
+            {
+                return false;
+            }
+
+            const KinematicUser &                     kinematic_user_lhs = static_cast<const KinematicUser &>(*lhs);
+            const KinematicUser &                     kinematic_user_rhs = static_cast<const KinematicUser &>(*rhs);
+            std::unordered_set<KinematicVariable::Id> kinematic_ids_lhs(kinematic_user_lhs.begin_kinematics(), kinematic_user_lhs.end_kinematics());
+            std::unordered_set<KinematicVariable::Id> kinematic_ids_rhs(kinematic_user_rhs.begin_kinematics(), kinematic_user_rhs.end_kinematics());
+
+            return kinematic_ids_lhs == kinematic_ids_rhs;
+        }
+    } // namespace
+
+    ExpressionCompiler::ExpressionCompiler(CompiledExpression & result) :
+        _result(result)
+    {
+    }
+
+    unsigned
+    ExpressionCompiler::emit(const CompiledExpression::Instruction & instruction)
+    {
+        _result.instructions.push_back(instruction);
+
+        return _result.instructions.size() - 1;
+    }
+
+    unsigned
+    ExpressionCompiler::operator() (const BinaryExpression & e)
+    {
+        using OpCode = CompiledExpression::OpCode;
+
+        OpCode op;
+        switch (e.op)
+        {
+            case '+': op = OpCode::sum;        break;
+            case '-': op = OpCode::difference; break;
+            case '*': op = OpCode::product;    break;
+            case '/': op = OpCode::ratio;      break;
+            case '^': op = OpCode::power;      break;
+            default:  throw InternalError("Unknown binary operator '" + stringify(e.op) + "' encountered in ExpressionCompiler::operator()");
+        }
+
+        const unsigned lhs = std::visit(*this, *e.lhs);
+        const unsigned rhs = std::visit(*this, *e.rhs);
+
+        // fold constant subexpressions; a constant subexpression always compiles to a single, trailing instruction
+        const auto & instructions = _result.instructions;
+        if ((OpCode::constant == instructions[lhs].op) && (OpCode::constant == instructions[rhs].op))
+        {
+            const double value = BinaryExpression::Method(e.op)(instructions[lhs].value, instructions[rhs].value);
+            _result.instructions.resize(lhs);
+
+            return emit({ OpCode::constant, 0u, 0u, value });
+        }
+
+        return emit({ op, lhs, rhs, 0.0 });
+    }
+
+    unsigned
+    ExpressionCompiler::operator() (const FunctionExpression & e)
+    {
+        using OpCode = CompiledExpression::OpCode;
+
+        const unsigned arg = std::visit(*this, *e.arg);
+
+        if (OpCode::constant == _result.instructions[arg].op)
+        {
+            const double value = e.f(_result.instructions[arg].value);
+            _result.instructions.resize(arg);
+
+            return emit({ OpCode::constant, 0u, 0u, value });
+        }
+
+        _result.functions.push_back(e.f);
+
+        return emit({ OpCode::function, arg, unsigned(_result.functions.size() - 1), 0.0 });
+    }
+
+    unsigned
+    ExpressionCompiler::operator() (const ConstantExpression & e)
+    {
+        return emit({ CompiledExpression::OpCode::constant, 0u, 0u, e.value });
+    }
+
+    unsigned
+    ExpressionCompiler::operator() (const ObservableNameExpression &)
+    {
+        throw InternalError("Encountered ObservableNameExpression in ExpressionCompiler::operator()");
+
+        return 0;
+    }
+
+    unsigned
+    ExpressionCompiler::operator() (const ObservableExpression & e)
+    {
+        for (unsigned i = 0; i < _result.observables.size(); ++i)
+        {
+            if (identical_observables(_result.observables[i], e.observable))
+            {
+                return _observable_registers[i];
+            }
+        }
+
+        _result.observables.push_back(e.observable);
+        _observable_registers.push_back(emit({ CompiledExpression::OpCode::observable, unsigned(_result.observables.size() - 1), 0u, 0.0 }));
+
+        return _observable_registers.back();
+    }
+
+    unsigned
+    ExpressionCompiler::operator() (const ParameterNameExpression &)
+    {
+        throw InternalError("Encountered ParameterNameExpression in ExpressionCompiler::operator()");
+
+        return 0;
+    }
+
+    unsigned
+    ExpressionCompiler::operator() (const ParameterExpression & e)
+    {
+        auto i = _parameter_registers.find(e.parameter.id());
+        if (_parameter_registers.end() != i)
+        {
+            return i->second;
+        }
+
+        _result.parameters.push_back(e.parameter);
+        const unsigned r = emit({ CompiledExpression::OpCode::parameter, unsigned(_result.parameters.size() - 1), 0u, 0.0 });
+        _parameter_registers.insert(std::make_pair(e.parameter.id(), r));
+
+        return r;
+    }
+
+    unsigned
+    ExpressionCompiler::operator() (const KinematicVariableNameExpression &)
+    {
+        throw InternalError("Encountered KinematicVariableNameExpression in ExpressionCompiler::operator()");
+
+        return 0;
+    }
+
+    unsigned
+    ExpressionCompiler::operator() (const KinematicVariableExpression & e)
+    {
+        auto i = _kinematic_variable_registers.find(e.kinematic_variable.id());
+        if (_kinematic_variable_registers.end() != i)
+        {
+            return i->second;
+        }
+
+        _result.kinematic_variables.push_back(e.kinematic_variable);
+        const unsigned r = emit({ CompiledExpression::OpCode::kinematic_variable, unsigned(_result.kinematic_variables.size() - 1), 0u, 0.0 });
+        _kinematic_variable_registers.insert(std::make_pair(e.kinematic_variable.id(), r));
+
+        return r;
+    }
+
+    unsigned
+    ExpressionCompiler::operator() (const CachedObservableExpression & e)
+    {
+        // all cached observables of one expression stem from the same ObservableCache
+        if (! _result.cache.has_value())
+        {
+            _result.cache.emplace(e.cache);
+        }
+
+        auto i = _cached_observable_registers.find(e.id);
+        if (_cached_observable_registers.end() != i)
+        {
+            return i->second;
+        }
+
+        _result.cached_ids.push_back(e.id);
+        const unsigned r = emit({ CompiledExpression::OpCode::cached_observable, e.id, 0u, 0.0 });
+        _cached_observable_registers.insert(std::make_pair(e.id, r));
+
+        return r;
+    }
 } // namespace eos::exp
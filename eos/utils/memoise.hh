@@ -25,6 +25,7 @@
 #include <eos/utils/instantiation_policy.hh>
 #include <eos/utils/lock.hh>
 #include <eos/utils/mutex.hh>
+#include <eos/utils/profiler.hh>
 
 #include <cstdint>
 #include <functional>
@@ -143,9 +144,13 @@ namespace eos
 
                 if (_memoisations.end() != i)
                 {
+                    Profiler::count_memoisation(true);
+
                     return i->second;
                 }
 
+                Profiler::count_memoisation(false);
+
                 Result_ result = f(p...);
 
                 if (_memoisations.size() > 100000u)
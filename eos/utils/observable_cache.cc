@@ -19,11 +19,13 @@
  */
 
 #include <eos/utils/expression-cacher.hh>
+#include <eos/utils/expression-compiler.hh>
 #include <eos/utils/expression-observable.hh>
 #include <eos/utils/log.hh>
 #include <eos/utils/observable_cache.hh>
 #include <eos/utils/observable_set.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/profiler.hh>
 #include <eos/utils/thread_pool.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
@@ -60,9 +62,19 @@ namespace eos
             // Contains each cached observable and its associated index
             std::vector<std::tuple<ObservablePtr, ObservableCache::Id>> cached_observables;
 
-            // Contains each expression observable and its associated index
+            // Contains each expression observable and its associated index, in the order of their dependencies
             std::vector<std::tuple<ObservablePtr, ObservableCache::Id>> expression_observables;
 
+            // Contains the expression observables grouped by their depth in the dependency graph;
+            // the expressions of one level only depend on those of earlier levels
+            std::vector<std::vector<std::tuple<ObservablePtr, ObservableCache::Id>>> expression_levels;
+
+            // Contains the level of each expression observable, indexed by its associated index
+            std::map<ObservableCache::Id, unsigned> expression_level;
+
+            // Minimal number of expressions per job when evaluating one level in parallel
+            static constexpr std::size_t expressions_per_job = 64;
+
             // Contains values of all observables
             std::vector<double> predictions;
 
@@ -131,18 +143,37 @@ namespace eos
 
                 if (nullptr != expression_observable) // is the new observable an expression?
                 {
-                    ObservablePtr cached_expression_observable(new ExpressionObservable(expression_observable->name(),
-                                                                                        cache,
-                                                                                        expression_observable->kinematics(),
-                                                                                        expression_observable->options(),
-                                                                                        expression_observable->expression()));
+                    auto          compiled_expression_observable = new ExpressionObservable(expression_observable->name(),
+                                                                                    cache,
+                                                                                    expression_observable->kinematics(),
+                                                                                    expression_observable->options(),
+                                                                                    expression_observable->expression());
+                    ObservablePtr cached_expression_observable(compiled_expression_observable);
 
                     // ensure that the new index is correct, since the ExpressionCacher is capable to modify our cache
                     index = observables.size();
 
+                    // the nested observables have been added to the cache already; place the expression one level after its deepest nested expression
+                    unsigned level = 0;
+                    for (const auto & id : compiled_expression_observable->compiled().cached_ids)
+                    {
+                        auto l = expression_level.find(id);
+                        if (expression_level.end() != l)
+                        {
+                            level = std::max(level, l->second + 1);
+                        }
+                    }
+
+                    if (expression_levels.size() <= level)
+                    {
+                        expression_levels.resize(level + 1);
+                    }
+
                     observables.push_back(cached_expression_observable);
                     predictions.push_back(std::numeric_limits<double>::quiet_NaN());
                     expression_observables.push_back(std::make_tuple(cached_expression_observable, index));
+                    expression_levels[level].push_back(std::make_tuple(cached_expression_observable, index));
+                    expression_level[index] = level;
 
                     return index;
                 }
@@ -209,6 +240,90 @@ namespace eos
 
                 throw InternalError("should not be reached");
             }
+
+            template <typename ObservablePointer_>
+            void
+            evaluate(const ObservablePointer_ & o, const ObservableCache::Id & idx, const char * kind)
+            {
+                Profiler::Scope scope(*o, kind);
+
+                try
+                {
+                    predictions[idx] = o->evaluate();
+                }
+                catch (eos::Exception & e)
+                {
+                    Log::instance()->message("ObservableCache::update", ll_error) << "Exception encountered when evaluating " << kind << " observable '" << o->name() << "["
+                                                                                  << o->kinematics().as_string() << "];" << o->options().as_string() << "': " << e.what();
+                    predictions[idx] = std::numeric_limits<double>::quiet_NaN();
+                }
+            }
+
+            // evaluate all observables on the calling thread, respecting the order of dependencies
+            void
+            update_serially()
+            {
+                for (auto & co : cacheable_observables)
+                {
+                    evaluate(std::get<0>(co.second), std::get<1>(co.second), "cacheable");
+                }
+
+                for (auto & ro : regular_observables)
+                {
+                    evaluate(std::get<0>(ro), std::get<1>(ro), "regular");
+                }
+
+                for (auto & co : cached_observables)
+                {
+                    evaluate(std::get<0>(co), std::get<1>(co), "cached");
+                }
+
+                for (auto & eo : expression_observables)
+                {
+                    evaluate(std::get<0>(eo), std::get<1>(eo), "expression");
+                }
+            }
+
+            // evaluate the expression observables level by level, splitting large levels across the thread pool
+            void
+            update_expressions()
+            {
+                for (auto & level : expression_levels)
+                {
+                    const std::size_t workers = std::min<std::size_t>(ThreadPool::instance()->number_of_threads(), level.size() / expressions_per_job);
+
+                    if (workers < 2)
+                    {
+                        for (auto & eo : level)
+                        {
+                            evaluate(std::get<0>(eo), std::get<1>(eo), "expression");
+                        }
+
+                        continue;
+                    }
+
+                    const std::size_t size = (level.size() + workers - 1) / workers;
+
+                    std::vector<Ticket> tickets;
+                    tickets.reserve(workers);
+
+                    for (std::size_t w = 0; w < workers; ++w)
+                    {
+                        tickets.push_back(ThreadPool::instance()->enqueue([&, w]()
+                        {
+                            for (std::size_t i = w * size, i_end = std::min(level.size(), (w + 1) * size); i < i_end; ++i)
+                            {
+                                evaluate(std::get<0>(level[i]), std::get<1>(level[i]), "expression");
+                            }
+                        }));
+                    }
+
+                    for (auto & ticket : tickets)
+                    {
+                        ticket.wait();
+                    }
+                }
+            }
     };
 
     ObservableCache::ObservableCache(const Parameters & parameters) :
@@ -227,6 +342,14 @@ namespace eos
     void
     ObservableCache::update()
     {
+        // when updating from within a job of the thread pool, e.g. for a per-thread clone of
+        // a LogPosterior, waiting on nested jobs could block all workers; evaluate serially instead
+        if (ThreadPool::is_worker_thread())
+        {
+            _imp->update_serially();
+            return;
+        }
+
         // parallelize the evaluation of the observables
         std::vector<Ticket> cacheable_tickets;
         cacheable_tickets.reserve(_imp->cacheable_observables.size());
@@ -236,18 +359,7 @@ namespace eos
         {
             auto f = [=, this]()
             {
-                auto & o   = std::get<0>(co.second);
-                auto & idx = std::get<1>(co.second);
-                try
-                {
-                    _imp->predictions[idx] = o->evaluate();
-                }
-                catch (eos::Exception & e)
-                {
-                    Log::instance()->message("ObservableCache::update", ll_error) << "Exception encountered when evaluating cacheable observable '" << o->name() << "["
-                                                                                  << o->kinematics().as_string() << "];" << o->options().as_string() << "': " << e.what();
-                    _imp->predictions[idx] = std::numeric_limits<double>::quiet_NaN();
-                }
+                _imp->evaluate(std::get<0>(co.second), std::get<1>(co.second), "cacheable");
             };
             cacheable_tickets.push_back(ThreadPool::instance()->enqueue(std::function<void(void)>(f)));
         }
@@ -260,18 +372,7 @@ namespace eos
         {
             auto f = [=, this]()
             {
-                auto & o   = std::get<0>(ro);
-                auto & idx = std::get<1>(ro);
-                try
-                {
-                    _imp->predictions[idx] = o->evaluate();
-                }
-                catch (eos::Exception & e)
-                {
-                    Log::instance()->message("ObservableCache::update", ll_error) << "Exception encountered when evaluating regular observable '" << o->name() << "["
-                                                                                  << o->kinematics().as_string() << "];" << o->options().as_string() << "': " << e.what();
-                    _imp->predictions[idx] = std::numeric_limits<double>::quiet_NaN();
-                }
+                _imp->evaluate(std::get<0>(ro), std::get<1>(ro), "regular");
             };
             regular_tickets.push_back(ThreadPool::instance()->enqueue(std::function<void(void)>(f)));
         }
@@ -290,18 +391,7 @@ namespace eos
         {
             auto f = [=, this]()
             {
-                auto & o   = std::get<0>(co);
-                auto & idx = std::get<1>(co);
-                try
-                {
-                    _imp->predictions[idx] = o->evaluate();
-                }
-                catch (eos::Exception & e)
-                {
-                    Log::instance()->message("ObservableCache::update", ll_error) << "Exception encountered when evaluating cached observable '" << o->name() << "["
-                                                                                  << o->kinematics().as_string() << "];" << o->options().as_string() << "': " << e.what();
-                    _imp->predictions[idx] = std::numeric_limits<double>::quiet_NaN();
-                }
+                _imp->evaluate(std::get<0>(co), std::get<1>(co), "cached");
             };
             cached_tickets.push_back(ThreadPool::instance()->enqueue(std::function<void(void)>(f)));
         }
@@ -318,29 +408,13 @@ namespace eos
             ticket.wait();
         }
 
-        // evaluate all expression observables in a serial fashion
+        // evaluate all expression observables
         //
-        // This is necessary, since an expression observable can rely on
-        // another expression observable, which would be located earlier in
-        // the sequence.
-        // Serial evaluation ensures that no race conditions arise.
-        // There is not reason to optimize this, since expression observables
-        // are evaluated very quickly.
-        for (auto eo : _imp->expression_observables)
-        {
-            auto & o   = std::get<0>(eo);
-            auto & idx = std::get<1>(eo);
-            try
-            {
-                _imp->predictions[idx] = o->evaluate();
-            }
-            catch (eos::Exception & e)
-            {
-                Log::instance()->message("ObservableCache::update", ll_error) << "Exception encountered when evaluating expression observable '" << o->name() << "["
-                                                                              << o->kinematics().as_string() << "];" << o->options().as_string() << "': " << e.what();
-                _imp->predictions[idx] = std::numeric_limits<double>::quiet_NaN();
-            }
-        }
+        // An expression observable can rely on another expression observable,
+        // which is located earlier in the sequence. The expressions are therefore
+        // evaluated level by level of their dependency graph. Since expressions
+        // are evaluated very quickly, only large levels are split across threads.
+        _imp->update_expressions();
     }
 
     Parameters
@@ -367,6 +441,12 @@ namespace eos
         return _imp->observables.size();
     }
 
+    const double *
+    ObservableCache::predictions() const
+    {
+        return _imp->predictions.data();
+    }
+
     ObservableCache::Iterator
     ObservableCache::begin() const
     {
@@ -395,4 +475,31 @@ namespace eos
 
         return result;
     }
+
+    void
+    ObservableCache::enable_profiling(const bool & enabled)
+    {
+        Profiler::instance()->enable(enabled);
+    }
+
+    void
+    ObservableCache::reset_profile()
+    {
+        Profiler::instance()->reset();
+    }
+
+    std::string
+    ObservableCache::profile(const std::string & format)
+    {
+        if ("json" == format)
+        {
+            return Profiler::instance()->as_json();
+        }
+        else if ("folded" == format)
+        {
+            return Profiler::instance()->as_folded_stacks();
+        }
+
+        throw InternalError("ObservableCache::profile(): Unknown format '" + format + "'; expected 'json' or 'folded'");
+    }
 } // namespace eos
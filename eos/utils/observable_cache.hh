@@ -78,6 +78,13 @@ namespace eos
             /// Retrieve the number of independent predictions from the cache.
             unsigned size() const;
 
+            /*!
+             * Retrieve the predictions for all observables, indexed by their ObservableCache::Id.
+             *
+             * The storage is updated in place by update(), and remains valid until the next call to add().
+             */
+            const double * predictions() const;
+
             struct IteratorTag;
             using Iterator = WrappedForwardIterator<IteratorTag, ObservablePtr>;
             Iterator begin() const;
@@ -86,6 +93,30 @@ namespace eos
 
             /// Clone this cache whilst keeping the observables in the given order, i.e. all ids remain valid.
             ObservableCache clone(const Parameters & parameters) const;
+
+            ///@name Profiling
+            ///@{
+            /*!
+             * Enable or disable the recording of the wall time and the number of calls per observable
+             * for the updates of all caches. Also records the number of numerical integrations and the
+             * hit rates of the memoisers.
+             *
+             * @param enabled If true, subsequent updates are profiled.
+             */
+            static void enable_profiling(const bool & enabled);
+
+            /// Discard all profiling data recorded so far.
+            static void reset_profile();
+
+            /*!
+             * Retrieve the profiling data recorded so far.
+             *
+             * Can be called at any time, including during concurrent updates.
+             *
+             * @param format Either 'json' or 'folded'; the latter is suitable for flame graph tools.
+             */
+            static std::string profile(const std::string & format = "json");
+            ///@}
     };
 
     extern template class WrappedForwardIterator<ObservableCache::IteratorTag, ObservablePtr>;
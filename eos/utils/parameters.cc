@@ -34,8 +34,10 @@
 #include <boost/filesystem/path.hpp>
 #include <boost/format.hpp>
 
+#include <atomic>
 #include <cmath>
 #include <config.h>
+#include <cstdint>
 #include <iostream>
 #include <map>
 #include <random>
@@ -208,6 +210,17 @@ namespace eos
     struct Parameters::Data
     {
             std::vector<Parameter::Data> data;
+
+            // incremented whenever the value of any parameter changes; read concurrently by cached results
+            std::atomic<std::uint64_t> generation = 0;
+
+            Data() = default;
+
+            Data(const Data & other) :
+                data(other.data),
+                generation(other.generation.load(std::memory_order_acquire))
+            {
+            }
     };
 
     template <> struct WrappedForwardIteratorTraits<Parameters::IteratorTag>
@@ -744,6 +757,7 @@ namespace eos
                                     << "Overriding existing parameter '" << name << "' with central value '" << central << "'";
 
                             parameters_data->data[i->second].value = central;
+                            parameters_data->generation.fetch_add(1, std::memory_order_release);
                             if (has_min)
                             {
                                 parameters_data->data[i->second].min = min;
@@ -890,6 +904,7 @@ namespace eos
         }
 
         _imp->parameters_data->data[i->second].value = value;
+        _imp->parameters_data->generation.fetch_add(1, std::memory_order_release);
     }
 
     bool
@@ -937,6 +952,18 @@ namespace eos
         return rhs._imp.get() != this->_imp.get();
     }
 
+    const void *
+    Parameters::identity() const
+    {
+        return _imp->parameters_data.get();
+    }
+
+    std::uint64_t
+    Parameters::generation() const
+    {
+        return _imp->parameters_data->generation.load(std::memory_order_acquire);
+    }
+
     Parameters
     Parameters::Defaults()
     {
@@ -998,6 +1025,7 @@ namespace eos
     Parameter::operator= (const double & value)
     {
         _parameters_data->data[_index].value = value;
+        _parameters_data->generation.fetch_add(1, std::memory_order_release);
 
         return *this;
     }
@@ -1006,6 +1034,7 @@ namespace eos
     Parameter::set(const double & value)
     {
         _parameters_data->data[_index].value = value;
+        _parameters_data->generation.fetch_add(1, std::memory_order_release);
     }
 
     void
@@ -29,6 +29,7 @@
 #include <eos/utils/units.hh>
 #include <eos/utils/wrapped_forward_iterator.hh>
 
+#include <cstdint>
 #include <limits>
 #include <set>
 
@@ -242,6 +243,20 @@ namespace eos
              * @param rhs   The right hand side of the binary != operator.
              */
             bool operator!= (const Parameters & rhs) const;
+
+            /*!
+             * Retrieve an identifier that is shared by all copies of this set of parameters, but not by its clones.
+             *
+             * The identifier remains unique for as long as any Parameter object from this set exists.
+             */
+            const void * identity() const;
+
+            /*!
+             * Retrieve the number of changes to the values of this set of parameters.
+             *
+             * Results that depend only on the parameters remain valid for as long as the generation does not change.
+             */
+            std::uint64_t generation() const;
     };
 
     extern template class WrappedForwardIterator<Parameters::IteratorTag, Parameter>;
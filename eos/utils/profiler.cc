@@ -0,0 +1,408 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2025 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/observable.hh>
+#include <eos/utils/instantiation_policy-impl.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/mutex.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/profiler.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+namespace eos
+{
+    // The counters are only ever incremented by the owning thread, and read or zeroed by the
+    // threads that dump or reset the profile; relaxed atomics suffice.
+    struct Profiler::ObservableRecord
+    {
+        std::string label;
+
+        const char * kind;
+
+        std::atomic<unsigned long> calls{ 0 };
+
+        std::atomic<unsigned long> nanoseconds{ 0 };
+
+        std::atomic<unsigned long> integrations{ 0 };
+
+        std::atomic<unsigned long> memoiser_hits{ 0 };
+
+        std::atomic<unsigned long> memoiser_misses{ 0 };
+    };
+
+    namespace
+    {
+        // All data recorded by one thread. The mutex only guards the insertion of new records into the map,
+        // so that the profile can be dumped or reset while observables are being evaluated.
+        struct ThreadRecord
+        {
+            Mutex mutex;
+
+            unsigned index;
+
+            // keyed by kind and label, since the addresses of destroyed observables can be reused
+            std::map<std::tuple<std::string, std::string>, Profiler::ObservableRecord> observables;
+
+            std::atomic<unsigned long> integrations{ 0 };
+
+            std::atomic<unsigned long> memoiser_hits{ 0 };
+
+            std::atomic<unsigned long> memoiser_misses{ 0 };
+        };
+
+        // the merged records of one kind and label
+        struct MergedRecord
+        {
+            std::string label;
+
+            std::string kind;
+
+            unsigned long calls = 0;
+
+            double seconds = 0.0;
+
+            unsigned long integrations = 0;
+
+            unsigned long memoiser_hits = 0;
+
+            unsigned long memoiser_misses = 0;
+        };
+
+        thread_local ThreadRecord * current_thread = nullptr;
+
+        thread_local Profiler::ObservableRecord * current_observable = nullptr;
+
+        std::string
+        label(Observable & observable)
+        {
+            std::string result = observable.name().full() + '[' + observable.kinematics().as_string() + ']';
+
+            const std::string options = observable.options().as_string();
+            if (! options.empty())
+            {
+                result += ';' + options;
+            }
+
+            return result;
+        }
+
+        std::string
+        escape_json(const std::string & s)
+        {
+            std::string result;
+            result.reserve(s.size());
+
+            for (const char c : s)
+            {
+                if (('"' == c) || ('\\' == c))
+                {
+                    result += '\\';
+                }
+
+                result += c;
+            }
+
+            return result;
+        }
+    }
+
+    template <> struct Implementation<Profiler>
+    {
+            Mutex mutex;
+
+            // The records are never destroyed, since the threads keep pointers to them
+            std::vector<std::unique_ptr<ThreadRecord>> threads;
+
+            ThreadRecord *
+            thread_record()
+            {
+                if (nullptr == current_thread)
+                {
+                    Lock l(mutex);
+
+                    threads.push_back(std::make_unique<ThreadRecord>());
+                    threads.back()->index = threads.size() - 1;
+                    current_thread = threads.back().get();
+                }
+
+                return current_thread;
+            }
+
+            // The records of the observables are zeroed rather than removed, since scopes that are
+            // still active on other threads keep pointers to them.
+            void
+            reset()
+            {
+                Lock l(mutex);
+
+                for (auto & t : threads)
+                {
+                    Lock lt(t->mutex);
+
+                    for (auto & o : t->observables)
+                    {
+                        auto & record = o.second;
+                        record.calls.store(0, std::memory_order_relaxed);
+                        record.nanoseconds.store(0, std::memory_order_relaxed);
+                        record.integrations.store(0, std::memory_order_relaxed);
+                        record.memoiser_hits.store(0, std::memory_order_relaxed);
+                        record.memoiser_misses.store(0, std::memory_order_relaxed);
+                    }
+                    t->integrations.store(0, std::memory_order_relaxed);
+                    t->memoiser_hits.store(0, std::memory_order_relaxed);
+                    t->memoiser_misses.store(0, std::memory_order_relaxed);
+                }
+            }
+
+            // merge the records of all threads by kind and label
+            std::vector<std::tuple<MergedRecord, std::set<unsigned>>>
+            merge()
+            {
+                Lock l(mutex);
+
+                std::map<std::tuple<std::string, std::string>, std::tuple<MergedRecord, std::set<unsigned>>> merged;
+                for (auto & t : threads)
+                {
+                    Lock lt(t->mutex);
+
+                    for (auto & o : t->observables)
+                    {
+                        const auto & record = o.second;
+                        const unsigned long calls = record.calls.load(std::memory_order_relaxed);
+
+                        // skip records that have been reset and not used since
+                        if (0 == calls)
+                        {
+                            continue;
+                        }
+
+                        auto & [result, indices] = merged[o.first];
+
+                        result.label            = record.label;
+                        result.kind             = record.kind;
+                        result.calls           += calls;
+                        result.seconds         += record.nanoseconds.load(std::memory_order_relaxed) * 1.0e-9;
+                        result.integrations    += record.integrations.load(std::memory_order_relaxed);
+                        result.memoiser_hits   += record.memoiser_hits.load(std::memory_order_relaxed);
+                        result.memoiser_misses += record.memoiser_misses.load(std::memory_order_relaxed);
+                        indices.insert(t->index);
+                    }
+                }
+
+                std::vector<std::tuple<MergedRecord, std::set<unsigned>>> result;
+                result.reserve(merged.size());
+                for (auto & m : merged)
+                {
+                    result.push_back(m.second);
+                }
+
+                std::stable_sort(result.begin(), result.end(), [](const auto & lhs, const auto & rhs) { return std::get<0>(lhs).seconds > std::get<0>(rhs).seconds; });
+
+                return result;
+            }
+    };
+
+    std::atomic<bool> Profiler::_enabled(false);
+
+    Profiler::Profiler() :
+        PrivateImplementationPattern<Profiler>(new Implementation<Profiler>)
+    {
+    }
+
+    Profiler::~Profiler() {}
+
+    void
+    Profiler::enable(const bool & enabled)
+    {
+        _enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    void
+    Profiler::reset()
+    {
+        _imp->reset();
+    }
+
+    void
+    Profiler::count_integration()
+    {
+        if (! enabled())
+        {
+            return;
+        }
+
+        ThreadRecord * t = Profiler::instance()->_imp->thread_record();
+
+        t->integrations.fetch_add(1, std::memory_order_relaxed);
+
+        if (nullptr != current_observable)
+        {
+            current_observable->integrations.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void
+    Profiler::count_memoisation(const bool & hit)
+    {
+        if (! enabled())
+        {
+            return;
+        }
+
+        ThreadRecord * t = Profiler::instance()->_imp->thread_record();
+
+        (hit ? t->memoiser_hits : t->memoiser_misses).fetch_add(1, std::memory_order_relaxed);
+
+        if (nullptr != current_observable)
+        {
+            (hit ? current_observable->memoiser_hits : current_observable->memoiser_misses).fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    std::string
+    Profiler::as_json() const
+    {
+        std::ostringstream result;
+        result << std::setprecision(9);
+
+        result << "{\n  \"observables\": [";
+        bool first = true;
+        for (const auto & [record, indices] : _imp->merge())
+        {
+            result << (first ? "\n" : ",\n");
+            result << "    { \"name\": \"" << escape_json(record.label) << "\", \"kind\": \"" << record.kind << "\""
+                   << ", \"calls\": " << record.calls << ", \"seconds\": " << record.seconds
+                   << ", \"integrations\": " << record.integrations
+                   << ", \"memoiser_hits\": " << record.memoiser_hits << ", \"memoiser_misses\": " << record.memoiser_misses
+                   << ", \"threads\": [";
+            bool first_index = true;
+            for (const auto & index : indices)
+            {
+                result << (first_index ? "" : ", ") << index;
+                first_index = false;
+            }
+            result << "] }";
+            first = false;
+        }
+        result << (first ? "],\n" : "\n  ],\n");
+
+        Lock l(_imp->mutex);
+
+        result << "  \"threads\": [";
+        first = true;
+        for (const auto & t : _imp->threads)
+        {
+            Lock lt(t->mutex);
+
+            unsigned long calls = 0;
+            double seconds = 0.0;
+            for (const auto & o : t->observables)
+            {
+                calls   += o.second.calls.load(std::memory_order_relaxed);
+                seconds += o.second.nanoseconds.load(std::memory_order_relaxed) * 1.0e-9;
+            }
+
+            result << (first ? "\n" : ",\n");
+            result << "    { \"thread\": " << t->index << ", \"calls\": " << calls << ", \"seconds\": " << seconds
+                   << ", \"integrations\": " << t->integrations.load(std::memory_order_relaxed)
+                   << ", \"memoiser_hits\": " << t->memoiser_hits.load(std::memory_order_relaxed)
+                   << ", \"memoiser_misses\": " << t->memoiser_misses.load(std::memory_order_relaxed) << " }";
+            first = false;
+        }
+        result << (first ? "]\n" : "\n  ]\n");
+        result << "}\n";
+
+        return result.str();
+    }
+
+    std::string
+    Profiler::as_folded_stacks() const
+    {
+        std::ostringstream result;
+
+        Lock l(_imp->mutex);
+
+        for (const auto & t : _imp->threads)
+        {
+            Lock lt(t->mutex);
+
+            for (const auto & o : t->observables)
+            {
+                if (0 == o.second.calls.load(std::memory_order_relaxed))
+                {
+                    continue;
+                }
+
+                // the semicolon separates the frames of a stack
+                std::string label = o.second.label;
+                std::replace(label.begin(), label.end(), ';', '|');
+
+                result << "thread-" << t->index << ';' << o.second.kind << ';' << label << ' '
+                       << std::llround(o.second.nanoseconds.load(std::memory_order_relaxed) * 1.0e-3) << '\n';
+            }
+        }
+
+        return result.str();
+    }
+
+    void
+    Profiler::Scope::enter(Observable & observable, const char * kind)
+    {
+        ThreadRecord * t = Profiler::instance()->_imp->thread_record();
+
+        auto key = std::make_tuple(std::string(kind), label(observable));
+
+        // only the owning thread inserts, so the look-up does not need the lock
+        auto r = t->observables.find(key);
+        if (t->observables.end() == r)
+        {
+            Lock l(t->mutex);
+
+            r = t->observables.try_emplace(key).first;
+            r->second.label = std::get<1>(key);
+            r->second.kind  = kind;
+        }
+
+        _record            = &r->second;
+        _previous          = current_observable;
+        current_observable = _record;
+        _start             = std::chrono::steady_clock::now();
+    }
+
+    void
+    Profiler::Scope::leave()
+    {
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start);
+
+        _record->nanoseconds.fetch_add(elapsed.count(), std::memory_order_relaxed);
+        _record->calls.fetch_add(1, std::memory_order_relaxed);
+        current_observable = _previous;
+    }
+
+    template class InstantiationPolicy<Profiler, Singleton>;
+} // namespace eos
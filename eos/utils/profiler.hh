@@ -0,0 +1,143 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2025 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_PROFILER_HH
+#define EOS_GUARD_EOS_UTILS_PROFILER_HH 1
+
+#include <eos/observable-fwd.hh>
+#include <eos/utils/instantiation_policy.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+namespace eos
+{
+    /*!
+     * Opt-in profiler for the evaluation of observables.
+     *
+     * When enabled, it records the wall time and the number of calls per observable and per kind of
+     * evaluation (e.g. cacheable, cached or regular), together with the number of numerical integrations
+     * and the hits and misses of the memoisers that occur during each evaluation.
+     *
+     * Every thread accumulates into its own records, whose counters are atomics that are only ever
+     * incremented by that thread; recording an evaluation therefore takes no lock, except when an
+     * observable is recorded for the first time. Records are identified by kind and label, and the
+     * records of all threads are merged when the profile is dumped. The profile can therefore be
+     * dumped or reset at any time. An evaluation that is in progress while the profile is reset is
+     * recorded in full once it completes.
+     */
+    class Profiler :
+        public InstantiationPolicy<Profiler, Singleton>,
+        public PrivateImplementationPattern<Profiler>
+    {
+        private:
+            static std::atomic<bool> _enabled;
+
+            Profiler();
+
+            ~Profiler();
+
+        public:
+            friend class InstantiationPolicy<Profiler, Singleton>;
+
+            struct ObservableRecord;
+
+            /// Returns true if the profiler currently records evaluations.
+            static inline bool enabled()
+            {
+                return _enabled.load(std::memory_order_relaxed);
+            }
+
+            /*!
+             * Enable or disable the recording of evaluations.
+             *
+             * @param enabled If true, subsequent evaluations are recorded.
+             */
+            void enable(const bool & enabled);
+
+            /// Discard all recorded data.
+            void reset();
+
+            /// Count one numerical integration on the calling thread.
+            static void count_integration();
+
+            /*!
+             * Count one lookup in a memoiser on the calling thread.
+             *
+             * @param hit If true, the lookup found a memoised result.
+             */
+            static void count_memoisation(const bool & hit);
+
+            /*!
+             * Dump the profile as a JSON object, containing the merged records of all observables
+             * ordered by decreasing wall time, and the totals per thread.
+             */
+            std::string as_json() const;
+
+            /*!
+             * Dump the profile in the folded-stack format, i.e. one line 'thread;kind;observable microseconds'
+             * per record, which can be processed by the common flame graph tools.
+             */
+            std::string as_folded_stacks() const;
+
+            /*!
+             * RAII helper that records the evaluation of one observable for as long as it exists.
+             *
+             * Does nothing if the profiler is disabled when the scope is entered.
+             */
+            class Scope
+            {
+                private:
+                    ObservableRecord * _record;
+
+                    ObservableRecord * _previous;
+
+                    std::chrono::steady_clock::time_point _start;
+
+                    void enter(Observable & observable, const char * kind);
+
+                    void leave();
+
+                public:
+                    Scope(Observable & observable, const char * kind) :
+                        _record(nullptr)
+                    {
+                        if (Profiler::enabled())
+                        {
+                            enter(observable, kind);
+                        }
+                    }
+
+                    ~Scope()
+                    {
+                        if (nullptr != _record)
+                        {
+                            leave();
+                        }
+                    }
+
+                    Scope(const Scope &) = delete;
+                    Scope & operator= (const Scope &) = delete;
+            };
+    };
+} // namespace eos
+
+#endif
@@ -0,0 +1,140 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2025 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/observable.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/memoise.hh>
+#include <eos/utils/observable_cache.hh>
+#include <eos/utils/profiler.hh>
+
+#include <string>
+
+using namespace test;
+using namespace eos;
+
+class ProfilerTest :
+    public TestCase
+{
+    public:
+        ProfilerTest() :
+            TestCase("profiler_test")
+        {
+        }
+
+        static double
+        f(const double & x, const double & y)
+        {
+            return x * y;
+        }
+
+        static unsigned
+        count(const std::string & haystack, const std::string & needle)
+        {
+            unsigned result = 0;
+            for (auto pos = haystack.find(needle) ; std::string::npos != pos ; pos = haystack.find(needle, pos + needle.size()))
+            {
+                ++result;
+            }
+
+            return result;
+        }
+
+        virtual void run() const
+        {
+            Parameters p = Parameters::Defaults();
+
+            // nothing is recorded while the profiler is disabled
+            {
+                ObservableCache::enable_profiling(false);
+                ObservableCache::reset_profile();
+
+                ObservableCache cache(p);
+                cache.add(Observable::make("test::obs1", p, Kinematics{ { "q2_min", 1.0 }, { "q2_max", 3.0 } }, Options()));
+                cache.update();
+
+                TEST_CHECK_EQUAL(0u, count(ObservableCache::profile("json"), "test::obs1"));
+                TEST_CHECK_EQUAL(std::string(""), ObservableCache::profile("folded"));
+            }
+
+            // per-observable calls during updates of the cache
+            {
+                ObservableCache::enable_profiling(true);
+                ObservableCache::reset_profile();
+
+                ObservableCache cache(p);
+                auto id1 = cache.add(Observable::make("test::obs1", p, Kinematics{ { "q2_min", 1.0 }, { "q2_max", 3.0 } }, Options()));
+                auto id2 = cache.add(Observable::make("test::obs1", p, Kinematics{ { "q2_min", 1.0 }, { "q2_max", 5.0 } }, Options()));
+                cache.update();
+                cache.update();
+
+                TEST_CHECK_EQUAL(cache[id1] * 2.0, cache[id2]);
+
+                const std::string json = ObservableCache::profile();
+                TEST_CHECK_EQUAL(2u, count(json, "\"name\": \"test::obs1["));
+                TEST_CHECK_EQUAL(2u, count(json, "\"kind\": \"regular\", \"calls\": 2,"));
+
+                const std::string folded = ObservableCache::profile("folded");
+                TEST_CHECK(2u <= count(folded, ";regular;test::obs1["));
+
+                ObservableCache::reset_profile();
+                TEST_CHECK_EQUAL(0u, count(ObservableCache::profile("json"), "test::obs1"));
+            }
+
+            // integrations and memoisations are attributed to the observable being evaluated
+            {
+                ObservableCache::reset_profile();
+
+                auto o = Observable::make("test::obs1", p, Kinematics{ { "q2_min", 2.0 }, { "q2_max", 3.0 } }, Options());
+                {
+                    Profiler::Scope scope(*o, "manual");
+
+                    TEST_CHECK_EQUAL(6.0, memoise(f, 2.0, 3.0));
+                    TEST_CHECK_EQUAL(6.0, memoise(f, 2.0, 3.0));
+                    Profiler::count_integration();
+                }
+
+                const std::string json = ObservableCache::profile("json");
+                TEST_CHECK_EQUAL(1u, count(json, "\"kind\": \"manual\", \"calls\": 1,"));
+                TEST_CHECK_EQUAL(1u, count(json, "\"integrations\": 1, \"memoiser_hits\": 1, \"memoiser_misses\": 1, \"threads\": ["));
+            }
+
+            // resetting the profile during an evaluation keeps the active record valid
+            {
+                ObservableCache::reset_profile();
+
+                auto o = Observable::make("test::obs1", p, Kinematics{ { "q2_min", 2.0 }, { "q2_max", 4.0 } }, Options());
+                {
+                    Profiler::Scope scope(*o, "manual");
+
+                    Profiler::count_integration();
+                    ObservableCache::reset_profile();
+                    Profiler::count_integration();
+                }
+
+                const std::string json = ObservableCache::profile("json");
+                TEST_CHECK_EQUAL(1u, count(json, "\"kind\": \"manual\", \"calls\": 1,"));
+                TEST_CHECK_EQUAL(1u, count(json, "\"integrations\": 1, \"memoiser_hits\": 0, \"memoiser_misses\": 0, \"threads\": ["));
+            }
+
+            ObservableCache::enable_profiling(false);
+
+            TEST_CHECK_THROWS(InternalError, ObservableCache::profile("xml"));
+        }
+} profiler_test;
@@ -0,0 +1,137 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2024 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/instantiation_policy-impl.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/shared-result.hh>
+
+#include <map>
+#include <tuple>
+
+namespace eos
+{
+    namespace impl
+    {
+        /*
+         * Hands out one shared result per set of parameters and key.
+         *
+         * Since each result keeps its parameters alive, the parameters' identity cannot be reused while an entry
+         * is valid.
+         */
+        class SharedResultRegistry :
+            public InstantiationPolicy<SharedResultRegistry, Singleton>
+        {
+            private:
+                using KeyType = std::tuple<const void *, std::string>;
+
+                Mutex * const _mutex;
+
+                std::map<KeyType, std::weak_ptr<SharedResult>> _entries;
+
+            public:
+                SharedResultRegistry() :
+                    _mutex(new Mutex)
+                {
+                }
+
+                ~SharedResultRegistry() { delete _mutex; }
+
+                std::shared_ptr<SharedResult>
+                get(const Parameters & parameters, const std::string & key, const std::function<std::shared_ptr<SharedResult> ()> & make)
+                {
+                    Lock l(*_mutex);
+
+                    KeyType k(parameters.identity(), key);
+
+                    auto i = _entries.find(k);
+                    if (_entries.end() != i)
+                    {
+                        if (auto result = i->second.lock())
+                        {
+                            return result;
+                        }
+                    }
+
+                    // remove entries of destroyed results
+                    for (auto j = _entries.begin() ; j != _entries.end() ; )
+                    {
+                        j = j->second.expired() ? _entries.erase(j) : std::next(j);
+                    }
+
+                    auto result = make();
+                    _entries[k] = result;
+
+                    return result;
+                }
+        };
+    }
+
+    SharedResult::SharedResult(const Parameters & parameters) :
+        _parameters(parameters),
+        _mutex(new Mutex),
+        _generation(parameters.generation()),
+        _valid(false)
+    {
+    }
+
+    SharedResult::~SharedResult()
+    {
+        delete _mutex;
+    }
+
+    std::shared_ptr<SharedResult>
+    SharedResult::make(const Parameters & parameters, const std::string & key)
+    {
+        return impl::SharedResultRegistry::instance()->get(parameters, key, [&parameters]()
+        {
+            return std::shared_ptr<SharedResult>(new SharedResult(parameters));
+        });
+    }
+
+    std::vector<double>
+    SharedResult::operator() (const std::function<std::vector<double> ()> & compute)
+    {
+        const std::uint64_t generation = _parameters.generation();
+
+        {
+            Lock l(*_mutex);
+
+            if ((generation == _generation) && _valid)
+            {
+                return _value;
+            }
+        }
+
+        const std::vector<double> result = compute();
+
+        {
+            Lock l(*_mutex);
+
+            // only store the result if no parameter has changed during its computation
+            if (generation == _parameters.generation())
+            {
+                _generation = generation;
+                _valid      = true;
+                _value      = result;
+            }
+        }
+
+        return result;
+    }
+}
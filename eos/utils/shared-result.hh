@@ -0,0 +1,80 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2024 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_SHARED_RESULT_HH
+#define EOS_GUARD_EOS_UTILS_SHARED_RESULT_HH 1
+
+#include <eos/utils/mutex.hh>
+#include <eos/utils/parameters.hh>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * Holds a result that depends only on the values of a set of parameters.
+     *
+     * All objects that request a SharedResult for the same set of parameters and the same key
+     * obtain the same instance, e.g. all bins of a normalized distribution that share the same
+     * normalization. The result is computed once and remains valid until any parameter changes.
+     */
+    class SharedResult
+    {
+        private:
+            Parameters _parameters;
+
+            Mutex * const _mutex;
+
+            std::uint64_t _generation;
+
+            bool _valid;
+
+            std::vector<double> _value;
+
+            SharedResult(const Parameters & parameters);
+
+        public:
+            ~SharedResult();
+
+            /*!
+             * Retrieve the shared result for a set of parameters.
+             *
+             * Only weak references are held, so that the result is destroyed along with the last
+             * object that uses it.
+             *
+             * @param parameters The set of parameters on which the result depends.
+             * @param key        The key that identifies the result, including all options on which it depends.
+             */
+            static std::shared_ptr<SharedResult> make(const Parameters & parameters, const std::string & key);
+
+            /*!
+             * Retrieve the result, computing it if the parameters have changed since it was last computed.
+             *
+             * The computation runs without holding the lock, so concurrent users are not serialised.
+             *
+             * @param compute The function that computes the result.
+             */
+            std::vector<double> operator() (const std::function<std::vector<double> ()> & compute);
+    };
+}
+
+#endif
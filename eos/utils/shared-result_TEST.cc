@@ -0,0 +1,80 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2024 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/shared-result.hh>
+
+#include <test/test.hh>
+
+using namespace test;
+using namespace eos;
+
+class SharedResultTest :
+    public TestCase
+{
+    public:
+        SharedResultTest() :
+            TestCase("shared_result_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            Parameters p = Parameters::Defaults();
+            Parameter m_c = p["mass::c"];
+
+            unsigned computations = 0;
+            auto compute = [&]() -> std::vector<double>
+            {
+                ++computations;
+                return { m_c(), 2.0 * m_c() };
+            };
+
+            // results are shared among copies of the parameters
+            {
+                auto a = SharedResult::make(p, "test::a");
+                auto b = SharedResult::make(Parameters(p), "test::a");
+                auto c = SharedResult::make(p, "test::c");
+
+                TEST_CHECK(a.get() == b.get());
+                TEST_CHECK(a.get() != c.get());
+
+                TEST_CHECK_EQUAL((*a)(compute)[0], m_c());
+                TEST_CHECK_EQUAL(computations, 1u);
+                TEST_CHECK_EQUAL((*b)(compute)[1], 2.0 * m_c());
+                TEST_CHECK_EQUAL(computations, 1u);
+
+                // changing any parameter invalidates the result
+                m_c = 1.5;
+                TEST_CHECK_EQUAL((*b)(compute)[0], 1.5);
+                TEST_CHECK_EQUAL(computations, 2u);
+                TEST_CHECK_EQUAL((*a)(compute)[0], 1.5);
+                TEST_CHECK_EQUAL(computations, 2u);
+            }
+
+            // results are not shared among clones of the parameters
+            {
+                Parameters clone = p.clone();
+
+                auto a = SharedResult::make(p, "test::a");
+                auto b = SharedResult::make(clone, "test::a");
+
+                TEST_CHECK(a.get() != b.get());
+            }
+        }
+} shared_result_test;
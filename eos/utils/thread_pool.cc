@@ -31,6 +31,11 @@
 
 namespace eos
 {
+    namespace
+    {
+        thread_local bool is_worker = false;
+    }
+
     template <> struct Implementation<ThreadPool>
     {
             unsigned      number_of_threads;
@@ -61,6 +66,8 @@ namespace eos
                 std::function<void(void)> * job;
                 Ticket                      ticket;
 
+                is_worker = true;
+
                 do
                 {
                     {
@@ -221,4 +228,10 @@ namespace eos
     {
         return _imp->number_of_threads;
     }
+
+    bool
+    ThreadPool::is_worker_thread()
+    {
+        return is_worker;
+    }
 } // namespace eos
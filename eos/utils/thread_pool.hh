@@ -42,6 +42,14 @@ namespace eos
             void wait_for_free_capacity();
 
             unsigned number_of_threads() const;
+
+            /*!
+             * Returns true if the calling thread is one of the pool's worker threads.
+             *
+             * Code that is executed as part of a job must not wait for further jobs
+             * enqueued into the pool, since all workers might be blocked by waiting.
+             */
+            static bool is_worker_thread();
     };
 } // namespace eos
 
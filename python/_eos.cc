@@ -22,14 +22,21 @@
 #include "eos/config.hh"
 #include "eos/constraint.hh"
 #include "eos/models/model.hh"
+#include "eos/nonleptonic-amplitudes/su3f-amplitudes.hh"
+#include "eos/nonleptonic-amplitudes/topological-amplitudes.hh"
 #include "eos/nonlocal-form-factors/charm-loops-impl.hh"
 #include "eos/observable.hh"
 #include "eos/reference.hh"
 #include "eos/signal-pdf.hh"
+#include "eos/signal-pdf-generator.hh"
+#include "eos/statistics/event-sample.hh"
 #include "eos/statistics/goodness-of-fit.hh"
 #include "eos/statistics/log-likelihood.hh"
 #include "eos/statistics/log-posterior.hh"
 #include "eos/statistics/log-prior.hh"
+#include "eos/statistics/nested-sampler.hh"
+#include "eos/statistics/profile-likelihood.hh"
+#include "eos/statistics/sample-mask-evaluator.hh"
 #include "eos/statistics/test-statistic-impl.hh"
 #include "eos/utils/kinematic.hh"
 #include "eos/utils/log.hh"
@@ -42,6 +49,7 @@
 #include "python/_eos/converters.hh"
 #include "python/_eos/external-log-likelihood-block.hh"
 #include "python/_eos/external-observable.hh"
+#include "python/_eos/gil.hh"
 #include "python/_eos/log.hh"
 #include "python/_eos/version.hh"
 #include "python/_eos/wrappers.hh"
@@ -385,6 +393,40 @@ BOOST_PYTHON_MODULE(_eos)
             Return the current generator value of a parameter.
             )");
 
+    // ParameterVector
+    class_<::impl::ParameterVector>("ParameterVector", R"(
+            Provides bulk access to the values and generator values of an ordered list of parameters.
+
+            Each method crosses the boundary between Python and C++ only once, independent of the number of parameters.
+
+            :param parameters: The parameters, in the order in which their values are set and returned.
+            :type parameters: list of eos.Parameter
+        )",
+                                    init<object>())
+            .def("__len__", &::impl::ParameterVector::size)
+            .def("set", &::impl::ParameterVector::set, R"(
+            Set the values of all parameters.
+
+            :param values: The values, in the order of the parameters.
+            :type values: numpy.ndarray or iterable of float
+            )")
+            .def("values", &::impl::ParameterVector::values, R"(
+            Return the current values of all parameters.
+
+            :rtype: numpy.ndarray
+            )")
+            .def("set_generators", &::impl::ParameterVector::set_generators, R"(
+            Set the generator values of all parameters.
+
+            :param values: The generator values, in the order of the parameters.
+            :type values: numpy.ndarray or iterable of float
+            )")
+            .def("generators", &::impl::ParameterVector::generators, R"(
+            Return the current generator values of all parameters.
+
+            :rtype: numpy.ndarray
+            )");
+
     // ParameterUser
     class_<ParameterUser>("ParameterUser", no_init).def("used_parameter_ids", range(&ParameterUser::begin, &ParameterUser::end));
 
@@ -566,12 +608,122 @@ BOOST_PYTHON_MODULE(_eos)
             :rtype: int
         )",
                  args("observable"))
-            .def("update", &ObservableCache::update, R"(
+            .def("__len__", &ObservableCache::size)
+            .def("update", &::impl::WithoutGIL<&ObservableCache::update>::call, R"(
             Update the cache for the current parameter point.
+
+            The global interpreter lock is released during the update.
+        )")
+            .def("predictions", &::impl::ObservableCache_predictions, R"(
+            Returns the predictions of all observables, indexed by their handles.
+
+            The predictions are copied in a single call. The array does not reflect subsequent calls to :meth:`update`.
+
+            :rtype: numpy.ndarray
         )")
             .def("parameters", &ObservableCache::parameters, R"(
             Retrieve the set of parameters bound to this cache.
-        )");
+        )")
+            .def("enable_profiling", &ObservableCache::enable_profiling, R"(
+            Enable or disable the profiling of the updates of all caches.
+
+            When enabled, the wall time and the number of calls are recorded for each observable, together with
+            the number of numerical integrations and the hits and misses of the memoisers.
+
+            :param enabled: If true, subsequent updates are profiled.
+            :type enabled: bool
+        )",
+                 args("enabled"))
+            .staticmethod("enable_profiling")
+            .def("reset_profile", &ObservableCache::reset_profile, R"(
+            Discard all profiling data recorded so far.
+        )")
+            .staticmethod("reset_profile")
+            .def("profile", &ObservableCache::profile, R"(
+            Retrieve the profiling data recorded so far.
+
+            :param format: Either ``'json'``, for a JSON object with one entry per observable ordered by decreasing wall time
+                           and the totals per thread, or ``'folded'``, for the folded-stack format of flame graph tools.
+            :type format: str
+
+            :rtype: str
+        )",
+                 (arg("format") = "json"))
+            .staticmethod("profile");
+
+    // kernel density estimates and weighted quantiles
+    def("kernel_density_estimate_1d", &::impl::kernel_density_estimate_1d, R"(
+        Evaluates the Gaussian kernel density estimate (KDE) of a weighted sample of one variable.
+
+        The bandwidth follows the conventions of :class:`scipy.stats.gaussian_kde`. The samples are binned onto a fine grid
+        and convolved with the kernel using FFTs, which makes the cost independent of the product of the number of samples
+        and the number of points. Samples with non-finite values or weights are ignored.
+
+        :param samples: The values of the samples.
+        :type samples: 1D numpy.ndarray
+        :param weights: The weights of the samples, or None for unit weights.
+        :type weights: 1D numpy.ndarray or None
+        :param points: The points at which the density is evaluated.
+        :type points: 1D numpy.ndarray
+        :param bandwidth: The rule that determines the bandwidth factor; either ``'silverman'`` (default) or ``'scott'``.
+        :type bandwidth: str
+        :param factor: The relative factor that multiplies the bandwidth factor. Defaults to 1.
+        :type factor: float
+        :return: The values of the density at the points.
+        :rtype: 1D numpy.ndarray
+    )",
+        (arg("samples"), arg("weights"), arg("points"), arg("bandwidth") = "silverman", arg("factor") = 1.0));
+    def("kernel_density_estimate_2d", &::impl::kernel_density_estimate_2d, R"(
+        Evaluates the Gaussian kernel density estimate (KDE) of a weighted sample of two variables on a rectangular grid.
+
+        See :func:`kernel_density_estimate_1d` for the conventions.
+
+        :param xsamples: The x values of the samples.
+        :type xsamples: 1D numpy.ndarray
+        :param ysamples: The y values of the samples.
+        :type ysamples: 1D numpy.ndarray
+        :param weights: The weights of the samples, or None for unit weights.
+        :type weights: 1D numpy.ndarray or None
+        :param xpoints: The x coordinates of the grid.
+        :type xpoints: 1D numpy.ndarray
+        :param ypoints: The y coordinates of the grid.
+        :type ypoints: 1D numpy.ndarray
+        :param bandwidth: The rule that determines the bandwidth factor; either ``'silverman'`` (default) or ``'scott'``.
+        :type bandwidth: str
+        :param factor: The relative factor that multiplies the bandwidth factor. Defaults to 1.
+        :type factor: float
+        :return: The values of the density, with the entry ``[i, j]`` at ``(xpoints[i], ypoints[j])``.
+        :rtype: 2D numpy.ndarray
+    )",
+        (arg("xsamples"), arg("ysamples"), arg("weights"), arg("xpoints"), arg("ypoints"), arg("bandwidth") = "silverman", arg("factor") = 1.0));
+    def("hpd_threshold", &::impl::hpd_threshold, R"(
+        Determines the threshold of the highest-density region from the values of a density on a grid of equally-sized cells.
+
+        The region where the density is not smaller than the threshold contains at least the given probability.
+
+        :param density: The values of the density.
+        :type density: numpy.ndarray
+        :param probability: The probability content of the region, in [0, 1].
+        :type probability: float
+        :rtype: float
+    )",
+        (arg("density"), arg("probability")));
+    def("weighted_quantiles", &::impl::weighted_quantiles, R"(
+        Computes the quantiles of a weighted sample, ignoring NaN values.
+
+        Each sample's weight is assigned half to the left and half to the right of its value. The columns of a 2D sample
+        are processed in parallel.
+
+        :param samples: The samples, with one row per sample.
+        :type samples: 1D or 2D numpy.ndarray
+        :param quantiles: The quantiles to compute, in [0, 1].
+        :type quantiles: 1D numpy.ndarray or list of float
+        :param weights: The weights of the samples, or None for unit weights.
+        :type weights: 1D numpy.ndarray or None
+        :return: The quantiles, with one row per quantile and one column per column of the samples.
+        :rtype: 1D or 2D numpy.ndarray
+    )",
+        (arg("samples"), arg("quantiles"), arg("weights") = object()));
 
     // ReferenceName
     class_<ReferenceName>("ReferenceName", init<std::string>())
@@ -588,7 +740,7 @@ BOOST_PYTHON_MODULE(_eos)
     register_ptr_to_python<std::shared_ptr<LogLikelihoodBlock>>();
     class_<LogLikelihoodBlock, boost::noncopyable>("LogLikelihoodBlock", no_init)
             .def("__str__", &LogLikelihoodBlock::as_string)
-            .def("evaluate", &LogLikelihoodBlock::evaluate, R"(
+            .def("evaluate", &::impl::WithoutGIL<&LogLikelihoodBlock::evaluate>::call, R"(
             Evaluate the log-likelihood block at the current parameter point.
         )")
             .def("number_of_observations", &LogLikelihoodBlock::number_of_observations, R"(
@@ -606,7 +758,46 @@ BOOST_PYTHON_MODULE(_eos)
             :rtype: eos.LogLikelihoodBlock
         )",
                  args("cache", "factory"))
-            .staticmethod("External");
+            .staticmethod("External")
+            .def("Unbinned", &LogLikelihoodBlock::Unbinned, R"(
+            Create a new log-likelihood block for the unbinned likelihood of a sample of events.
+
+            The PDF's normalization is computed once per evaluation, and the events are processed concurrently.
+
+            :param cache: The observable cache used by the total log-likelihood.
+            :type cache: eos.ObservableCache
+            :param pdf: The signal PDF.
+            :type pdf: eos.SignalPDF
+            :param events: The events, with one column per kinematic variable of the PDF, followed by the event weight if weighted is True.
+            :type events: eos.EventSample
+            :param weighted: Whether the last column of the events holds the event weights.
+            :type weighted: bool
+            :param expected_yield: The observable for the expected yield, which enables the extended likelihood, or None.
+            :type expected_yield: eos.Observable or None
+
+            :returns: The new block.
+            :rtype: eos.LogLikelihoodBlock
+        )",
+                 (arg("cache"), arg("pdf"), arg("events"), arg("weighted") = false, arg("expected_yield") = ObservablePtr()))
+            .staticmethod("Unbinned");
+
+    // EventSample
+    class_<EventSample>("EventSample", R"(
+            Represents a read-only table of events, either held in memory or mapped from a binary file.
+
+            The file must contain raw double-precision values in the native byte order, stored event by event,
+            e.g., as written by numpy.ndarray.tofile for an array of dtype float64.
+
+            :param source: The name of the file, or the list of values of all events.
+            :type source: str or list of float
+            :param columns: The number of values per event.
+            :type columns: int
+        )",
+                        init<std::string, unsigned>())
+            .def(init<std::vector<double>, unsigned>())
+            .def("columns", &EventSample::columns)
+            .def("size", &EventSample::size)
+            .def("__len__", &EventSample::size);
 
     // LogLikelihood
     class_<LogLikelihood>("LogLikelihood", R"(
@@ -617,7 +808,7 @@ BOOST_PYTHON_MODULE(_eos)
             .def("add", (void(LogLikelihood::*)(const LogLikelihoodBlockPtr &)) & LogLikelihood::add)
             .def("__iter__", range(&LogLikelihood::begin, &LogLikelihood::end))
             .def("observable_cache", &LogLikelihood::observable_cache)
-            .def("evaluate", &LogLikelihood::operator());
+            .def("evaluate", &::impl::WithoutGIL<&LogLikelihood::operator()>::call);
 
     // Constraint
     class_<Constraint>("Constraint", no_init)
@@ -653,6 +844,7 @@ BOOST_PYTHON_MODULE(_eos)
     register_ptr_to_python<std::shared_ptr<LogPrior>>();
     ::impl::iterable_to_std_vector_converter<QualifiedName>       iterable_to_std_vector_converter_QualifiedName;
     ::impl::iterable_to_std_vector_converter<double>              iterable_to_std_vector_converter_double;
+    ::impl::iterable_to_std_vector_converter<unsigned>            iterable_to_std_vector_converter_unsigned;
     ::impl::iterable_to_std_vector_converter<std::vector<double>> iterable_to_std_vector_converter_vector_double;
     class_<LogPrior, boost::noncopyable>("LogPrior", R"(
             Represents a Bayesian prior on the log scale.
@@ -805,8 +997,16 @@ BOOST_PYTHON_MODULE(_eos)
             .def("log_priors", range(&LogPosterior::begin_priors, &LogPosterior::end_priors), R"(
             Returns a range of :class:`LogPrior` objects used as part of the posterior.
         )")
-            .def("evaluate", &LogPosterior::evaluate, R"(
+            .def("evaluate", &::impl::WithoutGIL<&LogPosterior::evaluate>::call, R"(
             Returns the posterior probability density.
+        )")
+            .def("sample_priors", &::impl::LogPosterior_sample_priors, R"(
+            Sets the values of all varied parameters from their generator values, using the inverse CDFs of all priors.
+            This is equivalent to calling :meth:`LogPrior.sample` for each prior.
+        )")
+            .def("compute_cdfs", &::impl::LogPosterior_compute_cdfs, R"(
+            Sets the generator values of all varied parameters from their values, using the CDFs of all priors.
+            This is equivalent to calling :meth:`LogPrior.compute_cdf` for each prior.
         )");
 
     // test_statistics::ChiSquare
@@ -815,12 +1015,34 @@ BOOST_PYTHON_MODULE(_eos)
             .def_readonly("dof", &test_statistics::ChiSquare::dof)
             .def_readonly("signed_chi", &test_statistics::ChiSquare::signed_chi);
 
+    // GoodnessOfFit::ToyConfig
+    class_<GoodnessOfFit::ToyConfig>("GoodnessOfFitToyConfig", R"(
+            Represents the configuration of :meth:`GoodnessOfFit.simulate_p_values`.
+        )")
+            .def_readwrite("toys", &GoodnessOfFit::ToyConfig::toys)
+            .def_readwrite("seed", &GoodnessOfFit::ToyConfig::seed)
+            .def_readwrite("chunk_size", &GoodnessOfFit::ToyConfig::chunk_size)
+            .def_readwrite("optimize", &GoodnessOfFit::ToyConfig::optimize)
+            .def_readwrite("max_iterations", &GoodnessOfFit::ToyConfig::max_iterations)
+            .def_readwrite("tolerance", &GoodnessOfFit::ToyConfig::tolerance)
+            .def_readwrite("step_size", &GoodnessOfFit::ToyConfig::step_size);
+
+    // GoodnessOfFit::ToyResults
+    class_<GoodnessOfFit::ToyResults>("GoodnessOfFitToyResults", no_init)
+            .def_readonly("t_obs", &GoodnessOfFit::ToyResults::t_obs)
+            .add_property("t", make_getter(&GoodnessOfFit::ToyResults::t, return_value_policy<return_by_value>()))
+            .def_readonly("p_value", &GoodnessOfFit::ToyResults::p_value)
+            .def_readonly("p_value_uncertainty", &GoodnessOfFit::ToyResults::p_value_uncertainty)
+            .add_property("constraints", make_getter(&GoodnessOfFit::ToyResults::constraints, return_value_policy<return_by_value>()))
+            .add_property("constraint_p_values", make_getter(&GoodnessOfFit::ToyResults::constraint_p_values, return_value_policy<return_by_value>()));
+
     // GoodnessOfFit
     ::impl::std_pair_to_python_converter<const QualifiedName, test_statistics::ChiSquare> converter_goodnessoffit_chi_square_iter;
     class_<GoodnessOfFit>("GoodnessOfFit", R"(
             Represents the goodness of fit characteristics of the log(posterior).
         )",
-                          init<LogPosterior>())
+                          no_init)
+            .def("__init__", make_constructor(&::impl::construct_without_gil<GoodnessOfFit, const LogPosterior &>))
             .def("__iter__", range(&GoodnessOfFit::begin_chi_square, &GoodnessOfFit::end_chi_square))
             .def("total_chi_square", &GoodnessOfFit::total_chi_square, R"(
             Returns the total :math:`\chi^2` value of the log(likelihood). Only (multivariate) gaussian
@@ -828,8 +1050,166 @@ BOOST_PYTHON_MODULE(_eos)
         )")
             .def("total_degrees_of_freedom", &GoodnessOfFit::total_degrees_of_freedom, R"(
             Returns the total number of degrees of freedom in the log(posterior).
+        )")
+            .def("simulate_p_values", &::impl::WithoutGIL<&GoodnessOfFit::simulate_p_values>::call, R"(
+            Simulates p-values for the current parameter point from pseudo data drawn from all log-likelihood blocks.
+            The current parameter point should be the best-fit point. By default, each simulated data set is refitted.
+
+            Contrary to :meth:`total_chi_square`, this also covers non-Gaussian likelihoods. The data sets are simulated
+            concurrently; for a fixed seed, the results do not depend on the number of threads.
+
+            :param config: The configuration of the simulation.
+            :type config: eos.GoodnessOfFitToyConfig
+
+            :returns: The observed and simulated values of the test statistic, and the p-values.
+            :rtype: eos.GoodnessOfFitToyResults
+        )",
+                 args("self", "config"));
+
+    // NestedSampler::Config
+    class_<NestedSampler::Config>("NestedSamplerConfig", R"(
+            Represents the configuration of a :class:`NestedSampler`.
+        )")
+            .def_readwrite("nlive", &NestedSampler::Config::nlive)
+            .def_readwrite("dlogz", &NestedSampler::Config::dlogz)
+            .def_readwrite("maxiter", &NestedSampler::Config::maxiter)
+            .def_readwrite("seed", &NestedSampler::Config::seed)
+            .def_readwrite("bound", &NestedSampler::Config::bound)
+            .def_readwrite("sample", &NestedSampler::Config::sample)
+            .def_readwrite("walks", &NestedSampler::Config::walks)
+            .def_readwrite("slices", &NestedSampler::Config::slices)
+            .def_readwrite("batch_size", &NestedSampler::Config::batch_size)
+            .def_readwrite("enlarge", &NestedSampler::Config::enlarge)
+            .def_readwrite("update_interval", &NestedSampler::Config::update_interval);
+
+    // NestedSampler::Results
+    ::impl::std_vector_to_python_converter<double>              converter_vector_double;
+    ::impl::std_vector_to_python_converter<unsigned>            converter_vector_unsigned;
+    ::impl::std_vector_to_python_converter<std::vector<double>> converter_vector_vector_double;
+    class_<NestedSampler::Results>("NestedSamplerResults", no_init)
+            .add_property("samples", make_getter(&NestedSampler::Results::samples, return_value_policy<return_by_value>()))
+            .add_property("samples_u", make_getter(&NestedSampler::Results::samples_u, return_value_policy<return_by_value>()))
+            .add_property("samples_id", make_getter(&NestedSampler::Results::samples_id, return_value_policy<return_by_value>()))
+            .add_property("samples_it", make_getter(&NestedSampler::Results::samples_it, return_value_policy<return_by_value>()))
+            .add_property("ncall", make_getter(&NestedSampler::Results::ncall, return_value_policy<return_by_value>()))
+            .add_property("logl", make_getter(&NestedSampler::Results::logl, return_value_policy<return_by_value>()))
+            .add_property("logvol", make_getter(&NestedSampler::Results::logvol, return_value_policy<return_by_value>()))
+            .add_property("logwt", make_getter(&NestedSampler::Results::logwt, return_value_policy<return_by_value>()))
+            .add_property("logz", make_getter(&NestedSampler::Results::logz, return_value_policy<return_by_value>()))
+            .add_property("logzerr", make_getter(&NestedSampler::Results::logzerr, return_value_policy<return_by_value>()))
+            .add_property("information", make_getter(&NestedSampler::Results::information, return_value_policy<return_by_value>()))
+            .def_readonly("nlive", &NestedSampler::Results::nlive)
+            .def_readonly("niter", &NestedSampler::Results::niter)
+            .def_readonly("eff", &NestedSampler::Results::eff);
+
+    // NestedSampler
+    class_<NestedSampler, boost::noncopyable>("NestedSampler", R"(
+            Samples from the log(likelihood) of a log(posterior) using static nested sampling.
+
+            Batches of live points are replaced concurrently, using one clone of the log(posterior) per thread.
+
+            :param log_posterior: The log(posterior) whose priors define the mapping from the unit hypercube to the parameter space.
+            :type log_posterior: eos.LogPosterior
+            :param config: The configuration of the sampler.
+            :type config: eos.NestedSamplerConfig
+        )",
+                                              no_init)
+            .def("__init__", make_constructor(&::impl::construct_without_gil<NestedSampler, const LogPosterior &, const NestedSampler::Config &>))
+            .def("run", &::impl::WithoutGIL<&NestedSampler::run>::call, R"(
+            Runs the sampler until the termination criterion is met, and returns the results.
         )");
 
+    // ProfileLikelihood::Config
+    class_<ProfileLikelihood::Config>("ProfileLikelihoodConfig", R"(
+            Represents the configuration of :meth:`ProfileLikelihood.profile`.
+        )")
+            .def_readwrite("chunk_size", &ProfileLikelihood::Config::chunk_size)
+            .def_readwrite("max_iterations", &ProfileLikelihood::Config::max_iterations)
+            .def_readwrite("tolerance", &ProfileLikelihood::Config::tolerance)
+            .def_readwrite("step_size", &ProfileLikelihood::Config::step_size)
+            .def_readwrite("restarts", &ProfileLikelihood::Config::restarts);
+
+    // ProfileLikelihood::Results
+    class_<ProfileLikelihood::Results>("ProfileLikelihoodResults", no_init)
+            .add_property("parameters", make_getter(&ProfileLikelihood::Results::parameters, return_value_policy<return_by_value>()))
+            .add_property("nuisance_parameters", make_getter(&ProfileLikelihood::Results::nuisance_parameters, return_value_policy<return_by_value>()))
+            .add_property("points", make_getter(&ProfileLikelihood::Results::points, return_value_policy<return_by_value>()))
+            .add_property("log_posterior", make_getter(&ProfileLikelihood::Results::log_posterior, return_value_policy<return_by_value>()))
+            .add_property("nuisance_values", make_getter(&ProfileLikelihood::Results::nuisance_values, return_value_policy<return_by_value>()))
+            .add_property("iterations", make_getter(&ProfileLikelihood::Results::iterations, return_value_policy<return_by_value>()));
+
+    // ProfileLikelihood
+    class_<ProfileLikelihood, boost::noncopyable>("ProfileLikelihood", R"(
+            Profiles the log(posterior) in one or more parameters of interest, maximising it with respect to all other varied parameters.
+
+            The grid points are processed concurrently in chunks, using one clone of the log(posterior) per thread.
+            Within a chunk, each maximisation starts from the solution at the neighbouring grid point.
+
+            :param log_posterior: The log(posterior) to be profiled.
+            :type log_posterior: eos.LogPosterior
+            :param parameters: The names of the parameters of interest.
+            :type parameters: iterable of str or eos.QualifiedName
+        )",
+                                                  no_init)
+            .def("__init__", make_constructor(&::impl::construct_without_gil<ProfileLikelihood, const LogPosterior &, const std::vector<QualifiedName> &>))
+            .def("profile", &::impl::WithoutGIL<&ProfileLikelihood::profile>::call, R"(
+            Computes the profile on the Cartesian product of the values of the parameters of interest.
+
+            :param values: The values of each parameter of interest.
+            :type values: iterable of iterables of float
+            :param config: The configuration of the maximisations.
+            :type config: eos.ProfileLikelihoodConfig
+
+            :returns: The profile, and the values of the nuisance parameters at each grid point.
+            :rtype: eos.ProfileLikelihoodResults
+        )",
+                 args("self", "values", "config"));
+
+    // SampleMaskEvaluator
+    enum_<SampleMaskEvaluator::Combination>("SampleMaskCombination")
+            .value("conjunction", SampleMaskEvaluator::Combination::conjunction)
+            .value("disjunction", SampleMaskEvaluator::Combination::disjunction);
+
+    class_<SampleMaskEvaluator, boost::noncopyable>("SampleMaskEvaluator", R"(
+            Evaluates sample masks on a set of samples.
+
+            A mask combines components, which are either observables or previously added masks, by logical conjunction or disjunction.
+            A sample passes an observable if its prediction is positive. All observables are held in a single cache, and the samples
+            are processed concurrently, using one clone of the cache per thread.
+
+            :param parameters: The parameters from which the observables are created.
+            :type parameters: eos.Parameters
+            :param names: The names of the parameters, in the order of the columns of the samples.
+            :type names: iterable of str or eos.QualifiedName
+        )",
+                                                    init<const Parameters &, const std::vector<QualifiedName> &>())
+            .def("add_observable", &SampleMaskEvaluator::add_observable, R"(
+            Adds an observable as a component and returns its index.
+
+            :param observable: The observable, which must use the parameters of this evaluator.
+            :type observable: eos.Observable
+        )",
+                 args("self", "observable"))
+            .def("add_mask", &SampleMaskEvaluator::add_mask, R"(
+            Adds a mask as a component and returns its index.
+
+            :param components: The indices of the components of this mask.
+            :type components: iterable of int
+            :param combination: The logical combination of the components.
+            :type combination: eos.SampleMaskCombination
+        )",
+                 args("self", "components", "combination"))
+            .def("number_of_masks", &SampleMaskEvaluator::number_of_masks)
+            .def("evaluate", &::impl::SampleMaskEvaluator_evaluate, R"(
+            Evaluates all masks on the samples.
+
+            :param samples: The samples, with one row per sample and one column per parameter.
+            :type samples: 2D numpy.ndarray
+            :returns: The values of all masks, with one row per mask in the order in which the masks were added.
+            :rtype: 2D numpy.ndarray of bool
+        )",
+                 args("self", "samples"));
+
     // }}}
 
     // {{{ eos/
@@ -877,13 +1257,26 @@ BOOST_PYTHON_MODULE(_eos)
         )",
                  args("name", "parameters", "kinematics", "options"))
             .staticmethod("make")
-            .def("evaluate", &Observable::evaluate, R"(
+            .def("evaluate", &::impl::WithoutGIL<&Observable::evaluate>::call, R"(
             Evaluates the observable for the present values of its bound set of parameters and set of kinematic variables.
 
             :return: The value of the observable.
             :rtype: float
         )",
                  args("self"))
+            .def("evaluate_many", &::impl::Observable_evaluate_many, R"(
+            Evaluates the observable for a sequence of values of one of its kinematic variables.
+
+            The kinematic variable retains its present value.
+
+            :param kinematic_name: The name of the kinematic variable.
+            :type kinematic_name: str
+            :param values: The values of the kinematic variable.
+            :type values: 1D numpy.ndarray or list of float
+            :return: The values of the observable.
+            :rtype: 1D numpy.ndarray
+        )",
+                 args("self", "kinematic_name", "values"))
             .def("name", &Observable::name, return_value_policy<copy_const_reference>(), R"(
             Returns the name of the observable.
         )")
@@ -957,7 +1350,7 @@ BOOST_PYTHON_MODULE(_eos)
                                           no_init)
             .def("make", &SignalPDF::make, return_value_policy<return_by_value>()) // docstring is maintained in python/eos/signal_pdf.py
             .staticmethod("make")
-            .def("evaluate", &SignalPDF::evaluate, R"(
+            .def("evaluate", &::impl::WithoutGIL<&SignalPDF::evaluate>::call, R"(
             Evaluates the (unnormalized) PDF for the present values of the sets of parameters and kinematic variables that it is bound to.
 
             :return: The value of the PDF.
@@ -984,6 +1377,49 @@ BOOST_PYTHON_MODULE(_eos)
             Returns the set of kinematic variables bound to this PDF.
         )");
 
+    // SignalPDFGenerator::Config
+    class_<SignalPDFGenerator::Config>("SignalPDFGeneratorConfig", R"(
+            Represents the configuration of a :class:`SignalPDFGenerator`.
+    )")
+            .def_readwrite("cells", &SignalPDFGenerator::Config::cells)
+            .def_readwrite("probes", &SignalPDFGenerator::Config::probes)
+            .def_readwrite("safety", &SignalPDFGenerator::Config::safety)
+            .def_readwrite("floor", &SignalPDFGenerator::Config::floor)
+            .def_readwrite("seed", &SignalPDFGenerator::Config::seed)
+            .def_readwrite("chunk_size", &SignalPDFGenerator::Config::chunk_size);
+
+    // SignalPDFGenerator
+    class_<SignalPDFGenerator, boost::noncopyable>("SignalPDFGenerator", R"(
+            Generates independent events from a signal PDF using accept-reject sampling with a piecewise-constant envelope.
+
+            Events are generated concurrently. For a fixed seed, they do not depend on the number of threads.
+
+            :param pdf: The signal PDF from which events shall be generated.
+            :type pdf: eos.SignalPDF
+            :param config: The configuration of the generator.
+            :type config: eos.SignalPDFGeneratorConfig
+    )",
+                                                   no_init)
+            .def("__init__", make_constructor(&::impl::construct_without_gil<SignalPDFGenerator, const SignalPDFPtr &, const SignalPDFGenerator::Config &>))
+            .def("variables", &SignalPDFGenerator::variables, return_value_policy<copy_const_reference>(), R"(
+            Returns the names of the kinematic variables, in the order in which they are stored for each event.
+        )")
+            .def("generate", &::impl::SignalPDFGenerator_generate, R"(
+            Fills the provided arrays with independent events.
+
+            :param events: Array of dtype float64 and shape (N, D), where D is the number of kinematic variables.
+            :type events: numpy.ndarray
+            :param log_pdf: Array of dtype float64 and shape (N,) for the values of the log(PDF), or None.
+            :type log_pdf: numpy.ndarray or None
+        )",
+                 args("self", "events", "log_pdf"))
+            .def("efficiency", &SignalPDFGenerator::efficiency, R"(
+            Returns the fraction of accepted proposals during the last call to generate.
+        )")
+            .def("envelope_violations", &SignalPDFGenerator::envelope_violations, R"(
+            Returns the number of cells in which the PDF exceeded the envelope during the last call to generate.
+        )");
+
     // SignalPDFEntry
     register_ptr_to_python<std::shared_ptr<const SignalPDFEntry>>();
     class_<SignalPDFEntry, boost::noncopyable>("SignalPDFEntry", no_init)
@@ -1011,6 +1447,43 @@ BOOST_PYTHON_MODULE(_eos)
             .def("__iter__", range(&SignalPDFs::begin, &SignalPDFs::end))
             .def("sections", range(&SignalPDFs::begin_sections, &SignalPDFs::end_sections));
 
+    // B -> PP amplitudes of several channels
+    ::impl::iterable_to_std_vector_converter<Options>       iterable_to_std_vector_converter_Options;
+    ::impl::std_vector_to_python_converter<complex<double>> converter_vector_complex_double;
+    class_<SU3FRepresentation<PToPP>::Channels, boost::noncopyable>("SU3FChannels", R"(
+            Evaluates the SU(3)_F amplitudes for B -> [P2 P1 + P1 P2] of several channels that share the same parameters and model,
+            as needed in global fits of B -> PP decays. The hadronic parameters, the CKM factors, and the mixing angle are evaluated
+            only once per call.
+
+            :param parameters: The parameters from which the amplitudes are created.
+            :type parameters: eos.Parameters
+            :param options: The options common to all channels, including the model.
+            :type options: eos.Options
+            :param channels: The options of each channel, i.e., q, P1, P2, and the like, which must not change the model.
+            :type channels: iterable of eos.Options
+        )",
+                                                                     init<const Parameters &, const Options &, const std::vector<Options> &>())
+            .def("amplitudes", &SU3FRepresentation<PToPP>::Channels::amplitudes, R"(
+            Returns the amplitudes of all channels, in the order in which the channels were given.
+        )");
+
+    class_<TopologicalRepresentation<PToPP>::Channels, boost::noncopyable>("TopologicalChannels", R"(
+            Evaluates the topological amplitudes for B -> [P2 P1 + P1 P2] of several channels that share the same parameters and model,
+            as needed in global fits of B -> PP decays. The hadronic parameters, the CKM factors, and the mixing angle are evaluated
+            only once per call.
+
+            :param parameters: The parameters from which the amplitudes are created.
+            :type parameters: eos.Parameters
+            :param options: The options common to all channels, including the model.
+            :type options: eos.Options
+            :param channels: The options of each channel, i.e., q, P1, P2, and the like, which must not change the model.
+            :type channels: iterable of eos.Options
+        )",
+                                                                            init<const Parameters &, const Options &, const std::vector<Options> &>())
+            .def("amplitudes", &TopologicalRepresentation<PToPP>::Channels::amplitudes, R"(
+            Returns the amplitudes of all channels, in the order in which the channels were given.
+        )");
+
     // Analytic Charm Loops
     def("delta_c7", &agv_2019a::delta_c7);
     def("delta_c7_Qc", &agv_2019a::delta_c7_Qc);
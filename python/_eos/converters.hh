@@ -59,6 +59,116 @@ namespace impl
             }
     };
 
+    // provides access to the memory of a writable, C-contiguous Python buffer of doubles, e.g. a NumPy array of dtype float64
+    class WritableDoubleBuffer
+    {
+        private:
+            Py_buffer _view;
+
+        public:
+            WritableDoubleBuffer(const boost::python::object & object, const char * name)
+            {
+                if (0 != PyObject_GetBuffer(object.ptr(), &_view, PyBUF_C_CONTIGUOUS | PyBUF_WRITABLE | PyBUF_FORMAT))
+                {
+                    PyErr_Clear();
+                    PyErr_SetString(PyExc_TypeError, (std::string(name) + " must be a writable, C-contiguous buffer of float64").c_str());
+                    boost::python::throw_error_already_set();
+                }
+
+                if ((_view.itemsize != sizeof(double)) || (nullptr == _view.format) || (std::string(_view.format) != "d"))
+                {
+                    PyBuffer_Release(&_view);
+                    PyErr_SetString(PyExc_TypeError, (std::string(name) + " must have dtype float64").c_str());
+                    boost::python::throw_error_already_set();
+                }
+            }
+
+            ~WritableDoubleBuffer() { PyBuffer_Release(&_view); }
+
+            WritableDoubleBuffer(const WritableDoubleBuffer &)             = delete;
+            WritableDoubleBuffer & operator= (const WritableDoubleBuffer &) = delete;
+
+            double *
+            data() const
+            {
+                return static_cast<double *>(_view.buf);
+            }
+
+            std::size_t
+            size() const
+            {
+                return _view.len / sizeof(double);
+            }
+    };
+
+    // provides read access to a C-contiguous Python buffer of doubles; other sequences are converted through NumPy
+    class ReadableDoubleBuffer
+    {
+        private:
+            boost::python::object _object;
+
+            Py_buffer _view;
+
+            bool
+            acquire()
+            {
+                if (0 != PyObject_GetBuffer(_object.ptr(), &_view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+                {
+                    PyErr_Clear();
+                    return false;
+                }
+
+                if ((_view.itemsize != sizeof(double)) || (nullptr == _view.format) || (std::string(_view.format) != "d"))
+                {
+                    PyBuffer_Release(&_view);
+                    return false;
+                }
+
+                return true;
+            }
+
+        public:
+            ReadableDoubleBuffer(const boost::python::object & object, const char * name) :
+                _object(object)
+            {
+                if (acquire())
+                {
+                    return;
+                }
+
+                _object = boost::python::import("numpy").attr("ascontiguousarray")(object, "float64");
+
+                if (! acquire())
+                {
+                    PyErr_SetString(PyExc_TypeError, (std::string(name) + " must be convertible to a C-contiguous buffer of float64").c_str());
+                    boost::python::throw_error_already_set();
+                }
+            }
+
+            ~ReadableDoubleBuffer() { PyBuffer_Release(&_view); }
+
+            ReadableDoubleBuffer(const ReadableDoubleBuffer &)             = delete;
+            ReadableDoubleBuffer & operator= (const ReadableDoubleBuffer &) = delete;
+
+            const double *
+            data() const
+            {
+                return static_cast<const double *>(_view.buf);
+            }
+
+            std::size_t
+            size() const
+            {
+                return _view.len / sizeof(double);
+            }
+
+            // the extents of the buffer in each of its dimensions
+            std::vector<std::size_t>
+            shape() const
+            {
+                return std::vector<std::size_t>(_view.shape, _view.shape + _view.ndim);
+            }
+    };
 } // namespace impl
 
 #endif // EOS_PYTHON__EOS_CONVERTERS_HH
@@ -26,14 +26,18 @@ using boost::python::object;
 
 namespace eos
 {
-    ExternalLogLikelihoodBlock::ExternalLogLikelihoodBlock(const ObservableCache & cache, object factory) :
+    ExternalLogLikelihoodBlock::ExternalLogLikelihoodBlock(const ObservableCache & cache, const ::impl::SharedObject & factory) :
         _cache(cache),
-        _factory(factory),
-        _python_llh_block(_factory(_cache)),
-        _evaluate(_python_llh_block.attr("evaluate")),
-        _number_of_observations(extract<unsigned>(_python_llh_block.attr("number_of_observations")))
+        _factory(factory)
     {
-        if (! PyCallable_Check(_evaluate.ptr()))
+        // clones are created from within worker threads
+        ::impl::AcquireGIL gil;
+
+        _python_llh_block       = ::impl::share((*_factory)(_cache));
+        _evaluate               = ::impl::share(_python_llh_block->attr("evaluate"));
+        _number_of_observations = extract<unsigned>(_python_llh_block->attr("number_of_observations"));
+
+        if (! PyCallable_Check(_evaluate->ptr()))
         {
             throw InternalError("ExternalLogLikelihoodBlock encountered a factory that does not yield a callable 'evaluate()' attribute");
         }
@@ -44,7 +48,7 @@ namespace eos
     LogLikelihoodBlockPtr
     ExternalLogLikelihoodBlock::make(const ObservableCache & cache, object factory)
     {
-        return LogLikelihoodBlockPtr(new ExternalLogLikelihoodBlock(cache, factory));
+        return LogLikelihoodBlockPtr(new ExternalLogLikelihoodBlock(cache, ::impl::share(factory)));
     }
 
     std::string
@@ -62,7 +66,9 @@ namespace eos
     double
     ExternalLogLikelihoodBlock::evaluate() const
     {
-        return extract<double>(_evaluate());
+        ::impl::AcquireGIL gil;
+
+        return extract<double>((*_evaluate)());
     }
 
     unsigned int
@@ -19,6 +19,8 @@
 
 #include "eos/statistics/log-likelihood.hh"
 
+#include "python/_eos/gil.hh"
+
 #include <boost/python.hpp>
 
 #ifndef EOS_PYTHON__EOS_EXTERNAL_LOG_LIKELIHOOD_BLOCK_HH
@@ -29,14 +31,14 @@ namespace eos
     class ExternalLogLikelihoodBlock : public LogLikelihoodBlock
     {
         private:
-            ObservableCache       _cache;
-            boost::python::object _factory;
-            boost::python::object _python_llh_block;
-            boost::python::object _evaluate;
-            unsigned              _number_of_observations;
+            ObservableCache      _cache;
+            ::impl::SharedObject _factory;
+            ::impl::SharedObject _python_llh_block;
+            ::impl::SharedObject _evaluate;
+            unsigned             _number_of_observations;
 
         public:
-            ExternalLogLikelihoodBlock(const ObservableCache & cache, boost::python::object factory);
+            ExternalLogLikelihoodBlock(const ObservableCache & cache, const ::impl::SharedObject & factory);
 
             ~ExternalLogLikelihoodBlock();
 
@@ -29,31 +29,36 @@ using boost::python::stl_input_iterator;
 
 namespace eos
 {
-    ExternalObservable::ExternalObservable(const QualifiedName & name, object provider, const Parameters & parameters, const Kinematics & kinematics, const Options & options) :
+    ExternalObservable::ExternalObservable(const QualifiedName & name, const ::impl::SharedObject & provider, const Parameters & parameters, const Kinematics & kinematics, const Options & options) :
         _name(name),
         _provider(provider),
         _parameters(parameters),
         _kinematics(kinematics),
         _options(options)
     {
-        if (! PyCallable_Check(_provider.ptr()))
+        // clones are created from within the ObservableCache's worker threads
+        ::impl::AcquireGIL gil;
+
+        if (! PyCallable_Check(_provider->ptr()))
         {
             throw InternalError("ExternalObservable encountered an observable provider that is not callable/constructible");
         }
 
-        auto o = boost::python::object(_provider(parameters, kinematics, options));
+        auto o = boost::python::object((*_provider)(parameters, kinematics, options));
 
-        _evaluate = o.attr("evaluate");
+        object evaluate = o.attr("evaluate");
 
-        if (_evaluate.is_none())
+        if (evaluate.is_none())
         {
             throw InternalError("ExternalObservable encountered an observable provider that lacks the 'evaluate' attribute");
         }
 
-        if (! PyCallable_Check(_evaluate.ptr()))
+        if (! PyCallable_Check(evaluate.ptr()))
         {
             throw InternalError("ExternalObservable encountered an 'evaluate' attribute that is not callable");
         }
+
+        _evaluate = ::impl::share(evaluate);
     }
 
     ExternalObservable::~ExternalObservable() = default;
@@ -67,7 +72,9 @@ namespace eos
     double
     ExternalObservable::evaluate() const
     {
-        return extract<double>(_evaluate());
+        ::impl::AcquireGIL gil;
+
+        return extract<double>((*_evaluate)());
     }
 
     Parameters
@@ -102,11 +109,11 @@ namespace eos
 
     ExternalObservableEntry::ExternalObservableEntry(const QualifiedName & name, object provider, const std::string & latex, const Unit & unit) :
         _name(name),
-        _provider(provider),
+        _provider(::impl::share(provider)),
         _latex(latex),
         _unit(unit)
     {
-        object kinematic_variables = _provider.attr("kinematic_variables");
+        object kinematic_variables = provider.attr("kinematic_variables");
         if (kinematic_variables.is_none())
         {
             throw InternalError("ExternalObservableEntry encountered a factory that posesses no 'kinematic_variables' attribute");
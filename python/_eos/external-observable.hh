@@ -19,6 +19,8 @@
 
 #include "eos/observable.hh"
 
+#include "python/_eos/gil.hh"
+
 #include <boost/python.hpp>
 
 #ifndef EOS_PYTHON__EOS_EXTERNAL_OBSERVABLE_HH
@@ -29,15 +31,15 @@ namespace eos
     class ExternalObservable : public Observable
     {
         private:
-            eos::QualifiedName    _name;
-            boost::python::object _provider;
-            Parameters            _parameters;
-            Kinematics            _kinematics;
-            Options               _options;
-            boost::python::object _evaluate;
+            eos::QualifiedName   _name;
+            ::impl::SharedObject _provider;
+            Parameters           _parameters;
+            Kinematics           _kinematics;
+            Options              _options;
+            ::impl::SharedObject _evaluate;
 
         public:
-            ExternalObservable(const QualifiedName & name, boost::python::object provider, const Parameters & parameters, const Kinematics & kinematics, const Options & options);
+            ExternalObservable(const QualifiedName & name, const ::impl::SharedObject & provider, const Parameters & parameters, const Kinematics & kinematics, const Options & options);
 
             ~ExternalObservable() override;
 
@@ -60,7 +62,7 @@ namespace eos
     {
         private:
             eos::QualifiedName               _name;
-            boost::python::object            _provider;
+            ::impl::SharedObject             _provider;
             std::string                      _latex;
             Unit                             _unit;
             std::vector<std::string>         _kinematic_variables;
@@ -0,0 +1,111 @@
+/* vim: set sw=4 sts=4 et foldmethod=marker : */
+
+/*
+ * Copyright (c) 2025      Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <boost/python.hpp>
+
+#include <memory>
+
+#ifndef EOS_PYTHON__EOS_GIL_HH
+#  define EOS_PYTHON__EOS_GIL_HH 1
+
+namespace impl
+{
+    // releases the global interpreter lock for the lifetime of the object
+    class ReleaseGIL
+    {
+        private:
+            PyThreadState * _state;
+
+        public:
+            ReleaseGIL() :
+                _state(PyEval_SaveThread())
+            {
+            }
+
+            ~ReleaseGIL() { PyEval_RestoreThread(_state); }
+
+            ReleaseGIL(const ReleaseGIL &)             = delete;
+            ReleaseGIL & operator= (const ReleaseGIL &) = delete;
+    };
+
+    // acquires the global interpreter lock for the lifetime of the object, from any thread
+    class AcquireGIL
+    {
+        private:
+            PyGILState_STATE _state;
+
+        public:
+            AcquireGIL() :
+                _state(PyGILState_Ensure())
+            {
+            }
+
+            ~AcquireGIL() { PyGILState_Release(_state); }
+
+            AcquireGIL(const AcquireGIL &)             = delete;
+            AcquireGIL & operator= (const AcquireGIL &) = delete;
+    };
+
+    // a Python object that can be copied and destroyed without holding the global interpreter lock
+    using SharedObject = std::shared_ptr<boost::python::object>;
+
+    // must be called while holding the global interpreter lock
+    inline SharedObject
+    share(const boost::python::object & object)
+    {
+        return SharedObject(new boost::python::object(object), [](boost::python::object * o) {
+            AcquireGIL gil;
+            delete o;
+        });
+    }
+
+    // calls a member function with the global interpreter lock released; use as &WithoutGIL<&Class::method>::call
+    template <auto f_> struct WithoutGIL;
+
+    template <typename Result_, typename Class_, typename... Args_, Result_ (Class_::*f_)(Args_...) const> struct WithoutGIL<f_>
+    {
+            static Result_
+            call(const Class_ & c, Args_... args)
+            {
+                ReleaseGIL gil;
+                return (c.*f_)(args...);
+            }
+    };
+
+    template <typename Result_, typename Class_, typename... Args_, Result_ (Class_::*f_)(Args_...)> struct WithoutGIL<f_>
+    {
+            static Result_
+            call(Class_ & c, Args_... args)
+            {
+                ReleaseGIL gil;
+                return (c.*f_)(args...);
+            }
+    };
+
+    // constructs an object with the global interpreter lock released; use with boost::python::make_constructor
+    template <typename Class_, typename... Args_>
+    Class_ *
+    construct_without_gil(Args_... args)
+    {
+        ReleaseGIL gil;
+        return new Class_(args...);
+    }
+} // namespace impl
+
+#endif // EOS_PYTHON__EOS_GIL_HH
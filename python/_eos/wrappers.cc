@@ -18,10 +18,19 @@
  * Place, Suite 330, Boston, MA  02111-1307  USA
  */
 
+#include "python/_eos/converters.hh"
+#include "python/_eos/gil.hh"
 #include "python/_eos/wrappers.hh"
 
+#include <algorithm>
+#include <memory>
+#include <span>
+
 using boost::python::_;
 using boost::python::dict;
+using boost::python::extract;
+using boost::python::handle;
+using boost::python::import;
 using boost::python::len;
 using boost::python::list;
 using boost::python::object;
@@ -113,4 +122,278 @@ namespace impl
     {
         PyErr_SetString(PyExc_RuntimeError, e.what());
     }
+
+    void
+    SignalPDFGenerator_generate(eos::SignalPDFGenerator & generator, object events, object log_pdf)
+    {
+        const std::size_t dim = generator.variables().size();
+
+        WritableDoubleBuffer events_buffer(events, "events");
+        if (0 != events_buffer.size() % dim)
+        {
+            PyErr_SetString(PyExc_ValueError, "the size of events must be a multiple of the number of kinematic variables");
+            boost::python::throw_error_already_set();
+        }
+
+        const std::size_t n = events_buffer.size() / dim;
+
+        std::unique_ptr<WritableDoubleBuffer> log_pdf_buffer;
+        if (! log_pdf.is_none())
+        {
+            log_pdf_buffer.reset(new WritableDoubleBuffer(log_pdf, "log_pdf"));
+
+            if (log_pdf_buffer->size() != n)
+            {
+                PyErr_SetString(PyExc_ValueError, "the size of log_pdf must match the number of events");
+                boost::python::throw_error_already_set();
+            }
+        }
+
+        ReleaseGIL gil;
+        generator.generate(n, events_buffer.data(), log_pdf_buffer ? log_pdf_buffer->data() : nullptr);
+    }
+
+    object
+    Observable_evaluate_many(eos::Observable & observable, const std::string & kinematic_name, object values)
+    {
+        ReadableDoubleBuffer values_buffer(values, "values");
+
+        object result = import("numpy").attr("empty")(values_buffer.size());
+        WritableDoubleBuffer result_buffer(result, "result");
+
+        {
+            ReleaseGIL gil;
+            observable.evaluate_many(kinematic_name,
+                    std::span<const double>(values_buffer.data(), values_buffer.size()),
+                    std::span<double>(result_buffer.data(), result_buffer.size()));
+        }
+
+        return result;
+    }
+
+    object
+    ObservableCache_predictions(const eos::ObservableCache & cache)
+    {
+        // copy the predictions, since the cache's storage is reallocated when observables are added
+        object result = import("numpy").attr("empty")(cache.size());
+        WritableDoubleBuffer result_buffer(result, "result");
+        std::copy(cache.predictions(), cache.predictions() + cache.size(), result_buffer.data());
+
+        return result;
+    }
+
+    object
+    kernel_density_estimate_1d(object samples, object weights, object points, const std::string & bandwidth, const double & factor)
+    {
+        ReadableDoubleBuffer samples_buffer(samples, "samples");
+        ReadableDoubleBuffer points_buffer(points, "points");
+        std::unique_ptr<ReadableDoubleBuffer> weights_buffer(weights.is_none() ? nullptr : new ReadableDoubleBuffer(weights, "weights"));
+
+        std::vector<double> density;
+        {
+            ReleaseGIL gil;
+            eos::kde::Config config;
+            config.bandwidth = bandwidth;
+            config.factor    = factor;
+            density = eos::kde::density(
+                    std::span<const double>(samples_buffer.data(), samples_buffer.size()),
+                    weights_buffer ? std::span<const double>(weights_buffer->data(), weights_buffer->size()) : std::span<const double>(),
+                    std::span<const double>(points_buffer.data(), points_buffer.size()),
+                    config);
+        }
+
+        object result = import("numpy").attr("empty")(density.size());
+        WritableDoubleBuffer result_buffer(result, "result");
+        std::copy(density.begin(), density.end(), result_buffer.data());
+
+        return result;
+    }
+
+    object
+    kernel_density_estimate_2d(object xsamples, object ysamples, object weights, object xpoints, object ypoints, const std::string & bandwidth, const double & factor)
+    {
+        ReadableDoubleBuffer xsamples_buffer(xsamples, "xsamples");
+        ReadableDoubleBuffer ysamples_buffer(ysamples, "ysamples");
+        ReadableDoubleBuffer xpoints_buffer(xpoints, "xpoints");
+        ReadableDoubleBuffer ypoints_buffer(ypoints, "ypoints");
+        std::unique_ptr<ReadableDoubleBuffer> weights_buffer(weights.is_none() ? nullptr : new ReadableDoubleBuffer(weights, "weights"));
+
+        std::vector<double> density;
+        {
+            ReleaseGIL gil;
+            eos::kde::Config config;
+            config.bandwidth = bandwidth;
+            config.factor    = factor;
+            density = eos::kde::density(
+                    std::span<const double>(xsamples_buffer.data(), xsamples_buffer.size()),
+                    std::span<const double>(ysamples_buffer.data(), ysamples_buffer.size()),
+                    weights_buffer ? std::span<const double>(weights_buffer->data(), weights_buffer->size()) : std::span<const double>(),
+                    std::span<const double>(xpoints_buffer.data(), xpoints_buffer.size()),
+                    std::span<const double>(ypoints_buffer.data(), ypoints_buffer.size()),
+                    config);
+        }
+
+        object result = import("numpy").attr("empty")(boost::python::make_tuple(xpoints_buffer.size(), ypoints_buffer.size()));
+        WritableDoubleBuffer result_buffer(result, "result");
+        std::copy(density.begin(), density.end(), result_buffer.data());
+
+        return result;
+    }
+
+    double
+    hpd_threshold(object density, const double & probability)
+    {
+        ReadableDoubleBuffer density_buffer(density, "density");
+
+        return eos::kde::hpd_threshold(std::span<const double>(density_buffer.data(), density_buffer.size()), probability);
+    }
+
+    object
+    weighted_quantiles(object samples, object quantiles, object weights)
+    {
+        ReadableDoubleBuffer samples_buffer(samples, "samples");
+        ReadableDoubleBuffer quantiles_buffer(quantiles, "quantiles");
+        std::unique_ptr<ReadableDoubleBuffer> weights_buffer(weights.is_none() ? nullptr : new ReadableDoubleBuffer(weights, "weights"));
+
+        const auto shape = samples_buffer.shape();
+        if ((shape.size() < 1) || (shape.size() > 2))
+        {
+            PyErr_SetString(PyExc_ValueError, "samples must be a 1D or 2D array");
+            boost::python::throw_error_already_set();
+        }
+
+        const std::size_t columns = (2 == shape.size()) ? shape[1] : 1;
+
+        std::vector<double> values;
+        {
+            ReleaseGIL gil;
+            values = eos::kde::weighted_quantiles(
+                    std::span<const double>(samples_buffer.data(), samples_buffer.size()),
+                    columns,
+                    weights_buffer ? std::span<const double>(weights_buffer->data(), weights_buffer->size()) : std::span<const double>(),
+                    std::span<const double>(quantiles_buffer.data(), quantiles_buffer.size()));
+        }
+
+        object result = (2 == shape.size())
+            ? import("numpy").attr("empty")(boost::python::make_tuple(quantiles_buffer.size(), columns))
+            : import("numpy").attr("empty")(quantiles_buffer.size());
+        WritableDoubleBuffer result_buffer(result, "result");
+        std::copy(values.begin(), values.end(), result_buffer.data());
+
+        return result;
+    }
+
+    object
+    SampleMaskEvaluator_evaluate(const eos::SampleMaskEvaluator & evaluator, object samples)
+    {
+        ReadableDoubleBuffer samples_buffer(samples, "samples");
+
+        if (2 != samples_buffer.shape().size())
+        {
+            PyErr_SetString(PyExc_ValueError, "samples must be a 2D array");
+            boost::python::throw_error_already_set();
+        }
+
+        eos::SampleMaskEvaluator::Results results;
+        {
+            ReleaseGIL gil;
+            results = evaluator.evaluate(std::span<const double>(samples_buffer.data(), samples_buffer.size()));
+        }
+
+        object masks(handle<>(PyByteArray_FromStringAndSize(reinterpret_cast<const char *>(results.masks.data()), results.masks.size())));
+
+        return import("numpy").attr("frombuffer")(masks, "bool").attr("reshape")(evaluator.number_of_masks(), results.samples);
+    }
+
+    void
+    LogPosterior_sample_priors(const eos::LogPosterior & log_posterior)
+    {
+        for (auto p = log_posterior.begin_priors(), p_end = log_posterior.end_priors() ; p != p_end ; ++p)
+        {
+            (*p)->sample();
+        }
+    }
+
+    void
+    LogPosterior_compute_cdfs(const eos::LogPosterior & log_posterior)
+    {
+        for (auto p = log_posterior.begin_priors(), p_end = log_posterior.end_priors() ; p != p_end ; ++p)
+        {
+            (*p)->compute_cdf();
+        }
+    }
+
+    ParameterVector::ParameterVector(object parameters)
+    {
+        for (unsigned i = 0 ; i < len(parameters) ; ++i)
+        {
+            _parameters.push_back(extract<eos::Parameter>(parameters[i]));
+        }
+    }
+
+    unsigned
+    ParameterVector::size() const
+    {
+        return _parameters.size();
+    }
+
+    void
+    ParameterVector::set(object values)
+    {
+        ReadableDoubleBuffer buffer(values, "values");
+        if (buffer.size() != _parameters.size())
+        {
+            PyErr_SetString(PyExc_ValueError, "the size of values must match the number of parameters");
+            boost::python::throw_error_already_set();
+        }
+
+        for (std::size_t i = 0 ; i < _parameters.size() ; ++i)
+        {
+            _parameters[i].set(buffer.data()[i]);
+        }
+    }
+
+    object
+    ParameterVector::values() const
+    {
+        object result = import("numpy").attr("empty")(_parameters.size());
+
+        WritableDoubleBuffer buffer(result, "result");
+        for (std::size_t i = 0 ; i < _parameters.size() ; ++i)
+        {
+            buffer.data()[i] = _parameters[i].evaluate();
+        }
+
+        return result;
+    }
+
+    void
+    ParameterVector::set_generators(object values)
+    {
+        ReadableDoubleBuffer buffer(values, "values");
+        if (buffer.size() != _parameters.size())
+        {
+            PyErr_SetString(PyExc_ValueError, "the size of values must match the number of parameters");
+            boost::python::throw_error_already_set();
+        }
+
+        for (std::size_t i = 0 ; i < _parameters.size() ; ++i)
+        {
+            _parameters[i].set_generator(buffer.data()[i]);
+        }
+    }
+
+    object
+    ParameterVector::generators() const
+    {
+        object result = import("numpy").attr("empty")(_parameters.size());
+
+        WritableDoubleBuffer buffer(result, "result");
+        for (std::size_t i = 0 ; i < _parameters.size() ; ++i)
+        {
+            buffer.data()[i] = _parameters[i].evaluate_generator();
+        }
+
+        return result;
+    }
 } // namespace impl
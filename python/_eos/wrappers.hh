@@ -19,10 +19,20 @@
  */
 
 #include "eos/models/model.hh"
+#include "eos/observable.hh"
+#include "eos/signal-pdf-generator.hh"
+#include "eos/statistics/kernel-density-estimate.hh"
+#include "eos/statistics/log-posterior.hh"
+#include "eos/statistics/sample-mask-evaluator.hh"
 #include "eos/utils/exception.hh"
+#include "eos/utils/observable_cache.hh"
+#include "eos/utils/parameters.hh"
 
 #include <boost/python.hpp>
 
+#include <string>
+#include <vector>
+
 #ifndef EOS_PYTHON__EOS_WRAPPERS_HH
 #  define EOS_PYTHON__EOS_WRAPPERS_HH 1
 
@@ -37,6 +47,58 @@ namespace impl
     // converter for eos::Exception
     void translate_exception(const eos::Exception & e);
 
+    // fills NumPy arrays with events from a SignalPDFGenerator, without intermediate copies
+    void SignalPDFGenerator_generate(eos::SignalPDFGenerator & generator, boost::python::object events, boost::python::object log_pdf);
+
+    // evaluates an Observable for a sequence of values of one kinematic variable, returning a NumPy array
+    boost::python::object Observable_evaluate_many(eos::Observable & observable, const std::string & kinematic_name, boost::python::object values);
+
+    // returns a NumPy array with a copy of the predictions of an ObservableCache
+    boost::python::object ObservableCache_predictions(const eos::ObservableCache & cache);
+
+    // evaluates the weighted Gaussian KDE of one variable at the given points, returning a NumPy array
+    boost::python::object kernel_density_estimate_1d(boost::python::object samples, boost::python::object weights, boost::python::object points,
+            const std::string & bandwidth, const double & factor);
+
+    // evaluates the weighted Gaussian KDE of two variables on a rectangular grid, returning a 2D NumPy array
+    boost::python::object kernel_density_estimate_2d(boost::python::object xsamples, boost::python::object ysamples, boost::python::object weights,
+            boost::python::object xpoints, boost::python::object ypoints, const std::string & bandwidth, const double & factor);
+
+    // determines the threshold of a highest-density region from a density on a grid
+    double hpd_threshold(boost::python::object density, const double & probability);
+
+    // computes the quantiles of each column of a weighted sample, returning a NumPy array
+    boost::python::object weighted_quantiles(boost::python::object samples, boost::python::object quantiles, boost::python::object weights);
+
+    // evaluates all masks of a SampleMaskEvaluator on a 2D array of samples, returning a 2D NumPy array of booleans
+    boost::python::object SampleMaskEvaluator_evaluate(const eos::SampleMaskEvaluator & evaluator, boost::python::object samples);
+
+    // samples all priors of a LogPosterior from their parameters' generator values
+    void LogPosterior_sample_priors(const eos::LogPosterior & log_posterior);
+
+    // computes the generator values of all parameters of a LogPosterior's priors
+    void LogPosterior_compute_cdfs(const eos::LogPosterior & log_posterior);
+
+    // provides bulk access to the values and generator values of an ordered list of parameters
+    class ParameterVector
+    {
+        private:
+            std::vector<eos::Parameter> _parameters;
+
+        public:
+            explicit ParameterVector(boost::python::object parameters);
+
+            unsigned size() const;
+
+            void set(boost::python::object values);
+
+            boost::python::object values() const;
+
+            void set_generators(boost::python::object values);
+
+            boost::python::object generators() const;
+    };
+
     // wrappers to avoid issues with virtual inheritance and overloading
     inline double
     m_b_pole_wrapper_noargs(const eos::Model & m)
@@ -18,10 +18,13 @@
 # this program; if not, write to the Free Software Foundation, Inc., 59 Temple
 # Place, Suite 330, Boston, MA  02111-1307  USA
 
+import copy
 import eos
+import functools
 import numpy as np
 import scipy
 import pypmc
+import types
 
 class BestFitPoint:
     """
@@ -65,15 +68,20 @@ class Analysis:
     :type fixed_parameters: dict, optional
     :param parameters: The optional set of parameters that shall be used for this analysis. Defaults to `None` which means that a new instance of :class:`eos.Parameters` is created.
     :type parameters: :class:`eos.Parameters` or None, optional
+    :param constraint_entries: The serialized entries of the EOS-wide constraints as recorded by :meth:`snapshot`. Constraints found therein are deserialized
+        instead of being looked up in the internal data base of constraints, which avoids loading the latter. Defaults to `None`.
+    :type constraint_entries: dict, optional
     """
 
-    def __init__(self, priors, likelihood, external_likelihood=[], global_options={}, manual_constraints={}, fixed_parameters={}, parameters=None):
+    def __init__(self, priors, likelihood, external_likelihood=[], global_options={}, manual_constraints={}, fixed_parameters={}, parameters=None, constraint_entries=None):
         """Constructor."""
         self.init_args = { 'priors': priors, 'likelihood': likelihood, 'external_likelihood': external_likelihood, 'global_options': global_options, 'manual_constraints': manual_constraints, 'fixed_parameters':fixed_parameters }
         self.parameters = parameters if parameters else eos.Parameters.Defaults()
         """The set of parameters used for this analysis."""
         self.global_options = eos.Options()
         self._constraint_names = []
+        self._constraint_entries = {}
+        self._constraints = None
         self._log_likelihood = eos.LogLikelihood(self.parameters)
         self._log_posterior = eos.LogPosterior(self._log_likelihood)
         self.varied_parameters = []
@@ -197,7 +205,7 @@ class Analysis:
                     raise ValueError(f'Unknown prior type \'{prior_type}\'')
             elif 'constraint' in prior:
                 constraint_name = eos.QualifiedName(prior['constraint'])
-                constraint_entry = eos.Constraints()[constraint_name]
+                constraint_entry = self._constraint_entry(constraint_name, constraint_entries)
                 log_prior = constraint_entry.make_prior(self.parameters, constraint_name.options_part())
                 self._log_posterior.add(log_prior, False)
                 for p in log_prior.varied_parameters():
@@ -208,6 +216,9 @@ class Analysis:
             else:
                 raise ValueError('Prior specification must contains either \'parameter\', \'parameters\', or \'constraint\'')
 
+        # bulk access to the varied parameters, in the order of self.varied_parameters
+        self._varied_parameter_vector = eos.ParameterVector(self.varied_parameters)
+
         # check for duplicate entries in the likelihood
         set_likelihood = set(likelihood)
         if len(set_likelihood) != len(likelihood):
@@ -230,7 +241,15 @@ class Analysis:
                 constraint_entry = eos.ConstraintEntry.deserialize(constraint_name, yaml_string)
                 constraint = constraint_entry.make(constraint_name, self.global_options)
             else:
-                constraint = eos.Constraint.make(constraint_name, self.global_options)
+                # equivalent to eos.Constraint.make, with the options of the constraint name superseded by the global options
+                qn = eos.QualifiedName(constraint_name)
+                options = eos.Options()
+                for key, value in qn.options_part():
+                    options.declare(key, value)
+                for key, value in self.global_options:
+                    options.declare(key, value)
+                constraint_entry = self._constraint_entry(qn, constraint_entries)
+                constraint = constraint_entry.make(constraint_entry.name(), options) # the entry's name does not carry options
             self._log_likelihood.add(constraint)
 
         # add external likelihood
@@ -256,22 +275,33 @@ class Analysis:
             eos.warn(f'likelihood does not depend on parameter \'{n}\'; remove from prior or check options!')
 
 
+    def _constraint_entry(self, name, constraint_entries):
+        """Internal function that looks up the entry of an EOS-wide constraint and records its serialization for :meth:`snapshot`."""
+        key = str(name)
+        if constraint_entries is not None and key in constraint_entries:
+            serialized = constraint_entries[key]
+            entry = eos.ConstraintEntry.deserialize(eos.QualifiedName(key), serialized)
+        else:
+            if self._constraints is None:
+                self._constraints = eos.Constraints()
+            entry = self._constraints[name]
+            serialized = entry.serialize()
+        self._constraint_entries[key] = serialized
+        return entry
+
+
     def _u_to_par(self, u):
         """Internal function that uses the inverse prior transform to translate from u ∈ [0, 1)^D to the parameter space"""
-        for p, uv in zip(self.varied_parameters, u):
-            p.set_generator(uv)
-        for prior in self._log_posterior.log_priors():
-            prior.sample()
-        return np.array([p.evaluate() for p in self.varied_parameters])
+        self._varied_parameter_vector.set_generators(u)
+        self._log_posterior.sample_priors()
+        return self._varied_parameter_vector.values()
 
 
     def _par_to_u(self, par):
         """Internal function that used the CDF to translate from parameter space to u ∈ [0, 1)^D."""
-        for p, pv in zip(self.varied_parameters, par):
-            p.set(pv)
-        for prior in self._log_posterior.log_priors():
-            prior.compute_cdf()
-        return np.array([p.evaluate_generator() for p in self.varied_parameters])
+        self._varied_parameter_vector.set(par)
+        self._log_posterior.compute_cdfs()
+        return self._varied_parameter_vector.generators()
 
 
     @staticmethod
@@ -322,6 +352,46 @@ class Analysis:
         return eos.Analysis(**self.init_args)
 
 
+    def __getstate__(self):
+        """Returns the arguments needed to recreate this analysis when pickling, e.g., as part of a sampler checkpoint."""
+        if len(self.init_args['external_likelihood']) > 0:
+            raise TypeError('Cannot pickle an eos.Analysis object with external likelihood blocks')
+
+        return self.init_args
+
+
+    def __setstate__(self, state):
+        """Recreates this analysis from the arguments recorded by :meth:`__getstate__`."""
+        self.__init__(**state)
+
+
+    def snapshot(self):
+        """Returns the arguments needed to recreate this analysis, including the serialized entries of all EOS-wide constraints in use.
+
+        Recreating the analysis via ``eos.Analysis(**snapshot)`` does not require the internal data base of constraints.
+        """
+        if len(self.init_args['external_likelihood']) > 0:
+            raise TypeError('Cannot snapshot an eos.Analysis object with external likelihood blocks')
+
+        return { **self.init_args, 'constraint_entries': dict(self._constraint_entries) }
+
+
+    @staticmethod
+    def _get_sampler_state(sampler):
+        """Helper function that extracts the picklable state of a pypmc sampler, omitting the target function and the RNG.
+           The returned state shares its data with the sampler and is meant to be pickled right away."""
+        return {
+            k: v for k, v in sampler.__dict__.items()
+            if k != 'rng' and not isinstance(v, (types.FunctionType, types.MethodType, functools.partial))
+        }
+
+
+    @staticmethod
+    def _set_sampler_state(sampler, state):
+        """Helper function that restores the state of a pypmc sampler as obtained from :meth:`_get_sampler_state`."""
+        sampler.__dict__.update(copy.deepcopy(state))
+
+
     def reset_parameters(self):
         """Resets the analysis parameters to their default values."""
         for p in eos.Parameters():
@@ -449,7 +519,7 @@ class Analysis:
 
 
     def sample(self, N=1000, stride=5, pre_N=150, preruns=3, cov_scale=0.1, observables=None, start_point=None, rng=np.random.mtrand,
-               return_uspace=False):
+               return_uspace=False, checkpoint=None, resume_state=None):
         """
         Return samples of the parameters, log(weights), and optionally posterior-predictive samples for a sequence of observables.
 
@@ -466,6 +536,10 @@ class Analysis:
         :param start_point: Optional starting point for the chain
         :type start_point: list-like, optional
         :param rng: Optional random number generator (must be compatible with the requirements of pypmc.sampler.markov_chain.MarkovChain)
+        :param checkpoint: Optional callable that is passed the (picklable) sampler state after each prerun and after each chunk of the main run.
+        :type checkpoint: callable, optional
+        :param resume_state: Optional sampler state as previously passed to `checkpoint`, from which sampling is continued.
+        :type resume_state: dict, optional
 
         :return: A tuple of the parameters as array of size N, the logarithmic weights as array of size N, and optionally the posterior-predictive samples of the observables as array of size N x len(observables).
 
@@ -497,15 +571,37 @@ class Analysis:
         # create MC sampler
         sampler = pypmc.sampler.markov_chain.AdaptiveMarkovChain(log_target, log_proposal, start_point, save_target_values=True, rng=rng)
 
+        def _state(phase, step, accept_count):
+            return {
+                'phase': phase, 'step': step, 'accept_count': accept_count,
+                'sampler': self._get_sampler_state(sampler), 'rng': rng.get_state()
+            }
+
+        # restore the state of the sampler, including its position, its adapted covariance and the RNG state
+        first_prerun, first_chunk, accept_count = 0, 0, 0
+        if resume_state is not None:
+            self._set_sampler_state(sampler, resume_state['sampler'])
+            rng.set_state(resume_state['rng'])
+            accept_count = resume_state['accept_count']
+            if resume_state['phase'] == 'prerun':
+                first_prerun = resume_state['step']
+            else:
+                first_prerun = preruns
+                first_chunk  = resume_state['step']
+            eos.info(f'Resuming sampling after {first_prerun} preruns and {first_chunk} chunks of the main run')
+
         # pre run to adapt markov chains
         eos.inprogress('Beginning preruns ...')
-        for i in progressbar(range(0, preruns), desc="Preruns", leave=False):
+        for i in progressbar(range(first_prerun, preruns), desc="Preruns", leave=False):
             eos.info(f'Prerun {i} out of {preruns}')
             accept_count = sampler.run(pre_N)
             accept_rate  = accept_count / pre_N * 100
             eos.info(f'Prerun {i}: acceptance rate is {accept_rate:3.0f}%')
             sampler.adapt()
-        sampler.clear()
+            if checkpoint:
+                checkpoint(_state('prerun', i + 1, accept_count))
+        if first_chunk == 0:
+            sampler.clear()
         eos.completed(f'... completed {preruns} preruns')
 
         # obtain final samples
@@ -514,8 +610,10 @@ class Analysis:
         sample_chunk  = sample_total // 100
         sample_chunks = [sample_chunk for i in range(0, 99)]
         sample_chunks.append(sample_total - 99 * sample_chunk)
-        for current_chunk in progressbar(sample_chunks, desc="Main run", leave=False):
+        for i, current_chunk in enumerate(progressbar(sample_chunks[first_chunk:], desc="Main run", leave=False), start=first_chunk):
             accept_count = accept_count + sampler.run(current_chunk)
+            if checkpoint:
+                checkpoint(_state('main', i + 1, accept_count))
         accept_rate  = accept_count / (N * stride) * 100
         eos.completed(f'... completed main run with acceptance rate {accept_rate:3.0f}%')
 
@@ -542,7 +640,7 @@ class Analysis:
 
     def sample_pmc(self, log_proposal, step_N=1000, steps=10, final_N=5000, rng=np.random.mtrand,
                     return_final_only=True, final_perplexity_threshold=1.0, weight_threshold=1e-10,
-                    pmc_iterations=1, pmc_rel_tol=1e-10, pmc_abs_tol=1e-05, pmc_lookback=1):
+                    pmc_iterations=1, pmc_rel_tol=1e-10, pmc_abs_tol=1e-05, pmc_lookback=1, checkpoint=None, resume_state=None):
         """
         Return samples of the parameters and log(weights), and a mixture density adapted to the posterior.
 
@@ -567,6 +665,10 @@ class Analysis:
         :param pmc_lookback: (advanced) Use reweighted samples from the previous update steps when adjusting the mixture density.
             The parameter determines the number of update steps to "look back".
             The default value of 1 disables this feature, a value of 0 means that all previous steps are used.
+        :param checkpoint: Optional callable that is passed the (picklable) sampler state after each adaptation step.
+        :type checkpoint: callable, optional
+        :param resume_state: Optional sampler state as previously passed to `checkpoint`, from which the adaptation is continued.
+        :type resume_state: dict, optional
 
         :return: A tuple of the parameters as array of length N = step_N * steps + final_N, the (linear) weights as array of length N, the posterior values as array of length N, and the
             final proposal function as pypmc.density.mixture.MixtureDensity.
@@ -614,9 +716,28 @@ class Analysis:
         # list of proposals used to generate the samples. These proposals are not modified by `combine_weights`
         proposals = [sampler.proposal]
 
+        # restore the state of the sampler, including the adapted mixture density and the RNG state
+        first_step = 0
+        step = 0
+        last_perplexity = 0.0
+        if resume_state is not None:
+            self._set_sampler_state(sampler, resume_state['sampler'])
+            rng.set_state(resume_state['rng'])
+            first_step            = resume_state['step']
+            step                  = first_step - 1
+            last_perplexity       = resume_state['last_perplexity']
+            generating_components = copy.deepcopy(resume_state['generating_components'])
+            proposals             = copy.deepcopy(resume_state['proposals'])
+            # the current proposal must remain identical to the last entry of the list of proposals
+            sampler.proposal      = proposals[-1]
+            eos.info(f'Resuming PMC adaptations after {first_step} step(s)')
+            # skip further adaptations if the previous run had already converged
+            if resume_state['converged']:
+                first_step = steps
+
         # carry out adaptions
         eos.inprogress('Beggning PMC adaptations ...')
-        for step in progressbar(range(steps), desc="Adaptations", leave=False):
+        for step in progressbar(range(first_step, steps), desc="Adaptations", leave=False):
             origins = sampler.run(step_N, trace_sort=True)
             generating_components.append(origins)
 
@@ -653,8 +774,16 @@ class Analysis:
             sampler.proposal.normalize()
             sampler.proposal.prune(threshold = weight_threshold)
 
+            converged = last_perplexity > final_perplexity_threshold
+            if checkpoint:
+                checkpoint({
+                    'step': step + 1, 'converged': converged, 'last_perplexity': last_perplexity,
+                    'sampler': self._get_sampler_state(sampler), 'rng': rng.get_state(),
+                    'proposals': proposals, 'generating_components': generating_components
+                })
+
             # stop adaptation if the perplexity of the last step is larger than the threshold
-            if last_perplexity > final_perplexity_threshold:
+            if converged:
                 break
         eos.completed(f'... completed adaptations after {step} steps(s) with perplexity = {last_perplexity}')
 
@@ -690,8 +819,7 @@ class Analysis:
         :param args: Dummy parameter (ignored)
         :type args: optional
         """
-        for p, pv in zip(self.varied_parameters, p):
-            p.set(pv)
+        self._varied_parameter_vector.set(p)
 
         try:
             return(self._log_likelihood.evaluate())
@@ -712,7 +840,8 @@ class Analysis:
         return self._u_to_par(u)
 
 
-    def sample_nested(self, bound='multi', nlive=250, dlogz=1.0, maxiter=None, miniter=0, print_progress=True, print_function=None, seed=10, sample='auto'):
+    def sample_nested(self, bound='multi', nlive=250, dlogz=1.0, maxiter=None, miniter=0, print_progress=True, print_function=None, seed=10, sample='auto',
+                      checkpoint_file=None, checkpoint_every=60, resume=False, backend='dynesty', batch_size=None):
         """
         Return samples of the parameters.
 
@@ -734,6 +863,18 @@ class Analysis:
         :type seed: {None, int, array_like[ints], SeedSequence}, optional
         :param sample: The method used for sampling within the likelihood constraints. For valid values, see dynesty documentation. Defaults to 'auto'.
         :type sample: str, optional
+        :param checkpoint_file: The file to which dynesty periodically saves the full sampler state, including the live points and the RNG state.
+        :type checkpoint_file: str, optional
+        :param checkpoint_every: The interval in seconds between two checkpoints. Defaults to 60.
+        :type checkpoint_every: float, optional
+        :param resume: If set to True, the sampler is restored from `checkpoint_file` and sampling is continued. Defaults to False.
+        :type resume: bool, optional
+        :param backend: The nested sampling implementation, either 'dynesty' or 'native'. The native backend runs static nested sampling in C++
+                        and replaces batches of live points concurrently. It supports the bounds 'none', 'single', and 'multi', and the
+                        sampling methods 'unif', 'rwalk', 'rslice', and 'auto'. Defaults to 'dynesty'.
+        :type backend: str, optional
+        :param batch_size: The number of live points replaced concurrently by the native backend. Defaults to the number of threads.
+        :type batch_size: int, optional
 
         .. note::
            This method requires the dynesty python module, which can be installed from PyPI.
@@ -741,17 +882,77 @@ class Analysis:
         import dynesty, tqdm
         from functools import partial
 
+        if backend == 'native':
+            return self._sample_nested_native(bound=bound, nlive=nlive, dlogz=dlogz, maxiter=maxiter, miniter=miniter, seed=seed, sample=sample,
+                                              checkpoint_file=checkpoint_file, resume=resume, batch_size=batch_size)
+        elif backend != 'dynesty':
+            raise ValueError(f'Unknown nested sampling backend: {backend}')
+
         if print_function is None:
             print_function = partial(dynesty.results.print_fn, pbar=tqdm.tqdm())
 
-        sampler = dynesty.DynamicNestedSampler(self.log_likelihood, self._prior_transform, len(self.varied_parameters), bound=bound, nlive=nlive, rstate = np.random.Generator(np.random.MT19937(seed)), sample=sample)
-        sampler.run_nested(dlogz_init=dlogz, maxiter=maxiter, print_progress=print_progress, print_func=print_function)
+        if resume and checkpoint_file is None:
+            raise ValueError('Resuming nested sampling requires a checkpoint file')
+
+        checkpoint_kwargs = { 'checkpoint_file': checkpoint_file, 'checkpoint_every': checkpoint_every } if checkpoint_file else {}
+
+        if resume:
+            sampler = dynesty.DynamicNestedSampler.restore(checkpoint_file)
+            eos.info(f'Resuming nested sampling after {sampler.results["niter"]} iterations')
+        else:
+            sampler = dynesty.DynamicNestedSampler(self.log_likelihood, self._prior_transform, len(self.varied_parameters), bound=bound, nlive=nlive, rstate = np.random.Generator(np.random.MT19937(seed)), sample=sample)
+        sampler.run_nested(dlogz_init=dlogz, maxiter=maxiter, print_progress=print_progress, print_func=print_function, resume=resume, **checkpoint_kwargs)
         while sampler.results['niter'] < miniter:
             # using mode='full' ensures sampling from the entire posterior
-            sampler.add_batch(mode='full', dlogz=dlogz, maxiter=maxiter, print_progress=print_progress, print_func=print_function)
+            sampler.add_batch(mode='full', dlogz=dlogz, maxiter=maxiter, print_progress=print_progress, print_func=print_function, **checkpoint_kwargs)
         return sampler.results
 
 
+    def _sample_nested_native(self, bound, nlive, dlogz, maxiter, miniter, seed, sample, checkpoint_file, resume, batch_size):
+        """Internal function that runs the native nested sampler and converts its results to dynesty's format."""
+        import dynesty
+
+        if len(self.init_args['external_likelihood']) > 0:
+            raise ValueError('The native nested sampling backend does not support external likelihood blocks')
+
+        if resume:
+            raise ValueError('The native nested sampling backend does not support resuming from a checkpoint')
+
+        if checkpoint_file is not None:
+            eos.warn('The native nested sampling backend does not write checkpoints; ignoring the checkpoint file')
+
+        config = eos.NestedSamplerConfig()
+        config.nlive = nlive
+        config.dlogz = dlogz
+        config.maxiter = maxiter if maxiter is not None else 0
+        config.seed = seed
+        config.bound = bound
+        config.sample = sample
+        config.batch_size = batch_size if batch_size is not None else 0
+
+        results = eos.NestedSampler(self._log_posterior, config).run()
+
+        if results.niter < miniter:
+            eos.warn(f'The native nested sampling backend stopped after {results.niter} < {miniter} iterations; decrease dlogz to obtain more samples')
+
+        return dynesty.results.Results([
+            ('nlive',       results.nlive),
+            ('niter',       results.niter),
+            ('ncall',       np.array(results.ncall)),
+            ('eff',         results.eff),
+            ('samples',     np.array(results.samples)),
+            ('samples_id',  np.array(results.samples_id)),
+            ('samples_it',  np.array(results.samples_it)),
+            ('samples_u',   np.array(results.samples_u)),
+            ('logwt',       np.array(results.logwt)),
+            ('logl',        np.array(results.logl)),
+            ('logvol',      np.array(results.logvol)),
+            ('logz',        np.array(results.logz)),
+            ('logzerr',     np.array(results.logzerr)),
+            ('information', np.array(results.information)),
+        ])
+
+
     def _repr_html_(self):
         result = r'''
         <table>
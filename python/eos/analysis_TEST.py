@@ -307,6 +307,42 @@ class ClassMethodTests(unittest.TestCase):
         chi2_2 = (results['logz'][-1] - logz_analytic)**2 / results['logzerr'][-1]**2 # Assuming 2% error on the log(Z) value
         self.assertLess(chi2_2, 4.5494e-1, 'chi^2 for log(Z) exceeds 50% integrated probability for 1 degree of freedom')
 
+    def test_sample_nested_native(self):
+
+        import numpy as np
+        analysis_args = {
+            'global_options': { },
+            'manual_constraints': {
+                'test::test': {
+                    'type': 'MultivariateGaussian(Covariance)',
+                    'observables': ['mass::c', 'mass::b(MSbar)'],
+                    'kinematics': [{}, {}],
+                    'options': [{}, {}],
+                    'means': [1.28, 4.17],
+                    'covariance': [[0.03**2, 0.0], [0.0, 0.02**2]],
+                }
+            },
+            'priors': [
+                { 'parameter': 'mass::c',        'min': 1.0, 'max': 1.6, 'type': 'uniform' },
+                { 'parameter': 'mass::b(MSbar)', 'min': 4.0, 'max': 4.4, 'type': 'uniform' },
+            ],
+            'likelihood': [ ]
+        }
+
+        analysis = eos.Analysis(**analysis_args)
+
+        for sample in ['unif', 'rwalk', 'rslice']:
+            results = analysis.sample_nested(bound='multi', nlive=250, dlogz=0.01, seed=10, sample=sample, print_progress=False, backend='native', batch_size=4)
+
+            # posterior means agree with the likelihood's mode
+            avg = np.average(results.samples, weights=results.importance_weights(), axis=0)
+            self.assertLess(abs(avg[0] - 1.28), 0.005, f'mean of mass::c deviates for sample={sample}')
+            self.assertLess(abs(avg[1] - 4.17), 0.005, f'mean of mass::b(MSbar) deviates for sample={sample}')
+
+            # the likelihood is fully contained in the prior, hence Z = 1 / (0.6 * 0.4)
+            logz_analytic = -np.log(0.6 * 0.4)
+            self.assertLess(abs(results['logz'][-1] - logz_analytic), 3.0 * results['logzerr'][-1], f'log(Z) deviates for sample={sample}')
+
     def test_pyhf_likelihood(self):
 
         try:
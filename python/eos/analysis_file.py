@@ -18,7 +18,10 @@
 # Place, Suite 330, Boston, MA  02111-1307  USA
 
 import eos
+import functools
+import hashlib
 import os
+import pickle
 import sys
 import yaml
 import inspect
@@ -35,12 +38,15 @@ class AnalysisFile:
 
     :param analysis_file: The path to the file to be parsed.
     :type analysis_file: str
+    :param snapshot_directory: The directory in which snapshots of the constructed analyses are stored, see :meth:`analysis`. Defaults to `None`, which disables snapshots.
+    :type snapshot_directory: str, optional
     """
 
-    def __init__(self, analysis_file):
+    def __init__(self, analysis_file, snapshot_directory=None):
         """Constructor."""
 
         self.analysis_file = analysis_file
+        self.snapshot_directory = snapshot_directory
 
         if not os.path.exists(analysis_file):
             raise RuntimeError(f'Cannot load analysis file: \'{analysis_file}\' does not exist')
@@ -48,8 +54,10 @@ class AnalysisFile:
         if not os.path.isfile(analysis_file):
             raise RuntimeError(f'Cannot load analysis file: \'{analysis_file}\' is not a file')
 
-        with open(analysis_file) as input_file:
-            self.input_data = yaml.safe_load(input_file)
+        with open(analysis_file, 'rb') as input_file:
+            content = input_file.read()
+            self._digest = hashlib.sha256(content).hexdigest()
+            self.input_data = yaml.safe_load(content)
 
         if 'metadata' in self.input_data:
             self._metadata = MetadataDescription.from_dict(**self.input_data['metadata'])
@@ -146,7 +154,13 @@ class AnalysisFile:
 
 
     def analysis(self, _posterior):
-        """Create an eos.Analysis object for the named posterior."""
+        """Create an eos.Analysis object for the named posterior.
+
+        If a snapshot directory has been provided, the serialized constraints of the analysis are stored in
+        SNAPSHOT_DIRECTORY/analysis-POSTERIOR.pkl, and read back when the same posterior is requested again.
+        This avoids loading the internal data base of constraints. Snapshots are invalidated whenever the
+        analysis file, the EOS data files, or the EOS version change.
+        """
         if _posterior not in self._posteriors:
             raise RuntimeError(f'Cannot create analysis for unknown posterior: \'{_posterior}\'')
 
@@ -196,12 +210,43 @@ class AnalysisFile:
         likelihood = [ d["constraint"] for d in (asdict(lc) for lc in likelihood) ]
         manual_constraints = { d["name"]: d["info"] for d in (asdict(mc) for mc in manual_constraints) }
 
-        return eos.Analysis(prior, likelihood,
-                            external_likelihood=external_likelihood,
-                            global_options=global_options,
-                            manual_constraints=manual_constraints,
-                            fixed_parameters=fixed_parameters,
-                            parameters=parameters)
+        # snapshots cannot capture external likelihood blocks
+        snapshot_file = None
+        if self.snapshot_directory is not None and len(external_likelihood) == 0:
+            snapshot_file = os.path.join(self.snapshot_directory, f'analysis-{_posterior}.pkl')
+
+        constraint_entries = None
+        digest = self._digest + _eos_data_digest() if snapshot_file else None
+        if snapshot_file and os.path.isfile(snapshot_file):
+            try:
+                with open(snapshot_file, 'rb') as f:
+                    snapshot = pickle.load(f)
+                if snapshot['digest'] == digest:
+                    constraint_entries = snapshot['constraint_entries']
+                    eos.debug(f'Using analysis snapshot \'{snapshot_file}\'')
+                else:
+                    eos.debug(f'Analysis snapshot \'{snapshot_file}\' is outdated')
+            except (OSError, EOFError, KeyError, pickle.UnpicklingError) as e:
+                eos.warn(f'Ignoring unreadable analysis snapshot \'{snapshot_file}\': {e}')
+
+        analysis = eos.Analysis(prior, likelihood,
+                                external_likelihood=external_likelihood,
+                                global_options=global_options,
+                                manual_constraints=manual_constraints,
+                                fixed_parameters=fixed_parameters,
+                                parameters=parameters,
+                                constraint_entries=constraint_entries)
+
+        if snapshot_file and constraint_entries is None:
+            # write to a unique temporary file first, since concurrent tasks might create the same snapshot
+            os.makedirs(self.snapshot_directory, exist_ok=True)
+            tmp_file = f'{snapshot_file}.{os.getpid()}.tmp'
+            with open(tmp_file, 'wb') as f:
+                pickle.dump({ 'digest': digest, 'constraint_entries': analysis.snapshot()['constraint_entries'] }, f, protocol=pickle.HIGHEST_PROTOCOL)
+            os.replace(tmp_file, snapshot_file)
+            eos.debug(f'Wrote analysis snapshot \'{snapshot_file}\'')
+
+        return analysis
 
 
     def observables(self, _posterior, _prediction, parameters):
@@ -780,3 +825,26 @@ class AnalysisFile:
         '''
 
         return result
+
+
+@functools.lru_cache(maxsize=None)
+def _eos_data_digest():
+    """Returns a digest of the EOS version and of all constraint and parameter files, in the locations used by the C++ library."""
+    data_dir = os.environ.get('EOS_HOME', eos._pkg_data_dir)
+    directories = [
+        os.environ.get('EOS_TESTS_CONSTRAINTS', os.path.join(data_dir, 'constraints')),
+        os.environ.get('EOS_TESTS_PARAMETERS', os.path.join(data_dir, 'parameters')),
+    ]
+
+    digest = hashlib.sha256(eos.__version__.encode())
+    for directory in directories:
+        if not os.path.isdir(directory):
+            continue
+        for name in sorted(os.listdir(directory)):
+            if not name.endswith('.yaml'):
+                continue
+            digest.update(name.encode())
+            with open(os.path.join(directory, name), 'rb') as f:
+                digest.update(f.read())
+
+    return digest.hexdigest()
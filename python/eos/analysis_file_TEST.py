@@ -17,6 +17,40 @@ class TestAnalysisFile(unittest.TestCase):
         af = eos.AnalysisFile(Path(__file__).parent / 'analysis_file_TEST.d' / 'minimal-analysis-file.yaml')
         af.validate()
 
+    def test_analysis_snapshot(self):
+
+        import pickle
+        import tempfile
+
+        path = Path(__file__).parent / 'analysis_file_TEST.d' / 'valid-analysis-file.yaml'
+        with tempfile.TemporaryDirectory() as tmpdir:
+            reference = eos.AnalysisFile(path).analysis('CKM-all')
+
+            # the first analysis creates the snapshot
+            af = eos.AnalysisFile(path, snapshot_directory=tmpdir)
+            analysis = af.analysis('CKM-all')
+            snapshot_file = os.path.join(tmpdir, 'analysis-CKM-all.pkl')
+            self.assertTrue(os.path.isfile(snapshot_file))
+            with open(snapshot_file, 'rb') as f:
+                snapshot = pickle.load(f)
+            self.assertEqual(set(snapshot['constraint_entries'].keys()), set(analysis.snapshot()['constraint_entries'].keys()))
+
+            # the second analysis is recreated from the snapshot
+            af = eos.AnalysisFile(path, snapshot_directory=tmpdir)
+            analysis = af.analysis('CKM-all')
+            self.assertEqual([p.name() for p in analysis.varied_parameters], [p.name() for p in reference.varied_parameters])
+            self.assertEqual(analysis._log_likelihood.evaluate(), reference._log_likelihood.evaluate())
+
+            # outdated snapshots are replaced
+            snapshot['digest'] = 'outdated'
+            snapshot['constraint_entries'] = {}
+            with open(snapshot_file, 'wb') as f:
+                pickle.dump(snapshot, f)
+            af.analysis('CKM-all')
+            with open(snapshot_file, 'rb') as f:
+                self.assertNotEqual(pickle.load(f)['digest'], 'outdated')
+
+
 
 if __name__ == '__main__':
     unittest.main(verbosity=5)
@@ -266,6 +266,11 @@ _task_argument_map = {
     ('sample-nested', 'min-number-iterations'): 'miniter', ('sample-nested', 'MINITER'): 'miniter',
     ('sample-nested', 's'): 'seed', ('sample-nested', 'use-random-seed'): 'seed', ('sample-nested', 'SEED'): 'seed',
     ('sample-nested', 'M'): 'sample', ('sample-nested', 'sampling-method'): 'sample', ('sample-nested', 'SAMPLE'): 'sample',
+    # profile-likelihood
+    ('profile-likelihood', 'POSTERIOR'): 'posterior', ('profile-likelihood', 'PARAMETERS'): 'parameters',
+    ('profile-likelihood', 'n'): 'points', ('profile-likelihood', 'number-of-points'): 'points', ('profile-likelihood', 'POINTS'): 'points',
+    ('profile-likelihood', 'c'): 'chunk_size', ('profile-likelihood', 'chunk-size'): 'chunk_size', ('profile-likelihood', 'CHUNK_SIZE'): 'chunk_size',
+    ('profile-likelihood', 'L'): 'label', ('profile-likelihood', 'LABEL'): 'label',
     # plot-samples
     ('plot-samples', 'POSTERIOR'): 'posterior',
     ('plot-samples', 'B'): 'bins', ('plot-samples', 'BINS'): 'bins',
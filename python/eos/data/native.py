@@ -754,3 +754,301 @@ class SampleMask:
         with open(os.path.join(path, 'description.yaml'), 'w') as description_file:
             yaml.dump(description, description_file, default_flow_style=False)
         _np.save(os.path.join(path, 'mask.npy'), mask)
+
+
+class GridScan:
+    def __init__(self, path):
+        """ Read a GridScan object from disk, e.g., as produced by eos-scan.
+
+        The file can be read while the scan is still ongoing; it then contains the points evaluated so far.
+
+        :param path: Path to the storage location.
+        :type path: str
+        """
+        if not os.path.exists(path) or not os.path.isdir(path):
+            raise RuntimeError(f'Path {path} does not exist or is not a directory')
+
+        f = os.path.join(path, 'description.yaml')
+        if not os.path.exists(f) or not os.path.isfile(f):
+            raise RuntimeError(f'Description file {f} does not exist or is not a file')
+
+        with open(f) as df:
+            description = yaml.load(df, Loader=yaml.SafeLoader)
+
+        if not description['type'] == 'GridScan':
+            raise RuntimeError(f'Path {path} not pointing to a GridScan object')
+
+        self.type = 'GridScan'
+        self.varied_parameters = description['parameters']
+        self.lookup_table = { item['name']: idx for idx, item in enumerate(self.varied_parameters) }
+        self.inputs = description.get('inputs', [])
+        self.levels = description.get('levels', [])
+        self.refinements = description.get('refinements', 0)
+
+        f = os.path.join(path, 'samples.npy')
+        if not os.path.exists(f) or not os.path.isfile(f):
+            raise RuntimeError(f'Samples file {f} does not exist or is not a file')
+        self.samples = _np.load(f)
+
+        f = os.path.join(path, 'chi2.npy')
+        if not os.path.exists(f) or not os.path.isfile(f):
+            raise RuntimeError(f'Chi-square file {f} does not exist or is not a file')
+        self.chi2 = _np.load(f).reshape(-1)
+
+        # both files are written concurrently, so one of them might be ahead of the other
+        n = min(self.samples.shape[0], self.chi2.shape[0])
+        self.samples = self.samples[:n]
+        self.chi2 = self.chi2[:n]
+
+    @property
+    def delta_chi2(self):
+        """ The chi-square values relative to their minimum. """
+        return self.chi2 - _np.min(self.chi2)
+
+    @staticmethod
+    def create(path, parameters, samples, chi2, levels=None, refinements=0):
+        """ Write a new GridScan object to disk.
+
+        :param path: Path to the storage location, which will be created as a directory.
+        :type path: str
+        :param parameters: Descriptions of the scanned parameters, with keys 'name', 'min', 'max', and 'intervals'.
+        :type parameters: list of dict
+        :param samples: Grid points as a 2D array of shape (N, P).
+        :type samples: 2D numpy array
+        :param chi2: Chi-square values as a 1D array of shape (N, ).
+        :type chi2: 1D numpy array
+        :param levels: Delta chi-square levels around which the grid has been refined.
+        :type levels: list of float, optional
+        :param refinements: Number of refinement steps.
+        :type refinements: int, optional
+        """
+        description = {}
+        description['version'] = eos.__version__
+        description['type'] = 'GridScan'
+        description['parameters'] = [{
+            'name': p['name'],
+            'min': float(p['min']),
+            'max': float(p['max']),
+            'intervals': int(p['intervals'])
+        } for p in parameters]
+        description['levels'] = [float(l) for l in levels] if levels is not None else []
+        description['refinements'] = int(refinements)
+
+        if not samples.shape[1] == len(parameters):
+            raise RuntimeError(f'Shape of samples {samples.shape} incompatible with number of parameters {len(parameters)}')
+
+        if not samples.shape[0] == chi2.shape[0]:
+            raise RuntimeError(f'Shape of chi2 {chi2.shape} incompatible with shape of samples {samples.shape}')
+
+        os.makedirs(path, exist_ok=True)
+        with open(os.path.join(path, 'description.yaml'), 'w') as description_file:
+            yaml.dump(description, description_file, default_flow_style=False)
+        _np.save(os.path.join(path, 'samples.npy'), samples)
+        _np.save(os.path.join(path, 'chi2.npy'), chi2.reshape(-1, 1))
+
+
+class ProfileLikelihood:
+    def __init__(self, path):
+        """ Read a ProfileLikelihood object from disk.
+
+        :param path: Path to the storage location.
+        :type path: str
+        """
+        if not os.path.exists(path) or not os.path.isdir(path):
+            raise RuntimeError(f'Path {path} does not exist or is not a directory')
+
+        f = os.path.join(path, 'description.yaml')
+        if not os.path.exists(f) or not os.path.isfile(f):
+            raise RuntimeError(f'Description file {f} does not exist or is not a file')
+
+        with open(f) as df:
+            description = yaml.load(df, Loader=yaml.SafeLoader)
+
+        if not description['type'] == 'ProfileLikelihood':
+            raise RuntimeError(f'Path {path} not pointing to a ProfileLikelihood object')
+
+        self.type = 'ProfileLikelihood'
+        self.varied_parameters = description['parameters']
+        self.nuisance_parameters = description['nuisance_parameters']
+        self.lookup_table = { item['name']: idx for idx, item in enumerate(self.varied_parameters) }
+
+        f = os.path.join(path, 'samples.npy')
+        if not os.path.exists(f) or not os.path.isfile(f):
+            raise RuntimeError(f'Samples file {f} does not exist or is not a file')
+        self.samples = _np.load(f)
+
+        f = os.path.join(path, 'log_posterior.npy')
+        if not os.path.exists(f) or not os.path.isfile(f):
+            raise RuntimeError(f'Log(posterior) file {f} does not exist or is not a file')
+        self.log_posterior = _np.load(f)
+
+        f = os.path.join(path, 'nuisance_samples.npy')
+        if not os.path.exists(f) or not os.path.isfile(f):
+            raise RuntimeError(f'Nuisance samples file {f} does not exist or is not a file')
+        self.nuisance_samples = _np.load(f)
+
+    @property
+    def delta_chi2(self):
+        """ The profile as -2 times the log(posterior) relative to its maximum. """
+        return -2.0 * (self.log_posterior - _np.max(self.log_posterior))
+
+    @staticmethod
+    def create(path, parameters, nuisance_parameters, samples, log_posterior, nuisance_samples):
+        """ Write a new ProfileLikelihood object to disk.
+
+        :param path: Path to the storage location, which will be created as a directory.
+        :type path: str
+        :param parameters: Parameters of interest as a 1D array of shape (P, ).
+        :type parameters: list or iterable of eos.Parameter
+        :param nuisance_parameters: Nuisance parameters as a 1D array of shape (Q, ).
+        :type nuisance_parameters: list or iterable of eos.Parameter
+        :param samples: Grid points in the parameters of interest as a 2D array of shape (N, P).
+        :type samples: 2D numpy array
+        :param log_posterior: Maximal values of the log(posterior) as a 1D array of shape (N, ).
+        :type log_posterior: 1D numpy array
+        :param nuisance_samples: Values of the nuisance parameters at the maxima as a 2D array of shape (N, Q).
+        :type nuisance_samples: 2D numpy array
+        """
+        description = {}
+        description['version'] = eos.__version__
+        description['type'] = 'ProfileLikelihood'
+        description['parameters'] = [{
+            'name': p.name(),
+            'min': p.min(),
+            'max': p.max()
+        } for p in parameters]
+        description['nuisance_parameters'] = [{
+            'name': p.name(),
+            'min': p.min(),
+            'max': p.max()
+        } for p in nuisance_parameters]
+
+        if not samples.shape[1] == len(parameters):
+            raise RuntimeError(f'Shape of samples {samples.shape} incompatible with number of parameters {len(parameters)}')
+
+        if not nuisance_samples.shape[1] == len(nuisance_parameters):
+            raise RuntimeError(f'Shape of nuisance samples {nuisance_samples.shape} incompatible with number of nuisance parameters {len(nuisance_parameters)}')
+
+        if not samples.shape[0] == log_posterior.shape[0] or not samples.shape[0] == nuisance_samples.shape[0]:
+            raise RuntimeError(f'Shapes of log(posterior) {log_posterior.shape} and nuisance samples {nuisance_samples.shape} incompatible with shape of samples {samples.shape}')
+
+        os.makedirs(path, exist_ok=True)
+        with open(os.path.join(path, 'description.yaml'), 'w') as description_file:
+            yaml.dump(description, description_file, default_flow_style=False)
+        _np.save(os.path.join(path, 'samples.npy'), samples)
+        _np.save(os.path.join(path, 'log_posterior.npy'), log_posterior)
+        _np.save(os.path.join(path, 'nuisance_samples.npy'), nuisance_samples)
+
+
+class Checkpoint:
+    def __init__(self, path):
+        """ Read the latest checkpoint of a sampler from disk.
+
+        :param path: Path to the storage location.
+        :type path: str
+        """
+        if not os.path.exists(path) or not os.path.isdir(path):
+            raise RuntimeError(f'Path {path} does not exist or is not a directory')
+
+        f = os.path.join(path, 'description.yaml')
+        if not os.path.exists(f) or not os.path.isfile(f):
+            raise RuntimeError(f'Description file {f} does not exist or is not a file')
+
+        with open(f) as df:
+            description_text = df.read()
+        description = yaml.load(description_text, Loader=yaml.SafeLoader)
+
+        if not description['type'] == 'Checkpoint':
+            raise RuntimeError(f'Path {path} not pointing to a Checkpoint')
+
+        self.type = 'Checkpoint'
+        self.sampler = description['sampler']
+        self.varied_parameters = description['parameters']
+
+        f = os.path.join(path, 'state.pkl')
+        if not os.path.exists(f) or not os.path.isfile(f):
+            raise RuntimeError(f'State file {f} does not exist or is not a file')
+
+        import pickle
+        with open(f, 'rb') as sf:
+            content = pickle.load(sf)
+
+        if content['description_digest'] != Checkpoint._digest(description_text):
+            raise RuntimeError(f'State file {f} does not match the description in {path}; the checkpoint is incomplete')
+
+        self.state = content['state']
+
+
+    @staticmethod
+    def exists(path):
+        """ Check if a complete checkpoint exists at the given location.
+
+        :param path: Path to the storage location.
+        :type path: str
+        """
+        return os.path.isfile(os.path.join(path, 'description.yaml')) and os.path.isfile(os.path.join(path, 'state.pkl'))
+
+
+    @staticmethod
+    def _digest(description_text):
+        import hashlib
+        return hashlib.sha256(description_text.encode('utf-8')).hexdigest()
+
+
+    @staticmethod
+    def _atomic_write(filename, mode, write):
+        tmp_filename = filename + '.tmp'
+        with open(tmp_filename, mode) as f:
+            write(f)
+            f.flush()
+            os.fsync(f.fileno())
+        os.replace(tmp_filename, filename)
+
+
+    @staticmethod
+    def create(path, sampler, parameters, state):
+        """ Write a new Checkpoint object to disk.
+
+        Each file is written to a temporary file first and then atomically moved into place.
+        The description is written before the state, and the state records a digest of the
+        description. A job that is interrupted in between therefore leaves a pair that is
+        rejected when read, rather than a state that is silently paired with the wrong description.
+
+        :param path: Path to the storage location, which will be created as a directory.
+        :type path: str
+        :param sampler: The name of the sampler that produced the state, e.g. 'mcmc', 'pmc' or 'nested'.
+        :type sampler: str
+        :param parameters: Parameter descriptions as a 1D array of shape (N, ).
+        :type parameters: list or iterable of eos.Parameter
+        :param state: The sampler state; must be picklable.
+        :type state: dict
+        """
+        import pickle
+
+        description = {}
+        description['version'] = eos.__version__
+        description['type'] = 'Checkpoint'
+        description['sampler'] = sampler
+        description['parameters'] = [{
+            'name': p.name(),
+            'min': p.min(),
+            'max': p.max()
+        } for p in parameters]
+
+        description_text = yaml.dump(description, default_flow_style=False)
+        content = { 'description_digest': Checkpoint._digest(description_text), 'state': state }
+
+        os.makedirs(path, exist_ok=True)
+        Checkpoint._atomic_write(os.path.join(path, 'description.yaml'), 'w', lambda f: f.write(description_text))
+        Checkpoint._atomic_write(os.path.join(path, 'state.pkl'), 'wb', lambda f: pickle.dump(content, f, protocol=pickle.HIGHEST_PROTOCOL))
+
+
+    @staticmethod
+    def remove(path):
+        """ Remove a checkpoint from disk, e.g. after the sampler has finished successfully.
+
+        :param path: Path to the storage location.
+        :type path: str
+        """
+        import shutil
+        shutil.rmtree(path, ignore_errors=True)
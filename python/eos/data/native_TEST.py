@@ -36,5 +36,100 @@ class PMCSamplerTests(unittest.TestCase):
 
         file = eos.data.ImportanceSamples(os.path.join(os.environ['SOURCE_DIR'], "eos/data/native_TEST.d/samples"))
 
+class GridScanTests(unittest.TestCase):
+
+    def test_create_and_read(self):
+        "Test that a grid scan can be written and read back."
+
+        import tempfile
+
+        parameters = [
+            { 'name': 'b->smumu::Re{c9}',  'min': 2.0, 'max': 6.0, 'intervals': 4 },
+            { 'name': 'b->smumu::Re{c10}', 'min': -6.0, 'max': -2.0, 'intervals': 2 },
+        ]
+        samples = np.array([[2.0, -6.0], [3.0, -6.0], [2.0, -4.0], [2.5, -5.0]])
+        chi2 = np.array([4.0, 1.5, 2.0, 3.0])
+
+        with tempfile.TemporaryDirectory() as tmpdir:
+            path = os.path.join(tmpdir, 'scan')
+            eos.data.GridScan.create(path, parameters, samples, chi2, levels=[2.30], refinements=1)
+
+            scan = eos.data.GridScan(path)
+            self.assertEqual(scan.lookup_table, { 'b->smumu::Re{c9}': 0, 'b->smumu::Re{c10}': 1 })
+            self.assertEqual(scan.levels, [2.30])
+            self.assertEqual(scan.refinements, 1)
+            np.testing.assert_array_equal(scan.samples, samples)
+            np.testing.assert_array_equal(scan.chi2, chi2)
+            np.testing.assert_array_equal(scan.delta_chi2, chi2 - 1.5)
+
+class ProfileLikelihoodTests(unittest.TestCase):
+
+    def test_create_and_read(self):
+        "Test that a profile likelihood can be written and read back."
+
+        import tempfile
+
+        parameters = [eos.Parameters()['mass::b(MSbar)']]
+        nuisance_parameters = [eos.Parameters()['mass::c'], eos.Parameters()['mass::t(pole)']]
+        samples = np.array([[4.1], [4.2], [4.3]])
+        log_posterior = np.array([-0.5, 0.0, -0.5])
+        nuisance_samples = np.array([[1.275, 173.0], [1.3, 173.0], [1.325, 173.0]])
+
+        with tempfile.TemporaryDirectory() as tmpdir:
+            path = os.path.join(tmpdir, 'profile')
+            eos.data.ProfileLikelihood.create(path, parameters, nuisance_parameters, samples, log_posterior, nuisance_samples)
+
+            profile = eos.data.ProfileLikelihood(path)
+            self.assertEqual(profile.lookup_table, { 'mass::b(MSbar)': 0 })
+            self.assertEqual([p['name'] for p in profile.nuisance_parameters], ['mass::c', 'mass::t(pole)'])
+            np.testing.assert_array_equal(profile.samples, samples)
+            np.testing.assert_array_equal(profile.log_posterior, log_posterior)
+            np.testing.assert_array_equal(profile.nuisance_samples, nuisance_samples)
+            np.testing.assert_array_equal(profile.delta_chi2, [1.0, 0.0, 1.0])
+
+            with self.assertRaises(RuntimeError):
+                eos.data.ProfileLikelihood.create(os.path.join(tmpdir, 'invalid'), parameters, nuisance_parameters, samples, log_posterior, nuisance_samples[:2])
+
+class CheckpointTests(unittest.TestCase):
+
+    def test_create_and_restore(self):
+        "Test that a checkpoint is written atomically and can be restored."
+
+        import tempfile
+
+        parameters = [eos.Parameters()['mass::b(MSbar)'], eos.Parameters()['mass::c']]
+        state = { 'phase': 'main', 'step': 3, 'rng': np.random.mtrand.RandomState(1701).get_state(), 'point': np.array([0.25, 0.75]) }
+
+        with tempfile.TemporaryDirectory() as tmpdir:
+            path = os.path.join(tmpdir, 'checkpoint')
+            self.assertFalse(eos.data.Checkpoint.exists(path))
+
+            eos.data.Checkpoint.create(path, 'mcmc', parameters, state)
+            self.assertTrue(eos.data.Checkpoint.exists(path))
+            self.assertFalse(os.path.exists(os.path.join(path, 'state.pkl.tmp')))
+
+            checkpoint = eos.data.Checkpoint(path)
+            self.assertEqual(checkpoint.sampler, 'mcmc')
+            self.assertEqual([p['name'] for p in checkpoint.varied_parameters], ['mass::b(MSbar)', 'mass::c'])
+            self.assertEqual(checkpoint.state['step'], 3)
+            np.testing.assert_array_equal(checkpoint.state['point'], state['point'])
+
+            rng = np.random.mtrand.RandomState(0)
+            rng.set_state(checkpoint.state['rng'])
+            self.assertEqual(rng.uniform(), np.random.mtrand.RandomState(1701).uniform())
+
+            # a state paired with a different description is rejected
+            eos.data.Checkpoint.create(path, 'mcmc', parameters[:1], state)
+            with open(os.path.join(path, 'state.pkl'), 'rb') as sf:
+                partial_state = sf.read()
+            eos.data.Checkpoint.create(path, 'mcmc', parameters, state)
+            with open(os.path.join(path, 'state.pkl'), 'wb') as sf:
+                sf.write(partial_state)
+            with self.assertRaises(RuntimeError):
+                eos.data.Checkpoint(path)
+
+            eos.data.Checkpoint.remove(path)
+            self.assertFalse(eos.data.Checkpoint.exists(path))
+
 if __name__ == '__main__':
     unittest.main(verbosity=5)
@@ -25,7 +25,6 @@ import eos
 import matplotlib as _matplotlib
 import numpy as _np
 import os
-import scipy as _scipy
 import yaml as _yaml
 
 class ItemColorCycler:
@@ -203,10 +202,12 @@ class ObservableItem(Item):
 
         # Declare variable that is either parameter or kinematic
         self._variable = None
+        self._variable_is_kinematic = False
 
         # Does the variable correspond to one of the kinematic variables?
         if self.variable in valid_kinematic_variables:
             self._variable = self._kinematics.declare(self.variable, _np.nan)
+            self._variable_is_kinematic = True
         else:
             # Is the variable name a QualifiedName?
             try:
@@ -231,6 +232,10 @@ class ObservableItem(Item):
     def prepare(self, context:AnalysisFileContext=None):
         "Prepare the drawing by evaluating the observable at the sample points."
         context = AnalysisFileContext() if context is None else context
+        if self._variable_is_kinematic:
+            self._yvalues = self._observable.evaluate_many(self.variable, self._xvalues)
+            return
+
         self._yvalues = _np.empty((len(self._xvalues),))
         for i, x in enumerate(self._xvalues):
             self._variable.set(x)
@@ -395,15 +400,8 @@ class UncertaintyBandItem(Item):
         _samples = self._datafile.samples
         _weights = self._datafile.weights
 
-        _ovalues_lower   = []
-        _ovalues_central = []
-        _ovalues_higher  = []
         INTERVAL = [0.15865, 0.5, 0.84135]  # central 68% interval
-        for i in range(len(_samples[0])):
-            lower, central, higher = eos.plot.Plotter._weighted_quantiles(_samples[:, i], INTERVAL, _weights)
-            _ovalues_lower.append(lower)
-            _ovalues_central.append(central)
-            _ovalues_higher.append(higher)
+        _ovalues_lower, _ovalues_central, _ovalues_higher = eos.weighted_quantiles(_samples, INTERVAL, _weights)
 
         self._xvalues = _np.linspace(_np.min(_xvalues), _np.max(_xvalues), self.resolution)
 
@@ -829,21 +827,16 @@ class OneDimensionalKernelDensityEstimateItem(Item):
             self.range = (samples.min(), samples.max())
 
         eos.inprogress(f"Computing KDE for samples of variable '{self.variable}'")
-        self.kde = _scipy.stats.gaussian_kde(samples, weights=weights)
-        self.kde.set_bandwidth(bw_method='silverman')
-        if self.bandwidth is not None:
-            self.kde.set_bandwidth(bw_method=self.kde.factor * self.bandwidth)
-
         self.xvalues = _np.linspace(self.range[0], self.range[1], self.xsamples)
-        self.pdf = self.kde(self.xvalues)
+        self.pdf = eos.kernel_density_estimate_1d(samples, weights, self.xvalues, bandwidth='silverman',
+                                                  factor=1.0 if self.bandwidth is None else self.bandwidth)
         self.pdf /= self.pdf.sum()
 
     def draw(self, ax):
         "Draw the KDE."
         # find the PDF value corresponding to a given cumulative probability
         if self.level is not None:
-            plevelf = lambda x, pdf, P: self.pdf[self.pdf > x].sum() - P
-            plevel = _scipy.optimize.brentq(plevelf, 0., 1., args=(self.pdf, self.level / 100.0 ))
+            plevel = eos.hpd_threshold(self.pdf, self.level / 100.0)
             ax.fill_between(_np.ma.masked_array(self.xvalues, mask=self.pdf < plevel),
                                             _np.ma.masked_array(self.pdf, mask=self.pdf < plevel, fill_value=_np.nan),
                                             facecolor=self.color, alpha=self.alpha)
@@ -990,10 +983,6 @@ class TwoDimensionalKernelDensityEstimateItem(Item):
         weights = self._datafile.weights
 
         eos.inprogress(f"Computing KDE for samples of variables '{self.variables[0]}' and '{self.variables[1]}'")
-        self._kde = _scipy.stats.gaussian_kde(samples.T, weights=weights)
-        self._kde.set_bandwidth(bw_method='silverman')
-        if self.bandwidth is not None:
-            self._kde.set_bandwidth(bw_method=self._kde.factor * self.bandwidth)
 
         # determine the extent of the plot
         if self.xrange is None:
@@ -1002,19 +991,20 @@ class TwoDimensionalKernelDensityEstimateItem(Item):
             self.yrange = (samples[:, 1].min(), samples[:, 1].max())
 
         # compute the PDF on a grid
-        xx,yy = _np.mgrid[self.xrange[0]:self.xrange[1]:100j, self.yrange[0]:self.yrange[1]:100j]
-        self._positions = _np.vstack([xx.ravel(), yy.ravel()])
-        self._pdf = _np.reshape(self._kde(self._positions).T, xx.shape)
+        self._pdf = eos.kernel_density_estimate_2d(samples[:, 0], samples[:, 1], weights,
+                                                   _np.linspace(self.xrange[0], self.xrange[1], 100),
+                                                   _np.linspace(self.yrange[0], self.yrange[1], 100),
+                                                   bandwidth='silverman', factor=1.0 if self.bandwidth is None else self.bandwidth)
         self._pdf /= self._pdf.sum()
 
     def draw(self, ax):
         "Draw the KDE."
         # find the PDF value corresponding to a given cummulative probability
-        plevel = lambda x, pdf, P: pdf[pdf > x].sum() - P
         plevels = []
         labels = []
         for level in self.levels:
-            plevels.append(_scipy.optimize.brentq(plevel, 0., 1., args=(self._pdf, level / 100.0)))
+            # the normalised PDF does not exceed one, which bounds the innermost region
+            plevels.append(eos.hpd_threshold(self._pdf, level / 100.0) if level > 0 else 1.0)
             labels.append(f'{level}%')
 
         if 'areas' in self.contours:
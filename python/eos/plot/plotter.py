@@ -518,10 +518,13 @@ class Plotter:
             observable = eos.Observable.make(oname, parameters, kinematics, options)
 
             xvalues = np.linspace(self.xlo, self.xhi, self.xsamples + 1)
-            ovalues = np.array([])
-            for xvalue in xvalues:
-                var.set(xvalue)
-                ovalues = np.append(ovalues, observable.evaluate())
+            if item['variable'] in valid_kin_vars:
+                ovalues = observable.evaluate_many(item['variable'], xvalues)
+            else:
+                ovalues = np.array([])
+                for xvalue in xvalues:
+                    var.set(xvalue)
+                    ovalues = np.append(ovalues, observable.evaluate())
 
             self.plotter.ax.plot(xvalues, ovalues, alpha=self.alpha, color=self.color, label=self.label, ls=self.style, lw=self.lw)
 
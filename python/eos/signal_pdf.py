@@ -104,6 +104,40 @@ class SignalPDF(_SignalPDF):
 
         return(parameter_samples, weights)
 
+    def sample_accept_reject(self, N, seed=1701, cells=4096, probes=16, safety=1.5):
+        """
+        Return independent samples of the kinematic variables and the log(PDF).
+
+        Obtains random samples using accept-reject sampling with a piecewise-constant envelope over a regular grid of cells
+        of the phase space. The samples are generated concurrently by EOS' thread pool, and are reproducible for a fixed seed.
+
+        :param N: Number of samples that shall be returned.
+        :param seed: Seed for the random number generator.
+        :param cells: Approximate total number of cells of the envelope.
+        :param probes: Number of probe points per cell used to estimate the maximum of the PDF within each cell.
+        :param safety: Factor by which the estimated maximum within each cell is enlarged.
+
+        :return: A tuple of the kinematic variables as array of shape (N, D) and the log(PDF) as array of size N.
+                 The columns correspond to the variables in `self.variables`.
+        """
+        config = eos.SignalPDFGeneratorConfig()
+        config.seed   = seed
+        config.cells  = cells
+        config.probes = probes
+        config.safety = safety
+
+        generator = eos.SignalPDFGenerator(self, config)
+
+        samples = np.empty((N, len(generator.variables())))
+        weights = np.empty(N)
+        generator.generate(samples, weights)
+        eos.info(f'Accept-reject sampling: efficiency is {generator.efficiency() * 100:3.0f}%')
+
+        # reorder the columns to match self.variables
+        columns = [generator.variables().index(v.name()) for v in self.variables]
+
+        return(samples[:, columns], weights)
+
     @staticmethod
     def make(name, parameters, kinematics, options):
         """
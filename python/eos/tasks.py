@@ -28,6 +28,7 @@ import os
 import pypmc
 import scipy
 import sys
+import time
 import copy as _copy
 import warnings
 import dynesty as _dynesty
@@ -79,7 +80,11 @@ def task(name, output, mode=lambda **kwargs: 'w', modules=[], logfile=True):
             _args.update(zip(func.__code__.co_varnames, args))
             _args.update(kwargs)
             if 'analysis_file' in _args and type(_args['analysis_file']) is str:
-                _args.update({ 'analysis_file': eos.AnalysisFile(_args['analysis_file'])})
+                # if EOS_ANALYSIS_SNAPSHOTS=1, share snapshots of the constructed analyses among all tasks using the same base directory
+                snapshot_directory = None
+                if os.environ.get('EOS_ANALYSIS_SNAPSHOTS', '0') == '1' and 'base_directory' in _args:
+                    snapshot_directory = os.path.join(_args['base_directory'], 'snapshots')
+                _args.update({ 'analysis_file': eos.AnalysisFile(_args['analysis_file'], snapshot_directory=snapshot_directory)})
             # create output directory if needed directly or for logging
             if output or logfile:
                 outputpath = ('{base_directory}/' + output).format(**_args)
@@ -110,6 +115,50 @@ def task(name, output, mode=lambda **kwargs: 'w', modules=[], logfile=True):
     return _task
 
 
+class _Checkpointer:
+    """
+    Writes the sampler state passed to it into a checkpoint, at most once per interval.
+
+    :param path: The path to the checkpoint, usually a subdirectory of the task's output directory.
+    :param sampler: The name of the sampler, e.g. 'mcmc' or 'pmc'.
+    :param analysis: The analysis from which the samples are drawn.
+    :param interval: The minimal time in seconds between two checkpoints.
+    """
+    def __init__(self, path, sampler, analysis, interval):
+        self.path = path
+        self.sampler = sampler
+        self.analysis = analysis
+        self.interval = interval
+        self.last_checkpoint = time.monotonic()
+
+    def __call__(self, state):
+        now = time.monotonic()
+        if now - self.last_checkpoint < self.interval:
+            return
+
+        eos.data.Checkpoint.create(self.path, self.sampler, self.analysis.varied_parameters, state)
+        self.last_checkpoint = now
+        eos.debug(f'Wrote checkpoint to \'{self.path}\'')
+
+    def load(self):
+        """Returns the state stored in the last checkpoint, or None if no checkpoint exists."""
+        if not eos.data.Checkpoint.exists(self.path):
+            eos.warn(f'No checkpoint found in \'{self.path}\'; starting from scratch')
+            return None
+
+        checkpoint = eos.data.Checkpoint(self.path)
+        if checkpoint.sampler != self.sampler:
+            raise ValueError(f'Checkpoint in \'{self.path}\' was created by sampler \'{checkpoint.sampler}\', expected \'{self.sampler}\'')
+        _check_varied_parameters_match(self.analysis, checkpoint)
+        eos.info(f'Resuming from checkpoint in \'{self.path}\'')
+
+        return checkpoint.state
+
+    def remove(self):
+        """Removes the checkpoint once the sampler has finished."""
+        eos.data.Checkpoint.remove(self.path)
+
+
 def _check_varied_parameters_match(analysis: eos.Analysis, data):
     # Check the parameters varied in the analysis match those of the loaded samples
     analysis_varied_params = [p.name() for p in analysis.varied_parameters]
@@ -275,8 +324,9 @@ def find_mode(analysis_file:str, posterior:str, base_directory:str='./', optimiz
     return (bfp, gof)
 
 
-@task('sample-mcmc', 'data/{posterior}/mcmc-{chain:04}')
-def sample_mcmc(analysis_file:str, posterior:str, chain:int, base_directory:str='./', pre_N:int=150, preruns:int=3, N:int=1000, stride:int=5, cov_scale:float=0.1, start_point:list=None):
+@task('sample-mcmc', 'data/{posterior}/mcmc-{chain:04}', mode=lambda resume, **kwargs: 'a' if resume else 'w')
+def sample_mcmc(analysis_file:str, posterior:str, chain:int, base_directory:str='./', pre_N:int=150, preruns:int=3, N:int=1000, stride:int=5, cov_scale:float=0.1, start_point:list=None,
+                resume:bool=False, checkpoint_interval:float=300.0):
     """
     Samples from a named posterior PDF using Markov Chain Monte Carlo (MCMC) methods.
 
@@ -302,15 +352,23 @@ def sample_mcmc(analysis_file:str, posterior:str, chain:int, base_directory:str=
     :type cov_scale: float, optional
     :param start_point: Optional starting point for the chain
     :type start_point: list-like, optional
+    :param resume: If set to True, sampling continues from the last checkpoint in EOS_BASE_DIRECTORY/data/POSTERIOR/mcmc-CHAIN/checkpoint. Defaults to False.
+    :type resume: bool, optional
+    :param checkpoint_interval: The minimal time in seconds between two checkpoints of the sampler state. Defaults to 300.
+    :type checkpoint_interval: float, optional
     """
 
     eos.inprogress(f'Beginning sampling...')
 
     analysis = analysis_file.analysis(posterior)
     rng = _np.random.mtrand.RandomState(int(chain) + 1701)
+    checkpointer = _Checkpointer(os.path.join(base_directory, 'data', posterior, f'mcmc-{chain:04}', 'checkpoint'), 'mcmc', analysis, checkpoint_interval)
+    resume_state = checkpointer.load() if resume else None
     try:
-        samples, usamples, weights = analysis.sample(N=N, stride=stride, pre_N=pre_N, preruns=preruns, rng=rng, cov_scale=cov_scale, start_point=start_point, return_uspace=True)
+        samples, usamples, weights = analysis.sample(N=N, stride=stride, pre_N=pre_N, preruns=preruns, rng=rng, cov_scale=cov_scale, start_point=start_point, return_uspace=True,
+                                                     checkpoint=checkpointer, resume_state=resume_state)
         eos.data.MarkovChain.create(os.path.join(base_directory, 'data', posterior, f'mcmc-{chain:04}'), analysis.varied_parameters, samples, usamples, weights)
+        checkpointer.remove()
     except RuntimeError as e:
         eos.error(f'encountered run time error ({e}) in parameter point:')
         for p in analysis.varied_parameters:
@@ -407,7 +465,8 @@ def mixture_product(posterior:str, posteriors:list, base_directory:str='./', ana
 @task('sample-pmc', 'data/{posterior}/pmc', mode=lambda initial_proposal, **kwargs: 'a' if initial_proposal != 'clusters' else 'a')
 def sample_pmc(analysis_file:str, posterior:str, base_directory:str='./', step_N:int=500, steps:int=10, final_N:int=5000,
                perplexity_threshold:float=1.0, weight_threshold:float=1e-10, sigma_test_stat:list=None, initial_proposal:str='clusters',
-               pmc_iterations:int=1, pmc_rel_tol:float=1e-10, pmc_abs_tol:float=1e-05, pmc_lookback:int=1):
+               pmc_iterations:int=1, pmc_rel_tol:float=1e-10, pmc_abs_tol:float=1e-05, pmc_lookback:int=1,
+               resume:bool=False, checkpoint_interval:float=300.0):
     """
     Samples from a named posterior using the Population Monte Carlo (PMC) methods.
 
@@ -450,10 +509,16 @@ def sample_pmc(analysis_file:str, posterior:str, base_directory:str='./', step_N
     :type pmc_abs_tol: float > 0.0, optional, advanced
     :param pmc_lookback: Use reweighted samples from the previous update steps when adjusting the mixture density. The parameter determines the number of update steps to "look back". The default value of 1 disables this feature, a value of 0 means that all previous steps are used.
     :type pmc_lookback: int >= 0, optional
+    :param resume: If set to True, the adaptation continues from the last checkpoint in EOS_BASE_DIRECTORY/data/POSTERIOR/pmc/checkpoint. Defaults to False.
+    :type resume: bool, optional
+    :param checkpoint_interval: The minimal time in seconds between two checkpoints of the sampler state. Defaults to 300.
+    :type checkpoint_interval: float, optional
     """
 
     analysis = analysis_file.analysis(posterior)
     rng = _np.random.mtrand.RandomState(1701)
+    checkpointer = _Checkpointer(os.path.join(base_directory, 'data', posterior, 'pmc', 'checkpoint'), 'pmc', analysis, checkpoint_interval)
+    resume_state = checkpointer.load() if resume else None
     eos.inprogress('Beginning sampling...')
     if initial_proposal == 'clusters':
         initial_density = eos.data.MixtureDensity(os.path.join(base_directory, 'data', posterior, 'clusters')).density()
@@ -468,7 +533,8 @@ def sample_pmc(analysis_file:str, posterior:str, base_directory:str='./', step_N
     samples, weights, posterior_values, proposal = analysis.sample_pmc(initial_density, step_N=step_N, steps=steps, final_N=final_N,
                                                      rng=rng, final_perplexity_threshold=perplexity_threshold,
                                                      weight_threshold=weight_threshold, pmc_iterations=pmc_iterations,
-                                                     pmc_rel_tol=pmc_rel_tol, pmc_abs_tol=pmc_abs_tol, pmc_lookback=pmc_lookback)
+                                                     pmc_rel_tol=pmc_rel_tol, pmc_abs_tol=pmc_abs_tol, pmc_lookback=pmc_lookback,
+                                                     checkpoint=checkpointer, resume_state=resume_state)
 
     if initial_proposal == 'pmc':
         samples = _np.concatenate((previous_sampler.samples, samples), axis=0)
@@ -478,6 +544,7 @@ def sample_pmc(analysis_file:str, posterior:str, base_directory:str='./', step_N
                                sigma_test_stat=sigma_test_stat, samples=samples, weights=weights)
     eos.data.ImportanceSamples.create(os.path.join(base_directory, 'data', posterior, 'samples'), analysis.varied_parameters,
                                       samples, weights, posterior_values=posterior_values)
+    checkpointer.remove()
     eos.completed('...finished!')
     eos.info(f'Finished sampling with {len(samples)} samples.')
 
@@ -604,8 +671,9 @@ class DynestyResultLogger:
 
 
 # Nested sampling
-@task('sample-nested', 'data/{posterior}/nested')
-def sample_nested(analysis_file:str, posterior:str, base_directory:str='./', bound:str='multi', nlive:int=250, dlogz:float=1.0, maxiter:int=None, miniter:int=0, seed:int=10, sample:str='auto'):
+@task('sample-nested', 'data/{posterior}/nested', mode=lambda resume, **kwargs: 'a' if resume else 'w')
+def sample_nested(analysis_file:str, posterior:str, base_directory:str='./', bound:str='multi', nlive:int=250, dlogz:float=1.0, maxiter:int=None, miniter:int=0, seed:int=10, sample:str='auto',
+                  resume:bool=False, checkpoint_interval:float=300.0, backend:str='dynesty'):
     """
     Samples from a likelihood associated with a named posterior using dynamic nested sampling.
 
@@ -632,11 +700,23 @@ def sample_nested(analysis_file:str, posterior:str, base_directory:str='./', bou
     :type seed: int, optional
     :param sample: The method used for sampling within the likelihood constraints. For valid values, see dynesty documentation. Defaults to 'auto'.
     :type sample: str, optional
+    :param resume: If set to True, sampling continues from the last checkpoint in EOS_BASE_DIRECTORY/data/POSTERIOR/nested/checkpoint.save. Defaults to False.
+    :type resume: bool, optional
+    :param checkpoint_interval: The minimal time in seconds between two checkpoints of the sampler state, including the live points. Defaults to 300.
+    :type checkpoint_interval: float, optional
+    :param backend: The nested sampling implementation, either 'dynesty' or 'native'. The native backend replaces batches of live points concurrently
+                    on all available threads, but does not support checkpoints. Defaults to 'dynesty'.
+    :type backend: str, optional
     """
     eos.inprogress('Beginning sampling...')
     analysis = analysis_file.analysis(posterior)
     logger = DynestyResultLogger()
-    results = analysis.sample_nested(bound=bound, nlive=nlive, dlogz=dlogz, maxiter=maxiter, miniter=miniter, print_function=logger.print_function, seed=seed, sample=sample)
+    checkpoint_file = os.path.join(base_directory, 'data', posterior, 'nested', 'checkpoint.save') if backend == 'dynesty' else None
+    if resume and (checkpoint_file is None or not os.path.isfile(checkpoint_file)):
+        eos.warn(f'No checkpoint found in \'{checkpoint_file}\'; starting from scratch')
+        resume = False
+    results = analysis.sample_nested(bound=bound, nlive=nlive, dlogz=dlogz, maxiter=maxiter, miniter=miniter, print_function=logger.print_function, seed=seed, sample=sample,
+                                     checkpoint_file=checkpoint_file, checkpoint_every=checkpoint_interval, resume=resume, backend=backend)
     samples = results.samples
     posterior_values = results.logwt - results.logz[-1]
     weights = _np.exp(posterior_values)
@@ -645,6 +725,81 @@ def sample_nested(analysis_file:str, posterior:str, base_directory:str='./', bou
     eos.data.DynestyResults.create(os.path.join(base_directory, 'data', posterior, 'nested'), analysis.varied_parameters, results)
     eos.data.ImportanceSamples.create(os.path.join(base_directory, 'data', posterior, 'samples'), analysis.varied_parameters,
                                       samples, weights, posterior_values=posterior_values)
+    if checkpoint_file is not None and os.path.isfile(checkpoint_file):
+        os.remove(checkpoint_file)
+
+
+@task('profile-likelihood', 'data/{posterior}/profile-{label}')
+def profile_likelihood(analysis_file:str, posterior:str, parameters:list, base_directory:str='./', points:int=21, label:str='default',
+                       chunk_size:int=16, max_iterations:int=10000, tolerance:float=1e-8):
+    """
+    Computes the profile of the log(posterior) associated with a named posterior on a grid in one or more parameters of interest.
+
+    At each grid point, the log(likelihood) plus the log(priors) of the nuisance parameters is maximised with respect to all other
+    varied parameters. The grid points are distributed across all available threads, and each maximisation is warm-started from
+    the solution at a neighbouring grid point.
+
+    The output will be stored in EOS_BASE_DIRECTORY/data/POSTERIOR/profile-LABEL.
+
+    :param analysis_file: The name of the analysis file that describes the named posterior, or an object of class `eos.AnalysisFile`.
+    :type analysis_file: str or `eos.AnalysisFile`
+    :param posterior: The name of the posterior.
+    :type posterior: str
+    :param parameters: The parameters of interest. Each entry is either the name of a varied parameter, in which case its prior range is used,
+                       or a dictionary with the keys 'name', 'min', 'max', and optionally 'points'.
+    :type parameters: list of str or dict
+    :param base_directory: The base directory for the storage of data files. Can also be set via the EOS_BASE_DIRECTORY environment variable.
+    :type base_directory: str, optional
+    :param points: The number of grid points per parameter of interest, unless specified otherwise. Defaults to 21.
+    :type points: int, optional
+    :param label: The label of the output directory. Defaults to 'default'.
+    :type label: str, optional
+    :param chunk_size: The number of consecutive grid points that are processed in sequence by one thread. Defaults to 16.
+    :type chunk_size: int, optional
+    :param max_iterations: The maximal number of iterations of the minimiser per grid point. Defaults to 10000.
+    :type max_iterations: int, optional
+    :param tolerance: The tolerance of the minimiser. Defaults to 1e-8.
+    :type tolerance: float, optional
+    """
+    if len(parameters) == 0:
+        raise ValueError('At least one parameter of interest is required')
+
+    analysis = analysis_file.analysis(posterior)
+    varied_parameters = { p.name(): p for p in analysis.varied_parameters }
+
+    names, values = [], []
+    for entry in parameters:
+        if isinstance(entry, str):
+            entry = { 'name': entry }
+        name = entry['name']
+        if name not in varied_parameters:
+            raise ValueError(f'Parameter of interest \'{name}\' is not varied in posterior \'{posterior}\'')
+        minv = float(entry['min']) if 'min' in entry else varied_parameters[name].min()
+        maxv = float(entry['max']) if 'max' in entry else varied_parameters[name].max()
+        n = int(entry['points']) if 'points' in entry else points
+        if n < 2:
+            raise ValueError(f'At least two grid points are required for parameter of interest \'{name}\'')
+        names.append(name)
+        values.append(_np.linspace(minv, maxv, n).tolist())
+
+    config = eos.ProfileLikelihoodConfig()
+    config.chunk_size = chunk_size
+    config.max_iterations = max_iterations
+    config.tolerance = tolerance
+
+    eos.inprogress(f'Beginning profile of posterior \'{posterior}\' in {len(names)} parameter(s)...')
+    results = eos.ProfileLikelihood(analysis._log_posterior, names).profile(values, config)
+    eos.completed('...finished!')
+
+    poi_parameters = [analysis.parameters[n] for n in results.parameters]
+    nuisance_parameters = [analysis.parameters[n] for n in results.nuisance_parameters]
+    log_posterior = _np.array(results.log_posterior)
+    nuisance_samples = _np.array(results.nuisance_values).reshape(len(log_posterior), len(nuisance_parameters))
+    eos.info(f'Maximal log(posterior) {_np.max(log_posterior):.4f} at the grid point ' +
+             '[ ' + ', '.join([f'{v:.4g}' for v in results.points[int(_np.argmax(log_posterior))]]) + ' ]')
+
+    eos.data.ProfileLikelihood.create(os.path.join(base_directory, 'data', posterior, f'profile-{label}'),
+                                      poi_parameters, nuisance_parameters, _np.array(results.points), log_posterior, nuisance_samples)
 
 
 def _get_modes(posterior:str, base_directory:str='./'):
@@ -922,54 +1077,65 @@ def validate(analysis_file:str):
     analysis_file.validate()
 
 
-def _calculate_mask(observable: eos.Observable, analysis_parameters: eos.Parameters, data: eos.data.ImportanceSamples):
-    try:
-        from tqdm.auto import tqdm
-        progressbar = tqdm
-    except ImportError:
-        progressbar = lambda x: x
-
-    parameters = [analysis_parameters[p['name']] for p in data.varied_parameters]
-    nsamples = len(data.samples)
-    observable_samples = _np.zeros(nsamples)
-    eos.inprogress(f'Predicting observable \'{observable.name()}\' for {nsamples} samples')
-    for i, sample in enumerate(progressbar(data.samples)):
-        for p, v in zip(parameters, sample):
-            p.set(v)
-        try:
-            observable_samples[i] = observable.evaluate()
-        except RuntimeError as e:
-            eos.error(f'skipping prediction for sample {i} due to runtime error ({e}): {sample}')
-            observable_samples[i] = _np.nan
-    return observable_samples > 0
-
 # Create mask
 @task('create-mask', 'data/{posterior}/mask-{mask_name}')
 def create_mask(analysis_file:str, posterior:str, mask_name:str, base_directory:str='./'):
+    """
+    Creates a mask for previously obtained importance samples of a named posterior.
+
+    All observables of the named mask and of the masks it refers to are evaluated in a single, parallel pass over the samples.
+    The input files are expected in EOS_BASE_DIRECTORY/data/POSTERIOR/samples.
+    The output files will be stored in EOS_BASE_DIRECTORY/data/POSTERIOR/mask-MASK_NAME, and likewise for each mask referred to.
+
+    :param analysis_file: The name of the analysis file that describes the named posterior, or an object of class `eos.AnalysisFile`.
+    :type analysis_file: str or `eos.AnalysisFile`
+    :param posterior: The name of the posterior.
+    :type posterior: str
+    :param mask_name: The name of the mask.
+    :type mask_name: str
+    :param base_directory: The base directory for the storage of data files. Can also be set via the EOS_BASE_DIRECTORY environment variable.
+    :type base_directory: str, optional
+    """
     _analysis = analysis_file.analysis(posterior)
     _parameters = _analysis.parameters
     data = eos.data.ImportanceSamples(os.path.join(base_directory, 'data', posterior, 'samples'))
     _check_varied_parameters_match(_analysis, data)
 
-    mask_component = analysis_file._masks[mask_name]
-    mask_logical_combination = mask_component.logical_combination
-    if mask_logical_combination == "and":
-        mask_combination_function = _np.all
-    elif mask_logical_combination == "or":
-        mask_combination_function = _np.any
+    evaluator = eos.SampleMaskEvaluator(_parameters, [p['name'] for p in data.varied_parameters])
+    masks = {} # mask name -> (component index, row of the evaluated masks, names of the components)
+    def add_mask(name):
+        if name in masks:
+            if masks[name] is None:
+                raise ValueError(f'Mask \'{name}\' refers to itself')
+            return masks[name][0]
+        masks[name] = None
+
+        mask_component = analysis_file._masks[name]
+        combination = eos.SampleMaskCombination.conjunction if mask_component.logical_combination == 'and' else eos.SampleMaskCombination.disjunction
+        components = []
+        observables = []
+        for d in mask_component.description:
+            if hasattr(d, 'mask_name'):
+                components.append(add_mask(d.mask_name))
+                observables.append(d.mask_name)
+            else:
+                components.append(evaluator.add_observable(analysis_file.observable(posterior, d.name, _parameters)))
+                observables.append(d.name)
 
-    masks = []
-    observables = []
-    for d in mask_component.description:
-        try:
-            masks.append(create_mask(analysis_file, posterior, d.mask_name, base_directory))
-            observables.append(d.mask_name)
-        except AttributeError: # Not a mask but an observable
-            masks.append(_calculate_mask(analysis_file.observable(posterior, d.name, _parameters), _parameters, data))
-            observables.append(d.name)
-    mask = mask_combination_function(_np.stack(masks), axis=0)
-    eos.data.SampleMask.create(os.path.join(base_directory, 'data', posterior, f'mask-{mask_name}'), mask, observables)
-    return mask
+        masks[name] = (evaluator.add_mask(components, combination), evaluator.number_of_masks() - 1, observables)
+        return masks[name][0]
+
+    add_mask(mask_name)
+
+    eos.inprogress(f'Evaluating {len(masks)} mask(s) for {len(data.samples)} samples')
+    values = evaluator.evaluate(data.samples)
+    eos.completed(f'... done')
+
+    for name, (_, row, observables) in masks.items():
+        eos.info(f'Mask \'{name}\' retains {_np.count_nonzero(values[row])} of {len(data.samples)} samples')
+        eos.data.SampleMask.create(os.path.join(base_directory, 'data', posterior, f'mask-{name}'), values[row], observables)
+
+    return values[masks[mask_name][1]]
 
 
 @task('list-figures', '', logfile=False)
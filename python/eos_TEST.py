@@ -183,6 +183,177 @@ class PythonTests:
                 except Exception as e:
                     raise TestFailedError(f'invalid latex string "${s}$" for unit \'{attr}\': {e}')
 
+    """
+    Check bulk access to parameters and the view onto the predictions of an ObservableCache.
+    """
+    def check_010_BulkAccess(self):
+        from eos import Kinematics, Observable, ObservableCache, Options, Parameters, ParameterVector
+
+        p = Parameters.Defaults()
+        parameters = [p['mass::e'], p['mass::mu']]
+        vector = ParameterVector(parameters)
+
+        if not len(vector) == 2:
+            raise TestFailedError('ParameterVector has the wrong size')
+
+        vector.set(_np.array([0.5, 0.25]))
+        if not (parameters[0].evaluate() == 0.5 and parameters[1].evaluate() == 0.25):
+            raise TestFailedError('ParameterVector.set failed')
+
+        if not _np.all(vector.values() == _np.array([0.5, 0.25])):
+            raise TestFailedError('ParameterVector.values failed')
+
+        vector.set([0.75, 1.0])
+        if not _np.all(vector.values() == _np.array([0.75, 1.0])):
+            raise TestFailedError('ParameterVector.set failed for a list')
+
+        try:
+            vector.set(_np.array([1.0]))
+            raise TestFailedError('ParameterVector.set accepted values of the wrong size')
+        except ValueError:
+            pass
+
+        cache = ObservableCache(p)
+        obs = Observable.make('B->Dlnu::BR', p, Kinematics(q2_min=0.02, q2_max=10), Options(model='SM'))
+        handle = cache.add(obs)
+        cache.update()
+        predictions = cache.predictions()
+
+        if not predictions[handle] == cache[handle]:
+            raise TestFailedError('ObservableCache.predictions does not match the updated cache')
+
+        # the predictions remain valid when the cache's storage is reallocated
+        for q2_max in _np.linspace(5.0, 9.0, 64):
+            cache.add(Observable.make('B->Dlnu::BR', p, Kinematics(q2_min=0.02, q2_max=q2_max), Options(model='SM')))
+
+        if not predictions[handle] == cache[handle]:
+            raise TestFailedError('ObservableCache.predictions is invalidated by ObservableCache.add')
+
+    """
+    Check the evaluation of an observable for a sequence of values of a kinematic variable.
+    """
+    def check_011_EvaluateMany(self):
+        from eos import Kinematics, Observable, Options, Parameters
+
+        k = Kinematics(q2=5.0)
+        obs = Observable.make('B->Dlnu::dBR/dq2', Parameters.Defaults(), k, Options(l='mu'))
+
+        q2 = _np.linspace(1.0, 10.0, 200)
+        values = obs.evaluate_many('q2', q2)
+
+        if not values.shape == q2.shape:
+            raise TestFailedError('Observable.evaluate_many returned an array of the wrong shape')
+
+        for i in [0, 99, 199]:
+            k['q2'].set(q2[i])
+            if not _np.isclose(values[i], obs.evaluate(), rtol=1e-13, atol=0.0):
+                raise TestFailedError('Observable.evaluate_many disagrees with Observable.evaluate')
+
+        k['q2'].set(5.0)
+        if not obs.evaluate_many('q2', [5.0])[0] == obs.evaluate():
+            raise TestFailedError('Observable.evaluate_many failed for a list')
+
+    """
+    Check the profiling of the updates of an ObservableCache.
+    """
+    def check_012_Profile(self):
+        import json
+        from eos import Kinematics, Observable, ObservableCache, Options, Parameters
+
+        p = Parameters.Defaults()
+        cache = ObservableCache(p)
+        cache.add(Observable.make('B->Dlnu::BR', p, Kinematics(q2_min=0.02, q2_max=10), Options(model='SM')))
+
+        ObservableCache.enable_profiling(True)
+        ObservableCache.reset_profile()
+        cache.update()
+        cache.update()
+        ObservableCache.enable_profiling(False)
+
+        profile = json.loads(ObservableCache.profile())
+        entries = [o for o in profile['observables'] if o['name'].startswith('B->Dlnu::BR[')]
+        if not len(entries) == 1 or not entries[0]['calls'] == 2:
+            raise TestFailedError('ObservableCache.profile did not record the updates')
+
+        if not 'B->Dlnu::BR[' in ObservableCache.profile('folded'):
+            raise TestFailedError('ObservableCache.profile failed for the folded format')
+
+        ObservableCache.reset_profile()
+
+    """
+    Check the native kernel density estimates and weighted quantiles against the SciPy and NumPy implementations.
+    """
+    def check_013_KernelDensityEstimate(self):
+        import eos
+        from scipy.stats import gaussian_kde
+
+        rng = _np.random.default_rng(1701)
+        n = 100000
+        x = rng.normal(size=n)
+        y = 0.5 * x + 0.3 * rng.normal(size=n)
+        w = rng.uniform(0.5, 1.5, size=n)
+
+        xpoints = _np.linspace(-3.0, 3.0, 100)
+        ypoints = _np.linspace(-2.0, 2.0, 100)
+
+        reference = gaussian_kde(x, weights=w, bw_method='silverman')
+        reference.set_bandwidth(bw_method=reference.factor * 2.0)
+        reference = reference(xpoints)
+        native = eos.kernel_density_estimate_1d(x, w, xpoints, bandwidth='silverman', factor=2.0)
+
+        if not _np.allclose(native, reference, rtol=0.0, atol=1e-4 * reference.max()):
+            raise TestFailedError('kernel_density_estimate_1d disagrees with scipy.stats.gaussian_kde')
+
+        m = 10000
+        xx, yy = _np.meshgrid(xpoints, ypoints, indexing='ij')
+        reference = gaussian_kde(_np.vstack([x[:m], y[:m]]), weights=w[:m], bw_method='silverman')
+        reference = reference(_np.vstack([xx.ravel(), yy.ravel()])).reshape(xx.shape)
+        native = eos.kernel_density_estimate_2d(x[:m], y[:m], w[:m], xpoints, ypoints)
+
+        if not native.shape == (100, 100):
+            raise TestFailedError('kernel_density_estimate_2d returned an array of the wrong shape')
+
+        if not _np.allclose(native, reference, rtol=0.0, atol=1e-2 * reference.max()):
+            raise TestFailedError('kernel_density_estimate_2d disagrees with scipy.stats.gaussian_kde')
+
+        pdf = native / native.sum()
+        threshold = eos.hpd_threshold(pdf, 0.68)
+        if not pdf[pdf >= threshold].sum() >= 0.68 > pdf[pdf > threshold].sum():
+            raise TestFailedError('hpd_threshold does not bound the highest-density region')
+
+        samples = _np.vstack([x, y]).T
+        quantiles = eos.weighted_quantiles(samples, [0.15865, 0.5, 0.84135], w)
+        for i in range(2):
+            reference = eos.plot.Plotter._weighted_quantiles(samples[:, i], [0.15865, 0.5, 0.84135], w)
+            if not _np.allclose(quantiles[:, i], reference, rtol=1e-12, atol=0.0):
+                raise TestFailedError('weighted_quantiles disagrees with the reference implementation')
+
+    """
+    Check the joint evaluation of the B -> PP amplitudes of several channels against the individual amplitudes.
+    """
+    def check_014_NonleptonicChannels(self):
+        from eos import Kinematics, Observable, Options, Parameters, SU3FChannels
+
+        p = Parameters.Defaults()
+        p['nonleptonic::Re{AT3}@SU3F'] = 0.5
+        p['nonleptonic::Im{CT3}@SU3F'] = 0.3
+        p['nonleptonic::Re{AP3}@SU3F'] = 0.1
+
+        channels = [Options(q='d', P1='pi^+', P2='pi^-'), Options(q='u', P1='pi^+', P2='pi^0'), Options(q='d', P1='K_u', P2='pi^-')]
+        amplitudes = SU3FChannels(p, Options(model='CKM'), channels).amplitudes()
+
+        if not len(amplitudes) == len(channels):
+            raise TestFailedError('SU3FChannels.amplitudes returned the wrong number of amplitudes')
+
+        for amplitude, o in zip(amplitudes, channels):
+            options = Options(model='CKM', representation='SU3F')
+            for key, value in o:
+                options.declare(key, value)
+            re = Observable.make('B->PP::Re{amplitude}', p, Kinematics(), options).evaluate()
+            im = Observable.make('B->PP::Im{amplitude}', p, Kinematics(), options).evaluate()
+            if not _np.isclose(amplitude, complex(re, im), rtol=1e-12, atol=0.0):
+                raise TestFailedError('SU3FChannels.amplitudes disagrees with the individual amplitudes')
+
 
 class LoggingTests(unittest.TestCase):
 
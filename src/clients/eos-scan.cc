@@ -1,7 +1,7 @@
 /* vim: set sw=4 sts=4 et foldmethod=syntax : */
 
 /*
- * Copyright (c) 2010, 2011 Danny van Dyk
+ * Copyright (c) 2010, 2011, 2025 Danny van Dyk
  *
  * This file is part of the EOS project. EOS is free software;
  * you can redistribute it and/or modify it under the terms of the GNU General
@@ -18,24 +18,27 @@
  */
 
 #include <eos/observable.hh>
-#include <eos/utils/cartesian-product.hh>
+#include <eos/statistics/grid-scan.hh>
 #include <eos/utils/destringify.hh>
-#include <eos/utils/lock.hh>
 #include <eos/utils/log.hh>
-#include <eos/utils/mutex.hh>
-#include <eos/utils/thread_pool.hh>
 
+#include <bit>
 #include <cmath>
 #include <config.h>
+#include <cstdint>
 #include <cstdlib>
-#include <functional>
+#include <filesystem>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <list>
-#include <map>
+#include <memory>
+#include <sstream>
 #include <utility>
 #include <vector>
 
+#include <yaml-cpp/yaml.h>
+
 using namespace eos;
 
 struct Input
@@ -53,155 +56,232 @@ struct Input
         const std::string o_name;
 };
 
-struct ScanData
-{
-        std::string name;
-        unsigned    points;
-        double      min;
-        double      max;
-};
-
-class WilsonScan
+// The chi^2 of all inputs at one point of the scan. Each instance uses its own parameters and observables.
+class ChiSquare
 {
-    public:
-        Mutex * const mutex;
+    private:
+        Parameters parameters;
 
-        std::list<std::pair<Input, ObservablePtr>> bins;
+        std::vector<Parameter> scan_parameters;
 
-        std::list<ScanData> scan_data;
+        std::vector<Parameter> variations;
 
-        std::list<Input> inputs;
-
-        std::list<std::string> variation_names;
+        std::vector<std::pair<Input, ObservablePtr>> bins;
 
         double theory_uncertainty;
 
-        std::list<std::pair<std::vector<double>, double>> results;
-
-        WilsonScan(const std::list<ScanData> & scan_data, const std::list<Input> & inputs, const std::list<std::pair<std::string, double>> & param_changes,
-                   const std::list<std::string> & variation_names, const double & theory_uncertainty) :
-            mutex(new Mutex),
-            scan_data(scan_data),
-            inputs(inputs),
-            variation_names(variation_names),
+    public:
+        ChiSquare(const std::vector<GridScan::Dimension> & dimensions, const std::list<Input> & inputs,
+                  const std::list<std::pair<std::string, double>> & param_changes, const std::list<std::string> & variation_names,
+                  const double & theory_uncertainty) :
+            parameters(Parameters::Defaults()),
             theory_uncertainty(theory_uncertainty)
         {
-            Parameters parameters = Parameters::Defaults();
-            Kinematics kinematics;
-            kinematics.declare("s_min");
-            kinematics.declare("s_max");
-
             for (const auto & param_change : param_changes)
             {
                 parameters[param_change.first] = param_change.second;
             }
 
+            for (const auto & d : dimensions)
+            {
+                scan_parameters.push_back(parameters[d.name]);
+            }
+
+            for (const auto & variation_name : variation_names)
+            {
+                variations.push_back(parameters[variation_name]);
+            }
+
             for (const auto & input : inputs)
             {
-                bins.push_back(std::make_pair(input, Observable::make(input.o_name, parameters.clone(), kinematics.clone(), Options())));
+                ObservablePtr observable = Observable::make(input.o_name, parameters, Kinematics{ { "q2_min", input.min }, { "q2_max", input.max } }, Options());
+                if (! observable)
+                {
+                    throw InternalError("Unknown observable '" + input.o_name + "'");
+                }
+
+                bins.push_back(std::make_pair(input, observable));
             }
         }
 
-        void
-        calc_chi_square(const Input & input, const ObservablePtr & observable, const CartesianProduct<std::vector<double>>::Iterator & wc_iterator)
+        double
+        operator() (const std::vector<double> & point)
         {
-            Kinematics k = observable->kinematics();
-            k.set("s_min", input.min);
-            k.set("s_max", input.max);
-
-            ObservablePtr o      = observable->clone();
-            Parameters    params = o->parameters();
-
-            auto                sd        = scan_data.cbegin();
-            std::vector<double> wc_values = *wc_iterator;
-            for (auto w = wc_values.cbegin(); wc_values.cend() != w; ++w, ++sd)
+            for (unsigned i = 0; i < scan_parameters.size(); ++i)
             {
-                params[sd->name] = *w;
+                scan_parameters[i] = point[i];
             }
 
-            // Calculate chi^2
-            double central   = o->evaluate();
-            double delta_min = 0.0, delta_max = 0.0;
-            for (auto & variation_name : variation_names)
+            double result = 0.0;
+            for (const auto & [input, o] : bins)
             {
-                Parameter p     = params[variation_name];
-                double    old_p = p();
-                double    max = 0.0, min = 0.0, value;
-
-                p     = p.min();
-                value = o->evaluate();
-                if (value > central)
+                double central   = o->evaluate();
+                double delta_min = 0.0, delta_max = 0.0;
+                for (auto & p : variations)
                 {
-                    max = value - central;
-                }
+                    double old_p = p();
+                    double max = 0.0, min = 0.0, value;
 
-                if (value < central)
-                {
-                    min = central - value;
+                    p     = p.min();
+                    value = o->evaluate();
+                    if (value > central)
+                    {
+                        max = value - central;
+                    }
+
+                    if (value < central)
+                    {
+                        min = central - value;
+                    }
+
+                    p     = p.max();
+                    value = o->evaluate();
+                    if (value > central)
+                    {
+                        max = std::max(max, value - central);
+                    }
+
+                    if (value < central)
+                    {
+                        min = std::max(min, central - value);
+                    }
+
+                    p = old_p;
+
+                    delta_min += min * min;
+                    delta_max += max * max;
                 }
 
-                p     = p.max();
-                value = o->evaluate();
-                if (value > central)
+                delta_min += pow(central * theory_uncertainty, 2);
+                delta_max += pow(central * theory_uncertainty, 2);
+
+                delta_max = std::sqrt(delta_max);
+                delta_min = std::sqrt(delta_min);
+
+                double chi = 0.0;
+                if (input.o - central > delta_max)
                 {
-                    max = std::max(max, value - central);
+                    chi = input.o - central - delta_max;
                 }
-
-                if (value < central)
+                else if (central - input.o > delta_min)
                 {
-                    min = std::max(min, central - value);
+                    chi = central - input.o - delta_min;
                 }
 
-                p = old_p;
-
-                delta_min += min * min;
-                delta_max += max * max;
+                chi    /= (input.o_max - input.o_min);
+                result += chi * chi;
             }
 
-            delta_min += pow(central * theory_uncertainty, 2);
-            delta_max += pow(central * theory_uncertainty, 2);
+            return result;
+        }
+};
+
+// Writes a two-dimensional array of doubles to a file in NumPy's .npy format. The header is updated
+// after each appended block of rows, so that the file can be read while the scan is still ongoing.
+class NumpyArrayWriter
+{
+    private:
+        std::fstream file;
+
+        const unsigned columns;
 
-            delta_max = std::sqrt(delta_max);
-            delta_min = std::sqrt(delta_min);
+        unsigned long rows;
 
-            double chi = 0.0;
-            if (input.o - central > delta_max)
-            {
-                chi = input.o - central - delta_max;
-            }
-            else if (central - input.o > delta_min)
+        // the header has a fixed size, so that it can be rewritten in place
+        static constexpr unsigned header_size = 128;
+
+        void
+        write_header()
+        {
+            std::ostringstream dict;
+            dict << "{'descr': '" << (std::endian::native == std::endian::little ? '<' : '>') << "f8', 'fortran_order': False, 'shape': ("
+                 << rows << ", " << columns << "), }";
+
+            std::string header = dict.str();
+            header.resize(header_size - 10 - 1, ' ');
+            header += '\n';
+
+            const std::uint16_t length = header.size();
+            file.seekp(0);
+            file.write("\x93NUMPY\x01\x00", 8);
+            file.put(char(length & 0xff));
+            file.put(char(length >> 8));
+            file.write(header.data(), header.size());
+        }
+
+    public:
+        NumpyArrayWriter(const std::filesystem::path & path, const unsigned & columns) :
+            file(path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc),
+            columns(columns),
+            rows(0)
+        {
+            if (! file)
             {
-                chi = central - input.o - delta_min;
+                throw InternalError("Cannot open file '" + path.string() + "' for writing");
             }
 
-            chi                /= (input.o_max - input.o_min);
-            double chi_squared  = chi * chi;
+            write_header();
+            file.flush();
+        }
+
+        void
+        append(const std::vector<double> & data)
+        {
+            file.seekp(0, std::ios::end);
+            file.write(reinterpret_cast<const char *>(data.data()), data.size() * sizeof(double));
+            rows += data.size() / columns;
 
+            write_header();
+            file.flush();
+        }
+};
+
+class WilsonScan
+{
+    public:
+        std::vector<GridScan::Dimension> dimensions;
+
+        std::list<Input> inputs;
+
+        std::list<std::pair<std::string, double>> param_changes;
+
+        std::list<std::string> variation_names;
+
+        double theory_uncertainty;
+
+        GridScan::Config config;
+
+        WilsonScan(const std::vector<GridScan::Dimension> & dimensions, const std::list<Input> & inputs, const std::list<std::pair<std::string, double>> & param_changes,
+                   const std::list<std::string> & variation_names, const double & theory_uncertainty, const GridScan::Config & config) :
+            dimensions(dimensions),
+            inputs(inputs),
+            param_changes(param_changes),
+            variation_names(variation_names),
+            theory_uncertainty(theory_uncertainty),
+            config(config)
+        {
+        }
+
+        GridScan::FunctionFactory
+        factory() const
+        {
+            return [this]() -> GridScan::Function
             {
-                Lock l(*mutex);
-                results.push_back(std::make_pair(wc_values, chi_squared));
-            }
+                auto chi_square = std::make_shared<ChiSquare>(dimensions, inputs, param_changes, variation_names, theory_uncertainty);
+
+                return [chi_square](const std::vector<double> & point) { return (*chi_square)(point); };
+            };
         }
 
+        // stream the results as text columns to standard output
         void
         scan()
         {
             std::cout << "# Generated by eos-scan (" EOS_GITHEAD ")" << std::endl;
             std::cout << "# Scan data" << std::endl;
-
-            CartesianProduct<std::vector<double>> cp;
-            for (auto sd = scan_data.cbegin(); scan_data.cend() != sd; ++sd)
+            for (const auto & d : dimensions)
             {
-                std::vector<double> set;
-                double              delta = (sd->max - sd->min) / sd->points;
-
-                for (unsigned i = 0; i <= sd->points; ++i)
-                {
-                    set.push_back(sd->min + delta * i);
-                }
-                cp.over(set);
-
-                std::cout << "#   " << sd->name << ": [" << sd->min << ", " << sd->max << "], increment = " << delta << std::endl;
+                std::cout << "#   " << d.name << ": [" << d.min << ", " << d.max << "], increment = " << (d.max - d.min) / d.intervals << std::endl;
             }
 
             std::cout << "# Inputs" << std::endl;
@@ -211,34 +291,83 @@ class WilsonScan
                           << std::endl;
             }
 
-            TicketList    tickets;
-            unsigned long jobs = 0;
-            for (auto bin = bins.begin(); bins.end() != bin; ++bin)
+            std::cout << std::scientific << std::setprecision(7);
+
+            unsigned long points = 0;
+            GridScan grid_scan(dimensions, factory());
+            grid_scan.scan(config, [&](const std::vector<double> & p, const std::vector<double> & chi_squares)
             {
-                for (auto w = cp.begin(); cp.end() != w; ++w)
+                for (unsigned k = 0; k < chi_squares.size(); ++k)
                 {
-                    ThreadPool::instance()->wait_for_free_capacity();
-                    tickets.push_back(ThreadPool::instance()->enqueue(std::bind(&WilsonScan::calc_chi_square, this, bin->first, bin->second, w)));
-                    ++jobs;
-                    if (jobs % 100 == 0)
+                    for (unsigned d = 0; d < dimensions.size(); ++d)
                     {
-                        std::cerr << '[' << jobs << '/' << cp.size() << ']' << std::endl;
+                        std::cout << p[k * dimensions.size() + d] << '\t';
                     }
+
+                    std::cout << chi_squares[k] << '\n';
                 }
+                std::cout << std::flush;
+
+                points += chi_squares.size();
+                std::cerr << '[' << points << " points]" << std::endl;
+            });
+        }
+
+        // stream the results into a directory in the format of eos.data.GridScan
+        void
+        scan(const std::filesystem::path & path)
+        {
+            std::filesystem::create_directories(path);
+
+            YAML::Emitter out;
+            out << YAML::BeginMap;
+            out << YAML::Key << "version" << YAML::Value << PACKAGE_VERSION;
+            out << YAML::Key << "type" << YAML::Value << "GridScan";
+            out << YAML::Key << "parameters" << YAML::Value << YAML::BeginSeq;
+            for (const auto & d : dimensions)
+            {
+                out << YAML::BeginMap;
+                out << YAML::Key << "name" << YAML::Value << d.name;
+                out << YAML::Key << "min" << YAML::Value << d.min;
+                out << YAML::Key << "max" << YAML::Value << d.max;
+                out << YAML::Key << "intervals" << YAML::Value << d.intervals;
+                out << YAML::EndMap;
+            }
+            out << YAML::EndSeq;
+            out << YAML::Key << "inputs" << YAML::Value << YAML::BeginSeq;
+            for (const auto & input : inputs)
+            {
+                out << YAML::BeginMap;
+                out << YAML::Key << "observable" << YAML::Value << input.o_name;
+                out << YAML::Key << "kinematics" << YAML::Value << YAML::Flow << YAML::BeginMap
+                    << YAML::Key << "q2_min" << YAML::Value << input.min
+                    << YAML::Key << "q2_max" << YAML::Value << input.max << YAML::EndMap;
+                out << YAML::Key << "measurement" << YAML::Value << YAML::Flow << YAML::BeginSeq << input.o_min << input.o << input.o_max << YAML::EndSeq;
+                out << YAML::EndMap;
             }
+            out << YAML::EndSeq;
+            out << YAML::Key << "levels" << YAML::Value << YAML::Flow << config.levels;
+            out << YAML::Key << "refinements" << YAML::Value << config.refinements;
+            out << YAML::EndMap;
 
-            tickets.wait();
+            std::ofstream description(path / "description.yaml");
+            description << out.c_str() << std::endl;
 
-            std::cout << std::scientific << std::setprecision(7);
-            for (const auto & result : results)
+            NumpyArrayWriter samples(path / "samples.npy", dimensions.size());
+            NumpyArrayWriter chi2(path / "chi2.npy", 1);
+
+            unsigned long points = 0;
+            GridScan grid_scan(dimensions, factory());
+            grid_scan.scan(config, [&](const std::vector<double> & p, const std::vector<double> & chi_squares)
             {
-                for (auto w = result.first.cbegin(), w_end = result.first.cend(); w != w_end; ++w)
-                {
-                    std::cout << *w << '\t';
-                }
+                samples.append(p);
+                chi2.append(chi_squares);
 
-                std::cout << result.second << std::endl;
-            }
+                points += chi_squares.size();
+                std::cerr << '[' << points << " points]" << std::endl;
+            });
+
+            std::cerr << "Minimal chi^2 = " << grid_scan.minimum() << " in " << grid_scan.size() << " points" << std::endl;
         }
 };
 
@@ -265,11 +394,13 @@ main(int argc, char * argv[])
 {
     try
     {
-        std::list<ScanData>                       scan_data;
+        std::vector<GridScan::Dimension>          dimensions;
         std::list<Input>                          input;
         std::list<std::string>                    variation_names;
         std::list<std::pair<std::string, double>> param_changes;
         double                                    theory_uncertainty = 0.0;
+        GridScan::Config                          config;
+        std::string                               output;
 
         Log::instance()->set_program_name("eos-scan");
 
@@ -282,7 +413,7 @@ main(int argc, char * argv[])
                 unsigned    points = destringify<unsigned>(*(++a));
                 double      min    = destringify<double>(*(++a));
                 double      max    = destringify<double>(*(++a));
-                scan_data.push_back(ScanData{ name, points, min, max });
+                dimensions.push_back(GridScan::Dimension{ name, min, max, points });
                 continue;
             }
 
@@ -323,10 +454,31 @@ main(int argc, char * argv[])
                 continue;
             }
 
+            if ("--level" == argument)
+            {
+                config.levels.push_back(destringify<double>(*(++a)));
+
+                continue;
+            }
+
+            if ("--refine" == argument)
+            {
+                config.refinements = destringify<unsigned>(*(++a));
+
+                continue;
+            }
+
+            if ("--output" == argument)
+            {
+                output = std::string(*(++a));
+
+                continue;
+            }
+
             throw DoUsage("Unknown command line argument: " + argument);
         }
 
-        if (scan_data.empty())
+        if (dimensions.empty())
         {
             throw DoUsage("Need at least one scan parameter");
         }
@@ -336,18 +488,33 @@ main(int argc, char * argv[])
             throw DoUsage("Need at least one input");
         }
 
-        WilsonScan scanner(scan_data, input, param_changes, variation_names, theory_uncertainty);
-        scanner.scan();
+        if ((config.refinements > 0) && config.levels.empty())
+        {
+            throw DoUsage("Need at least one delta chi^2 level to refine the scan");
+        }
+
+        WilsonScan scanner(dimensions, input, param_changes, variation_names, theory_uncertainty, config);
+        if (output.empty())
+        {
+            scanner.scan();
+        }
+        else
+        {
+            scanner.scan(output);
+        }
     }
     catch (DoUsage & e)
     {
         std::cout << e.what() << std::endl;
         std::cout << "Usage: eos-scan" << std::endl;
         std::cout << "  [--vary PARAMETER]*" << std::endl;
-        std::cout << "  [--parameter NEWVALUE]*" << std::endl;
-        std::cout << "  [--input NAME SMIN SMAX MIN CENTRAL MAX]+" << std::endl;
+        std::cout << "  [--parameter NAME NEWVALUE]*" << std::endl;
+        std::cout << "  [--input NAME Q2MIN Q2MAX MIN CENTRAL MAX]+" << std::endl;
         std::cout << "  [--scan PARAMETER POINTS MIN MAX]+" << std::endl;
         std::cout << "  [--theory-uncertainty PERCENT]" << std::endl;
+        std::cout << "  [--level DELTACHI2]*" << std::endl;
+        std::cout << "  [--refine STEPS]" << std::endl;
+        std::cout << "  [--output DIRECTORY]" << std::endl;
     }
     catch (Exception & e)
     {